@@ -40,4 +40,41 @@
  */
 -(instancetype) initWithPoints: (NSMutableArray<SFPoint *> *) points;
 
+/**
+ * Linearize the arcs with the default segments per quadrant. The
+ * linearization is cached until points are added or replaced.
+ *
+ * @return shared line string, not to be modified
+ */
+-(SFLineString *) linearize;
+
+/**
+ * Linearize the arcs within the maximum chord deviation. The linearization
+ * is cached until points are added or replaced.
+ *
+ * @param tolerance
+ *            maximum distance between an arc and its chords, greater than 0
+ *
+ * @return shared line string, not to be modified
+ */
+-(SFLineString *) linearizeWithTolerance: (double) tolerance;
+
+/**
+ * Linearize the arcs with a number of chords per quadrant of each arc. The
+ * linearization is cached until points are added or replaced.
+ *
+ * @param segments
+ *            segments per quadrant, greater than 0
+ *
+ * @return shared line string, not to be modified
+ */
+-(SFLineString *) linearizeWithSegmentsPerQuadrant: (int) segments;
+
+/**
+ * Clear the cached linearization, required after modifying existing points
+ * in place. Library transforms, filters, and minimize and normalize
+ * operations clear it.
+ */
+-(void) clearLinearization;
+
 @end
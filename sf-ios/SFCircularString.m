@@ -8,6 +8,26 @@
 
 #import "SFCircularString.h"
 #import "SFGeometryUtils.h"
+#import "SFCurveUtils.h"
+
+@interface SFCircularString()
+
+/**
+ * Cached linearization
+ */
+@property (nonatomic, strong) SFLineString *linearization;
+
+/**
+ * Tolerance of the cached linearization, 0 when by segments per quadrant
+ */
+@property (nonatomic) double linearizationTolerance;
+
+/**
+ * Segments per quadrant of the cached linearization, 0 when by tolerance
+ */
+@property (nonatomic) int linearizationSegments;
+
+@end
 
 @implementation SFCircularString
 
@@ -29,6 +49,67 @@
     return self;
 }
 
+-(void) setPoints: (NSMutableArray<SFPoint *> *) points{
+    [super setPoints:points];
+    [self clearLinearization];
+}
+
+-(void) addPoint: (SFPoint *) point{
+    [super addPoint:point];
+    [self clearLinearization];
+}
+
+-(void) addPoints: (NSArray<SFPoint *> *) points{
+    [super addPoints:points];
+    [self clearLinearization];
+}
+
+-(SFLineString *) linearize{
+    return [self linearizeWithSegmentsPerQuadrant:SF_CURVE_DEFAULT_SEGMENTS_PER_QUADRANT];
+}
+
+-(SFLineString *) linearizeWithTolerance: (double) tolerance{
+    SFLineString *linearization = nil;
+    @synchronized(self){
+        if(self.linearization != nil && self.linearizationSegments == 0 && self.linearizationTolerance == tolerance){
+            linearization = self.linearization;
+        }
+    }
+    if(linearization == nil){
+        linearization = [SFCurveUtils linearizeCircularString:self withTolerance:tolerance];
+        @synchronized(self){
+            self.linearization = linearization;
+            self.linearizationTolerance = tolerance;
+            self.linearizationSegments = 0;
+        }
+    }
+    return linearization;
+}
+
+-(SFLineString *) linearizeWithSegmentsPerQuadrant: (int) segments{
+    SFLineString *linearization = nil;
+    @synchronized(self){
+        if(self.linearization != nil && self.linearizationTolerance == 0.0 && self.linearizationSegments == segments){
+            linearization = self.linearization;
+        }
+    }
+    if(linearization == nil){
+        linearization = [SFCurveUtils linearizeCircularString:self withSegmentsPerQuadrant:segments];
+        @synchronized(self){
+            self.linearization = linearization;
+            self.linearizationTolerance = 0.0;
+            self.linearizationSegments = segments;
+        }
+    }
+    return linearization;
+}
+
+-(void) clearLinearization{
+    @synchronized(self){
+        self.linearization = nil;
+    }
+}
+
 -(id) mutableCopyWithZone: (NSZone *) zone{
     SFCircularString *circularString = [[SFCircularString alloc] initWithHasZ:self.hasZ andHasM:self.hasM];
     for(SFPoint *point in self.points){
@@ -11,6 +11,7 @@
 #import "SFGeometryEnvelope.h"
 
 @class SFPoint;
+@class SFGeometryTransform;
 
 /**
  *  The root of the geometry type hierarchy
@@ -96,6 +97,23 @@
  */
 -(BOOL) isSimple;
 
+/**
+ * Transform the Geometry coordinates in place
+ *
+ * @param transform
+ *            geometry transform
+ */
+-(void) transform: (SFGeometryTransform *) transform;
+
+/**
+ * Snap the Geometry x and y coordinates to the grid in place, removing
+ * collapsed vertices and degenerate components. See SFPointGridFilter.
+ *
+ * @param gridSize
+ *            grid cell size
+ */
+-(void) snapToGrid: (double) gridSize;
+
 /**
  * Update currently false hasZ and hasM values using the provided geometry
  *
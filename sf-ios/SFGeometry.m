@@ -9,6 +9,8 @@
 #import "SFGeometry.h"
 #import "SFGeometryEnvelopeBuilder.h"
 #import "SFGeometryUtils.h"
+#import "SFGeometryTransform.h"
+#import "SFPointGridFilter.h"
 
 @implementation SFGeometry
 
@@ -52,6 +54,14 @@
     return NO;
 }
 
+-(void) transform: (SFGeometryTransform *) transform{
+    [transform transformGeometry:self];
+}
+
+-(void) snapToGrid: (double) gridSize{
+    [[[SFPointGridFilter alloc] initWithGridSize:gridSize] snapGeometry:self];
+}
+
 -(void) updateZM: (SFGeometry *) geometry{
     if(!_hasZ){
         [self setHasZ:geometry.hasZ];
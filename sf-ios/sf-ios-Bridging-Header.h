@@ -51,5 +51,42 @@
 #import "SFGeometryFilter.h"
 #import "SFPointFiniteFilter.h"
 #import "SFTextReader.h"
+#import "SFAntimeridianSplitter.h"
+#import "SFGeometryClipper.h"
+#import "SFOverlayTypes.h"
+#import "SFMartinezRueda.h"
+#import "SFEarcut.h"
+#import "SFDelaunay.h"
+#import "SFPreparedTIN.h"
+#import "SFValidityErrorTypes.h"
+#import "SFValidityError.h"
+#import "SFGeometryValidator.h"
+#import "SFGeometryRepair.h"
+#import "SFGeometryPredicates.h"
+#import "SFCurveUtils.h"
+#import "SFGeodesicTypes.h"
+#import "SFGeodesic.h"
+#import "SFGeometryTransform.h"
+#import "SFPointGridFilter.h"
+#import "SFTileCover.h"
+#import "SFHilbertSort.h"
+#import "SFWKBGeometryReader.h"
+#import "SFWKBFileReader.h"
+#import "SFWKBGeometryBytes.h"
+#import "SFWKBLineString.h"
+#import "SFWKBPolygon.h"
+#import "SFWKBMultiLineString.h"
+#import "SFWKBMultiPolygon.h"
+#import "SFWKBGeometryCollection.h"
+#import "SFTWKBGeometryWriter.h"
+#import "SFTWKBGeometryReader.h"
+#import "SFGeoJSONReader.h"
+#import "SFGeoJSONWriter.h"
+#import "SFMVTGeometryEncoder.h"
+#import "SFMVTGeometryDecoder.h"
+#import "SFPackedGeometryWriter.h"
+#import "SFPackedGeometryReader.h"
+#import "SFEncodedPolyline.h"
+#import "SFGeohash.h"
 
 #endif /* sf_ios_Bridging_Header_h */
@@ -0,0 +1,46 @@
+//
+//  SFAntimeridianSplitter.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+
+/**
+ * Split geometries crossing the antimeridian (the -max x / max x boundary) into
+ * multiple geometries within the -max x to max x range. Consecutive points are
+ * connected using the shortest x distance, with crossing points interpolated
+ * (including z and m values) at the boundary. Unlike minimizing, the resulting
+ * envelopes stay within the world bounds.
+ *
+ * Supports points, line strings, polygons (including triangles), their multi
+ * variants, and geometry collections of supported types. Polygon rings are
+ * expected to span less than the world width, rings enclosing a pole are not
+ * supported.
+ */
+@interface SFAntimeridianSplitter : NSObject
+
+/**
+ * Split the geometry at the antimeridian. The provided geometry is not
+ * modified.
+ *
+ * Example: For WGS84 provide a max x of 180.0.
+ *
+ * Example: For web mercator provide a max x of 20037508.342789244.
+ *
+ * Line strings split into multiple parts are returned as a multi line string,
+ * polygons split into multiple parts as a multi polygon. Multi geometries and
+ * collections retain their type.
+ *
+ * @param geometry
+ *            geometry
+ * @param maxX
+ *            max positive x value in the geometry projection
+ * @return split geometry, nil if the geometry collapses entirely
+ */
++(SFGeometry *) splitGeometry: (SFGeometry *) geometry withMaxX: (double) maxX;
+
+@end
@@ -0,0 +1,502 @@
+//
+//  SFAntimeridianSplitter.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFAntimeridianSplitter.h"
+#import "SFPoint.h"
+#import "SFLineString.h"
+#import "SFPolygon.h"
+#import "SFMultiPoint.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+#import "SFGeometryCollection.h"
+#import "SFGeometryUtils.h"
+
+/**
+ * Coordinate values, missing z and m values are NaN
+ */
+typedef struct SFSplitCoordinate{
+    double x;
+    double y;
+    double z;
+    double m;
+} SFSplitCoordinate;
+
+/**
+ * Interpolate the coordinate between two coordinates at the x value
+ */
+static SFSplitCoordinate SFInterpolateAtX(SFSplitCoordinate from, SFSplitCoordinate to, double x){
+    double t = (x - from.x) / (to.x - from.x);
+    SFSplitCoordinate coordinate;
+    coordinate.x = x;
+    coordinate.y = from.y + t * (to.y - from.y);
+    coordinate.z = from.z + t * (to.z - from.z);
+    coordinate.m = from.m + t * (to.m - from.m);
+    return coordinate;
+}
+
+/**
+ * Sutherland-Hodgman clip of a ring against a vertical boundary
+ *
+ * @param input
+ *            ring coordinates, without a closing coordinate
+ * @param count
+ *            number of coordinates
+ * @param output
+ *            output coordinates with capacity of twice the count
+ * @param bound
+ *            x boundary
+ * @param side
+ *            1.0 to keep x values at or above the bound, -1.0 to keep x values at or below
+ * @return number of output coordinates
+ */
+static int SFClipRingAtX(const SFSplitCoordinate *input, int count, SFSplitCoordinate *output, double bound, double side){
+    int outputCount = 0;
+    if(count > 0){
+        SFSplitCoordinate previous = input[count - 1];
+        BOOL previousInside = side * (previous.x - bound) >= 0.0;
+        for(int i = 0; i < count; i++){
+            SFSplitCoordinate current = input[i];
+            BOOL currentInside = side * (current.x - bound) >= 0.0;
+            if(currentInside != previousInside){
+                output[outputCount++] = SFInterpolateAtX(previous, current, bound);
+            }
+            if(currentInside){
+                output[outputCount++] = current;
+            }
+            previous = current;
+            previousInside = currentInside;
+        }
+    }
+    return outputCount;
+}
+
+/**
+ * Remove consecutive repeated coordinates from the ring, including the wrap around
+ *
+ * @return updated coordinate count
+ */
+static int SFRemoveRepeatedCoordinates(SFSplitCoordinate *coordinates, int count){
+    int updated = 0;
+    for(int i = 0; i < count; i++){
+        if(updated == 0 || coordinates[i].x != coordinates[updated - 1].x || coordinates[i].y != coordinates[updated - 1].y){
+            coordinates[updated++] = coordinates[i];
+        }
+    }
+    while(updated > 1 && coordinates[0].x == coordinates[updated - 1].x && coordinates[0].y == coordinates[updated - 1].y){
+        updated--;
+    }
+    return updated;
+}
+
+/**
+ * Calculate the absolute area of the ring
+ */
+static double SFRingArea(const SFSplitCoordinate *coordinates, int count){
+    double area = 0.0;
+    for(int i = 0, j = count - 1; i < count; j = i++){
+        area += (coordinates[j].x - coordinates[i].x) * (coordinates[j].y + coordinates[i].y);
+    }
+    return fabs(area / 2.0);
+}
+
+@implementation SFAntimeridianSplitter
+
++(SFGeometry *) splitGeometry: (SFGeometry *) geometry withMaxX: (double) maxX{
+    
+    SFGeometry *split = nil;
+    
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch (geometryType) {
+        case SF_POINT:
+            split = [self splitPoint:(SFPoint *)geometry withMaxX:maxX];
+            break;
+        case SF_LINESTRING:
+            {
+                NSArray<SFLineString *> *lineStrings = [self splitLineString:(SFLineString *)geometry withMaxX:maxX];
+                if(lineStrings.count == 1){
+                    split = [lineStrings objectAtIndex:0];
+                }else if(lineStrings.count > 1){
+                    split = [[SFMultiLineString alloc] initWithLineStrings:[lineStrings mutableCopy]];
+                }
+            }
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            {
+                NSArray<SFPolygon *> *polygons = [self splitPolygon:(SFPolygon *)geometry withMaxX:maxX];
+                if(polygons.count == 1){
+                    split = [polygons objectAtIndex:0];
+                }else if(polygons.count > 1){
+                    split = [[SFMultiPolygon alloc] initWithPolygons:[polygons mutableCopy]];
+                }
+            }
+            break;
+        case SF_MULTIPOINT:
+            {
+                SFMultiPoint *multiPoint = (SFMultiPoint *)geometry;
+                SFMultiPoint *splitMultiPoint = [[SFMultiPoint alloc] initWithHasZ:multiPoint.hasZ andHasM:multiPoint.hasM];
+                for(SFPoint *point in [multiPoint points]){
+                    [splitMultiPoint addPoint:[self splitPoint:point withMaxX:maxX]];
+                }
+                split = splitMultiPoint;
+            }
+            break;
+        case SF_MULTILINESTRING:
+            {
+                SFMultiLineString *multiLineString = (SFMultiLineString *)geometry;
+                SFMultiLineString *splitMultiLineString = [[SFMultiLineString alloc] initWithHasZ:multiLineString.hasZ andHasM:multiLineString.hasM];
+                for(SFLineString *lineString in [multiLineString lineStrings]){
+                    [splitMultiLineString addLineStrings:[self splitLineString:lineString withMaxX:maxX]];
+                }
+                if(![splitMultiLineString isEmpty]){
+                    split = splitMultiLineString;
+                }
+            }
+            break;
+        case SF_MULTIPOLYGON:
+            {
+                SFMultiPolygon *multiPolygon = (SFMultiPolygon *)geometry;
+                SFMultiPolygon *splitMultiPolygon = [[SFMultiPolygon alloc] initWithHasZ:multiPolygon.hasZ andHasM:multiPolygon.hasM];
+                for(SFPolygon *polygon in [multiPolygon polygons]){
+                    [splitMultiPolygon addPolygons:[self splitPolygon:polygon withMaxX:maxX]];
+                }
+                if(![splitMultiPolygon isEmpty]){
+                    split = splitMultiPolygon;
+                }
+            }
+            break;
+        case SF_GEOMETRYCOLLECTION:
+            {
+                SFGeometryCollection *geometryCollection = (SFGeometryCollection *)geometry;
+                SFGeometryCollection *splitCollection = [[SFGeometryCollection alloc] initWithHasZ:geometryCollection.hasZ andHasM:geometryCollection.hasM];
+                for(SFGeometry *subGeometry in geometryCollection.geometries){
+                    SFGeometry *splitGeometry = [self splitGeometry:subGeometry withMaxX:maxX];
+                    if(splitGeometry != nil){
+                        [splitCollection addGeometry:splitGeometry];
+                    }
+                }
+                if(![splitCollection isEmpty]){
+                    split = splitCollection;
+                }
+            }
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for antimeridian split: %@", [SFGeometryTypes name:geometryType]];
+    }
+    
+    return split;
+}
+
+/**
+ * Split the point, normalizing the x value into range
+ *
+ * @param point
+ *            point
+ * @param maxX
+ *            max positive x value in the geometry projection
+ * @return normalized point copy
+ */
++(SFPoint *) splitPoint: (SFPoint *) point withMaxX: (double) maxX{
+    SFPoint *split = [point mutableCopy];
+    [SFGeometryUtils normalizeGeometry:split withMaxX:maxX];
+    return split;
+}
+
+/**
+ * Split the line string into line string parts within the world bounds
+ *
+ * @param lineString
+ *            line string
+ * @param maxX
+ *            max positive x value in the geometry projection
+ * @return line string parts
+ */
++(NSArray<SFLineString *> *) splitLineString: (SFLineString *) lineString withMaxX: (double) maxX{
+    
+    NSMutableArray<SFLineString *> *parts = [[NSMutableArray alloc] init];
+    
+    int count = [lineString numPoints];
+    if(count == 0){
+        return parts;
+    }
+    
+    BOOL hasZ = lineString.hasZ;
+    BOOL hasM = lineString.hasM;
+    double worldWidth = maxX * 2.0;
+    
+    SFSplitCoordinate *coordinates = [self coordinatesOfPoints:lineString.points];
+    [self unwrapCoordinates:coordinates withCount:count andMaxX:maxX];
+    
+    double center = 0.0;
+    SFLineString *part = [[SFLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+    [part addPoint:[self pointWithCoordinate:coordinates[0] andShift:-center andHasZ:hasZ andHasM:hasM]];
+    
+    for(int i = 1; i < count; i++){
+        
+        SFSplitCoordinate previous = coordinates[i - 1];
+        SFSplitCoordinate current = coordinates[i];
+        
+        double high = center + maxX;
+        double low = center - maxX;
+        
+        double bound = 0.0;
+        double direction = 0.0;
+        if(current.x > high){
+            bound = high;
+            direction = 1.0;
+        }else if(current.x < low){
+            bound = low;
+            direction = -1.0;
+        }
+        
+        if(direction != 0.0){
+            SFSplitCoordinate crossing = SFInterpolateAtX(previous, current, bound);
+            if(previous.x != bound){
+                [part addPoint:[self pointWithCoordinate:crossing andShift:-center andHasZ:hasZ andHasM:hasM]];
+            }
+            [self addLineString:part toParts:parts];
+            center += direction * worldWidth;
+            part = [[SFLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+            [part addPoint:[self pointWithCoordinate:crossing andShift:-center andHasZ:hasZ andHasM:hasM]];
+        }
+        
+        [part addPoint:[self pointWithCoordinate:current andShift:-center andHasZ:hasZ andHasM:hasM]];
+    }
+    [self addLineString:part toParts:parts];
+    
+    if(parts.count == 0){
+        // Single point or fully collapsed line string
+        SFLineString *normalized = [lineString mutableCopy];
+        [SFGeometryUtils normalizeGeometry:normalized withMaxX:maxX];
+        [parts addObject:normalized];
+    }
+    
+    free(coordinates);
+    
+    return parts;
+}
+
+/**
+ * Add the line string part when it contains at least two distinct points
+ *
+ * @param part
+ *            line string part
+ * @param parts
+ *            line string parts
+ */
++(void) addLineString: (SFLineString *) part toParts: (NSMutableArray<SFLineString *> *) parts{
+    NSArray<SFPoint *> *points = part.points;
+    if(points.count > 1){
+        SFPoint *first = [points objectAtIndex:0];
+        for(int i = 1; i < points.count; i++){
+            SFPoint *point = [points objectAtIndex:i];
+            if([point.x compare:first.x] != NSOrderedSame || [point.y compare:first.y] != NSOrderedSame){
+                [parts addObject:part];
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Split the polygon into polygons within the world bounds
+ *
+ * @param polygon
+ *            polygon
+ * @param maxX
+ *            max positive x value in the geometry projection
+ * @return polygon parts
+ */
++(NSArray<SFPolygon *> *) splitPolygon: (SFPolygon *) polygon withMaxX: (double) maxX{
+    
+    NSMutableArray<SFPolygon *> *parts = [[NSMutableArray alloc] init];
+    
+    NSArray<SFLineString *> *rings = [polygon lineStrings];
+    if(rings.count == 0 || [[rings objectAtIndex:0] numPoints] == 0){
+        return parts;
+    }
+    
+    BOOL hasZ = polygon.hasZ;
+    BOOL hasM = polygon.hasM;
+    double worldWidth = maxX * 2.0;
+    
+    int ringCount = (int)rings.count;
+    SFSplitCoordinate **ringCoordinates = malloc(sizeof(SFSplitCoordinate *) * ringCount);
+    int *ringCounts = malloc(sizeof(int) * ringCount);
+    BOOL *ringClosed = malloc(sizeof(BOOL) * ringCount);
+    int maxCount = 0;
+    
+    double minX = DBL_MAX;
+    double maxRingX = -DBL_MAX;
+    
+    for(int r = 0; r < ringCount; r++){
+        SFLineString *ring = [rings objectAtIndex:r];
+        int count = [ring numPoints];
+        SFSplitCoordinate *coordinates = [self coordinatesOfPoints:ring.points];
+        [self unwrapCoordinates:coordinates withCount:count andMaxX:maxX];
+        
+        // Remove the explicit closing point while clipping
+        BOOL closed = [SFGeometryUtils closedPolygonRing:ring];
+        if(closed && count > 1){
+            count--;
+        }
+        
+        if(r == 0){
+            for(int i = 0; i < count; i++){
+                minX = MIN(minX, coordinates[i].x);
+                maxRingX = MAX(maxRingX, coordinates[i].x);
+            }
+        }else if(count > 0){
+            // Shift the hole by world widths to fall within the exterior ring
+            double shift = round(((minX + maxRingX) / 2.0 - coordinates[0].x) / worldWidth) * worldWidth;
+            if(shift != 0.0){
+                for(int i = 0; i < count; i++){
+                    coordinates[i].x += shift;
+                }
+            }
+        }
+        
+        ringCoordinates[r] = coordinates;
+        ringCounts[r] = count;
+        ringClosed[r] = closed;
+        maxCount = MAX(maxCount, count);
+    }
+    
+    // World windows overlapped by the exterior ring, centered at (2 * window * max x)
+    int firstWindow = (int)floor((minX / maxX - 1.0) / 2.0) + 1;
+    int lastWindow = (int)ceil((maxRingX / maxX + 1.0) / 2.0) - 1;
+    
+    SFSplitCoordinate *clipBuffer = malloc(sizeof(SFSplitCoordinate) * maxCount * 2);
+    SFSplitCoordinate *clipped = malloc(sizeof(SFSplitCoordinate) * maxCount * 4);
+    
+    for(int window = firstWindow; window <= lastWindow; window++){
+        
+        double center = window * worldWidth;
+        SFPolygon *part = nil;
+        
+        for(int r = 0; r < ringCount; r++){
+            
+            int count = ringCounts[r];
+            SFSplitCoordinate *coordinates = ringCoordinates[r];
+            if(firstWindow != lastWindow){
+                count = SFClipRingAtX(ringCoordinates[r], count, clipBuffer, center - maxX, 1.0);
+                count = SFClipRingAtX(clipBuffer, count, clipped, center + maxX, -1.0);
+                count = SFRemoveRepeatedCoordinates(clipped, count);
+                coordinates = clipped;
+            }
+            
+            if(count == 0 || (firstWindow != lastWindow && (count < 3 || SFRingArea(coordinates, count) == 0.0))){
+                if(r == 0){
+                    break;
+                }
+                continue;
+            }
+            
+            SFLineString *ring = [[SFLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+            for(int i = 0; i < count; i++){
+                [ring addPoint:[self pointWithCoordinate:coordinates[i] andShift:-center andHasZ:hasZ andHasM:hasM]];
+            }
+            if(ringClosed[r]){
+                [ring addPoint:[self pointWithCoordinate:coordinates[0] andShift:-center andHasZ:hasZ andHasM:hasM]];
+            }
+            
+            if(part == nil){
+                part = [[SFPolygon alloc] initWithHasZ:hasZ andHasM:hasM];
+            }
+            [part addRing:ring];
+        }
+        
+        if(part != nil){
+            [parts addObject:part];
+        }
+    }
+    
+    free(clipBuffer);
+    free(clipped);
+    for(int r = 0; r < ringCount; r++){
+        free(ringCoordinates[r]);
+    }
+    free(ringCoordinates);
+    free(ringCounts);
+    free(ringClosed);
+    
+    return parts;
+}
+
+/**
+ * Load the coordinates of the points
+ *
+ * @param points
+ *            points
+ * @return allocated coordinates, caller is responsible for freeing
+ */
++(SFSplitCoordinate *) coordinatesOfPoints: (NSArray<SFPoint *> *) points{
+    SFSplitCoordinate *coordinates = malloc(sizeof(SFSplitCoordinate) * MAX(points.count, 1));
+    int i = 0;
+    for(SFPoint *point in points){
+        SFSplitCoordinate coordinate;
+        coordinate.x = [point.x doubleValue];
+        coordinate.y = [point.y doubleValue];
+        coordinate.z = point.z != nil ? [point.z doubleValue] : NAN;
+        coordinate.m = point.m != nil ? [point.m doubleValue] : NAN;
+        coordinates[i++] = coordinate;
+    }
+    return coordinates;
+}
+
+/**
+ * Unwrap the coordinate x values, normalizing the first value into range and
+ * connecting each following value using the shortest x distance
+ *
+ * @param coordinates
+ *            coordinates
+ * @param count
+ *            number of coordinates
+ * @param maxX
+ *            max positive x value in the geometry projection
+ */
++(void) unwrapCoordinates: (SFSplitCoordinate *) coordinates withCount: (int) count andMaxX: (double) maxX{
+    if(count > 0){
+        double worldWidth = maxX * 2.0;
+        if(coordinates[0].x < -maxX || coordinates[0].x > maxX){
+            coordinates[0].x -= ceil((coordinates[0].x - maxX) / worldWidth) * worldWidth;
+        }
+        for(int i = 1; i < count; i++){
+            double delta = coordinates[i].x - coordinates[i - 1].x;
+            if(delta > maxX || delta < -maxX){
+                coordinates[i].x -= round(delta / worldWidth) * worldWidth;
+            }
+        }
+    }
+}
+
+/**
+ * Create a point from the coordinate
+ *
+ * @param coordinate
+ *            coordinate
+ * @param shift
+ *            x shift
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ * @return point
+ */
++(SFPoint *) pointWithCoordinate: (SFSplitCoordinate) coordinate andShift: (double) shift andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    SFPoint *point = [[SFPoint alloc] initWithHasZ:hasZ andHasM:hasM andXValue:coordinate.x + shift andYValue:coordinate.y];
+    if(hasZ && !isnan(coordinate.z)){
+        [point setZValue:coordinate.z];
+    }
+    if(hasM && !isnan(coordinate.m)){
+        [point setMValue:coordinate.m];
+    }
+    return point;
+}
+
+@end
@@ -0,0 +1,204 @@
+//
+//  SFCurveUtils.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFCircularString.h"
+#import "SFCompoundCurve.h"
+#import "SFCurvePolygon.h"
+#import "SFPolygon.h"
+#import "SFGeometryEnvelope.h"
+
+/**
+ * Default linearization segments per quadrant (quarter circle) of an arc
+ */
+extern int const SF_CURVE_DEFAULT_SEGMENTS_PER_QUADRANT;
+
+/**
+ * Circular arc utilities for circular strings, compound curves, and curve
+ * polygons. Each consecutive three point arc of a circular string passes
+ * through its start, middle, and end point. Arcs with collinear points are
+ * straight segments and arcs starting and ending at the same point are full
+ * circles through the diametrically opposite middle point.
+ *
+ * Envelopes, lengths, centroids, and point on curve checks are exact for the
+ * arcs without densifying. Linearization approximates the arcs with chords,
+ * limited by either a maximum chord deviation (sagitta) or a number of
+ * segments per quadrant. Arc end points are retained exactly and z and m
+ * values are interpolated along each arc.
+ */
+@interface SFCurveUtils : NSObject
+
+/**
+ * Linearize the circular string within the maximum chord deviation. The
+ * linearization is computed on each call, see
+ * -[SFCircularString linearizeWithTolerance:] for the cached linearization.
+ *
+ * @param circularString
+ *            circular string
+ * @param tolerance
+ *            maximum distance between an arc and its chords, greater than 0
+ * @return line string
+ */
++(SFLineString *) linearizeCircularString: (SFCircularString *) circularString withTolerance: (double) tolerance;
+
+/**
+ * Linearize the circular string with a number of chords per quadrant of each
+ * arc. The linearization is computed on each call, see
+ * -[SFCircularString linearizeWithSegmentsPerQuadrant:] for the cached
+ * linearization.
+ *
+ * @param circularString
+ *            circular string
+ * @param segments
+ *            segments per quadrant, greater than 0
+ * @return line string
+ */
++(SFLineString *) linearizeCircularString: (SFCircularString *) circularString withSegmentsPerQuadrant: (int) segments;
+
+/**
+ * Linearize the compound curve within the maximum chord deviation, using the
+ * cached linearization of circular strings
+ *
+ * @param compoundCurve
+ *            compound curve
+ * @param tolerance
+ *            maximum distance between an arc and its chords, greater than 0
+ * @return line string
+ */
++(SFLineString *) linearizeCompoundCurve: (SFCompoundCurve *) compoundCurve withTolerance: (double) tolerance;
+
+/**
+ * Linearize the compound curve with a number of chords per quadrant of each
+ * arc, using the cached linearization of circular strings
+ *
+ * @param compoundCurve
+ *            compound curve
+ * @param segments
+ *            segments per quadrant, greater than 0
+ * @return line string
+ */
++(SFLineString *) linearizeCompoundCurve: (SFCompoundCurve *) compoundCurve withSegmentsPerQuadrant: (int) segments;
+
+/**
+ * Linearize the curve polygon rings within the maximum chord deviation,
+ * using the cached linearization of circular strings
+ *
+ * @param curvePolygon
+ *            curve polygon
+ * @param tolerance
+ *            maximum distance between an arc and its chords, greater than 0
+ * @return polygon
+ */
++(SFPolygon *) linearizeCurvePolygon: (SFCurvePolygon *) curvePolygon withTolerance: (double) tolerance;
+
+/**
+ * Linearize the curve polygon rings with a number of chords per quadrant of
+ * each arc, using the cached linearization of circular strings
+ *
+ * @param curvePolygon
+ *            curve polygon
+ * @param segments
+ *            segments per quadrant, greater than 0
+ * @return polygon
+ */
++(SFPolygon *) linearizeCurvePolygon: (SFCurvePolygon *) curvePolygon withSegmentsPerQuadrant: (int) segments;
+
+/**
+ * Linearize the curves of the geometry within the maximum chord deviation.
+ * Circular strings and compound curves become line strings, curve polygons
+ * become polygons, multi curves become multi line strings, multi surfaces
+ * become multi polygons, and geometry collections are linearized by member.
+ * Other geometries are returned as is.
+ *
+ * @param geometry
+ *            geometry
+ * @param tolerance
+ *            maximum distance between an arc and its chords, greater than 0
+ * @return linear geometry
+ */
++(SFGeometry *) linearizeGeometry: (SFGeometry *) geometry withTolerance: (double) tolerance;
+
+/**
+ * Linearize the curves of the geometry with a number of chords per quadrant
+ * of each arc. Circular strings and compound curves become line strings,
+ * curve polygons become polygons, multi curves become multi line strings,
+ * multi surfaces become multi polygons, and geometry collections are
+ * linearized by member. Other geometries are returned as is.
+ *
+ * @param geometry
+ *            geometry
+ * @param segments
+ *            segments per quadrant, greater than 0
+ * @return linear geometry
+ */
++(SFGeometry *) linearizeGeometry: (SFGeometry *) geometry withSegmentsPerQuadrant: (int) segments;
+
+/**
+ * Exact envelope of the circular string arcs, including the circle extremes
+ * crossed by each arc
+ *
+ * @param circularString
+ *            circular string
+ * @return envelope, nil if empty
+ */
++(SFGeometryEnvelope *) envelopeOfCircularString: (SFCircularString *) circularString;
+
+/**
+ * Expand the envelope by the circle extremes crossed by the circular string
+ * arcs. The envelope is expected to already contain the points.
+ *
+ * @param envelope
+ *            envelope
+ * @param circularString
+ *            circular string
+ */
++(void) expandEnvelope: (SFGeometryEnvelope *) envelope withCircularString: (SFCircularString *) circularString;
+
+/**
+ * Exact two dimensional length of the circular string arcs
+ *
+ * @param circularString
+ *            circular string
+ * @return length
+ */
++(double) lengthOfCircularString: (SFCircularString *) circularString;
+
+/**
+ * Exact two dimensional length of a line string, circular string, or
+ * compound curve
+ *
+ * @param curve
+ *            curve
+ * @return length
+ */
++(double) lengthOfCurve: (SFCurve *) curve;
+
+/**
+ * Exact length weighted centroid of the circular string arcs
+ *
+ * @param circularString
+ *            circular string
+ * @return centroid, nil if the circular string has no length
+ */
++(SFPoint *) centroidOfCircularString: (SFCircularString *) circularString;
+
+/**
+ * Check if the point is on the circular string arcs within the epsilon
+ * distance
+ *
+ * @param point
+ *            point
+ * @param circularString
+ *            circular string
+ * @param epsilon
+ *            epsilon distance tolerance
+ * @return true if on the circular string
+ */
++(BOOL) point: (SFPoint *) point onCircularString: (SFCircularString *) circularString withEpsilon: (double) epsilon;
+
+@end
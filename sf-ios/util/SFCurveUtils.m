@@ -0,0 +1,670 @@
+//
+//  SFCurveUtils.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFCurveUtils.h"
+#import "SFGeometryPredicates.h"
+#import "SFGeometryUtils.h"
+#import "SFGeometryEnvelopeBuilder.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+#import "SFMultiCurve.h"
+#import "SFMultiSurface.h"
+
+int const SF_CURVE_DEFAULT_SEGMENTS_PER_QUADRANT = 32;
+
+/**
+ * Maximum linearization segments of a single arc
+ */
+#define SF_CURVE_MAX_ARC_SEGMENTS 65536
+
+/**
+ * Circular arc through three points, a straight path through the points
+ * when linear
+ */
+typedef struct SFCurveArc{
+    BOOL linear;
+    double centerX;
+    double centerY;
+    double radius;
+    double start;
+    double sweep;
+    double middle;
+} SFCurveArc;
+
+/**
+ * Normalize an angle into the range [0, 2 pi)
+ */
+static double SFCurveNormalizeAngle(double angle){
+    angle = fmod(angle, 2.0 * M_PI);
+    if(angle < 0.0){
+        angle += 2.0 * M_PI;
+    }
+    return angle;
+}
+
+/**
+ * Determine the circular arc from the start point through the middle point
+ * to the end point. The sweep is positive when counter clockwise and the
+ * middle is the signed angle from the start to the middle point.
+ */
+static void SFCurveArcOf(double x0, double y0, double x1, double y1, double x2, double y2, SFCurveArc *arc){
+    
+    arc->linear = NO;
+    
+    if(x0 == x2 && y0 == y2){
+        if(x0 == x1 && y0 == y1){
+            arc->linear = YES;
+            return;
+        }
+        // Full circle through the diametrically opposite middle point
+        arc->centerX = (x0 + x1) / 2.0;
+        arc->centerY = (y0 + y1) / 2.0;
+        arc->radius = hypot(x1 - x0, y1 - y0) / 2.0;
+        arc->start = atan2(y0 - arc->centerY, x0 - arc->centerX);
+        arc->sweep = 2.0 * M_PI;
+        arc->middle = M_PI;
+        return;
+    }
+    
+    double orientation = [SFGeometryPredicates orientationWithX1:x0 andY1:y0 andX2:x1 andY2:y1 andX3:x2 andY3:y2];
+    if(orientation == 0.0){
+        arc->linear = YES;
+        return;
+    }
+    
+    // Circumcenter relative to the start point
+    double bx = x1 - x0;
+    double by = y1 - y0;
+    double cx = x2 - x0;
+    double cy = y2 - y0;
+    double b = bx * bx + by * by;
+    double c = cx * cx + cy * cy;
+    double d = 2.0 * (bx * cy - by * cx);
+    double ux = (cy * b - by * c) / d;
+    double uy = (bx * c - cx * b) / d;
+    
+    arc->centerX = x0 + ux;
+    arc->centerY = y0 + uy;
+    arc->radius = hypot(ux, uy);
+    arc->start = atan2(-uy, -ux);
+    double middle = atan2(y1 - arc->centerY, x1 - arc->centerX);
+    double end = atan2(y2 - arc->centerY, x2 - arc->centerX);
+    if(orientation > 0.0){
+        arc->sweep = SFCurveNormalizeAngle(end - arc->start);
+        arc->middle = SFCurveNormalizeAngle(middle - arc->start);
+    }else{
+        arc->sweep = -SFCurveNormalizeAngle(arc->start - end);
+        arc->middle = -SFCurveNormalizeAngle(arc->start - middle);
+    }
+    if(arc->sweep == 0.0){
+        arc->linear = YES;
+    }
+}
+
+/**
+ * Determine if the arc passes through the angle
+ */
+static BOOL SFCurveArcContainsAngle(const SFCurveArc *arc, double angle){
+    double offset = arc->sweep > 0.0 ? SFCurveNormalizeAngle(angle - arc->start) : SFCurveNormalizeAngle(arc->start - angle);
+    return offset <= fabs(arc->sweep);
+}
+
+/**
+ * Number of chord segments linearizing the arc within the tolerance, or
+ * with the segments per quadrant when the tolerance is not positive
+ */
+static int SFCurveArcSegments(const SFCurveArc *arc, double tolerance, int segments){
+    double sweep = fabs(arc->sweep);
+    double count;
+    if(tolerance > 0.0){
+        double maxAngle = M_PI_2;
+        if(tolerance < arc->radius){
+            maxAngle = fmin(maxAngle, 2.0 * acos(1.0 - tolerance / arc->radius));
+        }
+        count = maxAngle > 0.0 ? ceil(sweep / maxAngle) : SF_CURVE_MAX_ARC_SEGMENTS;
+    }else{
+        count = ceil(sweep / M_PI_2 * segments - 0.000000001);
+    }
+    return (int) fmax(1.0, fmin(count, SF_CURVE_MAX_ARC_SEGMENTS));
+}
+
+/**
+ * Interpolate a z or m value along the arc, from the start value to the
+ * middle point value to the end value
+ */
+static double SFCurveArcInterpolate(const SFCurveArc *arc, double angle, double value0, double value1, double value2){
+    double middle = fabs(arc->middle);
+    double sweep = fabs(arc->sweep);
+    angle = fabs(angle);
+    double value;
+    if(angle <= middle){
+        value = middle > 0.0 ? value0 + (value1 - value0) * angle / middle : value1;
+    }else{
+        value = sweep > middle ? value1 + (value2 - value1) * (angle - middle) / (sweep - middle) : value1;
+    }
+    return value;
+}
+
+@implementation SFCurveUtils
+
++(SFLineString *) linearizeCircularString: (SFCircularString *) circularString withTolerance: (double) tolerance{
+    if(!(tolerance > 0.0)){
+        [NSException raise:@"Invalid Tolerance" format:@"Linearization tolerance must be greater than 0: %f", tolerance];
+    }
+    return [self linearizeCircularString:circularString withTolerance:tolerance andSegmentsPerQuadrant:0];
+}
+
++(SFLineString *) linearizeCircularString: (SFCircularString *) circularString withSegmentsPerQuadrant: (int) segments{
+    if(segments < 1){
+        [NSException raise:@"Invalid Segments" format:@"Linearization segments per quadrant must be greater than 0: %d", segments];
+    }
+    return [self linearizeCircularString:circularString withTolerance:0.0 andSegmentsPerQuadrant:segments];
+}
+
+/**
+ * Linearize the circular string within the tolerance, or with the segments
+ * per quadrant when the tolerance is not positive
+ *
+ * @param circularString
+ *            circular string
+ * @param tolerance
+ *            maximum chord deviation or 0
+ * @param segments
+ *            segments per quadrant
+ * @return line string
+ */
++(SFLineString *) linearizeCircularString: (SFCircularString *) circularString withTolerance: (double) tolerance andSegmentsPerQuadrant: (int) segments{
+    
+    BOOL hasZ = circularString.hasZ;
+    BOOL hasM = circularString.hasM;
+    SFLineString *lineString = [[SFLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+    
+    NSArray<SFPoint *> *points = circularString.points;
+    int count = (int) points.count;
+    if(count == 0){
+        return lineString;
+    }
+    
+    [lineString addPoint:[[points objectAtIndex:0] mutableCopy]];
+    
+    int i = 0;
+    for(; i + 2 < count; i += 2){
+        
+        SFPoint *point0 = [points objectAtIndex:i];
+        SFPoint *point1 = [points objectAtIndex:i + 1];
+        SFPoint *point2 = [points objectAtIndex:i + 2];
+        
+        SFCurveArc arc;
+        SFCurveArcOf([point0.x doubleValue], [point0.y doubleValue],
+                     [point1.x doubleValue], [point1.y doubleValue],
+                     [point2.x doubleValue], [point2.y doubleValue], &arc);
+        
+        if(arc.linear){
+            [lineString addPoint:[point1 mutableCopy]];
+        }else{
+            
+            double z0 = 0, z1 = 0, z2 = 0, m0 = 0, m1 = 0, m2 = 0;
+            BOOL interpolateZ = hasZ && point0.z != nil && point1.z != nil && point2.z != nil;
+            if(interpolateZ){
+                z0 = [point0.z doubleValue];
+                z1 = [point1.z doubleValue];
+                z2 = [point2.z doubleValue];
+            }
+            BOOL interpolateM = hasM && point0.m != nil && point1.m != nil && point2.m != nil;
+            if(interpolateM){
+                m0 = [point0.m doubleValue];
+                m1 = [point1.m doubleValue];
+                m2 = [point2.m doubleValue];
+            }
+            
+            int arcSegments = SFCurveArcSegments(&arc, tolerance, segments);
+            for(int segment = 1; segment < arcSegments; segment++){
+                double angle = arc.sweep * segment / arcSegments;
+                double theta = arc.start + angle;
+                SFPoint *point = [[SFPoint alloc] initWithHasZ:hasZ andHasM:hasM
+                                                     andXValue:arc.centerX + arc.radius * cos(theta)
+                                                     andYValue:arc.centerY + arc.radius * sin(theta)];
+                if(interpolateZ){
+                    [point setZValue:SFCurveArcInterpolate(&arc, angle, z0, z1, z2)];
+                }
+                if(interpolateM){
+                    [point setMValue:SFCurveArcInterpolate(&arc, angle, m0, m1, m2)];
+                }
+                [lineString addPoint:point];
+            }
+        }
+        
+        [lineString addPoint:[point2 mutableCopy]];
+    }
+    
+    // Trailing points not forming an arc are connected linearly
+    for(i++; i < count; i++){
+        [lineString addPoint:[[points objectAtIndex:i] mutableCopy]];
+    }
+    
+    return lineString;
+}
+
++(SFLineString *) linearizeCompoundCurve: (SFCompoundCurve *) compoundCurve withTolerance: (double) tolerance{
+    return [self linearizeCompoundCurve:compoundCurve withTolerance:tolerance andSegmentsPerQuadrant:0];
+}
+
++(SFLineString *) linearizeCompoundCurve: (SFCompoundCurve *) compoundCurve withSegmentsPerQuadrant: (int) segments{
+    return [self linearizeCompoundCurve:compoundCurve withTolerance:0.0 andSegmentsPerQuadrant:segments];
+}
+
+/**
+ * Linearize the compound curve within the tolerance, or with the segments
+ * per quadrant when the tolerance is not positive
+ *
+ * @param compoundCurve
+ *            compound curve
+ * @param tolerance
+ *            maximum chord deviation or 0
+ * @param segments
+ *            segments per quadrant
+ * @return line string
+ */
++(SFLineString *) linearizeCompoundCurve: (SFCompoundCurve *) compoundCurve withTolerance: (double) tolerance andSegmentsPerQuadrant: (int) segments{
+    
+    SFLineString *lineString = [[SFLineString alloc] initWithHasZ:compoundCurve.hasZ andHasM:compoundCurve.hasM];
+    
+    for(SFLineString *curve in compoundCurve.lineStrings){
+        SFLineString *linear = [self linearizeLineString:curve withTolerance:tolerance andSegmentsPerQuadrant:segments];
+        NSArray<SFPoint *> *points = linear.points;
+        int start = 0;
+        if(points.count > 0 && ![lineString isEmpty]){
+            SFPoint *last = [lineString endPoint];
+            SFPoint *first = [points objectAtIndex:0];
+            if([last.x compare:first.x] == NSOrderedSame && [last.y compare:first.y] == NSOrderedSame){
+                start = 1;
+            }
+        }
+        for(int i = start; i < points.count; i++){
+            [lineString addPoint:[[points objectAtIndex:i] mutableCopy]];
+        }
+    }
+    
+    return lineString;
+}
+
+/**
+ * Linearize a line string, circular string, or compound curve into a new
+ * line string
+ *
+ * @param curve
+ *            curve
+ * @param tolerance
+ *            maximum chord deviation or 0
+ * @param segments
+ *            segments per quadrant
+ * @return line string
+ */
++(SFLineString *) linearizeCurve: (SFCurve *) curve withTolerance: (double) tolerance andSegmentsPerQuadrant: (int) segments{
+    SFLineString *lineString = nil;
+    enum SFGeometryType geometryType = curve.geometryType;
+    switch(geometryType){
+        case SF_COMPOUNDCURVE:
+            lineString = [self linearizeCompoundCurve:(SFCompoundCurve *)curve withTolerance:tolerance andSegmentsPerQuadrant:segments];
+            break;
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+            lineString = [[self linearizeLineString:(SFLineString *)curve withTolerance:tolerance andSegmentsPerQuadrant:segments] mutableCopy];
+            break;
+        default:
+            [NSException raise:@"Curve Type" format:@"Unexpected Curve Type: %@", [SFGeometryTypes name:geometryType]];
+    }
+    return lineString;
+}
+
+/**
+ * Get a line string as is or the cached linearization of a circular string
+ *
+ * @param lineString
+ *            line string or circular string
+ * @param tolerance
+ *            maximum chord deviation or 0
+ * @param segments
+ *            segments per quadrant
+ * @return line string
+ */
++(SFLineString *) linearizeLineString: (SFLineString *) lineString withTolerance: (double) tolerance andSegmentsPerQuadrant: (int) segments{
+    SFLineString *linear = lineString;
+    if(lineString.geometryType == SF_CIRCULARSTRING){
+        SFCircularString *circularString = (SFCircularString *) lineString;
+        if(tolerance > 0.0){
+            linear = [circularString linearizeWithTolerance:tolerance];
+        }else{
+            linear = [circularString linearizeWithSegmentsPerQuadrant:segments];
+        }
+    }
+    return linear;
+}
+
++(SFPolygon *) linearizeCurvePolygon: (SFCurvePolygon *) curvePolygon withTolerance: (double) tolerance{
+    return [self linearizeCurvePolygon:curvePolygon withTolerance:tolerance andSegmentsPerQuadrant:0];
+}
+
++(SFPolygon *) linearizeCurvePolygon: (SFCurvePolygon *) curvePolygon withSegmentsPerQuadrant: (int) segments{
+    return [self linearizeCurvePolygon:curvePolygon withTolerance:0.0 andSegmentsPerQuadrant:segments];
+}
+
+/**
+ * Linearize the curve polygon within the tolerance, or with the segments
+ * per quadrant when the tolerance is not positive
+ *
+ * @param curvePolygon
+ *            curve polygon
+ * @param tolerance
+ *            maximum chord deviation or 0
+ * @param segments
+ *            segments per quadrant
+ * @return polygon
+ */
++(SFPolygon *) linearizeCurvePolygon: (SFCurvePolygon *) curvePolygon withTolerance: (double) tolerance andSegmentsPerQuadrant: (int) segments{
+    SFPolygon *polygon = [[SFPolygon alloc] initWithHasZ:curvePolygon.hasZ andHasM:curvePolygon.hasM];
+    for(SFCurve *ring in curvePolygon.rings){
+        [polygon addRing:[self linearizeCurve:ring withTolerance:tolerance andSegmentsPerQuadrant:segments]];
+    }
+    return polygon;
+}
+
++(SFGeometry *) linearizeGeometry: (SFGeometry *) geometry withTolerance: (double) tolerance{
+    if(!(tolerance > 0.0)){
+        [NSException raise:@"Invalid Tolerance" format:@"Linearization tolerance must be greater than 0: %f", tolerance];
+    }
+    return [self linearizeGeometry:geometry withTolerance:tolerance andSegmentsPerQuadrant:0];
+}
+
++(SFGeometry *) linearizeGeometry: (SFGeometry *) geometry withSegmentsPerQuadrant: (int) segments{
+    if(segments < 1){
+        [NSException raise:@"Invalid Segments" format:@"Linearization segments per quadrant must be greater than 0: %d", segments];
+    }
+    return [self linearizeGeometry:geometry withTolerance:0.0 andSegmentsPerQuadrant:segments];
+}
+
+/**
+ * Linearize the geometry within the tolerance, or with the segments per
+ * quadrant when the tolerance is not positive
+ *
+ * @param geometry
+ *            geometry
+ * @param tolerance
+ *            maximum chord deviation or 0
+ * @param segments
+ *            segments per quadrant
+ * @return linear geometry
+ */
++(SFGeometry *) linearizeGeometry: (SFGeometry *) geometry withTolerance: (double) tolerance andSegmentsPerQuadrant: (int) segments{
+    
+    SFGeometry *linear = geometry;
+    
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch(geometryType){
+        case SF_CIRCULARSTRING:
+            linear = [self linearizeCircularString:(SFCircularString *)geometry withTolerance:tolerance andSegmentsPerQuadrant:segments];
+            break;
+        case SF_COMPOUNDCURVE:
+            linear = [self linearizeCompoundCurve:(SFCompoundCurve *)geometry withTolerance:tolerance andSegmentsPerQuadrant:segments];
+            break;
+        case SF_CURVEPOLYGON:
+            linear = [self linearizeCurvePolygon:(SFCurvePolygon *)geometry withTolerance:tolerance andSegmentsPerQuadrant:segments];
+            break;
+        case SF_MULTICURVE:
+            {
+                SFMultiLineString *multiLineString = [[SFMultiLineString alloc] initWithHasZ:geometry.hasZ andHasM:geometry.hasM];
+                for(SFCurve *curve in ((SFMultiCurve *) geometry).curves){
+                    [multiLineString addLineString:[self linearizeCurve:curve withTolerance:tolerance andSegmentsPerQuadrant:segments]];
+                }
+                linear = multiLineString;
+            }
+            break;
+        case SF_MULTISURFACE:
+            {
+                SFMultiPolygon *multiPolygon = [[SFMultiPolygon alloc] initWithHasZ:geometry.hasZ andHasM:geometry.hasM];
+                for(SFGeometry *surface in ((SFMultiSurface *) geometry).surfaces){
+                    SFGeometry *polygon = [self linearizeGeometry:surface withTolerance:tolerance andSegmentsPerQuadrant:segments];
+                    if(polygon.geometryType != SF_POLYGON){
+                        [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for linearization: %@", [SFGeometryTypes name:surface.geometryType]];
+                    }
+                    [multiPolygon addPolygon:(SFPolygon *)polygon];
+                }
+                linear = multiPolygon;
+            }
+            break;
+        case SF_GEOMETRYCOLLECTION:
+            {
+                SFGeometryCollection *collection = [[SFGeometryCollection alloc] initWithHasZ:geometry.hasZ andHasM:geometry.hasM];
+                for(SFGeometry *subGeometry in ((SFGeometryCollection *) geometry).geometries){
+                    [collection addGeometry:[self linearizeGeometry:subGeometry withTolerance:tolerance andSegmentsPerQuadrant:segments]];
+                }
+                linear = collection;
+            }
+            break;
+        default:
+            break;
+    }
+    
+    return linear;
+}
+
++(SFGeometryEnvelope *) envelopeOfCircularString: (SFCircularString *) circularString{
+    SFGeometryEnvelope *envelope = [SFGeometryEnvelopeBuilder buildEnvelopeWithGeometry:circularString];
+    return envelope;
+}
+
++(void) expandEnvelope: (SFGeometryEnvelope *) envelope withCircularString: (SFCircularString *) circularString{
+    
+    NSArray<SFPoint *> *points = circularString.points;
+    int count = (int) points.count;
+    
+    double minX = [envelope.minX doubleValue];
+    double minY = [envelope.minY doubleValue];
+    double maxX = [envelope.maxX doubleValue];
+    double maxY = [envelope.maxY doubleValue];
+    
+    for(int i = 0; i + 2 < count; i += 2){
+        
+        SFPoint *point0 = [points objectAtIndex:i];
+        SFPoint *point1 = [points objectAtIndex:i + 1];
+        SFPoint *point2 = [points objectAtIndex:i + 2];
+        
+        SFCurveArc arc;
+        SFCurveArcOf([point0.x doubleValue], [point0.y doubleValue],
+                     [point1.x doubleValue], [point1.y doubleValue],
+                     [point2.x doubleValue], [point2.y doubleValue], &arc);
+        if(arc.linear){
+            continue;
+        }
+        
+        if(SFCurveArcContainsAngle(&arc, 0.0) && arc.centerX + arc.radius > maxX){
+            maxX = arc.centerX + arc.radius;
+            [envelope setMaxX:[[NSDecimalNumber alloc] initWithDouble:maxX]];
+        }
+        if(SFCurveArcContainsAngle(&arc, M_PI_2) && arc.centerY + arc.radius > maxY){
+            maxY = arc.centerY + arc.radius;
+            [envelope setMaxY:[[NSDecimalNumber alloc] initWithDouble:maxY]];
+        }
+        if(SFCurveArcContainsAngle(&arc, M_PI) && arc.centerX - arc.radius < minX){
+            minX = arc.centerX - arc.radius;
+            [envelope setMinX:[[NSDecimalNumber alloc] initWithDouble:minX]];
+        }
+        if(SFCurveArcContainsAngle(&arc, 3.0 * M_PI_2) && arc.centerY - arc.radius < minY){
+            minY = arc.centerY - arc.radius;
+            [envelope setMinY:[[NSDecimalNumber alloc] initWithDouble:minY]];
+        }
+    }
+}
+
++(double) lengthOfCircularString: (SFCircularString *) circularString{
+    
+    double length = 0.0;
+    
+    NSArray<SFPoint *> *points = circularString.points;
+    int count = (int) points.count;
+    int i = 0;
+    for(; i + 2 < count; i += 2){
+        
+        SFPoint *point0 = [points objectAtIndex:i];
+        SFPoint *point1 = [points objectAtIndex:i + 1];
+        SFPoint *point2 = [points objectAtIndex:i + 2];
+        
+        SFCurveArc arc;
+        SFCurveArcOf([point0.x doubleValue], [point0.y doubleValue],
+                     [point1.x doubleValue], [point1.y doubleValue],
+                     [point2.x doubleValue], [point2.y doubleValue], &arc);
+        if(arc.linear){
+            length += [SFGeometryUtils distanceBetweenPoint1:point0 andPoint2:point1]
+                + [SFGeometryUtils distanceBetweenPoint1:point1 andPoint2:point2];
+        }else{
+            length += arc.radius * fabs(arc.sweep);
+        }
+    }
+    for(; i + 1 < count; i++){
+        length += [SFGeometryUtils distanceBetweenPoint1:[points objectAtIndex:i] andPoint2:[points objectAtIndex:i + 1]];
+    }
+    
+    return length;
+}
+
++(double) lengthOfCurve: (SFCurve *) curve{
+    
+    double length = 0.0;
+    
+    enum SFGeometryType geometryType = curve.geometryType;
+    switch(geometryType){
+        case SF_LINESTRING:
+            {
+                NSArray<SFPoint *> *points = ((SFLineString *) curve).points;
+                for(int i = 0; i + 1 < points.count; i++){
+                    length += [SFGeometryUtils distanceBetweenPoint1:[points objectAtIndex:i] andPoint2:[points objectAtIndex:i + 1]];
+                }
+            }
+            break;
+        case SF_CIRCULARSTRING:
+            length = [self lengthOfCircularString:(SFCircularString *)curve];
+            break;
+        case SF_COMPOUNDCURVE:
+            for(SFLineString *lineString in ((SFCompoundCurve *) curve).lineStrings){
+                length += [self lengthOfCurve:lineString];
+            }
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for length: %@", [SFGeometryTypes name:geometryType]];
+    }
+    
+    return length;
+}
+
++(SFPoint *) centroidOfCircularString: (SFCircularString *) circularString{
+    
+    double length = 0.0;
+    double sumX = 0.0;
+    double sumY = 0.0;
+    
+    NSArray<SFPoint *> *points = circularString.points;
+    int count = (int) points.count;
+    int i = 0;
+    for(; i + 2 < count; i += 2){
+        
+        SFPoint *point0 = [points objectAtIndex:i];
+        SFPoint *point1 = [points objectAtIndex:i + 1];
+        SFPoint *point2 = [points objectAtIndex:i + 2];
+        double x0 = [point0.x doubleValue];
+        double y0 = [point0.y doubleValue];
+        double x1 = [point1.x doubleValue];
+        double y1 = [point1.y doubleValue];
+        double x2 = [point2.x doubleValue];
+        double y2 = [point2.y doubleValue];
+        
+        SFCurveArc arc;
+        SFCurveArcOf(x0, y0, x1, y1, x2, y2, &arc);
+        if(arc.linear){
+            double length01 = hypot(x1 - x0, y1 - y0);
+            double length12 = hypot(x2 - x1, y2 - y1);
+            length += length01 + length12;
+            sumX += length01 * (x0 + x1) / 2.0 + length12 * (x1 + x2) / 2.0;
+            sumY += length01 * (y0 + y1) / 2.0 + length12 * (y1 + y2) / 2.0;
+        }else{
+            // Arc centroid lies on the bisector at r sin(a) / a from the center
+            double halfSweep = fabs(arc.sweep) / 2.0;
+            double arcLength = arc.radius * fabs(arc.sweep);
+            double distance = arc.radius * sin(halfSweep) / halfSweep;
+            double bisector = arc.start + arc.sweep / 2.0;
+            length += arcLength;
+            sumX += arcLength * (arc.centerX + distance * cos(bisector));
+            sumY += arcLength * (arc.centerY + distance * sin(bisector));
+        }
+    }
+    for(; i + 1 < count; i++){
+        SFPoint *point0 = [points objectAtIndex:i];
+        SFPoint *point1 = [points objectAtIndex:i + 1];
+        double x0 = [point0.x doubleValue];
+        double y0 = [point0.y doubleValue];
+        double x1 = [point1.x doubleValue];
+        double y1 = [point1.y doubleValue];
+        double segmentLength = hypot(x1 - x0, y1 - y0);
+        length += segmentLength;
+        sumX += segmentLength * (x0 + x1) / 2.0;
+        sumY += segmentLength * (y0 + y1) / 2.0;
+    }
+    
+    SFPoint *centroid = nil;
+    if(length > 0.0){
+        centroid = [[SFPoint alloc] initWithXValue:sumX / length andYValue:sumY / length];
+    }
+    return centroid;
+}
+
++(BOOL) point: (SFPoint *) point onCircularString: (SFCircularString *) circularString withEpsilon: (double) epsilon{
+    
+    BOOL onCurve = NO;
+    
+    double px = [point.x doubleValue];
+    double py = [point.y doubleValue];
+    
+    NSArray<SFPoint *> *points = circularString.points;
+    int count = (int) points.count;
+    if(count == 1){
+        SFPoint *only = [points objectAtIndex:0];
+        onCurve = hypot(px - [only.x doubleValue], py - [only.y doubleValue]) <= epsilon;
+    }
+    
+    int i = 0;
+    for(; !onCurve && i + 2 < count; i += 2){
+        
+        SFPoint *point0 = [points objectAtIndex:i];
+        SFPoint *point1 = [points objectAtIndex:i + 1];
+        SFPoint *point2 = [points objectAtIndex:i + 2];
+        double x0 = [point0.x doubleValue];
+        double y0 = [point0.y doubleValue];
+        double x2 = [point2.x doubleValue];
+        double y2 = [point2.y doubleValue];
+        
+        SFCurveArc arc;
+        SFCurveArcOf(x0, y0, [point1.x doubleValue], [point1.y doubleValue], x2, y2, &arc);
+        if(arc.linear){
+            onCurve = [SFGeometryUtils point:point onPathPoint1:point0 andPoint2:point1 withDistance:epsilon]
+                || [SFGeometryUtils point:point onPathPoint1:point1 andPoint2:point2 withDistance:epsilon];
+        }else{
+            double distance = hypot(px - arc.centerX, py - arc.centerY);
+            if(fabs(distance - arc.radius) <= epsilon){
+                onCurve = SFCurveArcContainsAngle(&arc, atan2(py - arc.centerY, px - arc.centerX))
+                    || hypot(px - x0, py - y0) <= epsilon
+                    || hypot(px - x2, py - y2) <= epsilon;
+            }
+        }
+    }
+    for(; !onCurve && i + 1 < count; i++){
+        onCurve = [SFGeometryUtils point:point onPathPoint1:[points objectAtIndex:i] andPoint2:[points objectAtIndex:i + 1] withDistance:epsilon];
+    }
+    
+    return onCurve;
+}
+
+@end
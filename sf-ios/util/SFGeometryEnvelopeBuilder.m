@@ -21,6 +21,7 @@
 #import "SFPolyhedralSurface.h"
 #import "SFTIN.h"
 #import "SFTriangle.h"
+#import "SFCurveUtils.h"
 
 @implementation SFGeometryEnvelopeBuilder
 
@@ -61,7 +62,7 @@
             [self addMultiPolygon:(SFMultiPolygon *)geometry andEnvelope:envelope];
             break;
         case SF_CIRCULARSTRING:
-            [self addLineString:(SFCircularString *)geometry andEnvelope:envelope];
+            [self addCircularString:(SFCircularString *)geometry andEnvelope:envelope];
             break;
         case SF_COMPOUNDCURVE:
             [self addCompoundCurve:(SFCompoundCurve *)geometry andEnvelope:envelope];
@@ -167,6 +168,13 @@
     }
 }
 
++(void) addCircularString: (SFCircularString *) circularString andEnvelope: (SFGeometryEnvelope *) envelope{
+    
+    [self addLineString:circularString andEnvelope:envelope];
+    
+    [SFCurveUtils expandEnvelope:envelope withCircularString:circularString];
+}
+
 +(void) addMultiLineString: (SFMultiLineString *) multiLineString andEnvelope: (SFGeometryEnvelope *) envelope{
     
     [self updateHasZandMWithEnvelope:envelope andGeometry:multiLineString];
@@ -201,7 +209,7 @@
     [self updateHasZandMWithEnvelope:envelope andGeometry:compoundCurve];
     
     for(SFLineString * lineString in compoundCurve.lineStrings){
-        [self addLineString:lineString andEnvelope:envelope];
+        [self buildEnvelope:envelope andGeometry:lineString];
     }
 }
 
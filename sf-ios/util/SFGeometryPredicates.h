@@ -0,0 +1,99 @@
+//
+//  SFGeometryPredicates.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFPoint.h"
+
+/**
+ * Robust geometric predicates with adaptive precision floating point
+ * arithmetic. A fast floating point evaluation is used when its error bound
+ * guarantees the sign, with progressively more exact evaluations only for
+ * nearly degenerate input. The sign of each result is always exact, the
+ * magnitude is an approximation of the determinant.
+ *
+ * Based upon the adaptive precision predicates of Jonathan Richard Shewchuk,
+ * "Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric
+ * Predicates", Discrete and Computational Geometry 18:305-363, 1997.
+ */
+@interface SFGeometryPredicates : NSObject
+
+/**
+ * Orientation of point 3 relative to the line from point 1 to point 2
+ *
+ * @param x1
+ *            point 1 x
+ * @param y1
+ *            point 1 y
+ * @param x2
+ *            point 2 x
+ * @param y2
+ *            point 2 y
+ * @param x3
+ *            point 3 x
+ * @param y3
+ *            point 3 y
+ * @return > 0 if counter clockwise (left), 0 if collinear, < 0 if clockwise
+ *         (right)
+ */
++(double) orientationWithX1: (double) x1 andY1: (double) y1 andX2: (double) x2 andY2: (double) y2 andX3: (double) x3 andY3: (double) y3;
+
+/**
+ * Orientation of point 3 relative to the line from point 1 to point 2
+ *
+ * @param point1
+ *            point 1
+ * @param point2
+ *            point 2
+ * @param point3
+ *            point 3
+ * @return > 0 if counter clockwise (left), 0 if collinear, < 0 if clockwise
+ *         (right)
+ */
++(double) orientationWithPoint1: (SFPoint *) point1 andPoint2: (SFPoint *) point2 andPoint3: (SFPoint *) point3;
+
+/**
+ * In circle test of point 4 against the circle through points 1, 2, and 3,
+ * which must be in counter clockwise order for a positive inside result
+ *
+ * @param x1
+ *            point 1 x
+ * @param y1
+ *            point 1 y
+ * @param x2
+ *            point 2 x
+ * @param y2
+ *            point 2 y
+ * @param x3
+ *            point 3 x
+ * @param y3
+ *            point 3 y
+ * @param x4
+ *            point 4 x
+ * @param y4
+ *            point 4 y
+ * @return > 0 if inside, 0 if cocircular, < 0 if outside
+ */
++(double) inCircleWithX1: (double) x1 andY1: (double) y1 andX2: (double) x2 andY2: (double) y2 andX3: (double) x3 andY3: (double) y3 andX4: (double) x4 andY4: (double) y4;
+
+/**
+ * In circle test of point 4 against the circle through points 1, 2, and 3,
+ * which must be in counter clockwise order for a positive inside result
+ *
+ * @param point1
+ *            point 1
+ * @param point2
+ *            point 2
+ * @param point3
+ *            point 3
+ * @param point4
+ *            point 4
+ * @return > 0 if inside, 0 if cocircular, < 0 if outside
+ */
++(double) inCircleWithPoint1: (SFPoint *) point1 andPoint2: (SFPoint *) point2 andPoint3: (SFPoint *) point3 andPoint4: (SFPoint *) point4;
+
+@end
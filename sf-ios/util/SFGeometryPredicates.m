@@ -0,0 +1,376 @@
+//
+//  SFGeometryPredicates.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFGeometryPredicates.h"
+
+/**
+ * Half of machine epsilon, the largest relative rounding error
+ */
+#define SF_PREDICATES_EPSILON 1.1102230246251565e-16
+
+/**
+ * Splitter for splitting doubles into two half precision values, 2^27 + 1
+ */
+#define SF_PREDICATES_SPLITTER 134217729.0
+
+/**
+ * Relative error bound of rounding an approximate result
+ */
+#define SF_PREDICATES_RESULT_ERROR ((3.0 + 8.0 * SF_PREDICATES_EPSILON) * SF_PREDICATES_EPSILON)
+
+/**
+ * Orientation error bound of the floating point filter
+ */
+#define SF_PREDICATES_ORIENT_ERROR_A ((3.0 + 16.0 * SF_PREDICATES_EPSILON) * SF_PREDICATES_EPSILON)
+
+/**
+ * Orientation error bound of the exact products of the rounded differences
+ */
+#define SF_PREDICATES_ORIENT_ERROR_B ((2.0 + 12.0 * SF_PREDICATES_EPSILON) * SF_PREDICATES_EPSILON)
+
+/**
+ * Orientation error bound of the first order difference tail correction
+ */
+#define SF_PREDICATES_ORIENT_ERROR_C ((9.0 + 64.0 * SF_PREDICATES_EPSILON) * SF_PREDICATES_EPSILON * SF_PREDICATES_EPSILON)
+
+/**
+ * In circle error bound of the floating point filter
+ */
+#define SF_PREDICATES_IN_CIRCLE_ERROR_A ((10.0 + 96.0 * SF_PREDICATES_EPSILON) * SF_PREDICATES_EPSILON)
+
+static inline void SFGeometryPredicatesTwoSum(double a, double b, double *x, double *y){
+    *x = a + b;
+    double bVirtual = *x - a;
+    double aVirtual = *x - bVirtual;
+    *y = (a - aVirtual) + (b - bVirtual);
+}
+
+/**
+ * Rounding error of the already computed difference x = a - b
+ */
+static inline double SFGeometryPredicatesTwoDiffTail(double a, double b, double x){
+    double bVirtual = a - x;
+    double aVirtual = x + bVirtual;
+    return (a - aVirtual) + (bVirtual - b);
+}
+
+static inline void SFGeometryPredicatesSplit(double a, double *high, double *low){
+    double c = SF_PREDICATES_SPLITTER * a;
+    double aBig = c - a;
+    *high = c - aBig;
+    *low = a - *high;
+}
+
+static inline void SFGeometryPredicatesTwoProduct(double a, double b, double *x, double *y){
+    *x = a * b;
+    double aHigh, aLow, bHigh, bLow;
+    SFGeometryPredicatesSplit(a, &aHigh, &aLow);
+    SFGeometryPredicatesSplit(b, &bHigh, &bLow);
+    double error1 = *x - (aHigh * bHigh);
+    double error2 = error1 - (aLow * bHigh);
+    double error3 = error2 - (aHigh * bLow);
+    *y = (aLow * bLow) - error3;
+}
+
+/**
+ * Exact difference of two products as a four component expansion
+ */
+static void SFGeometryPredicatesTwoProductDiff(double a, double b, double c, double d, double *expansion){
+    double ab1, ab0, cd1, cd0;
+    SFGeometryPredicatesTwoProduct(a, b, &ab1, &ab0);
+    SFGeometryPredicatesTwoProduct(-c, d, &cd1, &cd0);
+    double i, j, k, l;
+    SFGeometryPredicatesTwoSum(ab0, cd0, &i, &expansion[0]);
+    SFGeometryPredicatesTwoSum(ab1, i, &j, &k);
+    SFGeometryPredicatesTwoSum(k, cd1, &l, &expansion[1]);
+    SFGeometryPredicatesTwoSum(j, l, &expansion[3], &expansion[2]);
+}
+
+/**
+ * Sum two nonoverlapping expansions, eliminating zero components
+ *
+ * @return length of the sum expansion
+ */
+static int SFGeometryPredicatesExpansionSum(int elen, const double *e, int flen, const double *f, double *h){
+    double q, qNew, hh;
+    int eindex = 0;
+    int findex = 0;
+    int hindex = 0;
+    double enow = e[0];
+    double fnow = f[0];
+    if((fnow > enow) == (fnow > -enow)){
+        q = enow;
+        enow = ++eindex < elen ? e[eindex] : 0.0;
+    }else{
+        q = fnow;
+        fnow = ++findex < flen ? f[findex] : 0.0;
+    }
+    while(eindex < elen && findex < flen){
+        if((fnow > enow) == (fnow > -enow)){
+            SFGeometryPredicatesTwoSum(q, enow, &qNew, &hh);
+            enow = ++eindex < elen ? e[eindex] : 0.0;
+        }else{
+            SFGeometryPredicatesTwoSum(q, fnow, &qNew, &hh);
+            fnow = ++findex < flen ? f[findex] : 0.0;
+        }
+        q = qNew;
+        if(hh != 0.0){
+            h[hindex++] = hh;
+        }
+    }
+    while(eindex < elen){
+        SFGeometryPredicatesTwoSum(q, enow, &qNew, &hh);
+        enow = ++eindex < elen ? e[eindex] : 0.0;
+        q = qNew;
+        if(hh != 0.0){
+            h[hindex++] = hh;
+        }
+    }
+    while(findex < flen){
+        SFGeometryPredicatesTwoSum(q, fnow, &qNew, &hh);
+        fnow = ++findex < flen ? f[findex] : 0.0;
+        q = qNew;
+        if(hh != 0.0){
+            h[hindex++] = hh;
+        }
+    }
+    if(q != 0.0 || hindex == 0){
+        h[hindex++] = q;
+    }
+    return hindex;
+}
+
+/**
+ * Scale the expansion by the value, eliminating zero components
+ *
+ * @return length of the scaled expansion
+ */
+static int SFGeometryPredicatesExpansionScale(int elen, const double *e, double b, double *h){
+    double q, sum, hh, product1, product0;
+    int hindex = 0;
+    SFGeometryPredicatesTwoProduct(e[0], b, &q, &hh);
+    if(hh != 0.0){
+        h[hindex++] = hh;
+    }
+    for(int eindex = 1; eindex < elen; eindex++){
+        SFGeometryPredicatesTwoProduct(e[eindex], b, &product1, &product0);
+        SFGeometryPredicatesTwoSum(q, product0, &sum, &hh);
+        if(hh != 0.0){
+            h[hindex++] = hh;
+        }
+        SFGeometryPredicatesTwoSum(product1, sum, &q, &hh);
+        if(hh != 0.0){
+            h[hindex++] = hh;
+        }
+    }
+    if(q != 0.0 || hindex == 0){
+        h[hindex++] = q;
+    }
+    return hindex;
+}
+
+/**
+ * Approximate value of the expansion
+ */
+static double SFGeometryPredicatesEstimate(int elen, const double *e){
+    double q = e[0];
+    for(int i = 1; i < elen; i++){
+        q += e[i];
+    }
+    return q;
+}
+
+/**
+ * Adaptive orientation stages run when the floating point filter cannot
+ * determine the sign. The exact product of the rounded coordinate
+ * differences is tried first, then a first order correction of the
+ * difference rounding errors, and finally the fully exact determinant.
+ */
+static double SFGeometryPredicatesOrientAdapt(double ax, double ay, double bx, double by, double cx, double cy, double detSum){
+    
+    double acx = ax - cx;
+    double bcx = bx - cx;
+    double acy = ay - cy;
+    double bcy = by - cy;
+    
+    double b[4];
+    SFGeometryPredicatesTwoProductDiff(acx, bcy, acy, bcx, b);
+    
+    double det = SFGeometryPredicatesEstimate(4, b);
+    double errorBound = SF_PREDICATES_ORIENT_ERROR_B * detSum;
+    if(det >= errorBound || -det >= errorBound){
+        return det;
+    }
+    
+    double acxTail = SFGeometryPredicatesTwoDiffTail(ax, cx, acx);
+    double bcxTail = SFGeometryPredicatesTwoDiffTail(bx, cx, bcx);
+    double acyTail = SFGeometryPredicatesTwoDiffTail(ay, cy, acy);
+    double bcyTail = SFGeometryPredicatesTwoDiffTail(by, cy, bcy);
+    if(acxTail == 0.0 && acyTail == 0.0 && bcxTail == 0.0 && bcyTail == 0.0){
+        return det;
+    }
+    
+    errorBound = SF_PREDICATES_ORIENT_ERROR_C * detSum + SF_PREDICATES_RESULT_ERROR * fabs(det);
+    det += (acx * bcyTail + bcy * acxTail) - (acy * bcxTail + bcx * acyTail);
+    if(det >= errorBound || -det >= errorBound){
+        return det;
+    }
+    
+    double u[4], c1[8], c2[12], d[16];
+    SFGeometryPredicatesTwoProductDiff(acxTail, bcy, acyTail, bcx, u);
+    int c1Length = SFGeometryPredicatesExpansionSum(4, b, 4, u, c1);
+    SFGeometryPredicatesTwoProductDiff(acx, bcyTail, acy, bcxTail, u);
+    int c2Length = SFGeometryPredicatesExpansionSum(c1Length, c1, 4, u, c2);
+    SFGeometryPredicatesTwoProductDiff(acxTail, bcyTail, acyTail, bcxTail, u);
+    int dLength = SFGeometryPredicatesExpansionSum(c2Length, c2, 4, u, d);
+    
+    return d[dLength - 1];
+}
+
+/**
+ * Orientation of the points, positive when counter clockwise, negative
+ * when clockwise, and zero when collinear
+ */
+static double SFGeometryPredicatesOrient(double ax, double ay, double bx, double by, double cx, double cy){
+    double detLeft = (ax - cx) * (by - cy);
+    double detRight = (ay - cy) * (bx - cx);
+    double det = detLeft - detRight;
+    
+    double detSum;
+    if(detLeft > 0.0){
+        if(detRight <= 0.0){
+            return det;
+        }
+        detSum = detLeft + detRight;
+    }else if(detLeft < 0.0){
+        if(detRight >= 0.0){
+            return det;
+        }
+        detSum = -detLeft - detRight;
+    }else{
+        return det;
+    }
+    
+    double errorBound = SF_PREDICATES_ORIENT_ERROR_A * detSum;
+    if(det >= errorBound || -det >= errorBound){
+        return det;
+    }
+    
+    return SFGeometryPredicatesOrientAdapt(ax, ay, bx, by, cx, cy, detSum);
+}
+
+/**
+ * Lifted determinant term of one point in the exact in circle determinant
+ */
+static int SFGeometryPredicatesInCircleTerm(int length, const double *expansion, double x, double y, BOOL negate, double *term){
+    double det24x[24], det48x[48], det24y[24], det48y[48];
+    int xLength = SFGeometryPredicatesExpansionScale(length, expansion, x, det24x);
+    int xxLength = SFGeometryPredicatesExpansionScale(xLength, det24x, negate ? -x : x, det48x);
+    int yLength = SFGeometryPredicatesExpansionScale(length, expansion, y, det24y);
+    int yyLength = SFGeometryPredicatesExpansionScale(yLength, det24y, negate ? -y : y, det48y);
+    return SFGeometryPredicatesExpansionSum(xxLength, det48x, yyLength, det48y, term);
+}
+
+/**
+ * Exact in circle determinant of the points
+ */
+static double SFGeometryPredicatesInCircleExact(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy){
+    double ab[4], bc[4], cd[4], da[4], ac[4], bd[4];
+    SFGeometryPredicatesTwoProductDiff(ax, by, bx, ay, ab);
+    SFGeometryPredicatesTwoProductDiff(bx, cy, cx, by, bc);
+    SFGeometryPredicatesTwoProductDiff(cx, dy, dx, cy, cd);
+    SFGeometryPredicatesTwoProductDiff(dx, ay, ax, dy, da);
+    SFGeometryPredicatesTwoProductDiff(ax, cy, cx, ay, ac);
+    SFGeometryPredicatesTwoProductDiff(bx, dy, dx, by, bd);
+    
+    double temp8[8], abc[12], bcd[12], cda[12], dab[12];
+    int temp8Length = SFGeometryPredicatesExpansionSum(4, cd, 4, da, temp8);
+    int cdaLength = SFGeometryPredicatesExpansionSum(temp8Length, temp8, 4, ac, cda);
+    temp8Length = SFGeometryPredicatesExpansionSum(4, da, 4, ab, temp8);
+    int dabLength = SFGeometryPredicatesExpansionSum(temp8Length, temp8, 4, bd, dab);
+    for(int i = 0; i < 4; i++){
+        bd[i] = -bd[i];
+        ac[i] = -ac[i];
+    }
+    temp8Length = SFGeometryPredicatesExpansionSum(4, ab, 4, bc, temp8);
+    int abcLength = SFGeometryPredicatesExpansionSum(temp8Length, temp8, 4, ac, abc);
+    temp8Length = SFGeometryPredicatesExpansionSum(4, bc, 4, cd, temp8);
+    int bcdLength = SFGeometryPredicatesExpansionSum(temp8Length, temp8, 4, bd, bcd);
+    
+    double adet[96], bdet[96], cdet[96], ddet[96], abdet[192], cddet[192], deter[384];
+    int aLength = SFGeometryPredicatesInCircleTerm(bcdLength, bcd, ax, ay, NO, adet);
+    int bLength = SFGeometryPredicatesInCircleTerm(cdaLength, cda, bx, by, YES, bdet);
+    int cLength = SFGeometryPredicatesInCircleTerm(dabLength, dab, cx, cy, NO, cdet);
+    int dLength = SFGeometryPredicatesInCircleTerm(abcLength, abc, dx, dy, YES, ddet);
+    
+    int abLength = SFGeometryPredicatesExpansionSum(aLength, adet, bLength, bdet, abdet);
+    int cdLength = SFGeometryPredicatesExpansionSum(cLength, cdet, dLength, ddet, cddet);
+    int deterLength = SFGeometryPredicatesExpansionSum(abLength, abdet, cdLength, cddet, deter);
+    return deter[deterLength - 1];
+}
+
+/**
+ * In circle test, positive when point d lies inside the circle through the
+ * counter clockwise points a, b, and c, negative when outside, and zero
+ * when cocircular
+ */
+static double SFGeometryPredicatesInCircle(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy){
+    double adx = ax - dx;
+    double bdx = bx - dx;
+    double cdx = cx - dx;
+    double ady = ay - dy;
+    double bdy = by - dy;
+    double cdy = cy - dy;
+    
+    double bdxcdy = bdx * cdy;
+    double cdxbdy = cdx * bdy;
+    double alift = adx * adx + ady * ady;
+    
+    double cdxady = cdx * ady;
+    double adxcdy = adx * cdy;
+    double blift = bdx * bdx + bdy * bdy;
+    
+    double adxbdy = adx * bdy;
+    double bdxady = bdx * ady;
+    double clift = cdx * cdx + cdy * cdy;
+    
+    double det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+    double permanent = (fabs(bdxcdy) + fabs(cdxbdy)) * alift
+        + (fabs(cdxady) + fabs(adxcdy)) * blift
+        + (fabs(adxbdy) + fabs(bdxady)) * clift;
+    double errorBound = SF_PREDICATES_IN_CIRCLE_ERROR_A * permanent;
+    if(det > errorBound || -det > errorBound){
+        return det;
+    }
+    return SFGeometryPredicatesInCircleExact(ax, ay, bx, by, cx, cy, dx, dy);
+}
+
+@implementation SFGeometryPredicates
+
++(double) orientationWithX1: (double) x1 andY1: (double) y1 andX2: (double) x2 andY2: (double) y2 andX3: (double) x3 andY3: (double) y3{
+    return SFGeometryPredicatesOrient(x1, y1, x2, y2, x3, y3);
+}
+
++(double) orientationWithPoint1: (SFPoint *) point1 andPoint2: (SFPoint *) point2 andPoint3: (SFPoint *) point3{
+    return SFGeometryPredicatesOrient([point1.x doubleValue], [point1.y doubleValue],
+                                      [point2.x doubleValue], [point2.y doubleValue],
+                                      [point3.x doubleValue], [point3.y doubleValue]);
+}
+
++(double) inCircleWithX1: (double) x1 andY1: (double) y1 andX2: (double) x2 andY2: (double) y2 andX3: (double) x3 andY3: (double) y3 andX4: (double) x4 andY4: (double) y4{
+    return SFGeometryPredicatesInCircle(x1, y1, x2, y2, x3, y3, x4, y4);
+}
+
++(double) inCircleWithPoint1: (SFPoint *) point1 andPoint2: (SFPoint *) point2 andPoint3: (SFPoint *) point3 andPoint4: (SFPoint *) point4{
+    return SFGeometryPredicatesInCircle([point1.x doubleValue], [point1.y doubleValue],
+                                        [point2.x doubleValue], [point2.y doubleValue],
+                                        [point3.x doubleValue], [point3.y doubleValue],
+                                        [point4.x doubleValue], [point4.y doubleValue]);
+}
+
+@end
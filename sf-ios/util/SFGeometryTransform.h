@@ -0,0 +1,111 @@
+//
+//  SFGeometryTransform.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+
+/**
+ * Web Mercator max latitude, the latitude of a square world
+ */
+extern double const SF_WEB_MERCATOR_MAX_LATITUDE;
+
+/**
+ * Web Mercator half world width in meters, the max x and y
+ */
+extern double const SF_WEB_MERCATOR_HALF_WORLD_WIDTH;
+
+/**
+ * In place geometry coordinate transformation between WGS84 and Web
+ * Mercator or by a 2D or 3D affine matrix. Coordinates are gathered into
+ * contiguous x, y, and z buffers and transformed with vectorized (SIMD)
+ * Accelerate routines before being written back to the points. M values are
+ * not transformed.
+ */
+@interface SFGeometryTransform : NSObject
+
+/**
+ * WGS84 longitude, latitude to Web Mercator transform. Latitudes are clamped
+ * to the Web Mercator max latitude.
+ *
+ * @return transform
+ */
++(SFGeometryTransform *) wgs84ToWebMercator;
+
+/**
+ * Web Mercator to WGS84 longitude, latitude transform
+ *
+ * @return transform
+ */
++(SFGeometryTransform *) webMercatorToWGS84;
+
+/**
+ * 2D affine transform: x' = a * x + b * y + c, y' = d * x + e * y + f
+ *
+ * @param a
+ *            x scale of x
+ * @param b
+ *            x shear of y
+ * @param c
+ *            x offset
+ * @param d
+ *            y shear of x
+ * @param e
+ *            y scale of y
+ * @param f
+ *            y offset
+ * @return transform
+ */
++(SFGeometryTransform *) affineWithA: (double) a andB: (double) b andC: (double) c andD: (double) d andE: (double) e andF: (double) f;
+
+/**
+ * 3D affine transform by a row major 3 x 4 matrix:
+ * x' = m[0] * x + m[1] * y + m[2] * z + m[3],
+ * y' = m[4] * x + m[5] * y + m[6] * z + m[7],
+ * z' = m[8] * x + m[9] * y + m[10] * z + m[11].
+ * Geometries without z values are transformed with a z of 0 and remain 2D.
+ *
+ * @param matrix
+ *            12 matrix values
+ * @return transform
+ */
++(SFGeometryTransform *) affine3DWithMatrix: (const double *) matrix;
+
+/**
+ * Transform the geometry coordinates in place. Point instances shared within
+ * the geometry, such as a ring closed by its first point, are transformed
+ * once.
+ *
+ * @param geometry
+ *            geometry
+ */
+-(void) transformGeometry: (SFGeometry *) geometry;
+
+/**
+ * Transform the geometries coordinates in place, concurrently across chunks
+ * of the geometries when large enough. Geometries must not share points.
+ *
+ * @param geometries
+ *            geometries
+ */
+-(void) transformGeometries: (NSArray<SFGeometry *> *) geometries;
+
+/**
+ * Transform packed coordinate buffers in place
+ *
+ * @param x
+ *            x values
+ * @param y
+ *            y values
+ * @param z
+ *            z values, NULL when 2D
+ * @param count
+ *            number of coordinates
+ */
+-(void) transformX: (double *) x andY: (double *) y andZ: (double *) z withCount: (NSUInteger) count;
+
+@end
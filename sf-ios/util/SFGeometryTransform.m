@@ -0,0 +1,377 @@
+//
+//  SFGeometryTransform.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Accelerate/Accelerate.h>
+#import "SFGeometryTransform.h"
+#import "SFGeodesic.h"
+#import "SFPoint.h"
+#import "SFCircularString.h"
+#import "SFCompoundCurve.h"
+#import "SFCurvePolygon.h"
+#import "SFPolyhedralSurface.h"
+#import "SFGeometryCollection.h"
+
+double const SF_WEB_MERCATOR_MAX_LATITUDE = 85.0511287798066;
+
+double const SF_WEB_MERCATOR_HALF_WORLD_WIDTH = 20037508.342789244;
+
+/**
+ * Number of coordinates buffered on the stack before falling back to the heap
+ */
+#define SF_TRANSFORM_BUFFER_SIZE 256
+
+/**
+ * Number of geometries processed per concurrent chunk
+ */
+#define SF_TRANSFORM_CONCURRENT_CHUNK 64
+
+/**
+ * Transform kind
+ */
+typedef enum SFTransformKind{
+    SF_TRANSFORM_WGS84_TO_WEB_MERCATOR,
+    SF_TRANSFORM_WEB_MERCATOR_TO_WGS84,
+    SF_TRANSFORM_AFFINE
+} SFTransformKind;
+
+/**
+ * Transform kind and row major 3 x 4 affine matrix
+ */
+typedef struct SFTransformOperation{
+    SFTransformKind kind;
+    double matrix[12];
+} SFTransformOperation;
+
+/**
+ * Transform WGS84 coordinates to Web Mercator in place
+ *
+ * @param x
+ *            longitude values
+ * @param y
+ *            latitude values
+ * @param count
+ *            number of coordinates
+ */
+static void SFTransformToWebMercator(double *x, double *y, int count){
+    double xScale = SF_WGS84_SEMI_MAJOR_AXIS * M_PI / 180.0;
+    double yScale = M_PI / 180.0;
+    double minLatitude = -SF_WEB_MERCATOR_MAX_LATITUDE;
+    double maxLatitude = SF_WEB_MERCATOR_MAX_LATITUDE;
+    double radius = SF_WGS84_SEMI_MAJOR_AXIS;
+    vDSP_vsmulD(x, 1, &xScale, x, 1, count);
+    vDSP_vclipD(y, 1, &minLatitude, &maxLatitude, y, 1, count);
+    vDSP_vsmulD(y, 1, &yScale, y, 1, count);
+    // y = R * ln(tan(pi / 4 + lat / 2)) = R * atanh(sin(lat))
+    vvsin(y, y, &count);
+    vvatanh(y, y, &count);
+    vDSP_vsmulD(y, 1, &radius, y, 1, count);
+}
+
+/**
+ * Transform Web Mercator coordinates to WGS84 in place
+ *
+ * @param x
+ *            x values
+ * @param y
+ *            y values
+ * @param count
+ *            number of coordinates
+ */
+static void SFTransformToWGS84(double *x, double *y, int count){
+    double xScale = 180.0 / (SF_WGS84_SEMI_MAJOR_AXIS * M_PI);
+    double yScale = 1.0 / SF_WGS84_SEMI_MAJOR_AXIS;
+    double degrees = 180.0 / M_PI;
+    vDSP_vsmulD(x, 1, &xScale, x, 1, count);
+    vDSP_vsmulD(y, 1, &yScale, y, 1, count);
+    // lat = atan(sinh(y / R))
+    vvsinh(y, y, &count);
+    vvatan(y, y, &count);
+    vDSP_vsmulD(y, 1, &degrees, y, 1, count);
+}
+
+/**
+ * Transform coordinates by the affine matrix in place
+ *
+ * @param m
+ *            row major 3 x 4 matrix
+ * @param x
+ *            x values
+ * @param y
+ *            y values
+ * @param z
+ *            z values, NULL when 2D
+ * @param buffer
+ *            temporary buffer with capacity for 2 * count values
+ * @param count
+ *            number of coordinates
+ */
+static void SFTransformAffine(const double *m, double *x, double *y, double *z, double *buffer, int count){
+    double *tx = buffer;
+    double *ty = buffer + count;
+    vDSP_vsmsmaD(x, 1, &m[0], y, 1, &m[1], tx, 1, count);
+    vDSP_vsmsmaD(x, 1, &m[4], y, 1, &m[5], ty, 1, count);
+    if(z != NULL){
+        vDSP_vsmaD(z, 1, &m[2], tx, 1, tx, 1, count);
+        vDSP_vsmaD(z, 1, &m[6], ty, 1, ty, 1, count);
+        vDSP_vsmsmaD(x, 1, &m[8], y, 1, &m[9], x, 1, count);
+        vDSP_vsmaD(z, 1, &m[10], x, 1, z, 1, count);
+        vDSP_vsaddD(z, 1, &m[11], z, 1, count);
+    }
+    vDSP_vsaddD(tx, 1, &m[3], x, 1, count);
+    vDSP_vsaddD(ty, 1, &m[7], y, 1, count);
+}
+
+/**
+ * Apply the transform operation to the coordinates in place
+ *
+ * @param operation
+ *            transform operation
+ * @param x
+ *            x values
+ * @param y
+ *            y values
+ * @param z
+ *            z values, NULL when 2D
+ * @param buffer
+ *            temporary buffer with capacity for 2 * count values
+ * @param count
+ *            number of coordinates
+ */
+static void SFTransformApply(const SFTransformOperation *operation, double *x, double *y, double *z, double *buffer, int count){
+    switch(operation->kind){
+        case SF_TRANSFORM_WGS84_TO_WEB_MERCATOR:
+            SFTransformToWebMercator(x, y, count);
+            break;
+        case SF_TRANSFORM_WEB_MERCATOR_TO_WGS84:
+            SFTransformToWGS84(x, y, count);
+            break;
+        default:
+            SFTransformAffine(operation->matrix, x, y, z, buffer, count);
+            break;
+    }
+}
+
+@interface SFGeometryTransform()
+
+/**
+ * Transform operation
+ */
+@property (nonatomic) SFTransformOperation operation;
+
+@end
+
+@implementation SFGeometryTransform
+
++(SFGeometryTransform *) wgs84ToWebMercator{
+    SFTransformOperation operation = {SF_TRANSFORM_WGS84_TO_WEB_MERCATOR, {0}};
+    return [[SFGeometryTransform alloc] initWithOperation:operation];
+}
+
++(SFGeometryTransform *) webMercatorToWGS84{
+    SFTransformOperation operation = {SF_TRANSFORM_WEB_MERCATOR_TO_WGS84, {0}};
+    return [[SFGeometryTransform alloc] initWithOperation:operation];
+}
+
++(SFGeometryTransform *) affineWithA: (double) a andB: (double) b andC: (double) c andD: (double) d andE: (double) e andF: (double) f{
+    double matrix[12] = {
+        a, b, 0, c,
+        d, e, 0, f,
+        0, 0, 1, 0
+    };
+    return [self affine3DWithMatrix:matrix];
+}
+
++(SFGeometryTransform *) affine3DWithMatrix: (const double *) matrix{
+    SFTransformOperation operation;
+    operation.kind = SF_TRANSFORM_AFFINE;
+    memcpy(operation.matrix, matrix, sizeof(operation.matrix));
+    return [[SFGeometryTransform alloc] initWithOperation:operation];
+}
+
+/**
+ * Initialize
+ *
+ * @param operation
+ *            transform operation
+ * @return new transform
+ */
+-(instancetype) initWithOperation: (SFTransformOperation) operation{
+    self = [super init];
+    if(self != nil){
+        self.operation = operation;
+    }
+    return self;
+}
+
+-(void) transformGeometry: (SFGeometry *) geometry{
+    
+    NSMutableArray<SFPoint *> *points = [NSMutableArray array];
+    NSHashTable<SFPoint *> *added = [[NSHashTable alloc] initWithOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality capacity:0];
+    [self addPointsOfGeometry:geometry toPoints:points withAdded:added];
+    
+    int count = (int) points.count;
+    if(count > 0){
+        
+        BOOL hasZ = NO;
+        for(SFPoint *point in points){
+            if(point.hasZ){
+                hasZ = YES;
+                break;
+            }
+        }
+        
+        // x, y, z, and two temporary buffers
+        double stackValues[SF_TRANSFORM_BUFFER_SIZE * 5];
+        double *values = count <= SF_TRANSFORM_BUFFER_SIZE ? stackValues : malloc(sizeof(double) * 5 * count);
+        double *x = values;
+        double *y = values + count;
+        double *z = hasZ ? values + 2 * count : NULL;
+        double *buffer = values + 3 * count;
+        
+        int i = 0;
+        for(SFPoint *point in points){
+            x[i] = [point.x doubleValue];
+            y[i] = [point.y doubleValue];
+            if(z != NULL){
+                z[i] = point.z != nil ? [point.z doubleValue] : 0.0;
+            }
+            i++;
+        }
+        
+        SFTransformOperation operation = self.operation;
+        SFTransformApply(&operation, x, y, z, buffer, count);
+        
+        i = 0;
+        for(SFPoint *point in points){
+            [point setXValue:x[i]];
+            [point setYValue:y[i]];
+            if(z != NULL && point.z != nil){
+                [point setZValue:z[i]];
+            }
+            i++;
+        }
+        
+        if(values != stackValues){
+            free(values);
+        }
+    }
+    
+}
+
+-(void) transformGeometries: (NSArray<SFGeometry *> *) geometries{
+    
+    NSUInteger count = geometries.count;
+    if(count < SF_TRANSFORM_CONCURRENT_CHUNK * 2){
+        for(SFGeometry *geometry in geometries){
+            [self transformGeometry:geometry];
+        }
+    }else{
+        size_t chunks = (count + SF_TRANSFORM_CONCURRENT_CHUNK - 1) / SF_TRANSFORM_CONCURRENT_CHUNK;
+        dispatch_apply(chunks, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t chunk) {
+            NSUInteger start = chunk * SF_TRANSFORM_CONCURRENT_CHUNK;
+            NSUInteger end = MIN(start + SF_TRANSFORM_CONCURRENT_CHUNK, count);
+            for(NSUInteger i = start; i < end; i++){
+                [self transformGeometry:[geometries objectAtIndex:i]];
+            }
+        });
+    }
+    
+}
+
+-(void) transformX: (double *) x andY: (double *) y andZ: (double *) z withCount: (NSUInteger) count{
+    
+    if(count > 0){
+        double *buffer = malloc(sizeof(double) * 2 * count);
+        SFTransformOperation operation = self.operation;
+        SFTransformApply(&operation, x, y, z, buffer, (int) count);
+        free(buffer);
+    }
+    
+}
+
+/**
+ * Add the point to the points once, by instance. Shared point instances,
+ * such as a ring closing point that is its first point, are transformed a
+ * single time.
+ *
+ * @param point
+ *            point
+ * @param points
+ *            points
+ * @param added
+ *            point instances already added
+ */
+-(void) addPoint: (SFPoint *) point toPoints: (NSMutableArray<SFPoint *> *) points withAdded: (NSHashTable<SFPoint *> *) added{
+    if(![added containsObject:point]){
+        [added addObject:point];
+        [points addObject:point];
+    }
+}
+
+/**
+ * Add the points of the geometry to the points, clearing cached circular
+ * string linearizations
+ *
+ * @param geometry
+ *            geometry
+ * @param points
+ *            points
+ * @param added
+ *            point instances already added
+ */
+-(void) addPointsOfGeometry: (SFGeometry *) geometry toPoints: (NSMutableArray<SFPoint *> *) points withAdded: (NSHashTable<SFPoint *> *) added{
+    
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch(geometryType){
+        case SF_POINT:
+            [self addPoint:(SFPoint *) geometry toPoints:points withAdded:added];
+            break;
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+            if(geometryType == SF_CIRCULARSTRING){
+                [((SFCircularString *) geometry) clearLinearization];
+            }
+            for(SFPoint *point in ((SFLineString *) geometry).points){
+                [self addPoint:point toPoints:points withAdded:added];
+            }
+            break;
+        case SF_COMPOUNDCURVE:
+            for(SFLineString *lineString in ((SFCompoundCurve *) geometry).lineStrings){
+                [self addPointsOfGeometry:lineString toPoints:points withAdded:added];
+            }
+            break;
+        case SF_POLYGON:
+        case SF_CURVEPOLYGON:
+        case SF_TRIANGLE:
+            for(SFCurve *ring in ((SFCurvePolygon *) geometry).rings){
+                [self addPointsOfGeometry:ring toPoints:points withAdded:added];
+            }
+            break;
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            for(SFPolygon *polygon in ((SFPolyhedralSurface *) geometry).polygons){
+                [self addPointsOfGeometry:polygon toPoints:points withAdded:added];
+            }
+            break;
+        case SF_MULTIPOINT:
+        case SF_MULTILINESTRING:
+        case SF_MULTIPOLYGON:
+        case SF_MULTICURVE:
+        case SF_MULTISURFACE:
+        case SF_GEOMETRYCOLLECTION:
+            for(SFGeometry *subGeometry in ((SFGeometryCollection *) geometry).geometries){
+                [self addPointsOfGeometry:subGeometry toPoints:points withAdded:added];
+            }
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for transform: %@", [SFGeometryTypes name:geometryType]];
+    }
+    
+}
+
+@end
@@ -31,7 +31,8 @@
 +(int) dimensionOfGeometry: (SFGeometry *) geometry;
 
 /**
- * Get the Pythagorean theorem distance between two points
+ * Get the Pythagorean theorem distance between two points. See SFGeodesic
+ * for distances between WGS84 longitude and latitude points.
  *
  * @param point1
  *            point 1
@@ -88,6 +89,49 @@
  */
 +(void) normalizeGeometry: (SFGeometry *) geometry withMaxX: (double) maxX;
 
+/**
+ * Split the geometry at the antimeridian into geometries within the -max x to max x
+ * range, an alternative to minimizing that keeps envelopes within the world bounds.
+ * Crossing points are interpolated at the boundary. The provided geometry is not modified.
+ *
+ * Example: For WGS84 provide a max x of 180.0.
+ *
+ * Example: For web mercator provide a max x of 20037508.342789244.
+ *
+ * @param geometry
+ *            geometry
+ * @param maxX
+ *            max positive x value in the geometry projection
+ * @return split geometry, multi geometry when split into multiple parts
+ * @see SFAntimeridianSplitter
+ */
++(SFGeometry *) splitGeometry: (SFGeometry *) geometry withMaxX: (double) maxX;
+
+/**
+ * Minimize the geometries using the shortest x distance between each connected set of points.
+ * Large arrays are processed concurrently, geometries must not share point instances.
+ *
+ * @param geometries
+ *            geometries
+ * @param maxX
+ *            max positive x value in the geometry projection
+ * @see minimizeGeometry:withMaxX:
+ */
++(void) minimizeGeometries: (NSArray<SFGeometry *> *) geometries withMaxX: (double) maxX;
+
+/**
+ * Normalize the geometries so all points outside of the min and max value range are
+ * adjusted to fall within the range. Large arrays are processed concurrently, geometries
+ * must not share point instances.
+ *
+ * @param geometries
+ *            geometries
+ * @param maxX
+ *            max positive x value in the geometry projection
+ * @see normalizeGeometry:withMaxX:
+ */
++(void) normalizeGeometries: (NSArray<SFGeometry *> *) geometries withMaxX: (double) maxX;
+
 /**
  * Simplify the ordered points (representing a line, polygon, etc) using the Douglas Peucker algorithm
  * to create a similar curve with fewer points. Points should be in a meters unit type projection.
@@ -290,7 +334,7 @@
 +(BOOL) closedPolygonPoints: (NSArray<SFPoint *> *) points;
 
 /**
- * Check if the point is on the line
+ * Check if the point is on the line, following the arcs of circular strings
  *
  * @param point
  *            point
@@ -301,7 +345,7 @@
 +(BOOL) point: (SFPoint *) point onLine: (SFLineString *) line;
 
 /**
- * Check if the point is on the line
+ * Check if the point is on the line, following the arcs of circular strings
  *
  * @param point
  *            point
@@ -365,6 +409,36 @@
  */
 +(BOOL) point: (SFPoint *) point onPathPoint1: (SFPoint *) point1 andPoint2: (SFPoint *) point2 withEpsilon: (double) epsilon;
 
+/**
+ * Check if the point is on the line represented by the points, exactly by
+ * orientation or within the distance of a line segment
+ *
+ * @param point
+ *            point
+ * @param points
+ *            line points
+ * @param distance
+ *            distance tolerance, 0 for an exact check
+ * @return true if on the line
+ */
++(BOOL) point: (SFPoint *) point onLinePoints: (NSArray<SFPoint *> *) points withDistance: (double) distance;
+
+/**
+ * Check if the point is on the path between point 1 and point 2, exactly by
+ * orientation or within the distance of the path
+ *
+ * @param point
+ *            point
+ * @param point1
+ *            path point 1
+ * @param point2
+ *            path point 2
+ * @param distance
+ *            distance tolerance, 0 for an exact check
+ * @return true if on the path
+ */
++(BOOL) point: (SFPoint *) point onPathPoint1: (SFPoint *) point1 andPoint2: (SFPoint *) point2 withDistance: (double) distance;
+
 /**
  * Determine if the geometries contain a Z value
  *
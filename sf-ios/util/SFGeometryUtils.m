@@ -19,6 +19,9 @@
 #import "SFCircularString.h"
 #import "SFTriangle.h"
 #import "SFMultiPoint.h"
+#import "SFAntimeridianSplitter.h"
+#import "SFGeometryPredicates.h"
+#import "SFCurveUtils.h"
 
 @implementation SFGeometryUtils
 
@@ -27,6 +30,61 @@
  */
 static float DEFAULT_EPSILON = 0.000000000000001;
 
+/**
+ * Number of coordinates buffered on the stack before falling back to the heap
+ */
+#define SF_COORDINATE_BUFFER_SIZE 256
+
+/**
+ * Number of geometries processed per concurrent chunk in bulk operations
+ */
+#define SF_CONCURRENT_GEOMETRY_CHUNK 64
+
+/**
+ * Calculate the x shifts minimizing the distance of each value from the reference value.
+ * Values more than max x away from the reference are shifted by the world width (2 * max x).
+ * Branch free so the loop is vectorized.
+ *
+ * @param values
+ *            x values
+ * @param shifts
+ *            output x shifts
+ * @param count
+ *            number of values
+ * @param reference
+ *            reference x value
+ * @param maxX
+ *            max positive x value in the geometry projection
+ */
+static void SFMinimizeXValues(const double *values, double *shifts, int count, double reference, double maxX){
+    double worldWidth = maxX * 2.0;
+    for(int i = 0; i < count; i++){
+        double delta = values[i] - reference;
+        shifts[i] = worldWidth * ((double)(delta < -maxX) - (double)(delta > maxX));
+    }
+}
+
+/**
+ * Calculate the x shifts normalizing each value into the -max x to max x range.
+ * Branch free so the loop is vectorized.
+ *
+ * @param values
+ *            x values
+ * @param shifts
+ *            output x shifts
+ * @param count
+ *            number of values
+ * @param maxX
+ *            max positive x value in the geometry projection
+ */
+static void SFNormalizeXValues(const double *values, double *shifts, int count, double maxX){
+    double worldWidth = maxX * 2.0;
+    for(int i = 0; i < count; i++){
+        double value = values[i];
+        shifts[i] = worldWidth * ((double)(value < -maxX) - (double)(value > maxX));
+    }
+}
+
 +(int) dimensionOfGeometry: (SFGeometry *) geometry{
     
     int dimension = -1;
@@ -151,7 +209,7 @@ static float DEFAULT_EPSILON = 0.000000000000001;
             break;
         default:
             break;
-            
+        
     }
     
 }
@@ -159,21 +217,23 @@ static float DEFAULT_EPSILON = 0.000000000000001;
 +(void) minimizeLineString: (SFLineString *) lineString withMaxX: (double) maxX{
     
     NSMutableArray * points = lineString.points;
-    if(points.count > 1){
-        SFPoint *point = [points objectAtIndex:0];
-        for(int i = 1; i < points.count; i++){
-            SFPoint *nextPoint = [points objectAtIndex:i];
-            if([point.x doubleValue] < [nextPoint.x doubleValue]){
-                if([nextPoint.x doubleValue] - [point.x doubleValue] > [point.x doubleValue] - [nextPoint.x doubleValue] + (maxX * 2.0)){
-                    [nextPoint setX:[nextPoint.x decimalNumberBySubtracting:[[NSDecimalNumber alloc] initWithDouble: maxX * 2.0]]];
-                }
-            }else if([point.x doubleValue] > [nextPoint.x doubleValue]){
-                if([point.x doubleValue] - [nextPoint.x doubleValue] > [nextPoint.x doubleValue] - [point.x doubleValue] + (maxX * 2.0)){
-                    [nextPoint setX:[nextPoint.x decimalNumberByAdding:[[NSDecimalNumber alloc] initWithDouble: maxX * 2.0]]];
-                }
-            }
+    int count = (int)points.count;
+    if(count > 1){
+        double stackValues[SF_COORDINATE_BUFFER_SIZE];
+        double stackShifts[SF_COORDINATE_BUFFER_SIZE];
+        double *values = count <= SF_COORDINATE_BUFFER_SIZE ? stackValues : malloc(sizeof(double) * count);
+        double *shifts = count <= SF_COORDINATE_BUFFER_SIZE ? stackShifts : malloc(sizeof(double) * count);
+        
+        [self loadXValuesOfPoints:points intoBuffer:values];
+        SFMinimizeXValues(values, shifts, count, values[0], maxX);
+        [self shiftXValuesOfPoints:points withValues:values andShifts:shifts];
+        
+        if(values != stackValues){
+            free(values);
+            free(shifts);
         }
     }
+    [self clearLinearizationOfLineString:lineString];
 }
 
 +(void) minimizeMultiLineString: (SFMultiLineString *) multiLineString withMaxX: (double) maxX{
@@ -273,32 +333,71 @@ static float DEFAULT_EPSILON = 0.000000000000001;
             break;
         default:
             break;
-            
+        
     }
     
 }
 
 +(void) normalizePoint: (SFPoint *) point withMaxX: (double) maxX{
     
-    if([point.x doubleValue] < -maxX){
-        [point setX:[point.x decimalNumberByAdding:[[NSDecimalNumber alloc] initWithDouble: maxX * 2.0]]];
-    }else if([point.x doubleValue] > maxX){
-        [point setX:[point.x decimalNumberBySubtracting:[[NSDecimalNumber alloc] initWithDouble: maxX * 2.0]]];
+    double x = [point.x doubleValue];
+    double shift = 0.0;
+    SFNormalizeXValues(&x, &shift, 1, maxX);
+    if(shift != 0.0){
+        [point setXValue:x + shift];
     }
 }
 
 +(void) normalizeMultiPoint: (SFMultiPoint *) multiPoint withMaxX: (double) maxX{
     
-    NSArray * points = [multiPoint points];
-    for(SFPoint * point in points){
-        [self normalizePoint:point withMaxX:maxX];
-    }
+    [self normalizePoints:[multiPoint points] withMaxX:maxX];
 }
 
 +(void) normalizeLineString: (SFLineString *) lineString withMaxX: (double) maxX{
     
-    for(SFPoint * point in lineString.points){
-        [self normalizePoint:point withMaxX:maxX];
+    [self normalizePoints:lineString.points withMaxX:maxX];
+    [self clearLinearizationOfLineString:lineString];
+}
+
+/**
+ * Clear the cached linearization of a circular string after modifying its
+ * points in place
+ *
+ * @param lineString
+ *            line string
+ */
++(void) clearLinearizationOfLineString: (SFLineString *) lineString{
+    if(lineString.geometryType == SF_CIRCULARSTRING){
+        [((SFCircularString *) lineString) clearLinearization];
+    }
+}
+
+/**
+ * Normalize the points so all x values outside of the min and max value range are
+ * adjusted to fall within the range
+ *
+ * @param points
+ *            points
+ * @param maxX
+ *            max positive x value in the geometry projection
+ */
++(void) normalizePoints: (NSArray<SFPoint *> *) points withMaxX: (double) maxX{
+    
+    int count = (int)points.count;
+    if(count > 0){
+        double stackValues[SF_COORDINATE_BUFFER_SIZE];
+        double stackShifts[SF_COORDINATE_BUFFER_SIZE];
+        double *values = count <= SF_COORDINATE_BUFFER_SIZE ? stackValues : malloc(sizeof(double) * count);
+        double *shifts = count <= SF_COORDINATE_BUFFER_SIZE ? stackShifts : malloc(sizeof(double) * count);
+        
+        [self loadXValuesOfPoints:points intoBuffer:values];
+        SFNormalizeXValues(values, shifts, count, maxX);
+        [self shiftXValuesOfPoints:points withValues:values andShifts:shifts];
+        
+        if(values != stackValues){
+            free(values);
+            free(shifts);
+        }
     }
 }
 
@@ -346,6 +445,84 @@ static float DEFAULT_EPSILON = 0.000000000000001;
     }
 }
 
++(SFGeometry *) splitGeometry: (SFGeometry *) geometry withMaxX: (double) maxX{
+    return [SFAntimeridianSplitter splitGeometry:geometry withMaxX:maxX];
+}
+
++(void) minimizeGeometries: (NSArray<SFGeometry *> *) geometries withMaxX: (double) maxX{
+    [self applyToGeometries:geometries withBlock:^(SFGeometry *geometry) {
+        [self minimizeGeometry:geometry withMaxX:maxX];
+    }];
+}
+
++(void) normalizeGeometries: (NSArray<SFGeometry *> *) geometries withMaxX: (double) maxX{
+    [self applyToGeometries:geometries withBlock:^(SFGeometry *geometry) {
+        [self normalizeGeometry:geometry withMaxX:maxX];
+    }];
+}
+
+/**
+ * Apply the block to each geometry, concurrently across chunks of the geometries when large enough
+ *
+ * @param geometries
+ *            geometries
+ * @param block
+ *            block to apply to each geometry
+ */
++(void) applyToGeometries: (NSArray<SFGeometry *> *) geometries withBlock: (void (^)(SFGeometry *geometry)) block{
+    
+    NSUInteger count = geometries.count;
+    if(count < SF_CONCURRENT_GEOMETRY_CHUNK * 2){
+        for(SFGeometry *geometry in geometries){
+            block(geometry);
+        }
+    }else{
+        size_t chunks = (count + SF_CONCURRENT_GEOMETRY_CHUNK - 1) / SF_CONCURRENT_GEOMETRY_CHUNK;
+        dispatch_apply(chunks, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t chunk) {
+            NSUInteger start = chunk * SF_CONCURRENT_GEOMETRY_CHUNK;
+            NSUInteger end = MIN(start + SF_CONCURRENT_GEOMETRY_CHUNK, count);
+            for(NSUInteger i = start; i < end; i++){
+                block([geometries objectAtIndex:i]);
+            }
+        });
+    }
+}
+
+/**
+ * Load the point x values into the buffer
+ *
+ * @param points
+ *            points
+ * @param buffer
+ *            buffer with capacity for each point
+ */
++(void) loadXValuesOfPoints: (NSArray<SFPoint *> *) points intoBuffer: (double *) buffer{
+    int i = 0;
+    for(SFPoint *point in points){
+        buffer[i++] = [point.x doubleValue];
+    }
+}
+
+/**
+ * Apply the calculated x shifts to the points, only updating the points with a non zero shift
+ *
+ * @param points
+ *            points
+ * @param values
+ *            point x values
+ * @param shifts
+ *            point x shifts
+ */
++(void) shiftXValuesOfPoints: (NSArray<SFPoint *> *) points withValues: (const double *) values andShifts: (const double *) shifts{
+    int i = 0;
+    for(SFPoint *point in points){
+        if(shifts[i] != 0.0){
+            [point setXValue:values[i] + shifts[i]];
+        }
+        i++;
+    }
+}
+
 + (NSArray<SFPoint *> *) simplifyPoints: (NSArray<SFPoint *> *) points withTolerance : (double) tolerance{
     return [self simplifyPoints:points withTolerance:tolerance andStartIndex:0 andEndIndex:(int)[points count]-1];
 }
@@ -547,7 +724,13 @@ static float DEFAULT_EPSILON = 0.000000000000001;
 }
 
 +(BOOL) point: (SFPoint *) point onLine: (SFLineString *) line withEpsilon: (double) epsilon{
-    return [self point:point onLinePoints:line.points withEpsilon:epsilon];
+    BOOL onLine = NO;
+    if(line.geometryType == SF_CIRCULARSTRING){
+        onLine = [SFCurveUtils point:point onCircularString:(SFCircularString *)line withEpsilon:epsilon];
+    }else{
+        onLine = [self point:point onLinePoints:line.points withEpsilon:epsilon];
+    }
+    return onLine;
 }
 
 +(BOOL) point: (SFPoint *) point onLinePoints: (NSArray<SFPoint *> *) points{
@@ -592,6 +775,55 @@ static float DEFAULT_EPSILON = 0.000000000000001;
     return contains;
 }
 
++(BOOL) point: (SFPoint *) point onLinePoints: (NSArray<SFPoint *> *) points withDistance: (double) distance{
+    BOOL onLine = NO;
+    for(int i = 0; !onLine && i + 1 < points.count; i++){
+        onLine = [self point:point onPathPoint1:[points objectAtIndex:i] andPoint2:[points objectAtIndex:i + 1] withDistance:distance];
+    }
+    return onLine;
+}
+
++(BOOL) point: (SFPoint *) point onPathPoint1: (SFPoint *) point1 andPoint2: (SFPoint *) point2 withDistance: (double) distance{
+    
+    BOOL contains = NO;
+    
+    double px = [point.x doubleValue];
+    double py = [point.y doubleValue];
+    double p1x = [point1.x doubleValue];
+    double p1y = [point1.y doubleValue];
+    double p2x = [point2.x doubleValue];
+    double p2y = [point2.y doubleValue];
+    
+    double orientation = [SFGeometryPredicates orientationWithX1:p1x andY1:p1y andX2:p2x andY2:p2y andX3:px andY3:py];
+    if(orientation == 0.0
+       && px >= MIN(p1x, p2x) && px <= MAX(p1x, p2x)
+       && py >= MIN(p1y, p2y) && py <= MAX(p1y, p2y)){
+        // Exactly on the path
+        contains = YES;
+    }else{
+        
+        double x21 = p2x - p1x;
+        double y21 = p2y - p1y;
+        double xP1 = px - p1x;
+        double yP1 = py - p1y;
+        
+        // Distance to the path within the tolerance
+        double dp = xP1 * x21 + yP1 * y21;
+        double length21 = x21 * x21 + y21 * y21;
+        double pathDistance;
+        if(dp <= 0.0){
+            pathDistance = hypot(xP1, yP1);
+        }else if(dp >= length21){
+            pathDistance = hypot(px - p2x, py - p2y);
+        }else{
+            pathDistance = ABS(orientation) / sqrt(length21);
+        }
+        contains = pathDistance <= distance;
+    }
+    
+    return contains;
+}
+
 +(BOOL) point: (SFPoint *) point onPath: (NSArray<SFPoint *> *) points withEpsilon: (double) epsilon andCircular: (BOOL) circular{
     
     BOOL onPath = NO;
@@ -654,7 +886,7 @@ static float DEFAULT_EPSILON = 0.000000000000001;
     enum SFGeometryType parentType = SF_NONE;
     
     switch(geometryType){
-            
+        
         case SF_GEOMETRY:
             break;
         case SF_POINT:
@@ -738,7 +970,7 @@ static float DEFAULT_EPSILON = 0.000000000000001;
     NSMutableArray<NSNumber *> *childTypes = [[NSMutableArray alloc] init];
     
     switch (geometryType) {
-            
+        
         case SF_GEOMETRY:
             [childTypes addObject:[NSNumber numberWithInt:SF_POINT]];
             [childTypes addObject:[NSNumber numberWithInt:SF_GEOMETRYCOLLECTION]];
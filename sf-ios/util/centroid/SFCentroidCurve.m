@@ -11,6 +11,8 @@
 #import "SFGeometryUtils.h"
 #import "SFMultiLineString.h"
 #import "SFCompoundCurve.h"
+#import "SFCircularString.h"
+#import "SFCurveUtils.h"
 
 @interface SFCentroidCurve()
 
@@ -95,7 +97,27 @@
  *            line string
  */
 -(void) addLineString: (SFLineString *) lineString{
-    [self addPoints:lineString.points];
+    if(lineString.geometryType == SF_CIRCULARSTRING){
+        [self addCircularString:(SFCircularString *) lineString];
+    }else{
+        [self addPoints:lineString.points];
+    }
+}
+
+/**
+ * Add a circular string to the centroid total using the exact arcs
+ *
+ * @param circularString
+ *            circular string
+ */
+-(void) addCircularString: (SFCircularString *) circularString{
+    SFPoint * arcCentroid = [SFCurveUtils centroidOfCircularString:circularString];
+    if(arcCentroid != nil){
+        double length = [SFCurveUtils lengthOfCircularString:circularString];
+        self.totalLength += length;
+        [self.sum setX:[self.sum.x decimalNumberByAdding:[[NSDecimalNumber alloc] initWithDouble:length * [arcCentroid.x doubleValue]]]];
+        [self.sum setY:[self.sum.y decimalNumberByAdding:[[NSDecimalNumber alloc] initWithDouble:length * [arcCentroid.y doubleValue]]]];
+    }
 }
 
 /**
@@ -13,6 +13,7 @@
 #import "SFPolyhedralSurface.h"
 #import "SFGeometryUtils.h"
 #import "SFCompoundCurve.h"
+#import "SFCircularString.h"
 
 @interface SFCentroidSurface()
 
@@ -197,6 +198,9 @@
  *            line string
  */
 -(void) addWithPositive: (BOOL) positive andLineString: (SFLineString *) lineString{
+    if(lineString.geometryType == SF_CIRCULARSTRING){
+        lineString = [((SFCircularString *) lineString) linearize];
+    }
     NSArray * points = lineString.points;
     SFPoint * firstPoint = [points objectAtIndex:0];
     if(self.base == nil){
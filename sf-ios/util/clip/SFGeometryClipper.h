@@ -0,0 +1,125 @@
+//
+//  SFGeometryClipper.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+#import "SFGeometryEnvelope.h"
+
+/**
+ * Clip geometries to a rectangular envelope, such as a map tile with an
+ * optional buffer. Line strings are clipped using Liang-Barsky, splitting into
+ * multiple parts where they leave and re-enter the envelope. Polygon rings
+ * are clipped using Sutherland-Hodgman, one axis boundary at a time. Z and M
+ * values are interpolated at the boundary.
+ *
+ * Geometries (and their members) entirely within the envelope are copied
+ * without clipping and geometries entirely outside are rejected using their
+ * bounding box.
+ *
+ * Curves (circular strings, compound curves, and curve polygons) whose arcs
+ * are entirely within the envelope are copied, otherwise they are linearized
+ * with SFCurveUtils and clip to line strings and polygons. Multi curves and
+ * multi surfaces keep their collection type. Triangles clip to polygons and
+ * TINs to polyhedral surfaces.
+ *
+ * A clipper instance reuses its coordinate buffers between geometries, so
+ * prefer a single instance per envelope when clipping many geometries.
+ * Instances are not thread safe.
+ */
+@interface SFGeometryClipper : NSObject
+
+/**
+ * Minimum x clip boundary
+ */
+@property (nonatomic, readonly) double minX;
+
+/**
+ * Minimum y clip boundary
+ */
+@property (nonatomic, readonly) double minY;
+
+/**
+ * Maximum x clip boundary
+ */
+@property (nonatomic, readonly) double maxX;
+
+/**
+ * Maximum y clip boundary
+ */
+@property (nonatomic, readonly) double maxY;
+
+/**
+ * Initialize
+ *
+ * @param envelope
+ *            clip envelope
+ * @return new clipper
+ */
+-(instancetype) initWithEnvelope: (SFGeometryEnvelope *) envelope;
+
+/**
+ * Initialize
+ *
+ * @param envelope
+ *            clip envelope
+ * @param buffer
+ *            buffer distance to expand the envelope by on all sides
+ * @return new clipper
+ */
+-(instancetype) initWithEnvelope: (SFGeometryEnvelope *) envelope andBuffer: (double) buffer;
+
+/**
+ * Initialize
+ *
+ * @param minX
+ *            minimum x
+ * @param minY
+ *            minimum y
+ * @param maxX
+ *            maximum x
+ * @param maxY
+ *            maximum y
+ * @return new clipper
+ */
+-(instancetype) initWithMinX: (double) minX andMinY: (double) minY andMaxX: (double) maxX andMaxY: (double) maxY;
+
+/**
+ * Clip the geometry to the envelope. The provided geometry is not modified.
+ *
+ * @param geometry
+ *            geometry
+ * @return clipped geometry, nil if entirely outside of the envelope
+ */
+-(SFGeometry *) clipGeometry: (SFGeometry *) geometry;
+
+/**
+ * Clip the geometry to the envelope. The provided geometry is not modified.
+ *
+ * @param geometry
+ *            geometry
+ * @param envelope
+ *            clip envelope
+ * @return clipped geometry, nil if entirely outside of the envelope
+ */
++(SFGeometry *) clipGeometry: (SFGeometry *) geometry withEnvelope: (SFGeometryEnvelope *) envelope;
+
+/**
+ * Clip the geometry to the buffered envelope. The provided geometry is not
+ * modified.
+ *
+ * @param geometry
+ *            geometry
+ * @param envelope
+ *            clip envelope
+ * @param buffer
+ *            buffer distance to expand the envelope by on all sides
+ * @return clipped geometry, nil if entirely outside of the envelope
+ */
++(SFGeometry *) clipGeometry: (SFGeometry *) geometry withEnvelope: (SFGeometryEnvelope *) envelope andBuffer: (double) buffer;
+
+@end
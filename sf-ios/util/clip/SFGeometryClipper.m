@@ -0,0 +1,689 @@
+//
+//  SFGeometryClipper.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFGeometryClipper.h"
+#import "SFPoint.h"
+#import "SFLineString.h"
+#import "SFPolygon.h"
+#import "SFMultiPoint.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+#import "SFPolyhedralSurface.h"
+#import "SFTIN.h"
+#import "SFGeometryCollection.h"
+#import "SFMultiCurve.h"
+#import "SFMultiSurface.h"
+#import "SFCurveUtils.h"
+#import "SFGeometryEnvelopeBuilder.h"
+
+/**
+ * Clip coordinate, missing z and m values are NaN. The index references the
+ * source point, or is -1 for interpolated boundary coordinates.
+ */
+typedef struct SFClipCoordinate{
+    double x;
+    double y;
+    double z;
+    double m;
+    int index;
+} SFClipCoordinate;
+
+/**
+ * Position of coordinates relative to the clip bounds
+ */
+enum SFClipPosition{
+    SF_CLIP_INSIDE,
+    SF_CLIP_OUTSIDE,
+    SF_CLIP_CROSSES
+};
+
+/**
+ * Interpolate the coordinate between two coordinates
+ */
+static SFClipCoordinate SFClipInterpolate(SFClipCoordinate from, SFClipCoordinate to, double t){
+    SFClipCoordinate coordinate;
+    coordinate.x = from.x + t * (to.x - from.x);
+    coordinate.y = from.y + t * (to.y - from.y);
+    coordinate.z = from.z + t * (to.z - from.z);
+    coordinate.m = from.m + t * (to.m - from.m);
+    coordinate.index = -1;
+    return coordinate;
+}
+
+/**
+ * Determine the position of the coordinate bounding box relative to the clip bounds
+ */
+static enum SFClipPosition SFClipPositionOf(const SFClipCoordinate *coordinates, int count, double minX, double minY, double maxX, double maxY){
+    double boundsMinX = DBL_MAX;
+    double boundsMinY = DBL_MAX;
+    double boundsMaxX = -DBL_MAX;
+    double boundsMaxY = -DBL_MAX;
+    for(int i = 0; i < count; i++){
+        boundsMinX = fmin(boundsMinX, coordinates[i].x);
+        boundsMinY = fmin(boundsMinY, coordinates[i].y);
+        boundsMaxX = fmax(boundsMaxX, coordinates[i].x);
+        boundsMaxY = fmax(boundsMaxY, coordinates[i].y);
+    }
+    enum SFClipPosition position;
+    if(count == 0 || boundsMaxX < minX || boundsMinX > maxX || boundsMaxY < minY || boundsMinY > maxY){
+        position = SF_CLIP_OUTSIDE;
+    }else if(boundsMinX >= minX && boundsMaxX <= maxX && boundsMinY >= minY && boundsMaxY <= maxY){
+        position = SF_CLIP_INSIDE;
+    }else{
+        position = SF_CLIP_CROSSES;
+    }
+    return position;
+}
+
+/**
+ * Liang-Barsky clip of the segment parameter range
+ *
+ * @param from
+ *            segment start
+ * @param to
+ *            segment end
+ * @param t0
+ *            start parameter, updated to the clipped start
+ * @param t1
+ *            end parameter, updated to the clipped end
+ * @return true if a portion of the segment is within the bounds
+ */
+static BOOL SFClipSegment(SFClipCoordinate from, SFClipCoordinate to, double minX, double minY, double maxX, double maxY, double *t0, double *t1){
+    double dx = to.x - from.x;
+    double dy = to.y - from.y;
+    double p[4] = {-dx, dx, -dy, dy};
+    double q[4] = {from.x - minX, maxX - from.x, from.y - minY, maxY - from.y};
+    for(int i = 0; i < 4; i++){
+        if(p[i] == 0.0){
+            if(q[i] < 0.0){
+                return NO;
+            }
+        }else{
+            double r = q[i] / p[i];
+            if(p[i] < 0.0){
+                if(r > *t1){
+                    return NO;
+                }
+                if(r > *t0){
+                    *t0 = r;
+                }
+            }else{
+                if(r < *t0){
+                    return NO;
+                }
+                if(r < *t1){
+                    *t1 = r;
+                }
+            }
+        }
+    }
+    return YES;
+}
+
+/**
+ * Sutherland-Hodgman clip of a ring against a single axis boundary
+ *
+ * @param input
+ *            ring coordinates, without a closing coordinate
+ * @param count
+ *            number of coordinates
+ * @param output
+ *            output coordinates with capacity of twice the count
+ * @param yAxis
+ *            true to clip against a y boundary, false for an x boundary
+ * @param bound
+ *            boundary value
+ * @param side
+ *            1.0 to keep values at or above the bound, -1.0 to keep values at or below
+ * @return number of output coordinates
+ */
+static int SFClipRing(const SFClipCoordinate *input, int count, SFClipCoordinate *output, BOOL yAxis, double bound, double side){
+    int outputCount = 0;
+    if(count > 0){
+        SFClipCoordinate previous = input[count - 1];
+        double previousValue = yAxis ? previous.y : previous.x;
+        BOOL previousInside = side * (previousValue - bound) >= 0.0;
+        for(int i = 0; i < count; i++){
+            SFClipCoordinate current = input[i];
+            double currentValue = yAxis ? current.y : current.x;
+            BOOL currentInside = side * (currentValue - bound) >= 0.0;
+            if(currentInside != previousInside){
+                SFClipCoordinate crossing = SFClipInterpolate(previous, current, (bound - previousValue) / (currentValue - previousValue));
+                if(yAxis){
+                    crossing.y = bound;
+                }else{
+                    crossing.x = bound;
+                }
+                output[outputCount++] = crossing;
+            }
+            if(currentInside){
+                output[outputCount++] = current;
+            }
+            previous = current;
+            previousValue = currentValue;
+            previousInside = currentInside;
+        }
+    }
+    return outputCount;
+}
+
+/**
+ * Remove consecutive repeated coordinates from the ring, including the wrap around
+ *
+ * @return updated coordinate count
+ */
+static int SFClipRemoveRepeated(SFClipCoordinate *coordinates, int count){
+    int updated = 0;
+    for(int i = 0; i < count; i++){
+        if(updated == 0 || coordinates[i].x != coordinates[updated - 1].x || coordinates[i].y != coordinates[updated - 1].y){
+            coordinates[updated++] = coordinates[i];
+        }
+    }
+    while(updated > 1 && coordinates[0].x == coordinates[updated - 1].x && coordinates[0].y == coordinates[updated - 1].y){
+        updated--;
+    }
+    return updated;
+}
+
+/**
+ * Calculate the twice signed area of the ring
+ */
+static double SFClipRingArea(const SFClipCoordinate *coordinates, int count){
+    double area = 0.0;
+    for(int i = 0, j = count - 1; i < count; j = i++){
+        area += (coordinates[j].x - coordinates[i].x) * (coordinates[j].y + coordinates[i].y);
+    }
+    return area;
+}
+
+@interface SFGeometryClipper()
+
+/**
+ * Loaded source coordinates
+ */
+@property (nonatomic) SFClipCoordinate *coordinates;
+
+/**
+ * Clip working coordinates
+ */
+@property (nonatomic) SFClipCoordinate *scratch;
+
+/**
+ * Clip result coordinates
+ */
+@property (nonatomic) SFClipCoordinate *clipped;
+
+/**
+ * Coordinate buffer capacities
+ */
+@property (nonatomic) int capacity;
+
+@end
+
+@implementation SFGeometryClipper
+
++(SFGeometry *) clipGeometry: (SFGeometry *) geometry withEnvelope: (SFGeometryEnvelope *) envelope{
+    return [self clipGeometry:geometry withEnvelope:envelope andBuffer:0.0];
+}
+
++(SFGeometry *) clipGeometry: (SFGeometry *) geometry withEnvelope: (SFGeometryEnvelope *) envelope andBuffer: (double) buffer{
+    SFGeometryClipper *clipper = [[SFGeometryClipper alloc] initWithEnvelope:envelope andBuffer:buffer];
+    return [clipper clipGeometry:geometry];
+}
+
+-(instancetype) initWithEnvelope: (SFGeometryEnvelope *) envelope{
+    return [self initWithEnvelope:envelope andBuffer:0.0];
+}
+
+-(instancetype) initWithEnvelope: (SFGeometryEnvelope *) envelope andBuffer: (double) buffer{
+    return [self initWithMinX:[envelope.minX doubleValue] - buffer
+                      andMinY:[envelope.minY doubleValue] - buffer
+                      andMaxX:[envelope.maxX doubleValue] + buffer
+                      andMaxY:[envelope.maxY doubleValue] + buffer];
+}
+
+-(instancetype) initWithMinX: (double) minX andMinY: (double) minY andMaxX: (double) maxX andMaxY: (double) maxY{
+    self = [super init];
+    if(self != nil){
+        _minX = minX;
+        _minY = minY;
+        _maxX = maxX;
+        _maxY = maxY;
+        _coordinates = NULL;
+        _scratch = NULL;
+        _clipped = NULL;
+        _capacity = 0;
+    }
+    return self;
+}
+
+-(void) dealloc{
+    free(_coordinates);
+    free(_scratch);
+    free(_clipped);
+}
+
+-(SFGeometry *) clipGeometry: (SFGeometry *) geometry{
+    
+    SFGeometry *clipped = nil;
+    
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch (geometryType) {
+        case SF_POINT:
+            clipped = [self clipPoint:(SFPoint *)geometry];
+            break;
+        case SF_LINESTRING:
+            clipped = [self geometryOfLineStrings:[self clipLineString:(SFLineString *)geometry] withGeometry:geometry];
+            break;
+        case SF_CIRCULARSTRING:
+        case SF_COMPOUNDCURVE:
+        case SF_CURVEPOLYGON:
+            clipped = [self clipCurveGeometry:geometry];
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            clipped = [self clipSurface:(SFPolygon *)geometry];
+            break;
+        case SF_MULTIPOINT:
+            {
+                SFMultiPoint *multiPoint = (SFMultiPoint *)geometry;
+                SFMultiPoint *clippedMultiPoint = [[SFMultiPoint alloc] initWithHasZ:multiPoint.hasZ andHasM:multiPoint.hasM];
+                for(SFPoint *point in [multiPoint points]){
+                    SFPoint *clippedPoint = [self clipPoint:point];
+                    if(clippedPoint != nil){
+                        [clippedMultiPoint addPoint:clippedPoint];
+                    }
+                }
+                if(![clippedMultiPoint isEmpty]){
+                    clipped = clippedMultiPoint;
+                }
+            }
+            break;
+        case SF_MULTILINESTRING:
+            {
+                SFMultiLineString *multiLineString = (SFMultiLineString *)geometry;
+                SFMultiLineString *clippedMultiLineString = [[SFMultiLineString alloc] initWithHasZ:multiLineString.hasZ andHasM:multiLineString.hasM];
+                for(SFLineString *lineString in [multiLineString lineStrings]){
+                    [clippedMultiLineString addLineStrings:[self clipLineString:lineString]];
+                }
+                if(![clippedMultiLineString isEmpty]){
+                    clipped = clippedMultiLineString;
+                }
+            }
+            break;
+        case SF_MULTIPOLYGON:
+            {
+                SFMultiPolygon *multiPolygon = (SFMultiPolygon *)geometry;
+                SFMultiPolygon *clippedMultiPolygon = [[SFMultiPolygon alloc] initWithHasZ:multiPolygon.hasZ andHasM:multiPolygon.hasM];
+                for(SFPolygon *polygon in [multiPolygon polygons]){
+                    SFPolygon *clippedPolygon = [self clipSurface:polygon];
+                    if(clippedPolygon != nil){
+                        [clippedMultiPolygon addPolygon:clippedPolygon];
+                    }
+                }
+                if(![clippedMultiPolygon isEmpty]){
+                    clipped = clippedMultiPolygon;
+                }
+            }
+            break;
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            {
+                SFPolyhedralSurface *polyhedralSurface = (SFPolyhedralSurface *)geometry;
+                NSMutableArray<SFPolygon *> *polygons = [[NSMutableArray alloc] init];
+                BOOL triangles = YES;
+                for(SFPolygon *polygon in [polyhedralSurface polygons]){
+                    SFPolygon *clippedPolygon = [self clipSurface:polygon];
+                    if(clippedPolygon != nil){
+                        triangles = triangles && clippedPolygon.geometryType == SF_TRIANGLE;
+                        [polygons addObject:clippedPolygon];
+                    }
+                }
+                if(polygons.count > 0){
+                    SFPolyhedralSurface *clippedSurface = nil;
+                    if(geometryType == SF_TIN && triangles){
+                        clippedSurface = [[SFTIN alloc] initWithHasZ:polyhedralSurface.hasZ andHasM:polyhedralSurface.hasM];
+                    }else{
+                        clippedSurface = [[SFPolyhedralSurface alloc] initWithHasZ:polyhedralSurface.hasZ andHasM:polyhedralSurface.hasM];
+                    }
+                    [clippedSurface addPolygons:polygons];
+                    clipped = clippedSurface;
+                }
+            }
+            break;
+        case SF_GEOMETRYCOLLECTION:
+        case SF_MULTICURVE:
+        case SF_MULTISURFACE:
+            {
+                SFGeometryCollection *geometryCollection = (SFGeometryCollection *)geometry;
+                SFGeometryCollection *clippedCollection = nil;
+                switch(geometryType){
+                    case SF_MULTICURVE:
+                        clippedCollection = [[SFMultiCurve alloc] initWithType:SF_MULTICURVE andHasZ:geometryCollection.hasZ andHasM:geometryCollection.hasM];
+                        break;
+                    case SF_MULTISURFACE:
+                        clippedCollection = [[SFMultiSurface alloc] initWithType:SF_MULTISURFACE andHasZ:geometryCollection.hasZ andHasM:geometryCollection.hasM];
+                        break;
+                    default:
+                        clippedCollection = [[SFGeometryCollection alloc] initWithHasZ:geometryCollection.hasZ andHasM:geometryCollection.hasM];
+                        break;
+                }
+                for(SFGeometry *subGeometry in geometryCollection.geometries){
+                    SFGeometry *clippedGeometry = [self clipGeometry:subGeometry];
+                    if(clippedGeometry == nil){
+                        continue;
+                    }
+                    if(geometryType == SF_MULTICURVE && clippedGeometry.geometryType == SF_MULTILINESTRING){
+                        // Curves split by the bounds remain multi curve members
+                        [clippedCollection addGeometries:((SFMultiLineString *)clippedGeometry).geometries];
+                    }else{
+                        [clippedCollection addGeometry:clippedGeometry];
+                    }
+                }
+                if(![clippedCollection isEmpty]){
+                    clipped = clippedCollection;
+                }
+            }
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for clipping: %@", [SFGeometryTypes name:geometryType]];
+    }
+    
+    return clipped;
+}
+
+/**
+ * Clip the circular string, compound curve, or curve polygon. Curves with
+ * arcs entirely within the bounds are copied, otherwise the curves are
+ * linearized and the linear geometry clipped.
+ *
+ * @param geometry
+ *            curve geometry
+ * @return curve copy, clipped linear geometry, or nil if outside of the
+ *         bounds
+ */
+-(SFGeometry *) clipCurveGeometry: (SFGeometry *) geometry{
+    SFGeometry *clipped = nil;
+    SFGeometryEnvelope *envelope = [SFGeometryEnvelopeBuilder buildEnvelopeWithGeometry:geometry];
+    if(envelope != nil){
+        double minX = [envelope.minX doubleValue];
+        double minY = [envelope.minY doubleValue];
+        double maxX = [envelope.maxX doubleValue];
+        double maxY = [envelope.maxY doubleValue];
+        if(minX >= _minX && maxX <= _maxX && minY >= _minY && maxY <= _maxY){
+            clipped = [geometry mutableCopy];
+        }else if(maxX >= _minX && minX <= _maxX && maxY >= _minY && minY <= _maxY){
+            clipped = [self clipGeometry:[SFCurveUtils linearizeGeometry:geometry withSegmentsPerQuadrant:SF_CURVE_DEFAULT_SEGMENTS_PER_QUADRANT]];
+        }
+    }
+    return clipped;
+}
+
+/**
+ * Clip the point
+ *
+ * @param point
+ *            point
+ * @return point copy, nil if outside of the bounds
+ */
+-(SFPoint *) clipPoint: (SFPoint *) point{
+    SFPoint *clipped = nil;
+    double x = [point.x doubleValue];
+    double y = [point.y doubleValue];
+    if(x >= _minX && x <= _maxX && y >= _minY && y <= _maxY){
+        clipped = [point mutableCopy];
+    }
+    return clipped;
+}
+
+/**
+ * Create a geometry from the clipped line strings
+ *
+ * @param lineStrings
+ *            clipped line strings
+ * @param geometry
+ *            source geometry
+ * @return nil, single line string, or multi line string
+ */
+-(SFGeometry *) geometryOfLineStrings: (NSArray<SFLineString *> *) lineStrings withGeometry: (SFGeometry *) geometry{
+    SFGeometry *clipped = nil;
+    if(lineStrings.count == 1){
+        clipped = [lineStrings objectAtIndex:0];
+    }else if(lineStrings.count > 1){
+        SFMultiLineString *multiLineString = [[SFMultiLineString alloc] initWithHasZ:geometry.hasZ andHasM:geometry.hasM];
+        [multiLineString addLineStrings:lineStrings];
+        clipped = multiLineString;
+    }
+    return clipped;
+}
+
+/**
+ * Clip the line string into the line string parts within the bounds
+ *
+ * @param lineString
+ *            line string
+ * @return line string parts, a single copy of the line string when entirely within the bounds
+ */
+-(NSArray<SFLineString *> *) clipLineString: (SFLineString *) lineString{
+    
+    NSMutableArray<SFLineString *> *parts = [[NSMutableArray alloc] init];
+    
+    NSArray<SFPoint *> *points = lineString.points;
+    int count = [self loadPoints:points];
+    
+    switch(SFClipPositionOf(_coordinates, count, _minX, _minY, _maxX, _maxY)){
+        case SF_CLIP_INSIDE:
+            [parts addObject:[lineString mutableCopy]];
+            break;
+        case SF_CLIP_CROSSES:
+            {
+                int partCount = 0;
+                for(int i = 1; i < count; i++){
+                    SFClipCoordinate from = _coordinates[i - 1];
+                    SFClipCoordinate to = _coordinates[i];
+                    double t0 = 0.0;
+                    double t1 = 1.0;
+                    if(!SFClipSegment(from, to, _minX, _minY, _maxX, _maxY, &t0, &t1)){
+                        [self addLineStringOfCount:partCount withPoints:points andHasZ:lineString.hasZ andHasM:lineString.hasM toParts:parts];
+                        partCount = 0;
+                        continue;
+                    }
+                    if(partCount == 0){
+                        _clipped[partCount++] = t0 == 0.0 ? from : SFClipInterpolate(from, to, t0);
+                    }
+                    _clipped[partCount++] = t1 == 1.0 ? to : SFClipInterpolate(from, to, t1);
+                    if(t1 < 1.0){
+                        [self addLineStringOfCount:partCount withPoints:points andHasZ:lineString.hasZ andHasM:lineString.hasM toParts:parts];
+                        partCount = 0;
+                    }
+                }
+                [self addLineStringOfCount:partCount withPoints:points andHasZ:lineString.hasZ andHasM:lineString.hasM toParts:parts];
+            }
+            break;
+        default:
+            break;
+    }
+    
+    return parts;
+}
+
+/**
+ * Add a line string of the clipped coordinates when it contains at least two
+ * distinct coordinates
+ *
+ * @param count
+ *            number of clipped coordinates
+ * @param points
+ *            source points
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ * @param parts
+ *            line string parts
+ */
+-(void) addLineStringOfCount: (int) count withPoints: (NSArray<SFPoint *> *) points andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM toParts: (NSMutableArray<SFLineString *> *) parts{
+    BOOL distinct = NO;
+    for(int i = 1; !distinct && i < count; i++){
+        distinct = _clipped[i].x != _clipped[0].x || _clipped[i].y != _clipped[0].y;
+    }
+    if(distinct){
+        SFLineString *lineString = [[SFLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+        for(int i = 0; i < count; i++){
+            [lineString addPoint:[self pointOfCoordinate:_clipped[i] withPoints:points andHasZ:hasZ andHasM:hasM]];
+        }
+        [parts addObject:lineString];
+    }
+}
+
+/**
+ * Clip the polygon or triangle
+ *
+ * @param surface
+ *            polygon or triangle
+ * @return surface copy when entirely within the bounds, clipped polygon, or
+ *         nil when the exterior ring is clipped away
+ */
+-(SFPolygon *) clipSurface: (SFPolygon *) surface{
+    
+    NSArray<SFLineString *> *rings = [surface lineStrings];
+    if(rings.count == 0){
+        return nil;
+    }
+    
+    NSArray<SFPoint *> *exteriorPoints = [rings objectAtIndex:0].points;
+    int exteriorCount = [self loadPoints:exteriorPoints];
+    switch(SFClipPositionOf(_coordinates, exteriorCount, _minX, _minY, _maxX, _maxY)){
+        case SF_CLIP_INSIDE:
+            return [surface mutableCopy];
+        case SF_CLIP_OUTSIDE:
+            return nil;
+        default:
+            break;
+    }
+    
+    SFPolygon *polygon = nil;
+    
+    for(int r = 0; r < rings.count; r++){
+        
+        NSArray<SFPoint *> *points = r == 0 ? exteriorPoints : [rings objectAtIndex:r].points;
+        int count = [self loadPoints:points];
+        if(count == 0){
+            continue;
+        }
+        
+        // Remove the explicit closing coordinate while clipping
+        BOOL closed = count > 1 && _coordinates[0].x == _coordinates[count - 1].x && _coordinates[0].y == _coordinates[count - 1].y;
+        if(closed){
+            count--;
+        }
+        
+        count = SFClipRing(_coordinates, count, _scratch, NO, _minX, 1.0);
+        [self ensureCapacity:count * 2];
+        count = SFClipRing(_scratch, count, _clipped, NO, _maxX, -1.0);
+        [self ensureCapacity:count * 2];
+        count = SFClipRing(_clipped, count, _scratch, YES, _minY, 1.0);
+        [self ensureCapacity:count * 2];
+        count = SFClipRing(_scratch, count, _clipped, YES, _maxY, -1.0);
+        count = SFClipRemoveRepeated(_clipped, count);
+        
+        if(count < 3 || SFClipRingArea(_clipped, count) == 0.0){
+            if(r == 0){
+                break;
+            }
+            continue;
+        }
+        
+        SFLineString *ring = [[SFLineString alloc] initWithHasZ:surface.hasZ andHasM:surface.hasM];
+        for(int i = 0; i < count; i++){
+            [ring addPoint:[self pointOfCoordinate:_clipped[i] withPoints:points andHasZ:surface.hasZ andHasM:surface.hasM]];
+        }
+        if(closed){
+            [ring addPoint:[self pointOfCoordinate:_clipped[0] withPoints:points andHasZ:surface.hasZ andHasM:surface.hasM]];
+        }
+        
+        if(polygon == nil){
+            polygon = [[SFPolygon alloc] initWithHasZ:surface.hasZ andHasM:surface.hasM];
+        }
+        [polygon addRing:ring];
+    }
+    
+    return polygon;
+}
+
+/**
+ * Load the points into the coordinate buffer, ensuring clip capacity
+ *
+ * @param points
+ *            points
+ * @return number of loaded coordinates
+ */
+-(int) loadPoints: (NSArray<SFPoint *> *) points{
+    int count = (int)points.count;
+    [self ensureCapacity:count * 2];
+    int i = 0;
+    for(SFPoint *point in points){
+        SFClipCoordinate coordinate;
+        coordinate.x = [point.x doubleValue];
+        coordinate.y = [point.y doubleValue];
+        coordinate.z = point.z != nil ? [point.z doubleValue] : NAN;
+        coordinate.m = point.m != nil ? [point.m doubleValue] : NAN;
+        coordinate.index = i;
+        _coordinates[i++] = coordinate;
+    }
+    return count;
+}
+
+/**
+ * Ensure the coordinate buffers have at least the capacity, retaining the
+ * current buffer values
+ *
+ * @param capacity
+ *            minimum capacity
+ */
+-(void) ensureCapacity: (int) capacity{
+    if(capacity > _capacity){
+        int updated = MAX(capacity, MAX(_capacity * 2, 64));
+        _coordinates = realloc(_coordinates, sizeof(SFClipCoordinate) * updated);
+        _scratch = realloc(_scratch, sizeof(SFClipCoordinate) * updated);
+        _clipped = realloc(_clipped, sizeof(SFClipCoordinate) * updated);
+        _capacity = updated;
+    }
+}
+
+/**
+ * Create a point for the clipped coordinate, copying the source point when
+ * not interpolated
+ *
+ * @param coordinate
+ *            clipped coordinate
+ * @param points
+ *            source points
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ * @return point
+ */
+-(SFPoint *) pointOfCoordinate: (SFClipCoordinate) coordinate withPoints: (NSArray<SFPoint *> *) points andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    SFPoint *point = nil;
+    if(coordinate.index >= 0){
+        point = [[points objectAtIndex:coordinate.index] mutableCopy];
+    }else{
+        point = [[SFPoint alloc] initWithHasZ:hasZ andHasM:hasM andXValue:coordinate.x andYValue:coordinate.y];
+        if(hasZ && !isnan(coordinate.z)){
+            [point setZValue:coordinate.z];
+        }
+        if(hasM && !isnan(coordinate.m)){
+            [point setMValue:coordinate.m];
+        }
+    }
+    return point;
+}
+
+@end
@@ -0,0 +1,137 @@
+//
+//  SFEncodedPolyline.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFLineString.h"
+
+/**
+ * Default encoded polyline precision, in decimal digits
+ */
+extern int const SF_POLYLINE_DEFAULT_PRECISION;
+
+/**
+ * Encoded polyline codec. Line string y (latitude) and x (longitude) values
+ * are rounded to the precision, delta encoded, zigzag encoded, and written
+ * as 5 bit little endian chunks offset into printable ASCII. Strings are
+ * decoded directly from their ASCII bytes, without a per character string
+ * loop, and batch decoding reuses one coordinate buffer across strings.
+ *
+ * https://developers.google.com/maps/documentation/utilities/polylinealgorithm
+ */
+@interface SFEncodedPolyline : NSObject
+
+/**
+ * Encode the line string with the default precision
+ *
+ * @param lineString
+ *            line string
+ * @return encoded polyline
+ */
++(NSString *) encodeLineString: (SFLineString *) lineString;
+
+/**
+ * Encode the line string
+ *
+ * @param lineString
+ *            line string
+ * @param precision
+ *            decimal digits, 0 through 10
+ * @return encoded polyline
+ */
++(NSString *) encodeLineString: (SFLineString *) lineString withPrecision: (int) precision;
+
+/**
+ * Encode the line strings with the default precision
+ *
+ * @param lineStrings
+ *            line strings
+ * @return encoded polylines
+ */
++(NSArray<NSString *> *) encodeLineStrings: (NSArray<SFLineString *> *) lineStrings;
+
+/**
+ * Encode the line strings
+ *
+ * @param lineStrings
+ *            line strings
+ * @param precision
+ *            decimal digits, 0 through 10
+ * @return encoded polylines
+ */
++(NSArray<NSString *> *) encodeLineStrings: (NSArray<SFLineString *> *) lineStrings withPrecision: (int) precision;
+
+/**
+ * Decode the encoded polyline with the default precision
+ *
+ * @param polyline
+ *            encoded polyline
+ * @return line string
+ */
++(SFLineString *) decodeLineString: (NSString *) polyline;
+
+/**
+ * Decode the encoded polyline
+ *
+ * @param polyline
+ *            encoded polyline
+ * @param precision
+ *            decimal digits, 0 through 10
+ * @return line string
+ */
++(SFLineString *) decodeLineString: (NSString *) polyline withPrecision: (int) precision;
+
+/**
+ * Decode the encoded polyline bytes
+ *
+ * @param bytes
+ *            ASCII bytes
+ * @param length
+ *            byte length
+ * @param precision
+ *            decimal digits, 0 through 10
+ * @return line string
+ */
++(SFLineString *) decodeLineStringWithBytes: (const char *) bytes andLength: (size_t) length andPrecision: (int) precision;
+
+/**
+ * Decode the encoded polylines with the default precision
+ *
+ * @param polylines
+ *            encoded polylines
+ * @return line strings
+ */
++(NSArray<SFLineString *> *) decodeLineStrings: (NSArray<NSString *> *) polylines;
+
+/**
+ * Decode the encoded polylines
+ *
+ * @param polylines
+ *            encoded polylines
+ * @param precision
+ *            decimal digits, 0 through 10
+ * @return line strings
+ */
++(NSArray<SFLineString *> *) decodeLineStrings: (NSArray<NSString *> *) polylines withPrecision: (int) precision;
+
+/**
+ * Decode the encoded polyline bytes into x and y coordinates, without
+ * creating geometries
+ *
+ * @param coordinates
+ *            interleaved x and y values, with capacity for length / 2 points
+ * @param bytes
+ *            ASCII bytes
+ * @param length
+ *            byte length
+ * @param precision
+ *            decimal digits, 0 through 10
+ * @return number of points, -1 when the bytes are not a valid polyline
+ */
++(int) decodeCoordinates: (double *) coordinates withBytes: (const char *) bytes andLength: (size_t) length andPrecision: (int) precision;
+
+@end
@@ -0,0 +1,291 @@
+//
+//  SFEncodedPolyline.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFEncodedPolyline.h"
+
+int const SF_POLYLINE_DEFAULT_PRECISION = 5;
+
+/**
+ * Max precision, in decimal digits
+ */
+#define SF_POLYLINE_MAX_PRECISION 10
+
+/**
+ * Max encoded bytes per value, for a 64 bit zigzag value in 5 bit chunks
+ */
+#define SF_POLYLINE_MAX_VALUE_BYTES 13
+
+/**
+ * Number of bytes or values buffered on the stack before falling back to
+ * the heap
+ */
+#define SF_POLYLINE_BUFFER_SIZE 512
+
+/**
+ * Powers of ten of the precisions
+ */
+static const double SF_POLYLINE_FACTORS[SF_POLYLINE_MAX_PRECISION + 1] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10};
+
+/**
+ * Write a zigzag encoded value as 5 bit chunks, low chunk first, with a
+ * continuation bit on all but the last chunk and offset by 63
+ *
+ * @param bytes
+ *            bytes with capacity for the max value bytes
+ * @param value
+ *            signed value
+ * @return number of bytes written
+ */
+static int SFPolylineWriteValue(char *bytes, int64_t value){
+    uint64_t zigzag = (uint64_t) value << 1;
+    if(value < 0){
+        zigzag = ~zigzag;
+    }
+    int count = 0;
+    while(zigzag >= 0x20){
+        bytes[count++] = (char) ((0x20 | (zigzag & 0x1F)) + 63);
+        zigzag >>= 5;
+    }
+    bytes[count++] = (char) (zigzag + 63);
+    return count;
+}
+
+/**
+ * Decode the polyline bytes into x and y coordinates. Single byte values,
+ * most deltas at the default precision, are read without the chunk loop.
+ *
+ * @param bytes
+ *            ASCII bytes
+ * @param length
+ *            byte length
+ * @param factor
+ *            precision power of ten
+ * @param coordinates
+ *            interleaved x and y values, with capacity for length / 2 points
+ * @return number of points, -1 when invalid
+ */
+static int SFPolylineDecode(const uint8_t *bytes, size_t length, double factor, double *coordinates){
+    
+    int64_t values[2] = {0, 0};
+    size_t offset = 0;
+    int count = 0;
+    int dimension = 0;
+    
+    while(offset < length){
+        
+        uint64_t zigzag = 0;
+        int shift = 0;
+        uint32_t chunk = (uint32_t) bytes[offset++] - 63;
+        if(chunk < 0x20){
+            zigzag = chunk;
+        }else{
+            while(chunk >= 0x20 && chunk < 0x40 && shift < 60 && offset < length){
+                zigzag |= (uint64_t) (chunk & 0x1F) << shift;
+                shift += 5;
+                chunk = (uint32_t) bytes[offset++] - 63;
+            }
+            if(chunk >= 0x20 || (shift == 60 && chunk > 0xF)){
+                return -1;
+            }
+            zigzag |= (uint64_t) chunk << shift;
+        }
+        
+        int64_t delta = (int64_t) (zigzag >> 1) ^ -(int64_t) (zigzag & 1);
+        values[dimension] = (int64_t) ((uint64_t) values[dimension] + (uint64_t) delta);
+        
+        if(dimension == 1){
+            coordinates[2 * count] = values[1] / factor;
+            coordinates[2 * count + 1] = values[0] / factor;
+            count++;
+        }
+        dimension ^= 1;
+    }
+    
+    return dimension == 0 ? count : -1;
+}
+
+@implementation SFEncodedPolyline
+
++(NSString *) encodeLineString: (SFLineString *) lineString{
+    return [self encodeLineString:lineString withPrecision:SF_POLYLINE_DEFAULT_PRECISION];
+}
+
++(NSString *) encodeLineString: (SFLineString *) lineString withPrecision: (int) precision{
+    
+    double factor = [self factorOfPrecision:precision];
+    
+    NSArray<SFPoint *> *points = lineString.points;
+    size_t capacity = 2 * SF_POLYLINE_MAX_VALUE_BYTES * points.count;
+    char stackBytes[SF_POLYLINE_BUFFER_SIZE];
+    char *bytes = capacity <= SF_POLYLINE_BUFFER_SIZE ? stackBytes : malloc(capacity);
+    
+    size_t length = 0;
+    int64_t previous[2] = {0, 0};
+    BOOL valid = YES;
+    for(SFPoint *point in points){
+        double values[2] = {[point.y doubleValue] * factor, [point.x doubleValue] * factor};
+        for(int i = 0; i < 2; i++){
+            valid = fabs(values[i]) < 0x1p62;
+            if(!valid){
+                break;
+            }
+            int64_t value = llround(values[i]);
+            length += SFPolylineWriteValue(bytes + length, value - previous[i]);
+            previous[i] = value;
+        }
+        if(!valid){
+            break;
+        }
+    }
+    
+    NSString *polyline = nil;
+    if(valid){
+        polyline = [[NSString alloc] initWithBytes:bytes length:length encoding:NSASCIIStringEncoding];
+    }
+    
+    if(bytes != stackBytes){
+        free(bytes);
+    }
+    
+    if(!valid){
+        [NSException raise:@"Invalid Coordinate" format:@"Encoded polyline coordinates must be finite and within range, line string: %@", lineString];
+    }
+    
+    return polyline;
+}
+
++(NSArray<NSString *> *) encodeLineStrings: (NSArray<SFLineString *> *) lineStrings{
+    return [self encodeLineStrings:lineStrings withPrecision:SF_POLYLINE_DEFAULT_PRECISION];
+}
+
++(NSArray<NSString *> *) encodeLineStrings: (NSArray<SFLineString *> *) lineStrings withPrecision: (int) precision{
+    NSMutableArray<NSString *> *polylines = [NSMutableArray arrayWithCapacity:lineStrings.count];
+    for(SFLineString *lineString in lineStrings){
+        [polylines addObject:[self encodeLineString:lineString withPrecision:precision]];
+    }
+    return polylines;
+}
+
++(SFLineString *) decodeLineString: (NSString *) polyline{
+    return [self decodeLineString:polyline withPrecision:SF_POLYLINE_DEFAULT_PRECISION];
+}
+
++(SFLineString *) decodeLineString: (NSString *) polyline withPrecision: (int) precision{
+    return [[self decodeLineStrings:@[polyline] withPrecision:precision] firstObject];
+}
+
++(SFLineString *) decodeLineStringWithBytes: (const char *) bytes andLength: (size_t) length andPrecision: (int) precision{
+    double factor = [self factorOfPrecision:precision];
+    double stackCoordinates[SF_POLYLINE_BUFFER_SIZE];
+    double *coordinates = length <= SF_POLYLINE_BUFFER_SIZE ? stackCoordinates : malloc(sizeof(double) * length);
+    int count = SFPolylineDecode((const uint8_t *) bytes, length, factor, coordinates);
+    SFLineString *lineString = count >= 0 ? [self lineStringWithCoordinates:coordinates andCount:count] : nil;
+    if(coordinates != stackCoordinates){
+        free(coordinates);
+    }
+    if(lineString == nil){
+        [self raiseInvalidWithBytes:bytes andLength:length];
+    }
+    return lineString;
+}
+
++(NSArray<SFLineString *> *) decodeLineStrings: (NSArray<NSString *> *) polylines{
+    return [self decodeLineStrings:polylines withPrecision:SF_POLYLINE_DEFAULT_PRECISION];
+}
+
++(NSArray<SFLineString *> *) decodeLineStrings: (NSArray<NSString *> *) polylines withPrecision: (int) precision{
+    
+    double factor = [self factorOfPrecision:precision];
+    
+    NSMutableArray<SFLineString *> *lineStrings = [NSMutableArray arrayWithCapacity:polylines.count];
+    char *bytes = NULL;
+    double *coordinates = NULL;
+    size_t capacity = 0;
+    
+    @try {
+        for(NSString *polyline in polylines){
+            
+            size_t length = CFStringGetLength((__bridge CFStringRef) polyline);
+            if(length > capacity){
+                capacity = MAX(length, 2 * capacity);
+                bytes = realloc(bytes, capacity);
+                coordinates = realloc(coordinates, sizeof(double) * capacity);
+            }
+            
+            const char *ascii = CFStringGetCStringPtr((__bridge CFStringRef) polyline, kCFStringEncodingASCII);
+            if(ascii == NULL){
+                CFIndex used = 0;
+                CFIndex converted = CFStringGetBytes((__bridge CFStringRef) polyline, CFRangeMake(0, length), kCFStringEncodingASCII, 0, false, (UInt8 *) bytes, length, &used);
+                if(converted != length){
+                    [NSException raise:@"Invalid Polyline" format:@"Encoded polyline contains non ASCII characters: %@", polyline];
+                }
+                ascii = bytes;
+            }
+            
+            int count = SFPolylineDecode((const uint8_t *) ascii, length, factor, coordinates);
+            if(count < 0){
+                [self raiseInvalidWithBytes:ascii andLength:length];
+            }
+            [lineStrings addObject:[self lineStringWithCoordinates:coordinates andCount:count]];
+        }
+    } @finally {
+        free(bytes);
+        free(coordinates);
+    }
+    
+    return lineStrings;
+}
+
++(int) decodeCoordinates: (double *) coordinates withBytes: (const char *) bytes andLength: (size_t) length andPrecision: (int) precision{
+    return SFPolylineDecode((const uint8_t *) bytes, length, [self factorOfPrecision:precision], coordinates);
+}
+
+/**
+ * Get the power of ten of the precision
+ *
+ * @param precision
+ *            decimal digits
+ * @return factor
+ */
++(double) factorOfPrecision: (int) precision{
+    if(precision < 0 || precision > SF_POLYLINE_MAX_PRECISION){
+        [NSException raise:@"Invalid Precision" format:@"Encoded polyline precision must be between 0 and %d: %d", SF_POLYLINE_MAX_PRECISION, precision];
+    }
+    return SF_POLYLINE_FACTORS[precision];
+}
+
+/**
+ * Create a line string from x and y coordinates
+ *
+ * @param coordinates
+ *            interleaved x and y values
+ * @param count
+ *            number of points
+ * @return line string
+ */
++(SFLineString *) lineStringWithCoordinates: (const double *) coordinates andCount: (int) count{
+    NSMutableArray<SFPoint *> *points = [NSMutableArray arrayWithCapacity:count];
+    for(int i = 0; i < count; i++){
+        [points addObject:[[SFPoint alloc] initWithXValue:coordinates[2 * i] andYValue:coordinates[2 * i + 1]]];
+    }
+    return [[SFLineString alloc] initWithPoints:points];
+}
+
+/**
+ * Raise an invalid polyline exception
+ *
+ * @param bytes
+ *            polyline bytes
+ * @param length
+ *            byte length
+ */
++(void) raiseInvalidWithBytes: (const char *) bytes andLength: (size_t) length{
+    [NSException raise:@"Invalid Polyline" format:@"Invalid encoded polyline: %.*s", (int) MIN(length, 64), bytes];
+}
+
+@end
@@ -0,0 +1,123 @@
+//
+//  SFGeohash.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFPoint.h"
+#import "SFGeometryEnvelope.h"
+
+/**
+ * Max geohash length, 60 bits of interleaved longitude and latitude
+ */
+extern int const SF_GEOHASH_MAX_LENGTH;
+
+/**
+ * Geohash codec. Longitude and latitude are quantized to 32 bit cells and
+ * their bits interleaved in a single step, longitude first, then written
+ * 5 bits per character through a base32 alphabet table. Decoding maps
+ * characters through a 256 entry table and deinterleaves the bits into the
+ * cell bounds. Upper case characters are accepted when decoding.
+ *
+ * http://geohash.org
+ */
+@interface SFGeohash : NSObject
+
+/**
+ * Encode the point
+ *
+ * @param point
+ *            point with x longitude and y latitude
+ * @param length
+ *            geohash length, 1 through the max length
+ * @return geohash
+ */
++(NSString *) encodePoint: (SFPoint *) point withLength: (int) length;
+
+/**
+ * Encode the longitude and latitude
+ *
+ * @param longitude
+ *            longitude
+ * @param latitude
+ *            latitude
+ * @param length
+ *            geohash length, 1 through the max length
+ * @return geohash
+ */
++(NSString *) encodeLongitude: (double) longitude andLatitude: (double) latitude withLength: (int) length;
+
+/**
+ * Encode the points
+ *
+ * @param points
+ *            points with x longitude and y latitude
+ * @param length
+ *            geohash length, 1 through the max length
+ * @return geohashes
+ */
++(NSArray<NSString *> *) encodePoints: (NSArray<SFPoint *> *) points withLength: (int) length;
+
+/**
+ * Encode the envelope as the longest geohash whose cell contains it
+ *
+ * @param envelope
+ *            envelope with x longitude and y latitude
+ * @return geohash, empty when no cell contains the envelope
+ */
++(NSString *) encodeEnvelope: (SFGeometryEnvelope *) envelope;
+
+/**
+ * Decode the geohash cell center
+ *
+ * @param geohash
+ *            geohash
+ * @return point with x longitude and y latitude
+ */
++(SFPoint *) decodePoint: (NSString *) geohash;
+
+/**
+ * Decode the geohash cell
+ *
+ * @param geohash
+ *            geohash
+ * @return envelope with x longitude and y latitude
+ */
++(SFGeometryEnvelope *) decodeEnvelope: (NSString *) geohash;
+
+/**
+ * Decode the geohash cell centers
+ *
+ * @param geohashes
+ *            geohashes
+ * @return points with x longitude and y latitude
+ */
++(NSArray<SFPoint *> *) decodePoints: (NSArray<NSString *> *) geohashes;
+
+/**
+ * Decode the geohash cells
+ *
+ * @param geohashes
+ *            geohashes
+ * @return envelopes with x longitude and y latitude
+ */
++(NSArray<SFGeometryEnvelope *> *) decodeEnvelopes: (NSArray<NSString *> *) geohashes;
+
+/**
+ * Decode the geohash bytes into cell bounds, without creating geometries
+ *
+ * @param bounds
+ *            bounds with capacity for min longitude, min latitude, max
+ *            longitude, and max latitude
+ * @param bytes
+ *            ASCII bytes
+ * @param length
+ *            byte length
+ * @return true if decoded, false when the bytes are not a valid geohash
+ */
++(BOOL) decodeBounds: (double *) bounds withBytes: (const char *) bytes andLength: (size_t) length;
+
+@end
@@ -0,0 +1,301 @@
+//
+//  SFGeohash.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFGeohash.h"
+
+int const SF_GEOHASH_MAX_LENGTH = 12;
+
+/**
+ * Base32 alphabet of the character values
+ */
+static const char SF_GEOHASH_ALPHABET[33] = "0123456789bcdefghjkmnpqrstuvwxyz";
+
+/**
+ * Character values of the bytes, -1 for bytes outside of the alphabet
+ */
+static const int8_t SF_GEOHASH_VALUES[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, -1, -1, -1, -1, -1, -1,
+    -1, -1, 10, 11, 12, 13, 14, 15, 16, -1, 17, 18, -1, 19, 20, -1,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, -1, -1, -1, -1, -1,
+    -1, -1, 10, 11, 12, 13, 14, 15, 16, -1, 17, 18, -1, 19, 20, -1,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+/**
+ * Spread the 32 bits of the value into the even bits
+ *
+ * @param value
+ *            32 bit value
+ * @return 64 bit spread value
+ */
+static uint64_t SFGeohashSpread(uint32_t value){
+    uint64_t spread = value;
+    spread = (spread | (spread << 16)) & 0x0000FFFF0000FFFFULL;
+    spread = (spread | (spread << 8)) & 0x00FF00FF00FF00FFULL;
+    spread = (spread | (spread << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    spread = (spread | (spread << 2)) & 0x3333333333333333ULL;
+    spread = (spread | (spread << 1)) & 0x5555555555555555ULL;
+    return spread;
+}
+
+/**
+ * Compact the even bits of the value into 32 bits
+ *
+ * @param value
+ *            64 bit value
+ * @return 32 bit compacted value
+ */
+static uint32_t SFGeohashCompact(uint64_t value){
+    value &= 0x5555555555555555ULL;
+    value = (value | (value >> 1)) & 0x3333333333333333ULL;
+    value = (value | (value >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+    value = (value | (value >> 4)) & 0x00FF00FF00FF00FFULL;
+    value = (value | (value >> 8)) & 0x0000FFFF0000FFFFULL;
+    value = (value | (value >> 16)) & 0x00000000FFFFFFFFULL;
+    return (uint32_t) value;
+}
+
+/**
+ * Quantize the value to a 32 bit cell of the range
+ *
+ * @param value
+ *            value within the range
+ * @param min
+ *            range min
+ * @param range
+ *            range width
+ * @return cell
+ */
+static uint32_t SFGeohashQuantize(double value, double min, double range){
+    double cell = ldexp((value - min) / range, 32);
+    return cell <= 0 ? 0 : cell >= UINT32_MAX ? UINT32_MAX : (uint32_t) cell;
+}
+
+/**
+ * Quantize the inclusive upper value to a 32 bit cell of the range, the cell
+ * below when on a cell boundary above the lower cell
+ *
+ * @param value
+ *            value within the range
+ * @param min
+ *            range min
+ * @param range
+ *            range width
+ * @param lower
+ *            lower value cell
+ * @return cell
+ */
+static uint32_t SFGeohashQuantizeUpper(double value, double min, double range, uint32_t lower){
+    double cell = ceil(ldexp((value - min) / range, 32)) - 1.0;
+    return cell <= lower ? lower : cell >= UINT32_MAX ? UINT32_MAX : (uint32_t) cell;
+}
+
+/**
+ * Interleave the longitude and latitude cells, with the longitude bits in
+ * the odd positions starting at the high bit
+ *
+ * @param x
+ *            longitude cell
+ * @param y
+ *            latitude cell
+ * @return code
+ */
+static uint64_t SFGeohashInterleave(uint32_t x, uint32_t y){
+    return (SFGeohashSpread(x) << 1) | SFGeohashSpread(y);
+}
+
+/**
+ * Write the high bits of the code as geohash characters
+ *
+ * @param bytes
+ *            bytes with capacity for the length
+ * @param code
+ *            code
+ * @param length
+ *            number of characters, up to the max length
+ */
+static void SFGeohashWrite(char *bytes, uint64_t code, int length){
+    for(int i = 0; i < length; i++){
+        bytes[i] = SF_GEOHASH_ALPHABET[(code >> (59 - 5 * i)) & 0x1F];
+    }
+}
+
+/**
+ * Decode the geohash bytes into cell bounds
+ *
+ * @param bytes
+ *            bytes
+ * @param length
+ *            byte length
+ * @param bounds
+ *            min longitude, min latitude, max longitude, and max latitude
+ * @return false when invalid
+ */
+static BOOL SFGeohashDecode(const uint8_t *bytes, size_t length, double *bounds){
+    
+    if(length == 0 || length > SF_GEOHASH_MAX_LENGTH){
+        return NO;
+    }
+    
+    uint64_t code = 0;
+    int8_t invalid = 0;
+    for(size_t i = 0; i < length; i++){
+        int8_t value = SF_GEOHASH_VALUES[bytes[i]];
+        invalid |= value;
+        code = (code << 5) | (uint8_t) value;
+    }
+    if(invalid < 0){
+        return NO;
+    }
+    
+    int bits = 5 * (int) length;
+    code <<= 64 - bits;
+    
+    double width = ldexp(360.0, -((bits + 1) / 2));
+    double height = ldexp(180.0, -(bits / 2));
+    bounds[0] = ldexp(SFGeohashCompact(code >> 1) * 360.0, -32) - 180.0;
+    bounds[1] = ldexp(SFGeohashCompact(code) * 180.0, -32) - 90.0;
+    bounds[2] = bounds[0] + width;
+    bounds[3] = bounds[1] + height;
+    
+    return YES;
+}
+
+@implementation SFGeohash
+
++(NSString *) encodePoint: (SFPoint *) point withLength: (int) length{
+    return [self encodeLongitude:[point.x doubleValue] andLatitude:[point.y doubleValue] withLength:length];
+}
+
++(NSString *) encodeLongitude: (double) longitude andLatitude: (double) latitude withLength: (int) length{
+    if(length < 1 || length > SF_GEOHASH_MAX_LENGTH){
+        [NSException raise:@"Invalid Length" format:@"Geohash length must be between 1 and %d: %d", SF_GEOHASH_MAX_LENGTH, length];
+    }
+    char bytes[SF_GEOHASH_MAX_LENGTH];
+    SFGeohashWrite(bytes, [self codeOfLongitude:longitude andLatitude:latitude], length);
+    return [[NSString alloc] initWithBytes:bytes length:length encoding:NSASCIIStringEncoding];
+}
+
++(NSArray<NSString *> *) encodePoints: (NSArray<SFPoint *> *) points withLength: (int) length{
+    NSMutableArray<NSString *> *geohashes = [NSMutableArray arrayWithCapacity:points.count];
+    for(SFPoint *point in points){
+        [geohashes addObject:[self encodePoint:point withLength:length]];
+    }
+    return geohashes;
+}
+
++(NSString *) encodeEnvelope: (SFGeometryEnvelope *) envelope{
+    double minX = [envelope.minX doubleValue];
+    double minY = [envelope.minY doubleValue];
+    double maxX = [envelope.maxX doubleValue];
+    double maxY = [envelope.maxY doubleValue];
+    [self validateLongitude:minX andLatitude:minY];
+    [self validateLongitude:maxX andLatitude:maxY];
+    uint32_t minCellX = SFGeohashQuantize(minX, -180.0, 360.0);
+    uint32_t minCellY = SFGeohashQuantize(minY, -90.0, 180.0);
+    uint64_t min = SFGeohashInterleave(minCellX, minCellY);
+    uint64_t max = SFGeohashInterleave(SFGeohashQuantizeUpper(maxX, -180.0, 360.0, minCellX), SFGeohashQuantizeUpper(maxY, -90.0, 180.0, minCellY));
+    int common = min == max ? 64 : __builtin_clzll(min ^ max);
+    int length = MIN(common / 5, SF_GEOHASH_MAX_LENGTH);
+    char bytes[SF_GEOHASH_MAX_LENGTH];
+    SFGeohashWrite(bytes, min, length);
+    return [[NSString alloc] initWithBytes:bytes length:length encoding:NSASCIIStringEncoding];
+}
+
++(SFPoint *) decodePoint: (NSString *) geohash{
+    double bounds[4];
+    [self decodeBounds:bounds withGeohash:geohash];
+    return [[SFPoint alloc] initWithXValue:(bounds[0] + bounds[2]) / 2.0 andYValue:(bounds[1] + bounds[3]) / 2.0];
+}
+
++(SFGeometryEnvelope *) decodeEnvelope: (NSString *) geohash{
+    double bounds[4];
+    [self decodeBounds:bounds withGeohash:geohash];
+    return [[SFGeometryEnvelope alloc] initWithMinXDouble:bounds[0] andMinYDouble:bounds[1] andMaxXDouble:bounds[2] andMaxYDouble:bounds[3]];
+}
+
++(NSArray<SFPoint *> *) decodePoints: (NSArray<NSString *> *) geohashes{
+    NSMutableArray<SFPoint *> *points = [NSMutableArray arrayWithCapacity:geohashes.count];
+    for(NSString *geohash in geohashes){
+        [points addObject:[self decodePoint:geohash]];
+    }
+    return points;
+}
+
++(NSArray<SFGeometryEnvelope *> *) decodeEnvelopes: (NSArray<NSString *> *) geohashes{
+    NSMutableArray<SFGeometryEnvelope *> *envelopes = [NSMutableArray arrayWithCapacity:geohashes.count];
+    for(NSString *geohash in geohashes){
+        [envelopes addObject:[self decodeEnvelope:geohash]];
+    }
+    return envelopes;
+}
+
++(BOOL) decodeBounds: (double *) bounds withBytes: (const char *) bytes andLength: (size_t) length{
+    return SFGeohashDecode((const uint8_t *) bytes, length, bounds);
+}
+
+/**
+ * Get the interleaved code of the longitude and latitude
+ *
+ * @param longitude
+ *            longitude
+ * @param latitude
+ *            latitude
+ * @return code
+ */
++(uint64_t) codeOfLongitude: (double) longitude andLatitude: (double) latitude{
+    [self validateLongitude:longitude andLatitude:latitude];
+    return SFGeohashInterleave(SFGeohashQuantize(longitude, -180.0, 360.0), SFGeohashQuantize(latitude, -90.0, 180.0));
+}
+
+/**
+ * Validate the longitude and latitude are within range
+ *
+ * @param longitude
+ *            longitude
+ * @param latitude
+ *            latitude
+ */
++(void) validateLongitude: (double) longitude andLatitude: (double) latitude{
+    if(!(longitude >= -180.0 && longitude <= 180.0 && latitude >= -90.0 && latitude <= 90.0)){
+        [NSException raise:@"Invalid Coordinate" format:@"Geohash longitude must be between -180 and 180 and latitude between -90 and 90, longitude: %f, latitude: %f", longitude, latitude];
+    }
+}
+
+/**
+ * Decode the geohash string into cell bounds, reading the characters into a
+ * stack buffer
+ *
+ * @param bounds
+ *            min longitude, min latitude, max longitude, and max latitude
+ * @param geohash
+ *            geohash
+ */
++(void) decodeBounds: (double *) bounds withGeohash: (NSString *) geohash{
+    CFIndex length = CFStringGetLength((__bridge CFStringRef) geohash);
+    uint8_t bytes[SF_GEOHASH_MAX_LENGTH];
+    BOOL valid = length <= SF_GEOHASH_MAX_LENGTH
+        && CFStringGetBytes((__bridge CFStringRef) geohash, CFRangeMake(0, length), kCFStringEncodingASCII, 0, false, bytes, SF_GEOHASH_MAX_LENGTH, NULL) == length
+        && SFGeohashDecode(bytes, length, bounds);
+    if(!valid){
+        [NSException raise:@"Invalid Geohash" format:@"Invalid geohash: %@", geohash];
+    }
+}
+
+@end
@@ -0,0 +1,77 @@
+//
+//  SFPointGridFilter.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometryFilter.h"
+
+/**
+ * Point filter for snapping x and y properties to a fixed grid, optionally
+ * snapping z and m properties. As a geometry filter, points are snapped in
+ * place and always pass. Whole geometries can be snapped with collapsed
+ * vertices and degenerate components removed.
+ */
+@interface SFPointGridFilter : NSObject<SFGeometryFilter>
+
+/**
+ * Grid cell size, such as 0.0000001 degrees or 1 tile unit
+ */
+@property (nonatomic) double gridSize;
+
+/**
+ * Include z values in snapping
+ */
+@property (nonatomic) BOOL snapZ;
+
+/**
+ * Include m values in snapping
+ */
+@property (nonatomic) BOOL snapM;
+
+/**
+ *  Initialize, snap x and y
+ *
+ *  @param gridSize grid cell size
+ *
+ *  @return new point grid filter
+ */
+-(instancetype) initWithGridSize: (double) gridSize;
+
+/**
+ *  Initialize, snap x, y, and optionally z and m
+ *
+ *  @param gridSize grid cell size
+ *  @param snapZ snap z values mode
+ *  @param snapM snap m values mode
+ *
+ *  @return new point grid filter
+ */
+-(instancetype) initWithGridSize: (double) gridSize andZ: (BOOL) snapZ andM: (BOOL) snapM;
+
+/**
+ * Snap the value to the grid
+ *
+ * @param value
+ *            value
+ * @return snapped value
+ */
+-(double) snapValue: (double) value;
+
+/**
+ * Snap the geometry to the grid in place. Repeated vertices are removed,
+ * line strings with fewer than two distinct points and rings with fewer
+ * than four points or zero area are removed, polygons with a removed
+ * exterior ring are emptied, and emptied members are removed from
+ * collections and surfaces. Circular string control points are snapped
+ * without vertex removal. A geometry that collapses entirely is left empty.
+ *
+ * @param geometry
+ *            geometry
+ */
+-(void) snapGeometry: (SFGeometry *) geometry;
+
+@end
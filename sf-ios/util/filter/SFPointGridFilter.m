@@ -0,0 +1,320 @@
+//
+//  SFPointGridFilter.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFPointGridFilter.h"
+#import "SFPoint.h"
+#import "SFGeometryPredicates.h"
+#import "SFCircularString.h"
+#import "SFCompoundCurve.h"
+#import "SFCurvePolygon.h"
+#import "SFPolyhedralSurface.h"
+#import "SFGeometryCollection.h"
+
+/**
+ * Number of points buffered on the stack before falling back to the heap
+ */
+#define SF_GRID_BUFFER_SIZE 256
+
+/**
+ * Snap the value to the grid
+ *
+ * @param value
+ *            value
+ * @param gridSize
+ *            grid cell size
+ * @param scale
+ *            integral inverse of the grid size, 0 when not integral
+ * @return snapped value
+ */
+static double SFGridSnap(double value, double gridSize, double scale){
+    // Dividing by an integral scale rounds to the closest double of decimal grids such as 0.0000001
+    return scale > 0.0 ? round(value * scale) / scale : round(value / gridSize) * gridSize;
+}
+
+/**
+ * Determine if all coordinates are collinear, including when all are equal
+ *
+ * @param x
+ *            x values
+ * @param y
+ *            y values
+ * @param count
+ *            number of coordinates
+ * @return true if collinear
+ */
+static BOOL SFGridCollinear(const double *x, const double *y, int count){
+    int second = 1;
+    while(second < count && x[second] == x[0] && y[second] == y[0]){
+        second++;
+    }
+    for(int i = second + 1; i < count; i++){
+        if([SFGeometryPredicates orientationWithX1:x[0] andY1:y[0] andX2:x[second] andY2:y[second] andX3:x[i] andY3:y[i]] != 0.0){
+            return NO;
+        }
+    }
+    return YES;
+}
+
+@interface SFPointGridFilter()
+
+/**
+ * Integral inverse of the grid size, 0 when not integral
+ */
+@property (nonatomic) double scale;
+
+@end
+
+@implementation SFPointGridFilter
+
+-(instancetype) initWithGridSize: (double) gridSize{
+    self = [self initWithGridSize:gridSize andZ:NO andM:NO];
+    return self;
+}
+
+-(instancetype) initWithGridSize: (double) gridSize andZ: (BOOL) snapZ andM: (BOOL) snapM{
+    self = [super init];
+    if(self){
+        self.gridSize = gridSize;
+        _snapZ = snapZ;
+        _snapM = snapM;
+    }
+    return self;
+}
+
+-(void) setGridSize: (double) gridSize{
+    if(!(gridSize > 0.0) || !isfinite(gridSize)){
+        [NSException raise:@"Invalid Grid Size" format:@"Grid size must be greater than 0 and finite: %f", gridSize];
+    }
+    _gridSize = gridSize;
+    double inverse = 1.0 / gridSize;
+    double rounded = round(inverse);
+    _scale = rounded >= 1.0 && fabs(inverse - rounded) <= rounded * DBL_EPSILON * 4.0 ? rounded : 0.0;
+}
+
+-(BOOL) filterGeometry: (SFGeometry *) geometry inType: (enum SFGeometryType) containingType{
+    if(geometry.geometryType == SF_POINT && [geometry isKindOfClass:[SFPoint class]]){
+        [self snapPoint:(SFPoint *) geometry];
+    }
+    return YES;
+}
+
+-(double) snapValue: (double) value{
+    return SFGridSnap(value, _gridSize, _scale);
+}
+
+-(void) snapGeometry: (SFGeometry *) geometry{
+    
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch(geometryType){
+        case SF_POINT:
+            [self snapPoint:(SFPoint *) geometry];
+            break;
+        case SF_LINESTRING:
+            [self snapLineString:(SFLineString *) geometry withMinimum:2 andArea:NO];
+            break;
+        case SF_CIRCULARSTRING:
+            [self snapCircularString:(SFCircularString *) geometry];
+            break;
+        case SF_COMPOUNDCURVE:
+            [self snapCompoundCurve:(SFCompoundCurve *) geometry];
+            break;
+        case SF_POLYGON:
+        case SF_CURVEPOLYGON:
+        case SF_TRIANGLE:
+            [self snapCurvePolygon:(SFCurvePolygon *) geometry];
+            break;
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            [self snapGeometries:((SFPolyhedralSurface *) geometry).polygons];
+            break;
+        case SF_MULTIPOINT:
+        case SF_MULTILINESTRING:
+        case SF_MULTIPOLYGON:
+        case SF_MULTICURVE:
+        case SF_MULTISURFACE:
+        case SF_GEOMETRYCOLLECTION:
+            [self snapGeometries:((SFGeometryCollection *) geometry).geometries];
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for snap to grid: %@", [SFGeometryTypes name:geometryType]];
+    }
+    
+}
+
+/**
+ * Snap the point in place
+ *
+ * @param point
+ *            point
+ */
+-(void) snapPoint: (SFPoint *) point{
+    double x = [point.x doubleValue];
+    double y = [point.y doubleValue];
+    double snappedX = [self snapValue:x];
+    double snappedY = [self snapValue:y];
+    // Only replace changed values to avoid decimal number allocations
+    if(snappedX != x){
+        [point setXValue:snappedX];
+    }
+    if(snappedY != y){
+        [point setYValue:snappedY];
+    }
+    if(_snapZ && point.z != nil){
+        double z = [point.z doubleValue];
+        double snappedZ = [self snapValue:z];
+        if(snappedZ != z){
+            [point setZValue:snappedZ];
+        }
+    }
+    if(_snapM && point.m != nil){
+        double m = [point.m doubleValue];
+        double snappedM = [self snapValue:m];
+        if(snappedM != m){
+            [point setMValue:snappedM];
+        }
+    }
+}
+
+/**
+ * Snap the line string points in place, removing repeated points and
+ * clearing the points when degenerate
+ *
+ * @param lineString
+ *            line string
+ * @param minimum
+ *            minimum number of distinct points, 4 for rings
+ * @param area
+ *            true to require non zero area
+ * @return true if not degenerate
+ */
+-(BOOL) snapLineString: (SFLineString *) lineString withMinimum: (int) minimum andArea: (BOOL) area{
+    
+    NSMutableArray<SFPoint *> *points = lineString.points;
+    int count = (int) points.count;
+    if(count == 0){
+        return NO;
+    }
+    
+    double stackValues[SF_GRID_BUFFER_SIZE * 2];
+    double *values = count <= SF_GRID_BUFFER_SIZE ? stackValues : malloc(sizeof(double) * 2 * count);
+    double *x = values;
+    double *y = values + count;
+    
+    // Snap and compact the distinct coordinates, collecting repeated point indices
+    NSMutableIndexSet *repeated = [NSMutableIndexSet indexSet];
+    int distinct = 0;
+    for(int i = 0; i < count; i++){
+        SFPoint *point = [points objectAtIndex:i];
+        [self snapPoint:point];
+        double pointX = [point.x doubleValue];
+        double pointY = [point.y doubleValue];
+        if(distinct > 0 && pointX == x[distinct - 1] && pointY == y[distinct - 1]){
+            [repeated addIndex:i];
+        }else{
+            x[distinct] = pointX;
+            y[distinct] = pointY;
+            distinct++;
+        }
+    }
+    
+    BOOL valid = distinct >= minimum && (!area || !SFGridCollinear(x, y, distinct));
+    
+    if(values != stackValues){
+        free(values);
+    }
+    
+    if(!valid){
+        [points removeAllObjects];
+    }else if(repeated.count > 0){
+        [points removeObjectsAtIndexes:repeated];
+    }
+    
+    return valid;
+}
+
+/**
+ * Snap the circular string control points in place
+ *
+ * @param circularString
+ *            circular string
+ */
+-(void) snapCircularString: (SFCircularString *) circularString{
+    for(SFPoint *point in circularString.points){
+        [self snapPoint:point];
+    }
+    [circularString clearLinearization];
+}
+
+/**
+ * Snap the compound curve in place, removing degenerate line strings
+ *
+ * @param compoundCurve
+ *            compound curve
+ */
+-(void) snapCompoundCurve: (SFCompoundCurve *) compoundCurve{
+    NSMutableArray<SFLineString *> *lineStrings = compoundCurve.lineStrings;
+    NSMutableIndexSet *degenerate = [NSMutableIndexSet indexSet];
+    for(NSUInteger i = 0; i < lineStrings.count; i++){
+        SFLineString *lineString = [lineStrings objectAtIndex:i];
+        [self snapGeometry:lineString];
+        if([lineString isEmpty]){
+            [degenerate addIndex:i];
+        }
+    }
+    [lineStrings removeObjectsAtIndexes:degenerate];
+}
+
+/**
+ * Snap the polygon in place, removing degenerate holes and all rings when the
+ * exterior ring is degenerate
+ *
+ * @param curvePolygon
+ *            polygon, curve polygon, or triangle
+ */
+-(void) snapCurvePolygon: (SFCurvePolygon *) curvePolygon{
+    NSMutableArray<SFCurve *> *rings = curvePolygon.rings;
+    NSMutableIndexSet *degenerate = [NSMutableIndexSet indexSet];
+    for(NSUInteger i = 0; i < rings.count; i++){
+        SFCurve *ring = [rings objectAtIndex:i];
+        BOOL valid;
+        if(ring.geometryType == SF_LINESTRING){
+            valid = [self snapLineString:(SFLineString *) ring withMinimum:4 andArea:YES];
+        }else{
+            [self snapGeometry:ring];
+            valid = ![ring isEmpty];
+        }
+        if(!valid){
+            if(i == 0){
+                [rings removeAllObjects];
+                return;
+            }
+            [degenerate addIndex:i];
+        }
+    }
+    [rings removeObjectsAtIndexes:degenerate];
+}
+
+/**
+ * Snap the geometries in place, removing emptied geometries
+ *
+ * @param geometries
+ *            collection or surface geometries
+ */
+-(void) snapGeometries: (NSMutableArray *) geometries{
+    NSMutableIndexSet *empty = [NSMutableIndexSet indexSet];
+    for(NSUInteger i = 0; i < geometries.count; i++){
+        SFGeometry *geometry = [geometries objectAtIndex:i];
+        [self snapGeometry:geometry];
+        if([geometry isEmpty]){
+            [empty addIndex:i];
+        }
+    }
+    [geometries removeObjectsAtIndexes:empty];
+}
+
+@end
@@ -0,0 +1,265 @@
+//
+//  SFGeodesic.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+#import "SFPoint.h"
+#import "SFGeodesicTypes.h"
+
+/**
+ * WGS84 ellipsoid semi-major axis (equatorial radius) in meters
+ */
+extern double const SF_WGS84_SEMI_MAJOR_AXIS;
+
+/**
+ * WGS84 ellipsoid flattening
+ */
+extern double const SF_WGS84_FLATTENING;
+
+/**
+ * Mean earth radius in meters used by spherical calculations
+ */
+extern double const SF_EARTH_MEAN_RADIUS;
+
+/**
+ * Geodesic distances, azimuths, destinations, lengths, and areas of WGS84
+ * geometries with x longitude and y latitude values in degrees.
+ *
+ * Ellipsoid calculations solve the geodesic problems on the WGS84 ellipsoid
+ * to round off accuracy (nanometers), including nearly antipodal points.
+ * Sphere calculations use the Haversine formula and spherical excess on a
+ * sphere of the mean earth radius, faster with up to about 0.5% error.
+ *
+ * Based upon the geodesic algorithms of GeographicLib by Charles F. F.
+ * Karney, "Algorithms for geodesics", Journal of Geodesy 87:43-55, 2013:
+ * https://geographiclib.sourceforge.io
+ *
+ * GeographicLib license:
+ *
+ * The MIT License (MIT).
+ *
+ * Copyright (c) 2012-2025, Charles Karney
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+@interface SFGeodesic : NSObject
+
+/**
+ * Ellipsoid geodesic distance between two points
+ *
+ * @param point1
+ *            point 1
+ * @param point2
+ *            point 2
+ * @return distance in meters
+ */
++(double) distanceBetweenPoint1: (SFPoint *) point1 andPoint2: (SFPoint *) point2;
+
+/**
+ * Geodesic distance between two points
+ *
+ * @param point1
+ *            point 1
+ * @param point2
+ *            point 2
+ * @param type
+ *            geodesic type
+ * @return distance in meters
+ */
++(double) distanceBetweenPoint1: (SFPoint *) point1 andPoint2: (SFPoint *) point2 withType: (enum SFGeodesicType) type;
+
+/**
+ * Ellipsoid geodesic initial azimuth from point 1 to point 2
+ *
+ * @param point1
+ *            point 1
+ * @param point2
+ *            point 2
+ * @return azimuth in degrees clockwise from north, -180 to 180
+ */
++(double) azimuthFromPoint1: (SFPoint *) point1 toPoint2: (SFPoint *) point2;
+
+/**
+ * Geodesic initial azimuth from point 1 to point 2
+ *
+ * @param point1
+ *            point 1
+ * @param point2
+ *            point 2
+ * @param type
+ *            geodesic type
+ * @return azimuth in degrees clockwise from north, -180 to 180
+ */
++(double) azimuthFromPoint1: (SFPoint *) point1 toPoint2: (SFPoint *) point2 withType: (enum SFGeodesicType) type;
+
+/**
+ * Ellipsoid geodesic destination point from the point along the azimuth
+ *
+ * @param point
+ *            start point
+ * @param azimuth
+ *            azimuth in degrees clockwise from north
+ * @param distance
+ *            distance in meters
+ * @return destination point with longitude normalized to -180 to 180
+ */
++(SFPoint *) destinationFromPoint: (SFPoint *) point withAzimuth: (double) azimuth andDistance: (double) distance;
+
+/**
+ * Geodesic destination point from the point along the azimuth
+ *
+ * @param point
+ *            start point
+ * @param azimuth
+ *            azimuth in degrees clockwise from north
+ * @param distance
+ *            distance in meters
+ * @param type
+ *            geodesic type
+ * @return destination point with longitude normalized to -180 to 180
+ */
++(SFPoint *) destinationFromPoint: (SFPoint *) point withAzimuth: (double) azimuth andDistance: (double) distance andType: (enum SFGeodesicType) type;
+
+/**
+ * Ellipsoid geodesic length of the geometry curves. Points and surfaces have
+ * no length, circular arcs are measured along their default linearization.
+ *
+ * @param geometry
+ *            geometry
+ * @return length in meters
+ */
++(double) lengthOfGeometry: (SFGeometry *) geometry;
+
+/**
+ * Geodesic length of the geometry curves. Points and surfaces have no
+ * length, circular arcs are measured along their default linearization.
+ *
+ * @param geometry
+ *            geometry
+ * @param type
+ *            geodesic type
+ * @return length in meters
+ */
++(double) lengthOfGeometry: (SFGeometry *) geometry withType: (enum SFGeodesicType) type;
+
+/**
+ * Ellipsoid geodesic perimeter of the geometry surface rings, including
+ * interior rings. Points and curves have no perimeter.
+ *
+ * @param geometry
+ *            geometry
+ * @return perimeter in meters
+ */
++(double) perimeterOfGeometry: (SFGeometry *) geometry;
+
+/**
+ * Geodesic perimeter of the geometry surface rings, including interior
+ * rings. Points and curves have no perimeter.
+ *
+ * @param geometry
+ *            geometry
+ * @param type
+ *            geodesic type
+ * @return perimeter in meters
+ */
++(double) perimeterOfGeometry: (SFGeometry *) geometry withType: (enum SFGeodesicType) type;
+
+/**
+ * Ellipsoid geodesic area of the geometry surfaces. Each polygon area is the
+ * exterior ring area less the interior ring areas, with each ring bounding
+ * the smaller of the two regions it divides the earth into regardless of
+ * orientation. Points and curves have no area.
+ *
+ * @param geometry
+ *            geometry
+ * @return area in square meters
+ */
++(double) areaOfGeometry: (SFGeometry *) geometry;
+
+/**
+ * Geodesic area of the geometry surfaces. Each polygon area is the exterior
+ * ring area less the interior ring areas, with each ring bounding the
+ * smaller of the two regions it divides the earth into regardless of
+ * orientation. Points and curves have no area.
+ *
+ * @param geometry
+ *            geometry
+ * @param type
+ *            geodesic type
+ * @return area in square meters
+ */
++(double) areaOfGeometry: (SFGeometry *) geometry withType: (enum SFGeodesicType) type;
+
+/**
+ * Geodesic distances between packed coordinate pairs, concurrently across
+ * chunks when large enough. Coordinates are packed longitude, latitude
+ * values. Pass the same coordinates offset by one coordinate (2 values) for
+ * the segment distances of a path.
+ *
+ * @param coordinates1
+ *            packed coordinates 1, 2 * count values
+ * @param coordinates2
+ *            packed coordinates 2, 2 * count values
+ * @param count
+ *            number of coordinate pairs
+ * @param distances
+ *            output distances in meters, count values
+ * @param type
+ *            geodesic type
+ */
++(void) distancesBetweenCoordinates1: (const double *) coordinates1 andCoordinates2: (const double *) coordinates2 withCount: (NSUInteger) count intoDistances: (double *) distances withType: (enum SFGeodesicType) type;
+
+/**
+ * Geodesic length of a path of packed longitude, latitude coordinates,
+ * concurrently across chunks when large enough
+ *
+ * @param coordinates
+ *            packed coordinates, 2 * count values
+ * @param count
+ *            number of coordinates
+ * @param type
+ *            geodesic type
+ * @return length in meters
+ */
++(double) lengthOfCoordinates: (const double *) coordinates withCount: (NSUInteger) count andType: (enum SFGeodesicType) type;
+
+/**
+ * Geodesic signed area of a ring of packed longitude, latitude coordinates,
+ * positive when counter clockwise. The ring is implicitly closed and may
+ * repeat the first coordinate.
+ *
+ * @param coordinates
+ *            packed coordinates, 2 * count values
+ * @param count
+ *            number of coordinates
+ * @param type
+ *            geodesic type
+ * @return signed area in square meters, between minus and plus half of the
+ *         earth area
+ */
++(double) areaOfCoordinates: (const double *) coordinates withCount: (NSUInteger) count andType: (enum SFGeodesicType) type;
+
+@end
@@ -0,0 +1,1583 @@
+//
+//  SFGeodesic.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFGeodesic.h"
+#import "SFCurveUtils.h"
+#import "SFGeometryCollection.h"
+#import "SFPolyhedralSurface.h"
+
+double const SF_WGS84_SEMI_MAJOR_AXIS = 6378137.0;
+
+double const SF_WGS84_FLATTENING = 1.0 / 298.257223563;
+
+double const SF_EARTH_MEAN_RADIUS = 6371008.8;
+
+/**
+ * Order of the geodesic series expansions
+ */
+#define SF_GEODESIC_ORDER 6
+
+/**
+ * Number of C3 series coefficients
+ */
+#define SF_GEODESIC_C3X ((SF_GEODESIC_ORDER * (SF_GEODESIC_ORDER - 1)) / 2)
+
+/**
+ * Number of C4 series coefficients
+ */
+#define SF_GEODESIC_C4X ((SF_GEODESIC_ORDER * (SF_GEODESIC_ORDER + 1)) / 2)
+
+/**
+ * Newton iterations before falling back to bisection in the inverse problem
+ */
+#define SF_GEODESIC_MAX_NEWTON 20
+
+/**
+ * Total iterations of the inverse problem
+ */
+#define SF_GEODESIC_MAX_ITERATIONS (SF_GEODESIC_MAX_NEWTON + DBL_MANT_DIG + 10)
+
+/**
+ * Number of coordinates buffered on the stack before falling back to the heap
+ */
+#define SF_GEODESIC_BUFFER_SIZE 256
+
+/**
+ * Number of coordinates processed per concurrent chunk in batch operations
+ */
+#define SF_GEODESIC_CONCURRENT_CHUNK 4096
+
+/**
+ * Degrees to radians
+ */
+#define SF_GEODESIC_DEGREE (M_PI / 180.0)
+
+/**
+ * Ellipsoid parameters and series coefficients
+ */
+typedef struct SFGeodesicEllipsoid{
+    double a;
+    double f;
+    double f1;
+    double e2;
+    double ep2;
+    double n;
+    double b;
+    double c2;
+    double etol2;
+    double A3x[SF_GEODESIC_ORDER];
+    double C3x[SF_GEODESIC_C3X];
+    double C4x[SF_GEODESIC_C4X];
+} SFGeodesicEllipsoid;
+
+/**
+ * Geodesic measure of a geometry
+ */
+typedef enum SFGeodesicMeasure{
+    SF_GEODESIC_LENGTH,
+    SF_GEODESIC_PERIMETER,
+    SF_GEODESIC_AREA
+} SFGeodesicMeasure;
+
+/**
+ * Compensated running sum
+ */
+typedef struct SFGeodesicSum{
+    double sum;
+    double compensation;
+} SFGeodesicSum;
+
+static const double SFGeodesicTiny = 1.4916681462400413e-154;
+static const double SFGeodesicTol0 = DBL_EPSILON;
+static const double SFGeodesicTol1 = 200 * DBL_EPSILON;
+static const double SFGeodesicTol2 = 1.4901161193847656e-08;
+static const double SFGeodesicXThresh = 1000 * 1.4901161193847656e-08;
+
+/**
+ * Add the value to the compensated sum
+ *
+ * @param sum
+ *            compensated sum
+ * @param value
+ *            value
+ */
+static void SFGeodesicSumAdd(SFGeodesicSum *sum, double value){
+    double total = sum->sum + value;
+    if(fabs(sum->sum) >= fabs(value)){
+        sum->compensation += (sum->sum - total) + value;
+    }else{
+        sum->compensation += (value - total) + sum->sum;
+    }
+    sum->sum = total;
+}
+
+/**
+ * Evaluate the polynomial of degree n with coefficients from highest order
+ */
+static double SFGeodesicPolyval(int n, const double *p, double x){
+    double y = n < 0 ? 0 : *p++;
+    while(n-- > 0){
+        y = y * x + *p++;
+    }
+    return y;
+}
+
+/**
+ * Error free sum of two values, returning the rounded sum with the error in t
+ */
+static double SFGeodesicErrorFreeSum(double u, double v, double *t){
+    double s = u + v;
+    double up = s - v;
+    double vpp = s - up;
+    up -= u;
+    vpp -= v;
+    *t = s != 0 ? 0.0 - (up + vpp) : s;
+    return s;
+}
+
+/**
+ * Round an angle so that small values underflow to zero
+ */
+static double SFGeodesicAngRound(double x){
+    const double z = 1.0 / 16.0;
+    double y = fabs(x);
+    y = y < z ? z - (z - y) : y;
+    return copysign(y, x);
+}
+
+/**
+ * Reduce an angle to -180 to 180 degrees
+ */
+static double SFGeodesicAngNormalize(double x){
+    double y = remainder(x, 360.0);
+    return fabs(y) == 180 ? copysign(180.0, x) : y;
+}
+
+/**
+ * Replace latitudes outside -90 to 90 degrees with NaN
+ */
+static double SFGeodesicLatFix(double x){
+    return fabs(x) > 90 ? NAN : x;
+}
+
+/**
+ * Accurate difference y - x of two angles reduced to -180 to 180 degrees,
+ * with the rounding error in e
+ */
+static double SFGeodesicAngDiff(double x, double y, double *e){
+    double t;
+    double d = SFGeodesicErrorFreeSum(remainder(-x, 360.0), remainder(y, 360.0), &t);
+    d = SFGeodesicErrorFreeSum(remainder(d, 360.0), t, &t);
+    if(d == 0 || fabs(d) == 180){
+        d = copysign(d, t == 0 ? y - x : -t);
+    }
+    *e = t;
+    return d;
+}
+
+/**
+ * Sine and cosine of an angle in degrees, exact for multiples of 90
+ */
+static void SFGeodesicSinCosd(double x, double *sinx, double *cosx){
+    int q = 0;
+    double r = remquo(x, 90.0, &q);
+    r *= SF_GEODESIC_DEGREE;
+    double s = sin(r);
+    double c = cos(r);
+    switch((unsigned) q & 3U){
+        case 0U: *sinx = s; *cosx = c; break;
+        case 1U: *sinx = c; *cosx = -s; break;
+        case 2U: *sinx = -s; *cosx = -c; break;
+        default: *sinx = -c; *cosx = s; break;
+    }
+    *cosx += 0.0;
+    if(*sinx == 0){
+        *sinx = copysign(*sinx, x);
+    }
+}
+
+/**
+ * Sine and cosine of the angle x + t in degrees, x in -180 to 180
+ */
+static void SFGeodesicSinCosde(double x, double t, double *sinx, double *cosx){
+    int q = 0;
+    double r = remquo(x, 90.0, &q);
+    r = SFGeodesicAngRound(r + t) * SF_GEODESIC_DEGREE;
+    double s = sin(r);
+    double c = cos(r);
+    switch((unsigned) q & 3U){
+        case 0U: *sinx = s; *cosx = c; break;
+        case 1U: *sinx = c; *cosx = -s; break;
+        case 2U: *sinx = -s; *cosx = -c; break;
+        default: *sinx = -c; *cosx = s; break;
+    }
+    *cosx += 0.0;
+    if(*sinx == 0){
+        *sinx = copysign(*sinx, x);
+    }
+}
+
+/**
+ * Arc tangent of y / x in degrees, exact in each quadrant
+ */
+static double SFGeodesicAtan2d(double y, double x){
+    int q = 0;
+    if(fabs(y) > fabs(x)){
+        double t = x;
+        x = y;
+        y = t;
+        q = 2;
+    }
+    if(signbit(x)){
+        x = -x;
+        q++;
+    }
+    double angle = atan2(y, x) / SF_GEODESIC_DEGREE;
+    switch(q){
+        case 1: angle = copysign(180.0, y) - angle; break;
+        case 2: angle = 90 - angle; break;
+        case 3: angle = -90 + angle; break;
+        default: break;
+    }
+    return angle;
+}
+
+/**
+ * Normalize the sine and cosine vector
+ */
+static void SFGeodesicNorm(double *sinx, double *cosx){
+    double r = hypot(*sinx, *cosx);
+    *sinx /= r;
+    *cosx /= r;
+}
+
+/**
+ * Evaluate a sine (sinp) or cosine series with n terms using Clenshaw
+ * summation, c is one based for sine series
+ */
+static double SFGeodesicSinCosSeries(BOOL sinp, double sinx, double cosx, const double *c, int n){
+    c += n + sinp;
+    double ar = 2 * (cosx - sinx) * (cosx + sinx);
+    double y0 = (n & 1) ? *--c : 0;
+    double y1 = 0;
+    n /= 2;
+    while(n--){
+        y1 = ar * y0 - y1 + *--c;
+        y0 = ar * y1 - y0 + *--c;
+    }
+    return sinp ? 2 * sinx * cosx * y0 : cosx * (y0 - y1);
+}
+
+/**
+ * Solve the astroid equation for the starting point of nearly antipodal
+ * inverse problems
+ */
+static double SFGeodesicAstroid(double x, double y){
+    double k = 0;
+    double p = x * x;
+    double q = y * y;
+    double r = (p + q - 1) / 6;
+    if(!(q == 0 && r <= 0)){
+        double S = p * q / 4;
+        double r2 = r * r;
+        double r3 = r * r2;
+        double disc = S * (S + 2 * r3);
+        double u = r;
+        if(disc >= 0){
+            double T3 = S + r3;
+            T3 += T3 < 0 ? -sqrt(disc) : sqrt(disc);
+            double T = cbrt(T3);
+            u += T + (T != 0 ? r2 / T : 0);
+        }else{
+            double angle = atan2(sqrt(-disc), -(S + r3));
+            u += 2 * r * cos(angle / 3);
+        }
+        double v = sqrt(u * u + q);
+        double uv = u < 0 ? q / (v - u) : u + v;
+        double w = (uv - q) / (2 * v);
+        k = uv / (sqrt(uv + w * w) + w);
+    }
+    return k;
+}
+
+/**
+ * A1 - 1 series
+ */
+static double SFGeodesicA1m1f(double eps){
+    static const double coeff[] = {1, 4, 64, 0, 256};
+    int m = SF_GEODESIC_ORDER / 2;
+    double t = SFGeodesicPolyval(m, coeff, eps * eps) / coeff[m + 1];
+    return (t + eps) / (1 - eps);
+}
+
+/**
+ * C1 series coefficients, one based
+ */
+static void SFGeodesicC1f(double eps, double *c){
+    static const double coeff[] = {
+        -1, 6, -16, 32,
+        -9, 64, -128, 2048,
+        9, -16, 768,
+        3, -5, 512,
+        -7, 1280,
+        -7, 2048
+    };
+    double eps2 = eps * eps;
+    double d = eps;
+    int o = 0;
+    for(int l = 1; l <= SF_GEODESIC_ORDER; l++){
+        int m = (SF_GEODESIC_ORDER - l) / 2;
+        c[l] = d * SFGeodesicPolyval(m, coeff + o, eps2) / coeff[o + m + 1];
+        o += m + 2;
+        d *= eps;
+    }
+}
+
+/**
+ * C1' (reverted C1) series coefficients, one based
+ */
+static void SFGeodesicC1pf(double eps, double *c){
+    static const double coeff[] = {
+        205, -432, 768, 1536,
+        4005, -4736, 3840, 12288,
+        -225, 116, 384,
+        -7173, 2695, 7680,
+        3467, 7680,
+        38081, 61440
+    };
+    double eps2 = eps * eps;
+    double d = eps;
+    int o = 0;
+    for(int l = 1; l <= SF_GEODESIC_ORDER; l++){
+        int m = (SF_GEODESIC_ORDER - l) / 2;
+        c[l] = d * SFGeodesicPolyval(m, coeff + o, eps2) / coeff[o + m + 1];
+        o += m + 2;
+        d *= eps;
+    }
+}
+
+/**
+ * A2 - 1 series
+ */
+static double SFGeodesicA2m1f(double eps){
+    static const double coeff[] = {-11, -28, -192, 0, 256};
+    int m = SF_GEODESIC_ORDER / 2;
+    double t = SFGeodesicPolyval(m, coeff, eps * eps) / coeff[m + 1];
+    return (t - eps) / (1 + eps);
+}
+
+/**
+ * C2 series coefficients, one based
+ */
+static void SFGeodesicC2f(double eps, double *c){
+    static const double coeff[] = {
+        1, 2, 16, 32,
+        35, 64, 384, 2048,
+        15, 80, 768,
+        7, 35, 512,
+        63, 1280,
+        77, 2048
+    };
+    double eps2 = eps * eps;
+    double d = eps;
+    int o = 0;
+    for(int l = 1; l <= SF_GEODESIC_ORDER; l++){
+        int m = (SF_GEODESIC_ORDER - l) / 2;
+        c[l] = d * SFGeodesicPolyval(m, coeff + o, eps2) / coeff[o + m + 1];
+        o += m + 2;
+        d *= eps;
+    }
+}
+
+/**
+ * A3 series
+ */
+static double SFGeodesicA3f(const SFGeodesicEllipsoid *g, double eps){
+    return SFGeodesicPolyval(SF_GEODESIC_ORDER - 1, g->A3x, eps);
+}
+
+/**
+ * C3 series coefficients, one based
+ */
+static void SFGeodesicC3f(const SFGeodesicEllipsoid *g, double eps, double *c){
+    double mult = 1;
+    int o = 0;
+    for(int l = 1; l < SF_GEODESIC_ORDER; l++){
+        int m = SF_GEODESIC_ORDER - l - 1;
+        mult *= eps;
+        c[l] = mult * SFGeodesicPolyval(m, g->C3x + o, eps);
+        o += m + 1;
+    }
+}
+
+/**
+ * C4 series coefficients, zero based
+ */
+static void SFGeodesicC4f(const SFGeodesicEllipsoid *g, double eps, double *c){
+    double mult = 1;
+    int o = 0;
+    for(int l = 0; l < SF_GEODESIC_ORDER; l++){
+        int m = SF_GEODESIC_ORDER - l - 1;
+        c[l] = mult * SFGeodesicPolyval(m, g->C4x + o, eps);
+        o += m + 1;
+        mult *= eps;
+    }
+}
+
+/**
+ * Initialize the ellipsoid parameters and series coefficients
+ *
+ * @param g
+ *            ellipsoid
+ * @param a
+ *            semi-major axis
+ * @param f
+ *            flattening, greater than 0
+ */
+static void SFGeodesicEllipsoidInit(SFGeodesicEllipsoid *g, double a, double f){
+    static const double A3coeff[] = {
+        -3, 128,
+        -2, -3, 64,
+        -1, -3, -1, 16,
+        3, -1, -2, 8,
+        1, -1, 2,
+        1, 1
+    };
+    static const double C3coeff[] = {
+        3, 128,
+        2, 5, 128,
+        -1, 3, 3, 64,
+        -1, 0, 1, 8,
+        -1, 1, 4,
+        5, 256,
+        1, 3, 128,
+        -3, -2, 3, 64,
+        1, -3, 2, 32,
+        7, 512,
+        -10, 9, 384,
+        5, -9, 5, 192,
+        7, 512,
+        -14, 7, 512,
+        21, 2560
+    };
+    static const double C4coeff[] = {
+        97, 15015,
+        1088, 156, 45045,
+        -224, -4784, 1573, 45045,
+        -10656, 14144, -4576, -858, 45045,
+        64, 624, -4576, 6864, -3003, 15015,
+        100, 208, 572, 3432, -12012, 30030, 45045,
+        1, 9009,
+        -2944, 468, 135135,
+        5792, 1040, -1287, 135135,
+        5952, -11648, 9152, -2574, 135135,
+        -64, -624, 4576, -6864, 3003, 135135,
+        8, 10725,
+        1856, -936, 225225,
+        -8448, 4992, -1144, 225225,
+        -1440, 4160, -4576, 1716, 225225,
+        -136, 63063,
+        1024, -208, 105105,
+        3584, -3328, 1144, 315315,
+        -128, 135135,
+        -2560, 832, 405405,
+        128, 99099
+    };
+    
+    g->a = a;
+    g->f = f;
+    g->f1 = 1 - f;
+    g->e2 = f * (2 - f);
+    g->ep2 = g->e2 / (g->f1 * g->f1);
+    g->n = f / (2 - f);
+    g->b = a * g->f1;
+    g->c2 = (a * a + g->b * g->b * atanh(sqrt(g->e2)) / sqrt(g->e2)) / 2;
+    g->etol2 = 0.1 * SFGeodesicTol2 / sqrt(fmax(0.001, f) * fmin(1.0, 1 - f / 2) / 2);
+    
+    int o = 0;
+    int k = 0;
+    for(int j = SF_GEODESIC_ORDER - 1; j >= 0; j--){
+        int m = MIN(SF_GEODESIC_ORDER - j - 1, j);
+        g->A3x[k++] = SFGeodesicPolyval(m, A3coeff + o, g->n) / A3coeff[o + m + 1];
+        o += m + 2;
+    }
+    
+    o = 0;
+    k = 0;
+    for(int l = 1; l < SF_GEODESIC_ORDER; l++){
+        for(int j = SF_GEODESIC_ORDER - 1; j >= l; j--){
+            int m = MIN(SF_GEODESIC_ORDER - j - 1, j);
+            g->C3x[k++] = SFGeodesicPolyval(m, C3coeff + o, g->n) / C3coeff[o + m + 1];
+            o += m + 2;
+        }
+    }
+    
+    o = 0;
+    k = 0;
+    for(int l = 0; l < SF_GEODESIC_ORDER; l++){
+        for(int j = SF_GEODESIC_ORDER - 1; j >= l; j--){
+            int m = SF_GEODESIC_ORDER - j - 1;
+            g->C4x[k++] = SFGeodesicPolyval(m, C4coeff + o, g->n) / C4coeff[o + m + 1];
+            o += m + 2;
+        }
+    }
+}
+
+/**
+ * Shared WGS84 ellipsoid, initialized once
+ *
+ * @return WGS84 ellipsoid
+ */
+static const SFGeodesicEllipsoid *SFGeodesicWGS84(void){
+    static SFGeodesicEllipsoid wgs84;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        SFGeodesicEllipsoidInit(&wgs84, SF_WGS84_SEMI_MAJOR_AXIS, SF_WGS84_FLATTENING);
+    });
+    return &wgs84;
+}
+
+/**
+ * Distance (s12b) and reduced length (m12b) along the geodesic in units of
+ * the semi-minor axis, either output may be NULL
+ */
+static void SFGeodesicLengths(const SFGeodesicEllipsoid *g, double eps, double sig12,
+                              double ssig1, double csig1, double dn1,
+                              double ssig2, double csig2, double dn2,
+                              double *s12b, double *m12b, double *C1a, double *C2a){
+    double m0x = 0;
+    double J12 = 0;
+    double A2 = 0;
+    double A1 = SFGeodesicA1m1f(eps);
+    SFGeodesicC1f(eps, C1a);
+    if(m12b != NULL){
+        A2 = SFGeodesicA2m1f(eps);
+        SFGeodesicC2f(eps, C2a);
+        m0x = A1 - A2;
+        A2 = 1 + A2;
+    }
+    A1 = 1 + A1;
+    if(s12b != NULL){
+        double B1 = SFGeodesicSinCosSeries(YES, ssig2, csig2, C1a, SF_GEODESIC_ORDER)
+            - SFGeodesicSinCosSeries(YES, ssig1, csig1, C1a, SF_GEODESIC_ORDER);
+        *s12b = A1 * (sig12 + B1);
+        if(m12b != NULL){
+            double B2 = SFGeodesicSinCosSeries(YES, ssig2, csig2, C2a, SF_GEODESIC_ORDER)
+                - SFGeodesicSinCosSeries(YES, ssig1, csig1, C2a, SF_GEODESIC_ORDER);
+            J12 = m0x * sig12 + (A1 * B1 - A2 * B2);
+        }
+    }else if(m12b != NULL){
+        for(int l = 1; l <= SF_GEODESIC_ORDER; l++){
+            C2a[l] = A1 * C1a[l] - A2 * C2a[l];
+        }
+        J12 = m0x * sig12 + (SFGeodesicSinCosSeries(YES, ssig2, csig2, C2a, SF_GEODESIC_ORDER)
+                             - SFGeodesicSinCosSeries(YES, ssig1, csig1, C2a, SF_GEODESIC_ORDER));
+    }
+    if(m12b != NULL){
+        *m12b = dn2 * (csig1 * ssig2) - dn1 * (ssig1 * csig2) - csig1 * csig2 * J12;
+    }
+}
+
+/**
+ * Starting azimuth for the inverse problem Newton iterations, returning the
+ * arc length when the short line solution is already accurate or -1
+ */
+static double SFGeodesicInverseStart(const SFGeodesicEllipsoid *g,
+                                     double sbet1, double cbet1, double dn1,
+                                     double sbet2, double cbet2, double dn2,
+                                     double lam12, double slam12, double clam12,
+                                     double *psalp1, double *pcalp1,
+                                     double *psalp2, double *pcalp2, double *pdnm){
+    double sig12 = -1;
+    double salp1, calp1;
+    double sbet12 = sbet2 * cbet1 - cbet2 * sbet1;
+    double cbet12 = cbet2 * cbet1 + sbet2 * sbet1;
+    double sbet12a = sbet2 * cbet1 + cbet2 * sbet1;
+    BOOL shortline = cbet12 >= 0 && sbet12 < 0.5 && cbet2 * lam12 < 0.5;
+    double somg12, comg12;
+    if(shortline){
+        double sbetm2 = (sbet1 + sbet2) * (sbet1 + sbet2);
+        sbetm2 /= sbetm2 + (cbet1 + cbet2) * (cbet1 + cbet2);
+        *pdnm = sqrt(1 + g->ep2 * sbetm2);
+        double omg12 = lam12 / (g->f1 * *pdnm);
+        somg12 = sin(omg12);
+        comg12 = cos(omg12);
+    }else{
+        somg12 = slam12;
+        comg12 = clam12;
+    }
+    
+    salp1 = cbet2 * somg12;
+    calp1 = comg12 >= 0
+        ? sbet12 + cbet2 * sbet1 * somg12 * somg12 / (1 + comg12)
+        : sbet12a - cbet2 * sbet1 * somg12 * somg12 / (1 - comg12);
+    
+    double ssig12 = hypot(salp1, calp1);
+    double csig12 = sbet1 * sbet2 + cbet1 * cbet2 * comg12;
+    
+    if(shortline && ssig12 < g->etol2){
+        // Really short lines
+        double salp2 = cbet1 * somg12;
+        double calp2 = sbet12 - cbet1 * sbet2 * (comg12 >= 0 ? somg12 * somg12 / (1 + comg12) : 1 - comg12);
+        SFGeodesicNorm(&salp2, &calp2);
+        *psalp2 = salp2;
+        *pcalp2 = calp2;
+        sig12 = atan2(ssig12, csig12);
+    }else if(fabs(g->n) >= 0.1 || csig12 >= 0 || ssig12 >= 6 * fabs(g->n) * M_PI * cbet1 * cbet1){
+        // Zeroth order spherical approximation is sufficient
+    }else{
+        // Nearly antipodal, scale to the astroid problem
+        double lam12x = atan2(-slam12, -clam12);
+        double k2 = sbet1 * sbet1 * g->ep2;
+        double eps = k2 / (2 * (1 + sqrt(1 + k2)) + k2);
+        double lamscale = g->f * cbet1 * SFGeodesicA3f(g, eps) * M_PI;
+        double betscale = lamscale * cbet1;
+        double x = lam12x / lamscale;
+        double y = sbet12a / betscale;
+        if(y > -SFGeodesicTol1 && x > -1 - SFGeodesicXThresh){
+            salp1 = fmin(1.0, -x);
+            calp1 = -sqrt(1 - salp1 * salp1);
+        }else{
+            double k = SFGeodesicAstroid(x, y);
+            double omg12a = lamscale * (-x * k / (1 + k));
+            somg12 = sin(omg12a);
+            comg12 = -cos(omg12a);
+            salp1 = cbet2 * somg12;
+            calp1 = sbet12a - cbet2 * sbet1 * somg12 * somg12 / (1 - comg12);
+        }
+    }
+    if(!(salp1 <= 0)){
+        SFGeodesicNorm(&salp1, &calp1);
+    }else{
+        salp1 = 1;
+        calp1 = 0;
+    }
+    *psalp1 = salp1;
+    *pcalp1 = calp1;
+    return sig12;
+}
+
+/**
+ * Longitude difference (lam12) of the geodesic with the starting azimuth and
+ * its derivative with respect to the azimuth when requested
+ */
+static double SFGeodesicLambda12(const SFGeodesicEllipsoid *g,
+                                 double sbet1, double cbet1, double dn1,
+                                 double sbet2, double cbet2, double dn2,
+                                 double salp1, double calp1,
+                                 double slam120, double clam120,
+                                 double *psalp2, double *pcalp2, double *psig12,
+                                 double *pssig1, double *pcsig1,
+                                 double *pssig2, double *pcsig2,
+                                 double *peps, double *pdomg12,
+                                 BOOL diffp, double *pdlam12,
+                                 double *C1a, double *C2a, double *C3a){
+    if(sbet1 == 0 && calp1 == 0){
+        calp1 = -SFGeodesicTiny;
+    }
+    
+    double salp0 = salp1 * cbet1;
+    double calp0 = hypot(calp1, salp1 * sbet1);
+    
+    double ssig1 = sbet1;
+    double somg1 = salp0 * sbet1;
+    double csig1 = calp1 * cbet1;
+    double comg1 = csig1;
+    SFGeodesicNorm(&ssig1, &csig1);
+    
+    double salp2 = cbet2 != cbet1 ? salp0 / cbet2 : salp1;
+    double calp2 = cbet2 != cbet1 || fabs(sbet2) != -sbet1
+        ? sqrt(calp1 * cbet1 * calp1 * cbet1
+               + (cbet1 < -sbet1 ? (cbet2 - cbet1) * (cbet1 + cbet2) : (sbet1 - sbet2) * (sbet1 + sbet2))) / cbet2
+        : fabs(calp1);
+    
+    double ssig2 = sbet2;
+    double somg2 = salp0 * sbet2;
+    double csig2 = calp2 * cbet2;
+    double comg2 = csig2;
+    SFGeodesicNorm(&ssig2, &csig2);
+    
+    double sig12 = atan2(fmax(0.0, csig1 * ssig2 - ssig1 * csig2) + 0.0, csig1 * csig2 + ssig1 * ssig2);
+    
+    double somg12 = fmax(0.0, comg1 * somg2 - somg1 * comg2) + 0.0;
+    double comg12 = comg1 * comg2 + somg1 * somg2;
+    double eta = atan2(somg12 * clam120 - comg12 * slam120, comg12 * clam120 + somg12 * slam120);
+    
+    double k2 = calp0 * calp0 * g->ep2;
+    double eps = k2 / (2 * (1 + sqrt(1 + k2)) + k2);
+    SFGeodesicC3f(g, eps, C3a);
+    double B312 = SFGeodesicSinCosSeries(YES, ssig2, csig2, C3a, SF_GEODESIC_ORDER - 1)
+        - SFGeodesicSinCosSeries(YES, ssig1, csig1, C3a, SF_GEODESIC_ORDER - 1);
+    double domg12 = -g->f * SFGeodesicA3f(g, eps) * salp0 * (sig12 + B312);
+    double lam12 = eta + domg12;
+    
+    if(diffp){
+        if(calp2 == 0){
+            *pdlam12 = -2 * g->f1 * dn1 / sbet1;
+        }else{
+            double m12b;
+            SFGeodesicLengths(g, eps, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2, NULL, &m12b, C1a, C2a);
+            *pdlam12 = m12b * g->f1 / (calp2 * cbet2);
+        }
+    }
+    
+    *psalp2 = salp2;
+    *pcalp2 = calp2;
+    *psig12 = sig12;
+    *pssig1 = ssig1;
+    *pcsig1 = csig1;
+    *pssig2 = ssig2;
+    *pcsig2 = csig2;
+    *peps = eps;
+    *pdomg12 = domg12;
+    
+    return lam12;
+}
+
+/**
+ * Solve the inverse geodesic problem on the ellipsoid
+ *
+ * @param g
+ *            ellipsoid
+ * @param lat1
+ *            latitude 1 in degrees
+ * @param lon1
+ *            longitude 1 in degrees
+ * @param lat2
+ *            latitude 2 in degrees
+ * @param lon2
+ *            longitude 2 in degrees
+ * @param azi1
+ *            output initial azimuth in degrees, NULL if not needed
+ * @param azi2
+ *            output final azimuth in degrees, NULL if not needed
+ * @param area
+ *            output area between the geodesic and the equator in square
+ *            meters, NULL if not needed
+ * @return distance in meters
+ */
+static double SFGeodesicInverse(const SFGeodesicEllipsoid *g, double lat1, double lon1, double lat2, double lon2,
+                                double *azi1, double *azi2, double *area){
+    double C1a[SF_GEODESIC_ORDER + 1];
+    double C2a[SF_GEODESIC_ORDER + 1];
+    double C3a[SF_GEODESIC_ORDER];
+    
+    double lon12s;
+    double lon12 = SFGeodesicAngDiff(lon1, lon2, &lon12s);
+    // Make longitude difference positive
+    double lonsign = signbit(lon12) ? -1 : 1;
+    lon12 *= lonsign;
+    lon12s *= lonsign;
+    double lam12 = lon12 * SF_GEODESIC_DEGREE;
+    double slam12, clam12;
+    SFGeodesicSinCosde(lon12, lon12s, &slam12, &clam12);
+    // Supplementary longitude difference
+    lon12s = (180 - lon12) - lon12s;
+    
+    lat1 = SFGeodesicAngRound(SFGeodesicLatFix(lat1));
+    lat2 = SFGeodesicAngRound(SFGeodesicLatFix(lat2));
+    // Swap points so that point 1 has the larger absolute latitude
+    int swapp = fabs(lat1) < fabs(lat2) || isnan(lat2) ? -1 : 1;
+    if(swapp < 0){
+        lonsign *= -1;
+        double t = lat1;
+        lat1 = lat2;
+        lat2 = t;
+    }
+    // Make latitude 1 negative
+    double latsign = signbit(lat1) ? 1 : -1;
+    lat1 *= latsign;
+    lat2 *= latsign;
+    
+    double sbet1, cbet1, sbet2, cbet2;
+    SFGeodesicSinCosd(lat1, &sbet1, &cbet1);
+    sbet1 *= g->f1;
+    SFGeodesicNorm(&sbet1, &cbet1);
+    cbet1 = fmax(SFGeodesicTiny, cbet1);
+    
+    SFGeodesicSinCosd(lat2, &sbet2, &cbet2);
+    sbet2 *= g->f1;
+    SFGeodesicNorm(&sbet2, &cbet2);
+    cbet2 = fmax(SFGeodesicTiny, cbet2);
+    
+    if(cbet1 < -sbet1){
+        if(cbet2 == cbet1){
+            sbet2 = copysign(sbet1, sbet2);
+        }
+    }else if(fabs(sbet2) == -sbet1){
+        cbet2 = cbet1;
+    }
+    
+    double dn1 = sqrt(1 + g->ep2 * sbet1 * sbet1);
+    double dn2 = sqrt(1 + g->ep2 * sbet2 * sbet2);
+    
+    double sig12 = 0;
+    double s12x = 0;
+    double m12x = 0;
+    double salp1 = 0, calp1 = 0, salp2 = 0, calp2 = 0;
+    double omg12 = 0;
+    double somg12 = 2;
+    double comg12 = 0;
+    
+    BOOL meridian = lat1 == -90 || slam12 == 0;
+    
+    if(meridian){
+        // Point 1 is a pole or both points are on a meridian
+        calp1 = clam12;
+        salp1 = slam12;
+        calp2 = 1;
+        salp2 = 0;
+        
+        double ssig1 = sbet1;
+        double csig1 = calp1 * cbet1;
+        double ssig2 = sbet2;
+        double csig2 = calp2 * cbet2;
+        
+        sig12 = atan2(fmax(0.0, csig1 * ssig2 - ssig1 * csig2) + 0.0, csig1 * csig2 + ssig1 * ssig2);
+        SFGeodesicLengths(g, g->n, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2, &s12x, &m12x, C1a, C2a);
+        
+        if(sig12 < SFGeodesicTol2 || m12x >= 0){
+            if(sig12 < 3 * SFGeodesicTiny || (sig12 < SFGeodesicTol0 && (s12x < 0 || m12x < 0))){
+                sig12 = m12x = s12x = 0;
+            }
+            m12x *= g->b;
+            s12x *= g->b;
+        }else{
+            // Prolate and nearly antipodal, not the shortest path
+            meridian = NO;
+        }
+    }
+    
+    if(!meridian && sbet1 == 0 && (g->f <= 0 || lon12s >= g->f * 180)){
+        // Both points on the equator
+        calp1 = calp2 = 0;
+        salp1 = salp2 = 1;
+        s12x = g->a * lam12;
+        sig12 = omg12 = lam12 / g->f1;
+    }else if(!meridian){
+        double dnm = 1;
+        sig12 = SFGeodesicInverseStart(g, sbet1, cbet1, dn1, sbet2, cbet2, dn2, lam12, slam12, clam12,
+                                       &salp1, &calp1, &salp2, &calp2, &dnm);
+        if(sig12 >= 0){
+            // Short line solution
+            s12x = sig12 * g->b * dnm;
+            omg12 = lam12 / (g->f1 * dnm);
+        }else{
+            // Newton's method on the azimuth, falling back to bisection
+            double ssig1 = 0, csig1 = 0, ssig2 = 0, csig2 = 0, eps = 0, domg12 = 0;
+            int numit = 0;
+            BOOL tripn = NO;
+            BOOL tripb = NO;
+            double salp1a = SFGeodesicTiny, calp1a = 1;
+            double salp1b = SFGeodesicTiny, calp1b = -1;
+            for(;;){
+                double dv = 0;
+                double v = SFGeodesicLambda12(g, sbet1, cbet1, dn1, sbet2, cbet2, dn2, salp1, calp1, slam12, clam12,
+                                              &salp2, &calp2, &sig12, &ssig1, &csig1, &ssig2, &csig2, &eps, &domg12,
+                                              numit < SF_GEODESIC_MAX_NEWTON, &dv, C1a, C2a, C3a);
+                if(tripb || !(fabs(v) >= (tripn ? 8 : 1) * SFGeodesicTol0) || numit == SF_GEODESIC_MAX_ITERATIONS){
+                    break;
+                }
+                // Update the bisection bracket
+                if(v > 0 && (numit > SF_GEODESIC_MAX_NEWTON || calp1 / salp1 > calp1b / salp1b)){
+                    salp1b = salp1;
+                    calp1b = calp1;
+                }else if(v < 0 && (numit > SF_GEODESIC_MAX_NEWTON || calp1 / salp1 < calp1a / salp1a)){
+                    salp1a = salp1;
+                    calp1a = calp1;
+                }
+                numit++;
+                if(numit < SF_GEODESIC_MAX_NEWTON && dv > 0){
+                    double dalp1 = -v / dv;
+                    if(fabs(dalp1) < M_PI){
+                        double sdalp1 = sin(dalp1);
+                        double cdalp1 = cos(dalp1);
+                        double nsalp1 = salp1 * cdalp1 + calp1 * sdalp1;
+                        if(nsalp1 > 0){
+                            calp1 = calp1 * cdalp1 - salp1 * sdalp1;
+                            salp1 = nsalp1;
+                            SFGeodesicNorm(&salp1, &calp1);
+                            tripn = fabs(v) <= 16 * SFGeodesicTol0;
+                            continue;
+                        }
+                    }
+                }
+                salp1 = (salp1a + salp1b) / 2;
+                calp1 = (calp1a + calp1b) / 2;
+                SFGeodesicNorm(&salp1, &calp1);
+                tripn = NO;
+                tripb = fabs(salp1a - salp1) + (calp1a - calp1) < SFGeodesicTol0
+                    || fabs(salp1 - salp1b) + (calp1 - calp1b) < SFGeodesicTol0;
+            }
+            SFGeodesicLengths(g, eps, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2, &s12x, NULL, C1a, C2a);
+            s12x *= g->b;
+            if(area != NULL){
+                double sdomg12 = sin(domg12);
+                double cdomg12 = cos(domg12);
+                somg12 = slam12 * cdomg12 - clam12 * sdomg12;
+                comg12 = clam12 * cdomg12 + slam12 * sdomg12;
+            }
+        }
+    }
+    
+    if(area != NULL){
+        double salp0 = salp1 * cbet1;
+        double calp0 = hypot(calp1, salp1 * sbet1);
+        double S12 = 0;
+        if(calp0 != 0 && salp0 != 0){
+            double ssig1 = sbet1;
+            double csig1 = calp1 * cbet1;
+            double ssig2 = sbet2;
+            double csig2 = calp2 * cbet2;
+            double k2 = calp0 * calp0 * g->ep2;
+            double eps = k2 / (2 * (1 + sqrt(1 + k2)) + k2);
+            double A4 = g->a * g->a * calp0 * salp0 * g->e2;
+            SFGeodesicNorm(&ssig1, &csig1);
+            SFGeodesicNorm(&ssig2, &csig2);
+            double C4a[SF_GEODESIC_ORDER];
+            SFGeodesicC4f(g, eps, C4a);
+            double B41 = SFGeodesicSinCosSeries(NO, ssig1, csig1, C4a, SF_GEODESIC_ORDER);
+            double B42 = SFGeodesicSinCosSeries(NO, ssig2, csig2, C4a, SF_GEODESIC_ORDER);
+            S12 = A4 * (B42 - B41);
+        }
+        
+        if(!meridian && somg12 == 2){
+            somg12 = sin(omg12);
+            comg12 = cos(omg12);
+        }
+        
+        double alp12;
+        if(!meridian && comg12 > -0.7071 && sbet2 - sbet1 < 1.75){
+            double domg12 = 1 + comg12;
+            double dbet1 = 1 + cbet1;
+            double dbet2 = 1 + cbet2;
+            alp12 = 2 * atan2(somg12 * (sbet1 * dbet2 + sbet2 * dbet1), domg12 * (sbet1 * sbet2 + dbet1 * dbet2));
+        }else{
+            double salp12 = salp2 * calp1 - calp2 * salp1;
+            double calp12 = calp2 * calp1 + salp2 * salp1;
+            if(salp12 == 0 && calp12 < 0){
+                salp12 = SFGeodesicTiny * calp1;
+                calp12 = -1;
+            }
+            alp12 = atan2(salp12, calp12);
+        }
+        S12 += g->c2 * alp12;
+        S12 *= swapp * lonsign * latsign;
+        *area = S12 + 0.0;
+    }
+    
+    if(swapp < 0){
+        double t = salp1;
+        salp1 = salp2;
+        salp2 = t;
+        t = calp1;
+        calp1 = calp2;
+        calp2 = t;
+    }
+    
+    if(azi1 != NULL){
+        *azi1 = SFGeodesicAtan2d(salp1 * swapp * lonsign, calp1 * swapp * latsign);
+    }
+    if(azi2 != NULL){
+        *azi2 = SFGeodesicAtan2d(salp2 * swapp * lonsign, calp2 * swapp * latsign);
+    }
+    
+    return s12x + 0.0;
+}
+
+/**
+ * Solve the direct geodesic problem on the ellipsoid
+ *
+ * @param g
+ *            ellipsoid
+ * @param lat1
+ *            latitude 1 in degrees
+ * @param lon1
+ *            longitude 1 in degrees
+ * @param azi1
+ *            initial azimuth in degrees
+ * @param s12
+ *            distance in meters
+ * @param lat2
+ *            output latitude 2 in degrees
+ * @param lon2
+ *            output longitude 2 in degrees, -180 to 180
+ */
+static void SFGeodesicDirect(const SFGeodesicEllipsoid *g, double lat1, double lon1, double azi1, double s12,
+                             double *lat2, double *lon2){
+    double C1a[SF_GEODESIC_ORDER + 1];
+    double C1pa[SF_GEODESIC_ORDER + 1];
+    double C3a[SF_GEODESIC_ORDER];
+    
+    lat1 = SFGeodesicLatFix(lat1);
+    double salp1, calp1;
+    SFGeodesicSinCosd(SFGeodesicAngRound(azi1), &salp1, &calp1);
+    
+    double sbet1, cbet1;
+    SFGeodesicSinCosd(SFGeodesicAngRound(lat1), &sbet1, &cbet1);
+    sbet1 *= g->f1;
+    SFGeodesicNorm(&sbet1, &cbet1);
+    cbet1 = fmax(SFGeodesicTiny, cbet1);
+    
+    double salp0 = salp1 * cbet1;
+    double calp0 = hypot(calp1, salp1 * sbet1);
+    
+    double ssig1 = sbet1;
+    double somg1 = salp0 * sbet1;
+    double csig1 = sbet1 != 0 || calp1 != 0 ? cbet1 * calp1 : 1;
+    double comg1 = csig1;
+    SFGeodesicNorm(&ssig1, &csig1);
+    
+    double k2 = calp0 * calp0 * g->ep2;
+    double eps = k2 / (2 * (1 + sqrt(1 + k2)) + k2);
+    
+    double A1m1 = SFGeodesicA1m1f(eps);
+    SFGeodesicC1f(eps, C1a);
+    double B11 = SFGeodesicSinCosSeries(YES, ssig1, csig1, C1a, SF_GEODESIC_ORDER);
+    double s = sin(B11);
+    double c = cos(B11);
+    double stau1 = ssig1 * c + csig1 * s;
+    double ctau1 = csig1 * c - ssig1 * s;
+    
+    SFGeodesicC1pf(eps, C1pa);
+    SFGeodesicC3f(g, eps, C3a);
+    double A3c = -g->f * salp0 * SFGeodesicA3f(g, eps);
+    double B31 = SFGeodesicSinCosSeries(YES, ssig1, csig1, C3a, SF_GEODESIC_ORDER - 1);
+    
+    double tau12 = s12 / (g->b * (1 + A1m1));
+    s = sin(tau12);
+    c = cos(tau12);
+    double B12 = -SFGeodesicSinCosSeries(YES, stau1 * c + ctau1 * s, ctau1 * c - stau1 * s, C1pa, SF_GEODESIC_ORDER);
+    double sig12 = tau12 - (B12 - B11);
+    double ssig12 = sin(sig12);
+    double csig12 = cos(sig12);
+    
+    double ssig2 = ssig1 * csig12 + csig1 * ssig12;
+    double csig2 = csig1 * csig12 - ssig1 * ssig12;
+    double sbet2 = calp0 * ssig2;
+    double cbet2 = hypot(salp0, calp0 * csig2);
+    if(cbet2 == 0){
+        cbet2 = csig2 = SFGeodesicTiny;
+    }
+    
+    double somg2 = salp0 * ssig2;
+    double comg2 = csig2;
+    double omg12 = atan2(somg2 * comg1 - comg2 * somg1, comg2 * comg1 + somg2 * somg1);
+    double lam12 = omg12 + A3c * (sig12 + (SFGeodesicSinCosSeries(YES, ssig2, csig2, C3a, SF_GEODESIC_ORDER - 1) - B31));
+    double lon12 = lam12 / SF_GEODESIC_DEGREE;
+    
+    *lon2 = SFGeodesicAngNormalize(SFGeodesicAngNormalize(lon1) + SFGeodesicAngNormalize(lon12));
+    *lat2 = SFGeodesicAtan2d(sbet2, g->f1 * cbet2);
+}
+
+/**
+ * Haversine distance on the mean radius sphere
+ *
+ * @param lat1
+ *            latitude 1 in degrees
+ * @param lon1
+ *            longitude 1 in degrees
+ * @param lat2
+ *            latitude 2 in degrees
+ * @param lon2
+ *            longitude 2 in degrees
+ * @return distance in meters
+ */
+static double SFGeodesicSphereDistance(double lat1, double lon1, double lat2, double lon2){
+    double sinLat = sin((lat2 - lat1) * SF_GEODESIC_DEGREE / 2);
+    double sinLon = sin((lon2 - lon1) * SF_GEODESIC_DEGREE / 2);
+    double h = sinLat * sinLat + cos(lat1 * SF_GEODESIC_DEGREE) * cos(lat2 * SF_GEODESIC_DEGREE) * sinLon * sinLon;
+    return 2 * SF_EARTH_MEAN_RADIUS * asin(sqrt(fmin(1.0, h)));
+}
+
+/**
+ * Initial azimuth on the sphere
+ *
+ * @param lat1
+ *            latitude 1 in degrees
+ * @param lon1
+ *            longitude 1 in degrees
+ * @param lat2
+ *            latitude 2 in degrees
+ * @param lon2
+ *            longitude 2 in degrees
+ * @return azimuth in degrees
+ */
+static double SFGeodesicSphereAzimuth(double lat1, double lon1, double lat2, double lon2){
+    double e;
+    double slam12, clam12, sphi1, cphi1, sphi2, cphi2;
+    SFGeodesicSinCosd(SFGeodesicAngDiff(lon1, lon2, &e), &slam12, &clam12);
+    SFGeodesicSinCosd(lat1, &sphi1, &cphi1);
+    SFGeodesicSinCosd(lat2, &sphi2, &cphi2);
+    return SFGeodesicAtan2d(slam12 * cphi2, cphi1 * sphi2 - sphi1 * cphi2 * clam12);
+}
+
+/**
+ * Destination on the sphere
+ *
+ * @param lat1
+ *            latitude 1 in degrees
+ * @param lon1
+ *            longitude 1 in degrees
+ * @param azi1
+ *            initial azimuth in degrees
+ * @param s12
+ *            distance in meters
+ * @param lat2
+ *            output latitude 2 in degrees
+ * @param lon2
+ *            output longitude 2 in degrees, -180 to 180
+ */
+static void SFGeodesicSphereDirect(double lat1, double lon1, double azi1, double s12, double *lat2, double *lon2){
+    double sphi1, cphi1, salp1, calp1;
+    SFGeodesicSinCosd(lat1, &sphi1, &cphi1);
+    SFGeodesicSinCosd(azi1, &salp1, &calp1);
+    double sig12 = s12 / SF_EARTH_MEAN_RADIUS;
+    double ssig12 = sin(sig12);
+    double csig12 = cos(sig12);
+    double sphi2 = sphi1 * csig12 + cphi1 * ssig12 * calp1;
+    *lat2 = SFGeodesicAtan2d(sphi2, hypot(cphi1 * csig12 - sphi1 * ssig12 * calp1, salp1 * ssig12));
+    double lam12 = atan2(salp1 * ssig12 * cphi1, csig12 - sphi1 * sphi2);
+    *lon2 = SFGeodesicAngNormalize(SFGeodesicAngNormalize(lon1) + lam12 / SF_GEODESIC_DEGREE);
+}
+
+/**
+ * Area between the great circle edge and the equator on the sphere, with
+ * the same sign convention as the ellipsoid inverse area
+ *
+ * @param lat1
+ *            latitude 1 in degrees
+ * @param lon1
+ *            longitude 1 in degrees
+ * @param lat2
+ *            latitude 2 in degrees
+ * @param lon2
+ *            longitude 2 in degrees
+ * @return area in square meters
+ */
+static double SFGeodesicSphereEdgeArea(double lat1, double lon1, double lat2, double lon2){
+    double e;
+    double lam12 = SFGeodesicAngDiff(lon1, lon2, &e) * SF_GEODESIC_DEGREE;
+    double t1 = tan(lat1 * SF_GEODESIC_DEGREE / 2);
+    double t2 = tan(lat2 * SF_GEODESIC_DEGREE / 2);
+    double excess = 2 * atan2(tan(lam12 / 2) * (t1 + t2), 1 + t1 * t2);
+    return excess * SF_EARTH_MEAN_RADIUS * SF_EARTH_MEAN_RADIUS;
+}
+
+/**
+ * Geodesic distance
+ *
+ * @param type
+ *            geodesic type
+ * @param lat1
+ *            latitude 1 in degrees
+ * @param lon1
+ *            longitude 1 in degrees
+ * @param lat2
+ *            latitude 2 in degrees
+ * @param lon2
+ *            longitude 2 in degrees
+ * @return distance in meters
+ */
+static double SFGeodesicDistance(enum SFGeodesicType type, double lat1, double lon1, double lat2, double lon2){
+    double distance;
+    if(type == SF_GT_SPHERE){
+        distance = SFGeodesicSphereDistance(lat1, lon1, lat2, lon2);
+    }else{
+        distance = SFGeodesicInverse(SFGeodesicWGS84(), lat1, lon1, lat2, lon2, NULL, NULL, NULL);
+    }
+    return distance;
+}
+
+/**
+ * Geodesic distances between packed coordinate pairs
+ *
+ * @param type
+ *            geodesic type
+ * @param coordinates1
+ *            packed longitude, latitude coordinates 1
+ * @param coordinates2
+ *            packed longitude, latitude coordinates 2
+ * @param count
+ *            number of coordinate pairs
+ * @param distances
+ *            output distances in meters
+ */
+static void SFGeodesicDistances(enum SFGeodesicType type, const double *coordinates1, const double *coordinates2,
+                                size_t count, double *distances){
+    if(type == SF_GT_SPHERE){
+        for(size_t i = 0; i < count; i++){
+            distances[i] = SFGeodesicSphereDistance(coordinates1[2 * i + 1], coordinates1[2 * i],
+                                                    coordinates2[2 * i + 1], coordinates2[2 * i]);
+        }
+    }else{
+        const SFGeodesicEllipsoid *g = SFGeodesicWGS84();
+        for(size_t i = 0; i < count; i++){
+            distances[i] = SFGeodesicInverse(g, coordinates1[2 * i + 1], coordinates1[2 * i],
+                                             coordinates2[2 * i + 1], coordinates2[2 * i], NULL, NULL, NULL);
+        }
+    }
+}
+
+/**
+ * Geodesic length of a path of packed coordinates
+ *
+ * @param type
+ *            geodesic type
+ * @param coordinates
+ *            packed longitude, latitude coordinates
+ * @param count
+ *            number of coordinates
+ * @return length in meters
+ */
+static double SFGeodesicPathLength(enum SFGeodesicType type, const double *coordinates, size_t count){
+    SFGeodesicSum length = {0, 0};
+    for(size_t i = 1; i < count; i++){
+        SFGeodesicSumAdd(&length, SFGeodesicDistance(type, coordinates[2 * i - 1], coordinates[2 * i - 2],
+                                                     coordinates[2 * i + 1], coordinates[2 * i]));
+    }
+    return length.sum + length.compensation;
+}
+
+/**
+ * Crossings of the prime meridian by the edge, counting the direction
+ *
+ * @param lon1
+ *            longitude 1 in degrees
+ * @param lon2
+ *            longitude 2 in degrees
+ * @return 1 if crossing eastward, -1 if crossing westward, 0 otherwise
+ */
+static int SFGeodesicTransit(double lon1, double lon2){
+    double e;
+    double lon12 = SFGeodesicAngDiff(lon1, lon2, &e);
+    lon1 = SFGeodesicAngNormalize(lon1);
+    lon2 = SFGeodesicAngNormalize(lon2);
+    int transit = 0;
+    if(lon12 > 0 && ((lon1 < 0 && lon2 >= 0) || (lon1 > 0 && lon2 == 0))){
+        transit = 1;
+    }else if(lon12 < 0 && lon1 >= 0 && lon2 < 0){
+        transit = -1;
+    }
+    return transit;
+}
+
+/**
+ * Geodesic signed area of a ring of packed coordinates
+ *
+ * @param type
+ *            geodesic type
+ * @param coordinates
+ *            packed longitude, latitude coordinates
+ * @param count
+ *            number of coordinates
+ * @return signed area in square meters, positive when counter clockwise
+ */
+static double SFGeodesicRingArea(enum SFGeodesicType type, const double *coordinates, size_t count){
+    if(count < 3){
+        return 0.0;
+    }
+    
+    const SFGeodesicEllipsoid *g = SFGeodesicWGS84();
+    double area0 = type == SF_GT_SPHERE
+        ? 4 * M_PI * SF_EARTH_MEAN_RADIUS * SF_EARTH_MEAN_RADIUS
+        : 4 * M_PI * g->c2;
+    
+    SFGeodesicSum sum = {0, 0};
+    int crossings = 0;
+    for(size_t i = 0; i < count; i++){
+        size_t j = i + 1 < count ? i + 1 : 0;
+        double lon1 = coordinates[2 * i];
+        double lat1 = coordinates[2 * i + 1];
+        double lon2 = coordinates[2 * j];
+        double lat2 = coordinates[2 * j + 1];
+        double edgeArea;
+        if(type == SF_GT_SPHERE){
+            edgeArea = SFGeodesicSphereEdgeArea(lat1, lon1, lat2, lon2);
+        }else{
+            SFGeodesicInverse(g, lat1, lon1, lat2, lon2, NULL, NULL, &edgeArea);
+        }
+        SFGeodesicSumAdd(&sum, edgeArea);
+        crossings += SFGeodesicTransit(lon1, lon2);
+    }
+    
+    double area = remainder(sum.sum, area0) + sum.compensation;
+    area = remainder(area, area0);
+    if(crossings & 1){
+        area += (area < 0 ? 1 : -1) * area0 / 2;
+    }
+    area = -area;
+    if(area > area0 / 2){
+        area -= area0;
+    }else if(area <= -area0 / 2){
+        area += area0;
+    }
+    return area + 0.0;
+}
+
+@implementation SFGeodesic
+
++(double) distanceBetweenPoint1: (SFPoint *) point1 andPoint2: (SFPoint *) point2{
+    return [self distanceBetweenPoint1:point1 andPoint2:point2 withType:SF_GT_ELLIPSOID];
+}
+
++(double) distanceBetweenPoint1: (SFPoint *) point1 andPoint2: (SFPoint *) point2 withType: (enum SFGeodesicType) type{
+    return SFGeodesicDistance(type, [point1.y doubleValue], [point1.x doubleValue], [point2.y doubleValue], [point2.x doubleValue]);
+}
+
++(double) azimuthFromPoint1: (SFPoint *) point1 toPoint2: (SFPoint *) point2{
+    return [self azimuthFromPoint1:point1 toPoint2:point2 withType:SF_GT_ELLIPSOID];
+}
+
++(double) azimuthFromPoint1: (SFPoint *) point1 toPoint2: (SFPoint *) point2 withType: (enum SFGeodesicType) type{
+    double lat1 = [point1.y doubleValue];
+    double lon1 = [point1.x doubleValue];
+    double lat2 = [point2.y doubleValue];
+    double lon2 = [point2.x doubleValue];
+    double azimuth;
+    if(type == SF_GT_SPHERE){
+        azimuth = SFGeodesicSphereAzimuth(lat1, lon1, lat2, lon2);
+    }else{
+        SFGeodesicInverse(SFGeodesicWGS84(), lat1, lon1, lat2, lon2, &azimuth, NULL, NULL);
+    }
+    return azimuth;
+}
+
++(SFPoint *) destinationFromPoint: (SFPoint *) point withAzimuth: (double) azimuth andDistance: (double) distance{
+    return [self destinationFromPoint:point withAzimuth:azimuth andDistance:distance andType:SF_GT_ELLIPSOID];
+}
+
++(SFPoint *) destinationFromPoint: (SFPoint *) point withAzimuth: (double) azimuth andDistance: (double) distance andType: (enum SFGeodesicType) type{
+    double lat1 = [point.y doubleValue];
+    double lon1 = [point.x doubleValue];
+    double lat2;
+    double lon2;
+    if(type == SF_GT_SPHERE){
+        SFGeodesicSphereDirect(lat1, lon1, azimuth, distance, &lat2, &lon2);
+    }else{
+        SFGeodesicDirect(SFGeodesicWGS84(), lat1, lon1, azimuth, distance, &lat2, &lon2);
+    }
+    return [[SFPoint alloc] initWithXValue:lon2 andYValue:lat2];
+}
+
++(double) lengthOfGeometry: (SFGeometry *) geometry{
+    return [self lengthOfGeometry:geometry withType:SF_GT_ELLIPSOID];
+}
+
++(double) lengthOfGeometry: (SFGeometry *) geometry withType: (enum SFGeodesicType) type{
+    return [self measure:SF_GEODESIC_LENGTH ofGeometry:geometry withType:type];
+}
+
++(double) perimeterOfGeometry: (SFGeometry *) geometry{
+    return [self perimeterOfGeometry:geometry withType:SF_GT_ELLIPSOID];
+}
+
++(double) perimeterOfGeometry: (SFGeometry *) geometry withType: (enum SFGeodesicType) type{
+    return [self measure:SF_GEODESIC_PERIMETER ofGeometry:geometry withType:type];
+}
+
++(double) areaOfGeometry: (SFGeometry *) geometry{
+    return [self areaOfGeometry:geometry withType:SF_GT_ELLIPSOID];
+}
+
++(double) areaOfGeometry: (SFGeometry *) geometry withType: (enum SFGeodesicType) type{
+    return [self measure:SF_GEODESIC_AREA ofGeometry:geometry withType:type];
+}
+
++(void) distancesBetweenCoordinates1: (const double *) coordinates1 andCoordinates2: (const double *) coordinates2 withCount: (NSUInteger) count intoDistances: (double *) distances withType: (enum SFGeodesicType) type{
+    
+    if(count < SF_GEODESIC_CONCURRENT_CHUNK * 2){
+        SFGeodesicDistances(type, coordinates1, coordinates2, count, distances);
+    }else{
+        size_t chunks = (count + SF_GEODESIC_CONCURRENT_CHUNK - 1) / SF_GEODESIC_CONCURRENT_CHUNK;
+        dispatch_apply(chunks, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t chunk) {
+            size_t start = chunk * SF_GEODESIC_CONCURRENT_CHUNK;
+            size_t end = MIN(start + SF_GEODESIC_CONCURRENT_CHUNK, count);
+            SFGeodesicDistances(type, coordinates1 + 2 * start, coordinates2 + 2 * start, end - start, distances + start);
+        });
+    }
+}
+
++(double) lengthOfCoordinates: (const double *) coordinates withCount: (NSUInteger) count andType: (enum SFGeodesicType) type{
+    
+    double length = 0.0;
+    if(count < SF_GEODESIC_CONCURRENT_CHUNK * 2){
+        length = SFGeodesicPathLength(type, coordinates, count);
+    }else{
+        // Each chunk measures its segments through the first coordinate of the next chunk
+        size_t segments = count - 1;
+        size_t chunks = (segments + SF_GEODESIC_CONCURRENT_CHUNK - 1) / SF_GEODESIC_CONCURRENT_CHUNK;
+        double *lengths = calloc(chunks, sizeof(double));
+        dispatch_apply(chunks, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t chunk) {
+            size_t start = chunk * SF_GEODESIC_CONCURRENT_CHUNK;
+            size_t end = MIN(start + SF_GEODESIC_CONCURRENT_CHUNK, segments);
+            lengths[chunk] = SFGeodesicPathLength(type, coordinates + 2 * start, end - start + 1);
+        });
+        SFGeodesicSum sum = {0, 0};
+        for(size_t chunk = 0; chunk < chunks; chunk++){
+            SFGeodesicSumAdd(&sum, lengths[chunk]);
+        }
+        free(lengths);
+        length = sum.sum + sum.compensation;
+    }
+    return length;
+}
+
++(double) areaOfCoordinates: (const double *) coordinates withCount: (NSUInteger) count andType: (enum SFGeodesicType) type{
+    return SFGeodesicRingArea(type, coordinates, count);
+}
+
+/**
+ * Geodesic measure of the geometry
+ *
+ * @param measure
+ *            geodesic measure
+ * @param geometry
+ *            geometry
+ * @param type
+ *            geodesic type
+ * @return measure in meters or square meters
+ */
++(double) measure: (SFGeodesicMeasure) measure ofGeometry: (SFGeometry *) geometry withType: (enum SFGeodesicType) type{
+    
+    double value = 0.0;
+    
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch(geometryType){
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+        case SF_COMPOUNDCURVE:
+            if(measure == SF_GEODESIC_LENGTH){
+                value = [self measure:measure ofCurve:(SFCurve *) geometry withType:type];
+            }
+            break;
+        case SF_POLYGON:
+        case SF_CURVEPOLYGON:
+        case SF_TRIANGLE:
+            if(measure != SF_GEODESIC_LENGTH){
+                value = [self measure:measure ofCurvePolygon:(SFCurvePolygon *) geometry withType:type];
+            }
+            break;
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            if(measure != SF_GEODESIC_LENGTH){
+                for(SFPolygon *polygon in ((SFPolyhedralSurface *) geometry).polygons){
+                    value += [self measure:measure ofCurvePolygon:polygon withType:type];
+                }
+            }
+            break;
+        case SF_MULTILINESTRING:
+        case SF_MULTIPOLYGON:
+        case SF_MULTICURVE:
+        case SF_MULTISURFACE:
+        case SF_GEOMETRYCOLLECTION:
+            for(SFGeometry *subGeometry in ((SFGeometryCollection *) geometry).geometries){
+                value += [self measure:measure ofGeometry:subGeometry withType:type];
+            }
+            break;
+        default:
+            break;
+    }
+    
+    return value;
+}
+
+/**
+ * Geodesic perimeter or absolute area of the curve polygon
+ *
+ * @param measure
+ *            perimeter or area measure
+ * @param curvePolygon
+ *            curve polygon
+ * @param type
+ *            geodesic type
+ * @return perimeter in meters or area in square meters
+ */
++(double) measure: (SFGeodesicMeasure) measure ofCurvePolygon: (SFCurvePolygon *) curvePolygon withType: (enum SFGeodesicType) type{
+    
+    double value = 0.0;
+    
+    NSArray<SFCurve *> *rings = curvePolygon.rings;
+    for(int i = 0; i < rings.count; i++){
+        double ringValue = [self measure:measure ofCurve:[rings objectAtIndex:i] withType:type];
+        if(measure == SF_GEODESIC_AREA && i > 0){
+            ringValue = -ringValue;
+        }
+        value += ringValue;
+    }
+    
+    if(measure == SF_GEODESIC_AREA){
+        value = MAX(value, 0.0);
+    }
+    
+    return value;
+}
+
+/**
+ * Geodesic length or absolute ring area of the curve
+ *
+ * @param measure
+ *            length, perimeter, or area measure
+ * @param curve
+ *            curve
+ * @param type
+ *            geodesic type
+ * @return length in meters or area in square meters
+ */
++(double) measure: (SFGeodesicMeasure) measure ofCurve: (SFCurve *) curve withType: (enum SFGeodesicType) type{
+    
+    NSArray<SFPoint *> *points = nil;
+    switch(curve.geometryType){
+        case SF_CIRCULARSTRING:
+            points = [((SFCircularString *) curve) linearize].points;
+            break;
+        case SF_COMPOUNDCURVE:
+            points = [SFCurveUtils linearizeCompoundCurve:(SFCompoundCurve *) curve withSegmentsPerQuadrant:SF_CURVE_DEFAULT_SEGMENTS_PER_QUADRANT].points;
+            break;
+        default:
+            points = ((SFLineString *) curve).points;
+            break;
+    }
+    
+    double value = 0.0;
+    
+    int count = (int) points.count;
+    if(count > 1){
+        double stackCoordinates[SF_GEODESIC_BUFFER_SIZE * 2];
+        double *coordinates = count <= SF_GEODESIC_BUFFER_SIZE ? stackCoordinates : malloc(sizeof(double) * 2 * count);
+        
+        int i = 0;
+        for(SFPoint *point in points){
+            coordinates[i++] = [point.x doubleValue];
+            coordinates[i++] = [point.y doubleValue];
+        }
+        
+        switch(measure){
+            case SF_GEODESIC_AREA:
+                value = fabs(SFGeodesicRingArea(type, coordinates, count));
+                break;
+            case SF_GEODESIC_PERIMETER:
+                value = SFGeodesicPathLength(type, coordinates, count);
+                if(coordinates[0] != coordinates[2 * count - 2] || coordinates[1] != coordinates[2 * count - 1]){
+                    value += SFGeodesicDistance(type, coordinates[2 * count - 1], coordinates[2 * count - 2], coordinates[1], coordinates[0]);
+                }
+                break;
+            default:
+                value = SFGeodesicPathLength(type, coordinates, count);
+                break;
+        }
+        
+        if(coordinates != stackCoordinates){
+            free(coordinates);
+        }
+    }
+    
+    return value;
+}
+
+@end
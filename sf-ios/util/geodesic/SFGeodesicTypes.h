@@ -0,0 +1,22 @@
+//
+//  SFGeodesicTypes.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Geodesic calculation type, the accurate WGS84 ellipsoid (Karney) or the
+ * fast mean radius sphere (Haversine)
+ */
+enum SFGeodesicType{
+    SF_GT_ELLIPSOID = 0,
+    SF_GT_SPHERE
+};
+
+@interface SFGeodesicTypes : NSObject
+
+@end
@@ -0,0 +1,100 @@
+//
+//  SFGeoJSONReader.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+
+/**
+ * Streaming GeoJSON geometry reader. A pull parser over UTF-8 bytes reads a
+ * GeoJSON geometry, Feature, or FeatureCollection through a fixed size
+ * buffer, returning the geometries of FeatureCollection features one at a
+ * time so documents of any size are read in bounded memory. Coordinate
+ * arrays are parsed directly into packed values before geometries are
+ * created, and all other members, such as feature properties, are skipped
+ * without being decoded. Features with null geometries are skipped, and
+ * empty Point coordinates are read as points with NaN coordinates.
+ *
+ * https://tools.ietf.org/html/rfc7946
+ */
+@interface SFGeoJSONReader : NSEnumerator<SFGeometry *>
+
+/**
+ * Initialize
+ *
+ * @param data
+ *            GeoJSON UTF-8 data
+ *
+ * @return new reader
+ */
+-(instancetype) initWithData: (NSData *) data;
+
+/**
+ * Initialize, streaming the file
+ *
+ * @param path
+ *            GeoJSON file path
+ *
+ * @return new reader
+ */
+-(instancetype) initWithPath: (NSString *) path;
+
+/**
+ * Initialize, opening the stream if not open
+ *
+ * @param stream
+ *            GeoJSON UTF-8 input stream
+ *
+ * @return new reader
+ */
+-(instancetype) initWithStream: (NSInputStream *) stream;
+
+/**
+ * Determine if there is another geometry, reading ahead to it
+ *
+ * @return true if another geometry
+ */
+-(BOOL) hasNext;
+
+/**
+ * Read the next geometry
+ *
+ * @return geometry, nil when done
+ */
+-(SFGeometry *) nextObject;
+
+/**
+ * Number of bytes read so far
+ *
+ * @return byte offset
+ */
+-(unsigned long long) offset;
+
+/**
+ * Close the input stream
+ */
+-(void) close;
+
+/**
+ * Read a GeoJSON geometry or the geometry of a GeoJSON Feature
+ *
+ * @param text
+ *            GeoJSON text
+ * @return geometry, nil for a null feature geometry
+ */
++(SFGeometry *) readGeometryWithText: (NSString *) text;
+
+/**
+ * Read a GeoJSON geometry or the geometry of a GeoJSON Feature
+ *
+ * @param data
+ *            GeoJSON UTF-8 data
+ * @return geometry, nil for a null feature geometry
+ */
++(SFGeometry *) readGeometryWithData: (NSData *) data;
+
+@end
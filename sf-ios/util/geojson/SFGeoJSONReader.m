@@ -0,0 +1,926 @@
+//
+//  SFGeoJSONReader.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFGeoJSONReader.h"
+#import "SFPoint.h"
+#import "SFPolygon.h"
+#import "SFMultiPoint.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+
+/**
+ * Input stream read buffer size
+ */
+#define SF_GEOJSON_BUFFER_SIZE 65536
+
+/**
+ * Maximum coordinate array nesting depth, of MultiPolygon coordinates
+ */
+#define SF_GEOJSON_MAX_DEPTH 4
+
+/**
+ * Maximum object nesting depth, of geometry collection geometries and
+ * feature geometry members
+ */
+#define SF_GEOJSON_MAX_OBJECT_DEPTH 64
+
+/**
+ * Maximum member name and type name length, longer names are truncated
+ */
+#define SF_GEOJSON_NAME_SIZE 32
+
+/**
+ * Maximum number token length
+ */
+#define SF_GEOJSON_NUMBER_SIZE 64
+
+/**
+ * Pull parser over UTF-8 bytes, refilled from an optional input stream
+ */
+typedef struct SFGeoJSONParser{
+    const uint8_t *bytes;
+    size_t length;
+    size_t offset;
+    unsigned long long consumed;
+    uint8_t *buffer;
+    __unsafe_unretained NSInputStream *stream;
+    BOOL error;
+    int depth;
+} SFGeoJSONParser;
+
+/**
+ * Packed coordinates of a coordinates member. Positions are packed as x, y,
+ * and z values with NaN z values when absent. The array counts of each
+ * nesting level above the positions are in document order.
+ */
+typedef struct SFGeoJSONCoordinates{
+    double *values;
+    size_t count;
+    size_t capacity;
+    size_t *counts[SF_GEOJSON_MAX_DEPTH];
+    size_t countsLength[SF_GEOJSON_MAX_DEPTH];
+    size_t countsCapacity[SF_GEOJSON_MAX_DEPTH];
+    int depth;
+} SFGeoJSONCoordinates;
+
+/**
+ * Members of a GeoJSON object read so far
+ */
+typedef struct SFGeoJSONMembers{
+    char type[SF_GEOJSON_NAME_SIZE];
+    BOOL hasCoordinates;
+    SFGeoJSONCoordinates coordinates;
+} SFGeoJSONMembers;
+
+/**
+ * Refill the parser from the input stream
+ *
+ * @param parser
+ *            parser
+ * @return true if bytes were read
+ */
+static BOOL SFGeoJSONFill(SFGeoJSONParser *parser){
+    BOOL filled = NO;
+    if(parser->stream != nil && !parser->error){
+        parser->consumed += parser->length;
+        parser->offset = 0;
+        parser->length = 0;
+        NSInteger read = [parser->stream read:parser->buffer maxLength:SF_GEOJSON_BUFFER_SIZE];
+        if(read > 0){
+            parser->bytes = parser->buffer;
+            parser->length = read;
+            filled = YES;
+        }else if(read < 0){
+            parser->error = YES;
+        }
+    }
+    return filled;
+}
+
+/**
+ * Peek at the next byte
+ *
+ * @param parser
+ *            parser
+ * @return byte, -1 at the end
+ */
+static inline int SFGeoJSONPeek(SFGeoJSONParser *parser){
+    if(parser->offset >= parser->length && !SFGeoJSONFill(parser)){
+        return -1;
+    }
+    return parser->bytes[parser->offset];
+}
+
+/**
+ * Peek at the next non whitespace byte
+ *
+ * @param parser
+ *            parser
+ * @return byte, -1 at the end
+ */
+static int SFGeoJSONPeekToken(SFGeoJSONParser *parser){
+    int c = SFGeoJSONPeek(parser);
+    while(c == ' ' || c == '\n' || c == '\r' || c == '\t'){
+        parser->offset++;
+        c = SFGeoJSONPeek(parser);
+    }
+    return c;
+}
+
+/**
+ * Skip a UTF-8 byte order mark if present
+ *
+ * @param parser
+ *            parser
+ */
+static void SFGeoJSONSkipByteOrderMark(SFGeoJSONParser *parser){
+    const uint8_t mark[] = {0xEF, 0xBB, 0xBF};
+    for(int i = 0; i < 3 && SFGeoJSONPeek(parser) == mark[i]; i++){
+        parser->offset++;
+    }
+}
+
+/**
+ * Consume the next non whitespace byte if it matches
+ *
+ * @param parser
+ *            parser
+ * @param c
+ *            expected byte
+ * @return true if consumed
+ */
+static BOOL SFGeoJSONConsume(SFGeoJSONParser *parser, char c){
+    BOOL consumed = !parser->error && SFGeoJSONPeekToken(parser) == c;
+    if(consumed){
+        parser->offset++;
+    }
+    return consumed;
+}
+
+/**
+ * Consume the next non whitespace byte, flagging an error if it does not
+ * match
+ *
+ * @param parser
+ *            parser
+ * @param c
+ *            expected byte
+ */
+static void SFGeoJSONExpect(SFGeoJSONParser *parser, char c){
+    if(!SFGeoJSONConsume(parser, c)){
+        parser->error = YES;
+    }
+}
+
+/**
+ * Read a string, keeping at most capacity - 1 bytes of the value
+ *
+ * @param parser
+ *            parser
+ * @param value
+ *            null terminated value, or NULL to skip the string
+ * @param capacity
+ *            value capacity
+ */
+static void SFGeoJSONReadString(SFGeoJSONParser *parser, char *value, size_t capacity){
+    size_t length = 0;
+    SFGeoJSONExpect(parser, '"');
+    while(!parser->error){
+        int c = SFGeoJSONPeek(parser);
+        if(c < 0){
+            parser->error = YES;
+            break;
+        }
+        parser->offset++;
+        if(c == '"'){
+            break;
+        }
+        if(c == '\\'){
+            c = SFGeoJSONPeek(parser);
+            if(c < 0){
+                parser->error = YES;
+                break;
+            }
+            parser->offset++;
+            switch(c){
+                case 'b':
+                    c = '\b';
+                    break;
+                case 'f':
+                    c = '\f';
+                    break;
+                case 'n':
+                    c = '\n';
+                    break;
+                case 'r':
+                    c = '\r';
+                    break;
+                case 't':
+                    c = '\t';
+                    break;
+                case 'u':
+                    {
+                        int code = 0;
+                        for(int i = 0; i < 4 && !parser->error; i++){
+                            int hex = SFGeoJSONPeek(parser);
+                            if(hex >= '0' && hex <= '9'){
+                                code = (code << 4) | (hex - '0');
+                            }else if((hex | 0x20) >= 'a' && (hex | 0x20) <= 'f'){
+                                code = (code << 4) | ((hex | 0x20) - 'a' + 10);
+                            }else{
+                                parser->error = YES;
+                            }
+                            parser->offset++;
+                        }
+                        c = code < 0x80 ? code : '?';
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        if(value != NULL && length + 1 < capacity){
+            value[length++] = (char) c;
+        }
+    }
+    if(value != NULL && capacity > 0){
+        value[length] = '\0';
+    }
+}
+
+/**
+ * Read a number
+ *
+ * @param parser
+ *            parser
+ * @return number, 0 on error
+ */
+static double SFGeoJSONReadNumber(SFGeoJSONParser *parser){
+    char number[SF_GEOJSON_NUMBER_SIZE];
+    size_t length = 0;
+    int c = SFGeoJSONPeekToken(parser);
+    while((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E'){
+        if(length + 1 >= SF_GEOJSON_NUMBER_SIZE){
+            parser->error = YES;
+            return 0;
+        }
+        number[length++] = (char) c;
+        parser->offset++;
+        c = SFGeoJSONPeek(parser);
+    }
+    number[length] = '\0';
+    char *end = NULL;
+    double value = strtod(number, &end);
+    if(length == 0 || end != number + length){
+        parser->error = YES;
+        value = 0;
+    }
+    return value;
+}
+
+/**
+ * Skip a value of any type, without decoding it
+ *
+ * @param parser
+ *            parser
+ */
+static void SFGeoJSONSkipValue(SFGeoJSONParser *parser){
+    int depth = 0;
+    do{
+        int c = SFGeoJSONPeekToken(parser);
+        if(c == '"'){
+            SFGeoJSONReadString(parser, NULL, 0);
+        }else if(c == '{' || c == '['){
+            parser->offset++;
+            depth++;
+        }else if((c == '}' || c == ']') && depth > 0){
+            parser->offset++;
+            depth--;
+        }else if((c == ',' || c == ':') && depth > 0){
+            parser->offset++;
+        }else if(c == '-' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z')){
+            do{
+                parser->offset++;
+                c = SFGeoJSONPeek(parser);
+            }while(c == '-' || c == '+' || c == '.' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c == 'E');
+        }else{
+            parser->error = YES;
+        }
+    }while(depth > 0 && !parser->error);
+}
+
+/**
+ * Consume a null literal if next
+ *
+ * @param parser
+ *            parser
+ * @return true if consumed
+ */
+static BOOL SFGeoJSONConsumeNull(SFGeoJSONParser *parser){
+    BOOL consumed = SFGeoJSONPeekToken(parser) == 'n';
+    if(consumed){
+        const char *literal = "null";
+        for(int i = 0; i < 4; i++){
+            if(SFGeoJSONPeek(parser) != literal[i]){
+                parser->error = YES;
+                break;
+            }
+            parser->offset++;
+        }
+    }
+    return consumed;
+}
+
+/**
+ * Reset the coordinates for reuse, keeping allocations
+ *
+ * @param coordinates
+ *            coordinates
+ */
+static void SFGeoJSONCoordinatesReset(SFGeoJSONCoordinates *coordinates){
+    coordinates->count = 0;
+    coordinates->depth = -1;
+    for(int i = 0; i < SF_GEOJSON_MAX_DEPTH; i++){
+        coordinates->countsLength[i] = 0;
+    }
+}
+
+/**
+ * Free the coordinates allocations
+ *
+ * @param coordinates
+ *            coordinates
+ */
+static void SFGeoJSONCoordinatesFree(SFGeoJSONCoordinates *coordinates){
+    free(coordinates->values);
+    coordinates->values = NULL;
+    coordinates->capacity = 0;
+    for(int i = 0; i < SF_GEOJSON_MAX_DEPTH; i++){
+        free(coordinates->counts[i]);
+        coordinates->counts[i] = NULL;
+        coordinates->countsCapacity[i] = 0;
+    }
+    SFGeoJSONCoordinatesReset(coordinates);
+}
+
+/**
+ * Read a coordinates array, a position or an array of nested arrays
+ *
+ * @param parser
+ *            parser
+ * @param coordinates
+ *            packed coordinates
+ * @param level
+ *            array nesting level
+ */
+static void SFGeoJSONReadCoordinates(SFGeoJSONParser *parser, SFGeoJSONCoordinates *coordinates, int level){
+    
+    SFGeoJSONExpect(parser, '[');
+    int c = SFGeoJSONPeekToken(parser);
+    if(parser->error){
+        return;
+    }
+    
+    if(c == '-' || (c >= '0' && c <= '9')){
+        
+        // Position, with values beyond z ignored
+        double position[3] = {0, 0, NAN};
+        int count = 0;
+        do{
+            double value = SFGeoJSONReadNumber(parser);
+            if(count < 3){
+                position[count] = value;
+            }
+            count++;
+        }while(SFGeoJSONConsume(parser, ','));
+        SFGeoJSONExpect(parser, ']');
+        if(count < 2 || (coordinates->depth >= 0 && coordinates->depth != level)){
+            parser->error = YES;
+        }
+        if(parser->error){
+            return;
+        }
+        coordinates->depth = level;
+        if(coordinates->count == coordinates->capacity){
+            coordinates->capacity = MAX(64, coordinates->capacity * 2);
+            coordinates->values = realloc(coordinates->values, sizeof(double) * 3 * coordinates->capacity);
+        }
+        memcpy(coordinates->values + 3 * coordinates->count++, position, sizeof(position));
+        
+    }else{
+        
+        if(level + 1 >= SF_GEOJSON_MAX_DEPTH){
+            parser->error = YES;
+            return;
+        }
+        size_t count = 0;
+        if(!SFGeoJSONConsume(parser, ']')){
+            do{
+                SFGeoJSONReadCoordinates(parser, coordinates, level + 1);
+                count++;
+            }while(!parser->error && SFGeoJSONConsume(parser, ','));
+            SFGeoJSONExpect(parser, ']');
+        }
+        if(coordinates->countsLength[level] == coordinates->countsCapacity[level]){
+            coordinates->countsCapacity[level] = MAX(16, coordinates->countsCapacity[level] * 2);
+            coordinates->counts[level] = realloc(coordinates->counts[level], sizeof(size_t) * coordinates->countsCapacity[level]);
+        }
+        coordinates->counts[level][coordinates->countsLength[level]++] = count;
+        
+    }
+    
+}
+
+/**
+ * Reading state of the top level GeoJSON object
+ */
+enum SFGeoJSONState{
+    SF_GEOJSON_START,
+    SF_GEOJSON_MEMBERS,
+    SF_GEOJSON_FEATURES,
+    SF_GEOJSON_DONE
+};
+
+@interface SFGeoJSONReader(){
+    SFGeoJSONParser _parser;
+    SFGeoJSONMembers _members;
+    size_t _countIndexes[SF_GEOJSON_MAX_DEPTH];
+    size_t _positionIndex;
+}
+
+/**
+ * Input data
+ */
+@property (nonatomic, strong) NSData *data;
+
+/**
+ * Input stream
+ */
+@property (nonatomic, strong) NSInputStream *stream;
+
+/**
+ * Top level object reading state
+ */
+@property (nonatomic) enum SFGeoJSONState state;
+
+/**
+ * True if the next top level object member or feature is the first
+ */
+@property (nonatomic) BOOL first;
+
+/**
+ * Geometries of the top level object members
+ */
+@property (nonatomic, strong) NSMutableArray<SFGeometry *> *geometries;
+
+/**
+ * Geometry read ahead by hasNext
+ */
+@property (nonatomic, strong) SFGeometry *next;
+
+@end
+
+@implementation SFGeoJSONReader
+
+-(instancetype) initWithData: (NSData *) data{
+    self = [super init];
+    if(self != nil){
+        self.data = data;
+        _parser.bytes = data.bytes;
+        _parser.length = data.length;
+        [self resetState];
+    }
+    return self;
+}
+
+-(instancetype) initWithPath: (NSString *) path{
+    NSInputStream *stream = [NSInputStream inputStreamWithFileAtPath:path];
+    if(stream == nil){
+        [NSException raise:@"File Read" format:@"Failed to open GeoJSON file: %@", path];
+    }
+    return [self initWithStream:stream];
+}
+
+-(instancetype) initWithStream: (NSInputStream *) stream{
+    self = [super init];
+    if(self != nil){
+        self.stream = stream;
+        if(stream.streamStatus == NSStreamStatusNotOpen){
+            [stream open];
+        }
+        _parser.buffer = malloc(SF_GEOJSON_BUFFER_SIZE);
+        _parser.stream = stream;
+        [self resetState];
+    }
+    return self;
+}
+
+/**
+ * Reset the reading state to the start of the input
+ */
+-(void) resetState{
+    SFGeoJSONCoordinatesReset(&_members.coordinates);
+    _members.type[0] = '\0';
+    self.state = SF_GEOJSON_START;
+    self.geometries = [NSMutableArray array];
+}
+
+-(void) dealloc{
+    free(_parser.buffer);
+    SFGeoJSONCoordinatesFree(&_members.coordinates);
+}
+
+-(BOOL) hasNext{
+    if(self.next == nil){
+        self.next = [self readNext];
+    }
+    return self.next != nil;
+}
+
+-(SFGeometry *) nextObject{
+    SFGeometry *geometry = self.next;
+    if(geometry != nil){
+        self.next = nil;
+    }else{
+        geometry = [self readNext];
+    }
+    return geometry;
+}
+
+-(unsigned long long) offset{
+    return _parser.consumed + _parser.offset;
+}
+
+-(void) close{
+    [self.stream close];
+    self.state = SF_GEOJSON_DONE;
+}
+
++(SFGeometry *) readGeometryWithText: (NSString *) text{
+    return [self readGeometryWithData:[text dataUsingEncoding:NSUTF8StringEncoding]];
+}
+
++(SFGeometry *) readGeometryWithData: (NSData *) data{
+    return [[[SFGeoJSONReader alloc] initWithData:data] nextObject];
+}
+
+/**
+ * Read the next geometry of the top level object
+ *
+ * @return geometry, nil when done
+ */
+-(SFGeometry *) readNext{
+    
+    SFGeoJSONParser *parser = &_parser;
+    SFGeometry *geometry = nil;
+    
+    while(geometry == nil && self.state != SF_GEOJSON_DONE){
+        
+        switch(self.state){
+            
+            case SF_GEOJSON_START:
+                SFGeoJSONSkipByteOrderMark(parser);
+                if(SFGeoJSONPeekToken(parser) < 0 && !parser->error){
+                    self.state = SF_GEOJSON_DONE;
+                }else{
+                    SFGeoJSONExpect(parser, '{');
+                    self.state = SF_GEOJSON_MEMBERS;
+                    self.first = YES;
+                }
+                break;
+            
+            case SF_GEOJSON_MEMBERS:
+                if(SFGeoJSONConsume(parser, '}')){
+                    self.state = SF_GEOJSON_DONE;
+                    geometry = [self geometryWithMembers:&_members andGeometries:self.geometries];
+                }else{
+                    if(!self.first){
+                        SFGeoJSONExpect(parser, ',');
+                    }
+                    self.first = NO;
+                    char name[SF_GEOJSON_NAME_SIZE];
+                    SFGeoJSONReadString(parser, name, SF_GEOJSON_NAME_SIZE);
+                    SFGeoJSONExpect(parser, ':');
+                    if(!parser->error && strcmp(name, "features") == 0){
+                        SFGeoJSONExpect(parser, '[');
+                        self.state = SF_GEOJSON_FEATURES;
+                        self.first = YES;
+                    }else{
+                        [self readMember:name intoMembers:&_members andGeometries:self.geometries];
+                    }
+                }
+                break;
+            
+            case SF_GEOJSON_FEATURES:
+                if(SFGeoJSONConsume(parser, ']')){
+                    self.state = SF_GEOJSON_MEMBERS;
+                    self.first = NO;
+                }else{
+                    if(!self.first){
+                        SFGeoJSONExpect(parser, ',');
+                    }
+                    self.first = NO;
+                    geometry = [self readObject];
+                }
+                break;
+            
+            default:
+                break;
+        }
+        
+        if(parser->error){
+            [self raiseInvalid];
+        }
+    }
+    
+    return geometry;
+}
+
+/**
+ * Read a GeoJSON object
+ *
+ * @return geometry of a geometry object or feature, nil for a null feature
+ *         geometry or a feature collection
+ */
+-(SFGeometry *) readObject{
+    
+    SFGeoJSONParser *parser = &_parser;
+    SFGeoJSONMembers members;
+    members.type[0] = '\0';
+    members.hasCoordinates = NO;
+    memset(&members.coordinates, 0, sizeof(SFGeoJSONCoordinates));
+    SFGeoJSONCoordinatesReset(&members.coordinates);
+    NSMutableArray<SFGeometry *> *geometries = [NSMutableArray array];
+    
+    if(parser->depth >= SF_GEOJSON_MAX_OBJECT_DEPTH){
+        [self raiseInvalid];
+    }
+    parser->depth++;
+    
+    SFGeometry *geometry = nil;
+    @try {
+        SFGeoJSONExpect(parser, '{');
+        if(!SFGeoJSONConsume(parser, '}')){
+            do{
+                char name[SF_GEOJSON_NAME_SIZE];
+                SFGeoJSONReadString(parser, name, SF_GEOJSON_NAME_SIZE);
+                SFGeoJSONExpect(parser, ':');
+                [self readMember:name intoMembers:&members andGeometries:geometries];
+            }while(!parser->error && SFGeoJSONConsume(parser, ','));
+            SFGeoJSONExpect(parser, '}');
+        }
+        if(parser->error){
+            [self raiseInvalid];
+        }
+        geometry = [self geometryWithMembers:&members andGeometries:geometries];
+    } @finally {
+        SFGeoJSONCoordinatesFree(&members.coordinates);
+        parser->depth--;
+    }
+    
+    return geometry;
+}
+
+/**
+ * Read an object member value
+ *
+ * @param name
+ *            member name
+ * @param members
+ *            members read so far
+ * @param geometries
+ *            geometries of the object geometries or geometry members
+ */
+-(void) readMember: (const char *) name intoMembers: (SFGeoJSONMembers *) members andGeometries: (NSMutableArray<SFGeometry *> *) geometries{
+    
+    SFGeoJSONParser *parser = &_parser;
+    if(parser->error){
+        return;
+    }
+    
+    if(strcmp(name, "type") == 0){
+        SFGeoJSONReadString(parser, members->type, SF_GEOJSON_NAME_SIZE);
+    }else if(strcmp(name, "coordinates") == 0){
+        SFGeoJSONCoordinatesReset(&members->coordinates);
+        SFGeoJSONReadCoordinates(parser, &members->coordinates, 0);
+        members->hasCoordinates = YES;
+    }else if(strcmp(name, "geometries") == 0){
+        SFGeoJSONExpect(parser, '[');
+        if(!SFGeoJSONConsume(parser, ']')){
+            do{
+                SFGeometry *geometry = [self readObject];
+                if(geometry != nil){
+                    [geometries addObject:geometry];
+                }
+            }while(SFGeoJSONConsume(parser, ','));
+            SFGeoJSONExpect(parser, ']');
+        }
+    }else if(strcmp(name, "geometry") == 0){
+        if(!SFGeoJSONConsumeNull(parser)){
+            SFGeometry *geometry = [self readObject];
+            if(geometry != nil){
+                [geometries addObject:geometry];
+            }
+        }
+    }else{
+        SFGeoJSONSkipValue(parser);
+    }
+    
+}
+
+/**
+ * Create the geometry of a read object
+ *
+ * @param members
+ *            object members
+ * @param geometries
+ *            geometries of the object geometries or geometry members
+ * @return geometry, nil for a null feature geometry or a feature collection
+ */
+-(SFGeometry *) geometryWithMembers: (SFGeoJSONMembers *) members andGeometries: (NSMutableArray<SFGeometry *> *) geometries{
+    
+    const char *type = members->type;
+    SFGeometry *geometry = nil;
+    
+    if(strcmp(type, "Feature") == 0){
+        geometry = [geometries firstObject];
+    }else if(strcmp(type, "FeatureCollection") == 0){
+        geometry = nil;
+    }else if(strcmp(type, "GeometryCollection") == 0){
+        SFGeometryCollection *geometryCollection = [[SFGeometryCollection alloc] init];
+        [geometryCollection addGeometries:geometries];
+        geometry = geometryCollection;
+    }else{
+        
+        enum SFGeometryType geometryType = SF_NONE;
+        int depth = 0;
+        if(strcmp(type, "Point") == 0){
+            geometryType = SF_POINT;
+            depth = 0;
+        }else if(strcmp(type, "LineString") == 0){
+            geometryType = SF_LINESTRING;
+            depth = 1;
+        }else if(strcmp(type, "MultiPoint") == 0){
+            geometryType = SF_MULTIPOINT;
+            depth = 1;
+        }else if(strcmp(type, "Polygon") == 0){
+            geometryType = SF_POLYGON;
+            depth = 2;
+        }else if(strcmp(type, "MultiLineString") == 0){
+            geometryType = SF_MULTILINESTRING;
+            depth = 2;
+        }else if(strcmp(type, "MultiPolygon") == 0){
+            geometryType = SF_MULTIPOLYGON;
+            depth = 3;
+        }else{
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported GeoJSON type: '%s' ending at byte offset: %llu", type, [self offset]];
+        }
+        
+        SFGeoJSONCoordinates *coordinates = &members->coordinates;
+        if(!members->hasCoordinates || (coordinates->depth >= 0 && coordinates->depth != depth)){
+            [self raiseInvalid];
+        }
+        for(int i = 0; i < SF_GEOJSON_MAX_DEPTH; i++){
+            _countIndexes[i] = 0;
+        }
+        _positionIndex = 0;
+        
+        switch(geometryType){
+            case SF_POINT:
+                if(coordinates->count > 0){
+                    geometry = [self pointWithCoordinates:coordinates];
+                }else{
+                    geometry = [[SFPoint alloc] initWithXValue:NAN andYValue:NAN];
+                }
+                break;
+            case SF_LINESTRING:
+                geometry = [self lineStringWithCoordinates:coordinates atLevel:0];
+                break;
+            case SF_POLYGON:
+                geometry = [self polygonWithCoordinates:coordinates atLevel:0];
+                break;
+            case SF_MULTIPOINT:
+                {
+                    SFMultiPoint *multiPoint = [[SFMultiPoint alloc] init];
+                    size_t count = [self countWithCoordinates:coordinates atLevel:0];
+                    for(size_t i = 0; i < count; i++){
+                        [multiPoint addPoint:[self pointWithCoordinates:coordinates]];
+                    }
+                    geometry = multiPoint;
+                }
+                break;
+            case SF_MULTILINESTRING:
+                {
+                    SFMultiLineString *multiLineString = [[SFMultiLineString alloc] init];
+                    size_t count = [self countWithCoordinates:coordinates atLevel:0];
+                    for(size_t i = 0; i < count; i++){
+                        [multiLineString addLineString:[self lineStringWithCoordinates:coordinates atLevel:1]];
+                    }
+                    geometry = multiLineString;
+                }
+                break;
+            case SF_MULTIPOLYGON:
+                {
+                    SFMultiPolygon *multiPolygon = [[SFMultiPolygon alloc] init];
+                    size_t count = [self countWithCoordinates:coordinates atLevel:0];
+                    for(size_t i = 0; i < count; i++){
+                        [multiPolygon addPolygon:[self polygonWithCoordinates:coordinates atLevel:1]];
+                    }
+                    geometry = multiPolygon;
+                }
+                break;
+            default:
+                break;
+        }
+        
+    }
+    
+    return geometry;
+}
+
+/**
+ * Create a polygon from the next counted rings
+ *
+ * @param coordinates
+ *            packed coordinates
+ * @param level
+ *            nesting level of the ring count
+ * @return polygon
+ */
+-(SFPolygon *) polygonWithCoordinates: (SFGeoJSONCoordinates *) coordinates atLevel: (int) level{
+    SFPolygon *polygon = [[SFPolygon alloc] init];
+    size_t count = [self countWithCoordinates:coordinates atLevel:level];
+    for(size_t i = 0; i < count; i++){
+        [polygon addRing:[self lineStringWithCoordinates:coordinates atLevel:level + 1]];
+    }
+    return polygon;
+}
+
+/**
+ * Create a line string from the next counted positions
+ *
+ * @param coordinates
+ *            packed coordinates
+ * @param level
+ *            nesting level of the position count
+ * @return line string
+ */
+-(SFLineString *) lineStringWithCoordinates: (SFGeoJSONCoordinates *) coordinates atLevel: (int) level{
+    SFLineString *lineString = [[SFLineString alloc] init];
+    size_t count = [self countWithCoordinates:coordinates atLevel:level];
+    for(size_t i = 0; i < count; i++){
+        [lineString addPoint:[self pointWithCoordinates:coordinates]];
+    }
+    return lineString;
+}
+
+/**
+ * Create a point from the next position
+ *
+ * @param coordinates
+ *            packed coordinates
+ * @return point
+ */
+-(SFPoint *) pointWithCoordinates: (SFGeoJSONCoordinates *) coordinates{
+    if(_positionIndex >= coordinates->count){
+        [self raiseInvalid];
+    }
+    const double *position = coordinates->values + 3 * _positionIndex++;
+    BOOL hasZ = !isnan(position[2]);
+    SFPoint *point = [[SFPoint alloc] initWithHasZ:hasZ andHasM:NO andXValue:position[0] andYValue:position[1]];
+    if(hasZ){
+        [point setZValue:position[2]];
+    }
+    return point;
+}
+
+/**
+ * Get the next array count of the nesting level
+ *
+ * @param coordinates
+ *            packed coordinates
+ * @param level
+ *            nesting level
+ * @return count
+ */
+-(size_t) countWithCoordinates: (SFGeoJSONCoordinates *) coordinates atLevel: (int) level{
+    if(_countIndexes[level] >= coordinates->countsLength[level]){
+        [self raiseInvalid];
+    }
+    return coordinates->counts[level][_countIndexes[level]++];
+}
+
+/**
+ * Raise an invalid GeoJSON exception
+ */
+-(void) raiseInvalid{
+    self.state = SF_GEOJSON_DONE;
+    [NSException raise:@"Invalid GeoJSON" format:@"Failed to read GeoJSON at byte offset: %llu", [self offset]];
+}
+
+@end
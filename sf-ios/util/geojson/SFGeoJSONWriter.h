@@ -0,0 +1,114 @@
+//
+//  SFGeoJSONWriter.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+
+/**
+ * Streaming GeoJSON geometry writer. Geometries are written as UTF-8 bytes
+ * through a fixed size buffer, either into memory or flushed to an output
+ * stream, and FeatureCollections are written one feature at a time. Points,
+ * line strings, polygons, multi points, multi line strings, multi polygons,
+ * and geometry collections are supported, with z values. Triangles are
+ * written as Polygons and polyhedral surfaces and TINs as MultiPolygons. M
+ * values are not written. Empty points are written with empty coordinates.
+ *
+ * https://tools.ietf.org/html/rfc7946
+ */
+@interface SFGeoJSONWriter : NSObject
+
+/**
+ * Initialize, writing into memory
+ *
+ * @return new writer
+ */
+-(instancetype) init;
+
+/**
+ * Initialize, streaming to the file
+ *
+ * @param path
+ *            GeoJSON file path
+ *
+ * @return new writer
+ */
+-(instancetype) initWithPath: (NSString *) path;
+
+/**
+ * Initialize, opening the stream if not open
+ *
+ * @param stream
+ *            output stream
+ *
+ * @return new writer
+ */
+-(instancetype) initWithStream: (NSOutputStream *) stream;
+
+/**
+ * Write a geometry object
+ *
+ * @param geometry
+ *            geometry
+ */
+-(void) writeGeometry: (SFGeometry *) geometry;
+
+/**
+ * Begin a FeatureCollection, followed by features and ended by
+ * endFeatureCollection
+ */
+-(void) beginFeatureCollection;
+
+/**
+ * Write a feature with null properties
+ *
+ * @param geometry
+ *            feature geometry, nil for a null geometry
+ */
+-(void) writeFeatureWithGeometry: (SFGeometry *) geometry;
+
+/**
+ * End a FeatureCollection
+ */
+-(void) endFeatureCollection;
+
+/**
+ * Get the written data when writing into memory
+ *
+ * @return GeoJSON UTF-8 data, nil when writing to a stream
+ */
+-(NSData *) data;
+
+/**
+ * Flush buffered bytes to the output stream
+ */
+-(void) flush;
+
+/**
+ * Flush and close the output stream
+ */
+-(void) close;
+
+/**
+ * Write a geometry object
+ *
+ * @param geometry
+ *            geometry
+ * @return GeoJSON text
+ */
++(NSString *) textWithGeometry: (SFGeometry *) geometry;
+
+/**
+ * Write a geometry object
+ *
+ * @param geometry
+ *            geometry
+ * @return GeoJSON UTF-8 data
+ */
++(NSData *) dataWithGeometry: (SFGeometry *) geometry;
+
+@end
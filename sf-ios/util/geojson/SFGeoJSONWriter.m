@@ -0,0 +1,398 @@
+//
+//  SFGeoJSONWriter.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFGeoJSONWriter.h"
+#import "SFPoint.h"
+#import "SFPolygon.h"
+#import "SFMultiPoint.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+#import "SFPolyhedralSurface.h"
+#import "SFGeometryTypes.h"
+
+/**
+ * Buffered byte count at which bytes are flushed to the output stream
+ */
+#define SF_GEOJSON_BUFFER_SIZE 65536
+
+/**
+ * Growable byte buffer
+ */
+typedef struct SFGeoJSONBuffer{
+    uint8_t *bytes;
+    size_t length;
+    size_t capacity;
+} SFGeoJSONBuffer;
+
+/**
+ * Write bytes
+ *
+ * @param buffer
+ *            buffer
+ * @param bytes
+ *            bytes
+ * @param count
+ *            number of bytes
+ */
+static void SFGeoJSONWriteBytes(SFGeoJSONBuffer *buffer, const char *bytes, size_t count){
+    if(buffer->length + count > buffer->capacity){
+        buffer->capacity = MAX(buffer->capacity * 2, buffer->length + count);
+        buffer->bytes = realloc(buffer->bytes, buffer->capacity);
+    }
+    memcpy(buffer->bytes + buffer->length, bytes, count);
+    buffer->length += count;
+}
+
+/**
+ * Write a null terminated string
+ *
+ * @param buffer
+ *            buffer
+ * @param value
+ *            string
+ */
+static void SFGeoJSONWriteString(SFGeoJSONBuffer *buffer, const char *value){
+    SFGeoJSONWriteBytes(buffer, value, strlen(value));
+}
+
+/**
+ * Write a number with 15 significant digits, or 17 when needed to read back
+ * as the same value
+ *
+ * @param buffer
+ *            buffer
+ * @param value
+ *            finite number
+ * @return false if the number is not finite and was not written
+ */
+static BOOL SFGeoJSONWriteNumber(SFGeoJSONBuffer *buffer, double value){
+    if(!isfinite(value)){
+        return NO;
+    }
+    char number[32];
+    int length = snprintf(number, sizeof(number), "%.15g", value);
+    if(strtod(number, NULL) != value){
+        length = snprintf(number, sizeof(number), "%.17g", value);
+    }
+    SFGeoJSONWriteBytes(buffer, number, length);
+    return YES;
+}
+
+/**
+ * Write a position
+ *
+ * @param buffer
+ *            buffer
+ * @param values
+ *            x, y, and z values
+ * @param dimensions
+ *            number of values, 2 or 3
+ * @return false if a value is not finite
+ */
+static BOOL SFGeoJSONWritePosition(SFGeoJSONBuffer *buffer, const double *values, int dimensions){
+    BOOL valid = YES;
+    SFGeoJSONWriteBytes(buffer, "[", 1);
+    for(int i = 0; i < dimensions && valid; i++){
+        if(i > 0){
+            SFGeoJSONWriteBytes(buffer, ",", 1);
+        }
+        valid = SFGeoJSONWriteNumber(buffer, values[i]);
+    }
+    SFGeoJSONWriteBytes(buffer, "]", 1);
+    return valid;
+}
+
+@interface SFGeoJSONWriter(){
+    SFGeoJSONBuffer _buffer;
+}
+
+/**
+ * Output stream, nil when writing into memory
+ */
+@property (nonatomic, strong) NSOutputStream *stream;
+
+/**
+ * True when writing a FeatureCollection
+ */
+@property (nonatomic) BOOL featureCollection;
+
+/**
+ * True if the next FeatureCollection feature is the first
+ */
+@property (nonatomic) BOOL first;
+
+@end
+
+@implementation SFGeoJSONWriter
+
+-(instancetype) init{
+    return [self initWithStream:nil];
+}
+
+-(instancetype) initWithPath: (NSString *) path{
+    NSOutputStream *stream = [NSOutputStream outputStreamToFileAtPath:path append:NO];
+    if(stream == nil){
+        [NSException raise:@"File Write" format:@"Failed to open GeoJSON file: %@", path];
+    }
+    return [self initWithStream:stream];
+}
+
+-(instancetype) initWithStream: (NSOutputStream *) stream{
+    self = [super init];
+    if(self != nil){
+        self.stream = stream;
+        if(stream != nil && stream.streamStatus == NSStreamStatusNotOpen){
+            [stream open];
+        }
+        _buffer.capacity = stream != nil ? SF_GEOJSON_BUFFER_SIZE : 1024;
+        _buffer.bytes = malloc(_buffer.capacity);
+        _buffer.length = 0;
+        self.featureCollection = NO;
+    }
+    return self;
+}
+
+-(void) dealloc{
+    free(_buffer.bytes);
+}
+
+-(void) writeGeometry: (SFGeometry *) geometry{
+    size_t length = _buffer.length;
+    @try {
+        [self writeGeometryObject:geometry];
+    } @catch (NSException *exception) {
+        _buffer.length = length;
+        @throw exception;
+    }
+    [self flushIfFull];
+}
+
+-(void) beginFeatureCollection{
+    if(self.featureCollection){
+        [NSException raise:NSInternalInconsistencyException format:@"FeatureCollection already begun"];
+    }
+    SFGeoJSONWriteString(&_buffer, "{\"type\":\"FeatureCollection\",\"features\":[");
+    self.featureCollection = YES;
+    self.first = YES;
+}
+
+-(void) writeFeatureWithGeometry: (SFGeometry *) geometry{
+    size_t length = _buffer.length;
+    if(self.featureCollection && !self.first){
+        SFGeoJSONWriteBytes(&_buffer, ",", 1);
+    }
+    SFGeoJSONWriteString(&_buffer, "{\"type\":\"Feature\",\"geometry\":");
+    if(geometry != nil){
+        @try {
+            [self writeGeometryObject:geometry];
+        } @catch (NSException *exception) {
+            _buffer.length = length;
+            @throw exception;
+        }
+    }else{
+        SFGeoJSONWriteString(&_buffer, "null");
+    }
+    SFGeoJSONWriteString(&_buffer, ",\"properties\":null}");
+    self.first = NO;
+    [self flushIfFull];
+}
+
+-(void) endFeatureCollection{
+    if(!self.featureCollection){
+        [NSException raise:NSInternalInconsistencyException format:@"FeatureCollection not begun"];
+    }
+    SFGeoJSONWriteString(&_buffer, "]}");
+    self.featureCollection = NO;
+    [self flushIfFull];
+}
+
+-(NSData *) data{
+    NSData *data = nil;
+    if(self.stream == nil){
+        data = [NSData dataWithBytes:_buffer.bytes length:_buffer.length];
+    }
+    return data;
+}
+
+-(void) flush{
+    if(self.stream != nil){
+        size_t offset = 0;
+        while(offset < _buffer.length){
+            NSInteger written = [self.stream write:_buffer.bytes + offset maxLength:_buffer.length - offset];
+            if(written <= 0){
+                [NSException raise:@"File Write" format:@"Failed to write GeoJSON to stream, Error: %@", self.stream.streamError];
+            }
+            offset += written;
+        }
+        _buffer.length = 0;
+    }
+}
+
+-(void) close{
+    [self flush];
+    [self.stream close];
+}
+
++(NSString *) textWithGeometry: (SFGeometry *) geometry{
+    return [[NSString alloc] initWithData:[self dataWithGeometry:geometry] encoding:NSUTF8StringEncoding];
+}
+
++(NSData *) dataWithGeometry: (SFGeometry *) geometry{
+    SFGeoJSONWriter *writer = [[SFGeoJSONWriter alloc] init];
+    [writer writeGeometry:geometry];
+    return [writer data];
+}
+
+/**
+ * Flush to the output stream when the buffer is full
+ */
+-(void) flushIfFull{
+    if(_buffer.length >= SF_GEOJSON_BUFFER_SIZE){
+        [self flush];
+    }
+}
+
+/**
+ * Write a geometry object
+ *
+ * @param geometry
+ *            geometry
+ */
+-(void) writeGeometryObject: (SFGeometry *) geometry{
+    
+    enum SFGeometryType geometryType = geometry.geometryType;
+    SFGeoJSONBuffer *buffer = &_buffer;
+    
+    switch(geometryType){
+        case SF_POINT:
+            SFGeoJSONWriteString(buffer, "{\"type\":\"Point\",\"coordinates\":");
+            {
+                SFPoint *point = (SFPoint *) geometry;
+                if(isnan([point.x doubleValue]) || isnan([point.y doubleValue])){
+                    SFGeoJSONWriteString(buffer, "[]");
+                }else{
+                    [self writePoint:point];
+                }
+            }
+            break;
+        case SF_LINESTRING:
+            SFGeoJSONWriteString(buffer, "{\"type\":\"LineString\",\"coordinates\":");
+            [self writePoints:((SFLineString *) geometry).points];
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            SFGeoJSONWriteString(buffer, "{\"type\":\"Polygon\",\"coordinates\":");
+            [self writeRingsOfPolygon:(SFPolygon *) geometry];
+            break;
+        case SF_MULTIPOINT:
+            SFGeoJSONWriteString(buffer, "{\"type\":\"MultiPoint\",\"coordinates\":");
+            [self writePoints:((SFMultiPoint *) geometry).points];
+            break;
+        case SF_MULTILINESTRING:
+            SFGeoJSONWriteString(buffer, "{\"type\":\"MultiLineString\",\"coordinates\":[");
+            {
+                NSArray<SFLineString *> *lineStrings = ((SFMultiLineString *) geometry).lineStrings;
+                for(int i = 0; i < lineStrings.count; i++){
+                    if(i > 0){
+                        SFGeoJSONWriteBytes(buffer, ",", 1);
+                    }
+                    [self writePoints:[lineStrings objectAtIndex:i].points];
+                }
+            }
+            SFGeoJSONWriteBytes(buffer, "]", 1);
+            break;
+        case SF_MULTIPOLYGON:
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            SFGeoJSONWriteString(buffer, "{\"type\":\"MultiPolygon\",\"coordinates\":[");
+            {
+                NSArray<SFPolygon *> *polygons = geometryType == SF_MULTIPOLYGON ? ((SFMultiPolygon *) geometry).polygons : ((SFPolyhedralSurface *) geometry).polygons;
+                for(int i = 0; i < polygons.count; i++){
+                    if(i > 0){
+                        SFGeoJSONWriteBytes(buffer, ",", 1);
+                    }
+                    [self writeRingsOfPolygon:[polygons objectAtIndex:i]];
+                }
+            }
+            SFGeoJSONWriteBytes(buffer, "]", 1);
+            break;
+        case SF_GEOMETRYCOLLECTION:
+            SFGeoJSONWriteString(buffer, "{\"type\":\"GeometryCollection\",\"geometries\":[");
+            {
+                NSArray<SFGeometry *> *geometries = ((SFGeometryCollection *) geometry).geometries;
+                for(int i = 0; i < geometries.count; i++){
+                    if(i > 0){
+                        SFGeoJSONWriteBytes(buffer, ",", 1);
+                    }
+                    [self writeGeometryObject:[geometries objectAtIndex:i]];
+                }
+            }
+            SFGeoJSONWriteBytes(buffer, "]", 1);
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for GeoJSON: %@", [SFGeometryTypes name:geometryType]];
+    }
+    
+    SFGeoJSONWriteBytes(buffer, "}", 1);
+}
+
+/**
+ * Write the polygon rings coordinates
+ *
+ * @param polygon
+ *            polygon
+ */
+-(void) writeRingsOfPolygon: (SFPolygon *) polygon{
+    NSArray<SFLineString *> *rings = [polygon lineStrings];
+    SFGeoJSONWriteBytes(&_buffer, "[", 1);
+    for(int i = 0; i < rings.count; i++){
+        if(i > 0){
+            SFGeoJSONWriteBytes(&_buffer, ",", 1);
+        }
+        [self writePoints:[rings objectAtIndex:i].points];
+    }
+    SFGeoJSONWriteBytes(&_buffer, "]", 1);
+}
+
+/**
+ * Write an array of point positions
+ *
+ * @param points
+ *            points
+ */
+-(void) writePoints: (NSArray<SFPoint *> *) points{
+    SFGeoJSONWriteBytes(&_buffer, "[", 1);
+    for(int i = 0; i < points.count; i++){
+        if(i > 0){
+            SFGeoJSONWriteBytes(&_buffer, ",", 1);
+        }
+        [self writePoint:[points objectAtIndex:i]];
+    }
+    SFGeoJSONWriteBytes(&_buffer, "]", 1);
+}
+
+/**
+ * Write a point position
+ *
+ * @param point
+ *            point
+ */
+-(void) writePoint: (SFPoint *) point{
+    double values[3];
+    int dimensions = 2;
+    values[0] = [point.x doubleValue];
+    values[1] = [point.y doubleValue];
+    if(point.hasZ && point.z != nil){
+        values[dimensions++] = [point.z doubleValue];
+    }
+    if(!SFGeoJSONWritePosition(&_buffer, values, dimensions)){
+        [NSException raise:@"Invalid Coordinate" format:@"GeoJSON coordinates must be finite, point: %@", point];
+    }
+}
+
+@end
@@ -0,0 +1,66 @@
+//
+//  SFHilbertSort.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometryCollection.h"
+
+/**
+ * Number of bits per axis of the Hilbert curve grid
+ */
+extern int const SF_HILBERT_BITS;
+
+/**
+ * Hilbert curve spatial sort. Envelope centers are quantized into a 2^16 by
+ * 2^16 grid over their combined extent and ordered by the 32 bit Hilbert
+ * index of their grid cell with a stable radix sort. Geometries without an
+ * envelope are ordered last, retaining their relative order.
+ */
+@interface SFHilbertSort : NSObject
+
+/**
+ * Get the Hilbert curve index of the grid cell
+ *
+ * @param x
+ *            grid x, 0 through 2^16 - 1
+ * @param y
+ *            grid y, 0 through 2^16 - 1
+ * @return Hilbert index
+ */
++(uint32_t) indexOfX: (uint32_t) x andY: (uint32_t) y;
+
+/**
+ * Sort the geometries by the Hilbert index of their envelope centers
+ *
+ * @param geometries
+ *            geometries
+ * @return new sorted geometries array
+ */
++(NSArray<SFGeometry *> *) sortGeometries: (NSArray<SFGeometry *> *) geometries;
+
+/**
+ * Sort the geometry collection members in place by the Hilbert index of
+ * their envelope centers, including multi points, multi line strings, and
+ * multi polygons
+ *
+ * @param geometryCollection
+ *            geometry collection
+ */
++(void) sortGeometryCollection: (SFGeometryCollection *) geometryCollection;
+
+/**
+ * Get the Hilbert order of the centers, ordering non finite centers last
+ *
+ * @param centers
+ *            interleaved x and y center values
+ * @param count
+ *            number of centers
+ * @return int center index data in Hilbert order
+ */
++(NSData *) orderOfCenters: (const double *) centers withCount: (int) count;
+
+@end
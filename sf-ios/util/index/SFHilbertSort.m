@@ -0,0 +1,273 @@
+//
+//  SFHilbertSort.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFHilbertSort.h"
+
+int const SF_HILBERT_BITS = 16;
+
+/**
+ * Number of centers buffered on the stack before falling back to the heap
+ */
+#define SF_HILBERT_BUFFER_SIZE 256
+
+/**
+ * Max Hilbert grid coordinate
+ */
+#define SF_HILBERT_MAX 0xFFFF
+
+/**
+ * Interleave the low 16 bits of the value with zero bits
+ *
+ * @param value
+ *            16 bit value
+ * @return 32 bit interleaved value
+ */
+static uint32_t SFHilbertInterleave(uint32_t value){
+    value = (value | (value << 8)) & 0x00FF00FF;
+    value = (value | (value << 4)) & 0x0F0F0F0F;
+    value = (value | (value << 2)) & 0x33333333;
+    value = (value | (value << 1)) & 0x55555555;
+    return value;
+}
+
+/**
+ * Hilbert curve index of the 16 bit grid cell, computed without branches by
+ * combining the curve state of each bit level in parallel prefix passes
+ *
+ * Based upon the public domain C implementation:
+ * https://github.com/rawrunprotected/hilbert_curves
+ *
+ * @param x
+ *            grid x
+ * @param y
+ *            grid y
+ * @return Hilbert index
+ */
+static uint32_t SFHilbertIndex(uint32_t x, uint32_t y){
+    
+    uint32_t a = x ^ y;
+    uint32_t b = 0xFFFF ^ a;
+    uint32_t c = 0xFFFF ^ (x | y);
+    uint32_t d = x & (y ^ 0xFFFF);
+    
+    uint32_t A = a | (b >> 1);
+    uint32_t B = (a >> 1) ^ a;
+    uint32_t C = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+    uint32_t D = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+    
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = (a & (a >> 2)) ^ (b & (b >> 2));
+    B = (a & (b >> 2)) ^ (b & ((a ^ b) >> 2));
+    C ^= (a & (c >> 2)) ^ (b & (d >> 2));
+    D ^= (b & (c >> 2)) ^ ((a ^ b) & (d >> 2));
+    
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = (a & (a >> 4)) ^ (b & (b >> 4));
+    B = (a & (b >> 4)) ^ (b & ((a ^ b) >> 4));
+    C ^= (a & (c >> 4)) ^ (b & (d >> 4));
+    D ^= (b & (c >> 4)) ^ ((a ^ b) & (d >> 4));
+    
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    C ^= (a & (c >> 8)) ^ (b & (d >> 8));
+    D ^= (b & (c >> 8)) ^ ((a ^ b) & (d >> 8));
+    
+    a = C ^ (C >> 1);
+    b = D ^ (D >> 1);
+    
+    uint32_t i0 = x ^ y;
+    uint32_t i1 = b | (0xFFFF ^ (i0 | a));
+    
+    return (SFHilbertInterleave(i1) << 1) | SFHilbertInterleave(i0);
+}
+
+/**
+ * Stable least significant digit radix sort of the values by 32 bit keys,
+ * one byte per pass, skipping passes where all keys share the byte
+ *
+ * @param keys
+ *            keys, sorted in place
+ * @param values
+ *            values, reordered in place with the keys
+ * @param count
+ *            number of keys
+ * @param keyBuffer
+ *            temporary key buffer with capacity for count keys
+ * @param valueBuffer
+ *            temporary value buffer with capacity for count values
+ */
+static void SFHilbertRadixSort(uint32_t *keys, int *values, int count, uint32_t *keyBuffer, int *valueBuffer){
+    
+    uint32_t *sourceKeys = keys;
+    int *sourceValues = values;
+    uint32_t *targetKeys = keyBuffer;
+    int *targetValues = valueBuffer;
+    
+    for(int shift = 0; shift < 32; shift += 8){
+        
+        int offsets[256] = {0};
+        for(int i = 0; i < count; i++){
+            offsets[(sourceKeys[i] >> shift) & 0xFF]++;
+        }
+        if(offsets[(sourceKeys[0] >> shift) & 0xFF] == count){
+            continue;
+        }
+        
+        int offset = 0;
+        for(int bucket = 0; bucket < 256; bucket++){
+            int bucketCount = offsets[bucket];
+            offsets[bucket] = offset;
+            offset += bucketCount;
+        }
+        
+        for(int i = 0; i < count; i++){
+            int target = offsets[(sourceKeys[i] >> shift) & 0xFF]++;
+            targetKeys[target] = sourceKeys[i];
+            targetValues[target] = sourceValues[i];
+        }
+        
+        uint32_t *swapKeys = sourceKeys;
+        sourceKeys = targetKeys;
+        targetKeys = swapKeys;
+        int *swapValues = sourceValues;
+        sourceValues = targetValues;
+        targetValues = swapValues;
+    }
+    
+    if(sourceKeys != keys){
+        memcpy(keys, sourceKeys, sizeof(uint32_t) * count);
+        memcpy(values, sourceValues, sizeof(int) * count);
+    }
+    
+}
+
+/**
+ * Order the centers by Hilbert index over their extent, non finite centers
+ * last
+ *
+ * @param centers
+ *            interleaved x and y center values
+ * @param count
+ *            number of centers
+ * @param order
+ *            center indices in Hilbert order, with capacity for count indices
+ */
+static void SFHilbertOrder(const double *centers, int count, int *order){
+    
+    double minX = INFINITY;
+    double minY = INFINITY;
+    double maxX = -INFINITY;
+    double maxY = -INFINITY;
+    for(int i = 0; i < count; i++){
+        double x = centers[2 * i];
+        double y = centers[2 * i + 1];
+        if(isfinite(x) && isfinite(y)){
+            minX = MIN(minX, x);
+            minY = MIN(minY, y);
+            maxX = MAX(maxX, x);
+            maxY = MAX(maxY, y);
+        }
+    }
+    double scaleX = maxX > minX ? SF_HILBERT_MAX / (maxX - minX) : 0.0;
+    double scaleY = maxY > minY ? SF_HILBERT_MAX / (maxY - minY) : 0.0;
+    
+    uint32_t stackKeys[SF_HILBERT_BUFFER_SIZE * 2];
+    int stackValues[SF_HILBERT_BUFFER_SIZE];
+    uint32_t *keys = count <= SF_HILBERT_BUFFER_SIZE ? stackKeys : malloc(sizeof(uint32_t) * 2 * count);
+    int *valueBuffer = count <= SF_HILBERT_BUFFER_SIZE ? stackValues : malloc(sizeof(int) * count);
+    
+    int finite = 0;
+    for(int i = 0; i < count; i++){
+        double x = centers[2 * i];
+        double y = centers[2 * i + 1];
+        if(isfinite(x) && isfinite(y)){
+            uint32_t gridX = MIN(SF_HILBERT_MAX, (uint32_t) ((x - minX) * scaleX));
+            uint32_t gridY = MIN(SF_HILBERT_MAX, (uint32_t) ((y - minY) * scaleY));
+            keys[finite] = SFHilbertIndex(gridX, gridY);
+            order[finite++] = i;
+        }
+    }
+    int last = finite;
+    for(int i = 0; i < count && last < count; i++){
+        if(!isfinite(centers[2 * i]) || !isfinite(centers[2 * i + 1])){
+            order[last++] = i;
+        }
+    }
+    
+    if(finite > 1){
+        SFHilbertRadixSort(keys, order, finite, keys + count, valueBuffer);
+    }
+    
+    if(keys != stackKeys){
+        free(keys);
+        free(valueBuffer);
+    }
+    
+}
+
+@implementation SFHilbertSort
+
++(uint32_t) indexOfX: (uint32_t) x andY: (uint32_t) y{
+    return SFHilbertIndex(x & SF_HILBERT_MAX, y & SF_HILBERT_MAX);
+}
+
++(NSArray<SFGeometry *> *) sortGeometries: (NSArray<SFGeometry *> *) geometries{
+    
+    int count = (int) geometries.count;
+    if(count < 2){
+        return [NSArray arrayWithArray:geometries];
+    }
+    
+    double *centers = malloc(sizeof(double) * 2 * count);
+    int i = 0;
+    for(SFGeometry *geometry in geometries){
+        SFGeometryEnvelope *envelope = [geometry envelope];
+        if(envelope != nil){
+            centers[i++] = ([envelope.minX doubleValue] + [envelope.maxX doubleValue]) / 2.0;
+            centers[i++] = ([envelope.minY doubleValue] + [envelope.maxY doubleValue]) / 2.0;
+        }else{
+            centers[i++] = NAN;
+            centers[i++] = NAN;
+        }
+    }
+    
+    int *order = malloc(sizeof(int) * count);
+    SFHilbertOrder(centers, count, order);
+    
+    NSMutableArray<SFGeometry *> *sorted = [NSMutableArray arrayWithCapacity:count];
+    for(i = 0; i < count; i++){
+        [sorted addObject:[geometries objectAtIndex:order[i]]];
+    }
+    
+    free(centers);
+    free(order);
+    
+    return sorted;
+}
+
++(void) sortGeometryCollection: (SFGeometryCollection *) geometryCollection{
+    [geometryCollection.geometries setArray:[self sortGeometries:geometryCollection.geometries]];
+}
+
++(NSData *) orderOfCenters: (const double *) centers withCount: (int) count{
+    NSMutableData *data = [NSMutableData dataWithLength:sizeof(int) * count];
+    if(count > 0){
+        SFHilbertOrder(centers, count, data.mutableBytes);
+    }
+    return data;
+}
+
+@end
@@ -0,0 +1,85 @@
+//
+//  SFPackedGeometryFormat.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Internal packed geometry file format constants shared by the packed
+ * geometry reader and writer. See SFPackedGeometryWriter for the file layout.
+ */
+
+/**
+ * File header byte length
+ */
+#define SF_PACKED_HEADER_LENGTH 56
+
+/**
+ * R-tree node byte length
+ */
+#define SF_PACKED_NODE_LENGTH 40
+
+/**
+ * Record header byte length
+ */
+#define SF_PACKED_RECORD_HEADER_LENGTH 16
+
+/**
+ * Max R-tree levels, for a uint32 geometry count and a node size of 2
+ */
+#define SF_PACKED_MAX_LEVELS 34
+
+/**
+ * Z values flag
+ */
+#define SF_PACKED_FLAG_Z 1
+
+/**
+ * M values flag
+ */
+#define SF_PACKED_FLAG_M 2
+
+/**
+ * File magic and version
+ */
+static const uint8_t SF_PACKED_MAGIC[8] = {'s', 'f', 'p', 'k', 'g', 'e', 'o', 1};
+
+/**
+ * Get the node index ranges of the R-tree levels. Levels are numbered from
+ * the leaves up and stored from the root down, with a root above the leaf
+ * of a single geometry.
+ *
+ * @param count
+ *            geometry count
+ * @param nodeSize
+ *            number of children per node
+ * @param starts
+ *            first node index of each level, with capacity for the max levels
+ * @param ends
+ *            exclusive end node index of each level, with capacity for the
+ *            max levels
+ * @return number of levels, 0 when no geometries
+ */
+static inline int SFPackedLevelBounds(uint64_t count, int nodeSize, uint64_t *starts, uint64_t *ends){
+    int levels = 0;
+    if(count > 0){
+        uint64_t nodes = count;
+        uint64_t total = 0;
+        do{
+            ends[levels++] = nodes;
+            total += nodes;
+            nodes = (nodes + nodeSize - 1) / nodeSize;
+        }while(ends[levels - 1] > 1 || levels == 1);
+        for(int level = 0; level < levels; level++){
+            uint64_t levelNodes = ends[level];
+            total -= levelNodes;
+            starts[level] = total;
+            ends[level] = total + levelNodes;
+        }
+    }
+    return levels;
+}
@@ -0,0 +1,121 @@
+//
+//  SFPackedGeometryReader.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+
+/**
+ * Packed geometry file reader, of files written by SFPackedGeometryWriter.
+ * The file is memory mapped and envelope queries walk the packed Hilbert
+ * R-tree breadth first, decoding only the records of intersecting leaves.
+ * Records are indexed in file order, which is the Hilbert order of their
+ * bounds centers, and query hits are returned in increasing record order.
+ */
+@interface SFPackedGeometryReader : NSObject
+
+/**
+ * Mapped file data
+ */
+@property (nonatomic, strong, readonly) NSData *data;
+
+/**
+ * Number of geometry records
+ */
+@property (nonatomic, readonly) int count;
+
+/**
+ * Number of children per R-tree node
+ */
+@property (nonatomic, readonly) int nodeSize;
+
+/**
+ * True if any record has z values
+ */
+@property (nonatomic, readonly) BOOL hasZ;
+
+/**
+ * True if any record has m values
+ */
+@property (nonatomic, readonly) BOOL hasM;
+
+/**
+ * Initialize, memory mapping the file
+ *
+ * @param path
+ *            file path
+ *
+ * @return new reader
+ */
+-(instancetype) initWithPath: (NSString *) path;
+
+/**
+ * Initialize
+ *
+ * @param data
+ *            packed geometry file data
+ *
+ * @return new reader
+ */
+-(instancetype) initWithData: (NSData *) data;
+
+/**
+ * Get the x and y envelope of all records
+ *
+ * @return envelope, nil when no records have coordinates
+ */
+-(SFGeometryEnvelope *) envelope;
+
+/**
+ * Get the x and y envelope of the record from its index leaf, without
+ * decoding the record
+ *
+ * @param index
+ *            record index
+ * @return envelope, nil when the record has no coordinates
+ */
+-(SFGeometryEnvelope *) envelopeAtIndex: (int) index;
+
+/**
+ * Decode the record geometry
+ *
+ * @param index
+ *            record index
+ * @return geometry
+ */
+-(SFGeometry *) geometryAtIndex: (int) index;
+
+/**
+ * Query the indices of the records with bounds intersecting the envelope
+ *
+ * @param envelope
+ *            query envelope
+ * @return int record index data, in increasing order
+ */
+-(NSData *) indicesInEnvelope: (SFGeometryEnvelope *) envelope;
+
+/**
+ * Query and decode the geometries with bounds intersecting the envelope
+ *
+ * @param envelope
+ *            query envelope
+ * @return geometries, in record order
+ */
+-(NSArray<SFGeometry *> *) geometriesInEnvelope: (SFGeometryEnvelope *) envelope;
+
+/**
+ * Enumerate the decoded geometries with bounds intersecting the envelope
+ *
+ * @param envelope
+ *            query envelope
+ * @param block
+ *            geometry block with the record index, set stop to true to stop
+ *            enumerating
+ */
+-(void) enumerateGeometriesInEnvelope: (SFGeometryEnvelope *) envelope usingBlock: (void (^)(SFGeometry *geometry, int index, BOOL *stop)) block;
+
+@end
@@ -0,0 +1,563 @@
+//
+//  SFPackedGeometryReader.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFPackedGeometryReader.h"
+#import "SFPackedGeometryFormat.h"
+#import "SFGeometryTypes.h"
+#import "SFMultiPoint.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+#import "SFTriangle.h"
+#import "SFTIN.h"
+
+/**
+ * Growable search queue and hit buffer
+ */
+typedef struct SFPackedSearchBuffer{
+    uint64_t *values;
+    size_t length;
+    size_t capacity;
+} SFPackedSearchBuffer;
+
+/**
+ * Decoded record header and value locations
+ */
+typedef struct SFPackedRecord{
+    enum SFGeometryType geometryType;
+    BOOL hasZ;
+    BOOL hasM;
+    uint32_t partCount;
+    uint32_t endCount;
+    uint32_t coordinateCount;
+    const uint8_t *parts;
+    const uint8_t *ends;
+    const uint8_t *xy;
+    const uint8_t *z;
+    const uint8_t *m;
+} SFPackedRecord;
+
+/**
+ * Read a little endian uint16
+ *
+ * @param bytes
+ *            bytes
+ * @return value
+ */
+static uint16_t SFPackedReadUInt16(const uint8_t *bytes){
+    uint16_t value = 0;
+    memcpy(&value, bytes, sizeof(value));
+    return CFSwapInt16LittleToHost(value);
+}
+
+/**
+ * Read a little endian uint32
+ *
+ * @param bytes
+ *            bytes
+ * @return value
+ */
+static uint32_t SFPackedReadUInt32(const uint8_t *bytes){
+    uint32_t value = 0;
+    memcpy(&value, bytes, sizeof(value));
+    return CFSwapInt32LittleToHost(value);
+}
+
+/**
+ * Read a little endian uint64
+ *
+ * @param bytes
+ *            bytes
+ * @return value
+ */
+static uint64_t SFPackedReadUInt64(const uint8_t *bytes){
+    uint64_t value = 0;
+    memcpy(&value, bytes, sizeof(value));
+    return CFSwapInt64LittleToHost(value);
+}
+
+/**
+ * Read a little endian double
+ *
+ * @param bytes
+ *            bytes
+ * @return value
+ */
+static double SFPackedReadDouble(const uint8_t *bytes){
+    uint64_t bits = SFPackedReadUInt64(bytes);
+    double value = 0;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * Append a value
+ *
+ * @param buffer
+ *            buffer
+ * @param value
+ *            value
+ */
+static void SFPackedSearchPush(SFPackedSearchBuffer *buffer, uint64_t value){
+    if(buffer->length == buffer->capacity){
+        buffer->capacity = MAX(buffer->capacity * 2, 64);
+        buffer->values = realloc(buffer->values, sizeof(uint64_t) * buffer->capacity);
+    }
+    buffer->values[buffer->length++] = value;
+}
+
+/**
+ * Search the R-tree breadth first for the leaves with bounds intersecting the
+ * query bounds. Each queued node group is the children of one branch, so
+ * hits are found in increasing leaf order.
+ *
+ * @param index
+ *            R-tree node bytes
+ * @param levels
+ *            number of levels
+ * @param starts
+ *            first node index of each level
+ * @param ends
+ *            exclusive end node index of each level
+ * @param nodeSize
+ *            number of children per node
+ * @param query
+ *            min x, min y, max x, and max y query bounds
+ * @param hits
+ *            hit record indices
+ * @return false if a branch offset is outside of its child level
+ */
+static BOOL SFPackedSearch(const uint8_t *index, int levels, const uint64_t *starts, const uint64_t *ends, int nodeSize, const double *query, SFPackedSearchBuffer *hits){
+    
+    BOOL valid = YES;
+    
+    SFPackedSearchBuffer queue = {NULL, 0, 0};
+    if(levels > 0){
+        SFPackedSearchPush(&queue, 0);
+        SFPackedSearchPush(&queue, levels - 1);
+    }
+    
+    for(size_t head = 0; head < queue.length && valid; head += 2){
+        uint64_t first = queue.values[head];
+        int level = (int) queue.values[head + 1];
+        uint64_t end = MIN(first + nodeSize, ends[level]);
+        for(uint64_t node = first; node < end && valid; node++){
+            const uint8_t *bytes = index + node * SF_PACKED_NODE_LENGTH;
+            if(SFPackedReadDouble(bytes) <= query[2] && SFPackedReadDouble(bytes + 8) <= query[3]
+               && SFPackedReadDouble(bytes + 16) >= query[0] && SFPackedReadDouble(bytes + 24) >= query[1]){
+                if(level == 0){
+                    SFPackedSearchPush(hits, node - starts[0]);
+                }else{
+                    uint64_t child = SFPackedReadUInt64(bytes + 32);
+                    valid = child >= starts[level - 1] && child < ends[level - 1];
+                    SFPackedSearchPush(&queue, child);
+                    SFPackedSearchPush(&queue, level - 1);
+                }
+            }
+        }
+    }
+    
+    free(queue.values);
+    
+    return valid;
+}
+
+/**
+ * Read and validate the record header and value locations
+ *
+ * @param bytes
+ *            record bytes
+ * @param length
+ *            record byte length
+ * @param record
+ *            record to read into
+ * @return false if the record is invalid
+ */
+static BOOL SFPackedReadRecord(const uint8_t *bytes, uint64_t length, SFPackedRecord *record){
+    
+    if(length < SF_PACKED_RECORD_HEADER_LENGTH){
+        return NO;
+    }
+    
+    record->geometryType = bytes[0];
+    record->hasZ = (bytes[1] & SF_PACKED_FLAG_Z) != 0;
+    record->hasM = (bytes[1] & SF_PACKED_FLAG_M) != 0;
+    record->partCount = SFPackedReadUInt32(bytes + 4);
+    record->endCount = SFPackedReadUInt32(bytes + 8);
+    record->coordinateCount = SFPackedReadUInt32(bytes + 12);
+    
+    uint64_t coordinateCount = record->coordinateCount;
+    uint64_t dimensions = 2 + (record->hasZ ? 1 : 0) + (record->hasM ? 1 : 0);
+    uint64_t required = SF_PACKED_RECORD_HEADER_LENGTH + 4 * ((uint64_t) record->partCount + record->endCount) + 8 * dimensions * coordinateCount;
+    if(required > length){
+        return NO;
+    }
+    
+    record->parts = bytes + SF_PACKED_RECORD_HEADER_LENGTH;
+    record->ends = record->parts + 4 * (size_t) record->partCount;
+    record->xy = record->ends + 4 * (size_t) record->endCount;
+    record->z = record->xy + 16 * (size_t) coordinateCount;
+    record->m = record->z + (record->hasZ ? 8 * (size_t) coordinateCount : 0);
+    
+    BOOL lines = NO;
+    BOOL parts = NO;
+    BOOL valid = YES;
+    switch(record->geometryType){
+        case SF_POINT:
+            valid = coordinateCount == 1;
+            break;
+        case SF_MULTIPOINT:
+            break;
+        case SF_LINESTRING:
+            valid = record->endCount == 1;
+            lines = YES;
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+        case SF_MULTILINESTRING:
+            lines = YES;
+            break;
+        case SF_MULTIPOLYGON:
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            lines = YES;
+            parts = YES;
+            break;
+        default:
+            valid = NO;
+    }
+    
+    valid = valid && (parts || record->partCount == 0) && (lines || record->endCount == 0);
+    
+    uint32_t previous = 0;
+    for(uint32_t i = 0; i < record->endCount && valid; i++){
+        uint32_t end = SFPackedReadUInt32(record->ends + 4 * i);
+        valid = end >= previous && end <= coordinateCount;
+        previous = end;
+    }
+    valid = valid && (!lines || previous == coordinateCount);
+    
+    uint64_t rings = 0;
+    for(uint32_t i = 0; i < record->partCount && valid; i++){
+        rings += SFPackedReadUInt32(record->parts + 4 * i);
+    }
+    valid = valid && (!parts || rings == record->endCount);
+    
+    return valid;
+}
+
+@interface SFPackedGeometryReader(){
+    int _levels;
+    uint64_t _starts[SF_PACKED_MAX_LEVELS];
+    uint64_t _ends[SF_PACKED_MAX_LEVELS];
+    const uint8_t *_index;
+    const uint8_t *_records;
+    uint64_t _recordsLength;
+    double _extent[4];
+}
+
+/**
+ * Mapped file data
+ */
+@property (nonatomic, strong) NSData *data;
+
+/**
+ * Number of geometry records
+ */
+@property (nonatomic) int count;
+
+/**
+ * Number of children per R-tree node
+ */
+@property (nonatomic) int nodeSize;
+
+/**
+ * True if any record has z values
+ */
+@property (nonatomic) BOOL hasZ;
+
+/**
+ * True if any record has m values
+ */
+@property (nonatomic) BOOL hasM;
+
+@end
+
+@implementation SFPackedGeometryReader
+
+-(instancetype) initWithPath: (NSString *) path{
+    NSError *error = nil;
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedAlways error:&error];
+    if(data == nil){
+        [NSException raise:@"File Read" format:@"Failed to map packed geometry file: %@, Error: %@", path, error];
+    }
+    return [self initWithData:data];
+}
+
+-(instancetype) initWithData: (NSData *) data{
+    self = [super init];
+    if(self != nil){
+        self.data = data;
+        
+        const uint8_t *bytes = data.bytes;
+        uint64_t length = data.length;
+        if(length < SF_PACKED_HEADER_LENGTH || memcmp(bytes, SF_PACKED_MAGIC, sizeof(SF_PACKED_MAGIC)) != 0){
+            [NSException raise:@"Invalid Packed Geometry" format:@"Missing packed geometry file header"];
+        }
+        
+        uint32_t count = SFPackedReadUInt32(bytes + 8);
+        int nodeSize = SFPackedReadUInt16(bytes + 12);
+        if(count > INT_MAX || nodeSize < 2){
+            [NSException raise:@"Invalid Packed Geometry" format:@"Invalid packed geometry count: %u or node size: %d", count, nodeSize];
+        }
+        self.count = count;
+        self.nodeSize = nodeSize;
+        self.hasZ = (bytes[14] & SF_PACKED_FLAG_Z) != 0;
+        self.hasM = (bytes[14] & SF_PACKED_FLAG_M) != 0;
+        for(int i = 0; i < 4; i++){
+            _extent[i] = SFPackedReadDouble(bytes + 16 + 8 * i);
+        }
+        _recordsLength = SFPackedReadUInt64(bytes + 48);
+        
+        _levels = SFPackedLevelBounds(count, nodeSize, _starts, _ends);
+        uint64_t nodeCount = _levels > 0 ? _ends[0] : 0;
+        uint64_t indexLength = nodeCount * SF_PACKED_NODE_LENGTH;
+        if(length - SF_PACKED_HEADER_LENGTH < indexLength || length - SF_PACKED_HEADER_LENGTH - indexLength != _recordsLength){
+            [NSException raise:@"Invalid Packed Geometry" format:@"Packed geometry index and records length does not match the file length: %llu", length];
+        }
+        _index = bytes + SF_PACKED_HEADER_LENGTH;
+        _records = _index + indexLength;
+    }
+    return self;
+}
+
+-(SFGeometryEnvelope *) envelope{
+    return [self envelopeWithBounds:_extent];
+}
+
+-(SFGeometryEnvelope *) envelopeAtIndex: (int) index{
+    const uint8_t *bytes = [self leafAtIndex:index];
+    double bounds[4];
+    for(int i = 0; i < 4; i++){
+        bounds[i] = SFPackedReadDouble(bytes + 8 * i);
+    }
+    return [self envelopeWithBounds:bounds];
+}
+
+-(SFGeometry *) geometryAtIndex: (int) index{
+    
+    uint64_t offset = SFPackedReadUInt64([self leafAtIndex:index] + 32);
+    uint64_t end = index + 1 < self.count ? SFPackedReadUInt64([self leafAtIndex:index + 1] + 32) : _recordsLength;
+    
+    SFPackedRecord record;
+    if(offset > end || end > _recordsLength || !SFPackedReadRecord(_records + offset, end - offset, &record)){
+        [NSException raise:@"Invalid Packed Geometry" format:@"Invalid packed geometry record at index: %d", index];
+    }
+    
+    SFGeometry *geometry = nil;
+    BOOL hasZ = record.hasZ;
+    BOOL hasM = record.hasM;
+    
+    switch(record.geometryType){
+        case SF_POINT:
+            geometry = [self pointWithRecord:&record atIndex:0];
+            break;
+        case SF_LINESTRING:
+            geometry = [self lineStringWithRecord:&record fromIndex:0 toIndex:record.coordinateCount];
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            {
+                SFPolygon *polygon = record.geometryType == SF_POLYGON ? [[SFPolygon alloc] initWithHasZ:hasZ andHasM:hasM] : [[SFTriangle alloc] initWithHasZ:hasZ andHasM:hasM];
+                [self addRingsToPolygon:polygon withRecord:&record fromEnd:0 toEnd:record.endCount];
+                geometry = polygon;
+            }
+            break;
+        case SF_MULTIPOINT:
+            {
+                SFMultiPoint *multiPoint = [[SFMultiPoint alloc] initWithHasZ:hasZ andHasM:hasM];
+                for(uint32_t i = 0; i < record.coordinateCount; i++){
+                    [multiPoint addPoint:[self pointWithRecord:&record atIndex:i]];
+                }
+                geometry = multiPoint;
+            }
+            break;
+        case SF_MULTILINESTRING:
+            {
+                SFMultiLineString *multiLineString = [[SFMultiLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+                uint32_t start = 0;
+                for(uint32_t i = 0; i < record.endCount; i++){
+                    uint32_t end = SFPackedReadUInt32(record.ends + 4 * i);
+                    [multiLineString addLineString:[self lineStringWithRecord:&record fromIndex:start toIndex:end]];
+                    start = end;
+                }
+                geometry = multiLineString;
+            }
+            break;
+        case SF_MULTIPOLYGON:
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            {
+                NSMutableArray<SFPolygon *> *polygons = [NSMutableArray arrayWithCapacity:record.partCount];
+                uint32_t ring = 0;
+                for(uint32_t i = 0; i < record.partCount; i++){
+                    uint32_t rings = SFPackedReadUInt32(record.parts + 4 * i);
+                    SFPolygon *polygon = record.geometryType == SF_TIN ? [[SFTriangle alloc] initWithHasZ:hasZ andHasM:hasM] : [[SFPolygon alloc] initWithHasZ:hasZ andHasM:hasM];
+                    [self addRingsToPolygon:polygon withRecord:&record fromEnd:ring toEnd:ring + rings];
+                    [polygons addObject:polygon];
+                    ring += rings;
+                }
+                if(record.geometryType == SF_MULTIPOLYGON){
+                    geometry = [[SFMultiPolygon alloc] initWithPolygons:polygons];
+                }else{
+                    SFPolyhedralSurface *surface = record.geometryType == SF_TIN ? [[SFTIN alloc] initWithHasZ:hasZ andHasM:hasM] : [[SFPolyhedralSurface alloc] initWithHasZ:hasZ andHasM:hasM];
+                    [surface addPolygons:polygons];
+                    geometry = surface;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    
+    return geometry;
+}
+
+-(NSData *) indicesInEnvelope: (SFGeometryEnvelope *) envelope{
+    
+    double query[4] = {[envelope.minX doubleValue], [envelope.minY doubleValue], [envelope.maxX doubleValue], [envelope.maxY doubleValue]};
+    
+    SFPackedSearchBuffer hits = {NULL, 0, 0};
+    BOOL valid = SFPackedSearch(_index, _levels, _starts, _ends, self.nodeSize, query, &hits);
+    
+    NSMutableData *indices = nil;
+    if(valid){
+        indices = [NSMutableData dataWithLength:sizeof(int) * hits.length];
+        int *values = indices.mutableBytes;
+        for(size_t i = 0; i < hits.length; i++){
+            values[i] = (int) hits.values[i];
+        }
+    }
+    free(hits.values);
+    
+    if(!valid){
+        [NSException raise:@"Invalid Packed Geometry" format:@"Packed geometry index branch offset outside of its child level"];
+    }
+    
+    return indices;
+}
+
+-(NSArray<SFGeometry *> *) geometriesInEnvelope: (SFGeometryEnvelope *) envelope{
+    NSMutableArray<SFGeometry *> *geometries = [NSMutableArray array];
+    [self enumerateGeometriesInEnvelope:envelope usingBlock:^(SFGeometry *geometry, int index, BOOL *stop) {
+        [geometries addObject:geometry];
+    }];
+    return geometries;
+}
+
+-(void) enumerateGeometriesInEnvelope: (SFGeometryEnvelope *) envelope usingBlock: (void (^)(SFGeometry *geometry, int index, BOOL *stop)) block{
+    NSData *indices = [self indicesInEnvelope:envelope];
+    const int *values = indices.bytes;
+    int count = (int) (indices.length / sizeof(int));
+    BOOL stop = NO;
+    for(int i = 0; i < count && !stop; i++){
+        block([self geometryAtIndex:values[i]], values[i], &stop);
+    }
+}
+
+/**
+ * Get the leaf node bytes of the record
+ *
+ * @param index
+ *            record index
+ * @return leaf node bytes
+ */
+-(const uint8_t *) leafAtIndex: (int) index{
+    if(index < 0 || index >= self.count){
+        [NSException raise:NSRangeException format:@"Packed geometry index: %d out of range for count: %d", index, self.count];
+    }
+    return _index + (_starts[0] + index) * SF_PACKED_NODE_LENGTH;
+}
+
+/**
+ * Create an envelope from bounds
+ *
+ * @param bounds
+ *            min x, min y, max x, and max y
+ * @return envelope, nil when inverted
+ */
+-(SFGeometryEnvelope *) envelopeWithBounds: (const double *) bounds{
+    SFGeometryEnvelope *envelope = nil;
+    if(bounds[0] <= bounds[2] && bounds[1] <= bounds[3]){
+        envelope = [[SFGeometryEnvelope alloc] initWithMinXDouble:bounds[0] andMinYDouble:bounds[1] andMaxXDouble:bounds[2] andMaxYDouble:bounds[3]];
+    }
+    return envelope;
+}
+
+/**
+ * Create a record point
+ *
+ * @param record
+ *            record
+ * @param index
+ *            coordinate index
+ * @return point
+ */
+-(SFPoint *) pointWithRecord: (SFPackedRecord *) record atIndex: (uint32_t) index{
+    SFPoint *point = [[SFPoint alloc] initWithHasZ:record->hasZ andHasM:record->hasM andXValue:SFPackedReadDouble(record->xy + 16 * (size_t) index) andYValue:SFPackedReadDouble(record->xy + 16 * (size_t) index + 8)];
+    if(record->hasZ){
+        [point setZValue:SFPackedReadDouble(record->z + 8 * (size_t) index)];
+    }
+    if(record->hasM){
+        [point setMValue:SFPackedReadDouble(record->m + 8 * (size_t) index)];
+    }
+    return point;
+}
+
+/**
+ * Create a record line string
+ *
+ * @param record
+ *            record
+ * @param start
+ *            first coordinate index
+ * @param end
+ *            exclusive end coordinate index
+ * @return line string
+ */
+-(SFLineString *) lineStringWithRecord: (SFPackedRecord *) record fromIndex: (uint32_t) start toIndex: (uint32_t) end{
+    SFLineString *lineString = [[SFLineString alloc] initWithHasZ:record->hasZ andHasM:record->hasM];
+    NSMutableArray<SFPoint *> *points = [NSMutableArray arrayWithCapacity:end - start];
+    for(uint32_t i = start; i < end; i++){
+        [points addObject:[self pointWithRecord:record atIndex:i]];
+    }
+    [lineString setPoints:points];
+    return lineString;
+}
+
+/**
+ * Add record rings to the polygon
+ *
+ * @param polygon
+ *            polygon
+ * @param record
+ *            record
+ * @param first
+ *            first ring end index
+ * @param last
+ *            exclusive last ring end index
+ */
+-(void) addRingsToPolygon: (SFPolygon *) polygon withRecord: (SFPackedRecord *) record fromEnd: (uint32_t) first toEnd: (uint32_t) last{
+    uint32_t start = first > 0 ? SFPackedReadUInt32(record->ends + 4 * (size_t) (first - 1)) : 0;
+    for(uint32_t i = first; i < last; i++){
+        uint32_t end = SFPackedReadUInt32(record->ends + 4 * (size_t) i);
+        [polygon addRing:[self lineStringWithRecord:record fromIndex:start toIndex:end]];
+        start = end;
+    }
+}
+
+@end
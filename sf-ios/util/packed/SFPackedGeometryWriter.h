@@ -0,0 +1,150 @@
+//
+//  SFPackedGeometryWriter.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+
+/**
+ * Default number of children per packed R-tree node
+ */
+extern int const SF_PACKED_DEFAULT_NODE_SIZE;
+
+/**
+ * Packed geometry file writer. Geometries are encoded as they are added into
+ * flat coordinate records, with the record bounds kept in memory. Finishing
+ * orders the records by the Hilbert index of their bounds centers, builds a
+ * static packed Hilbert R-tree over the ordered bounds, and writes a header,
+ * the tree, and the records, with each leaf node holding the byte offset of
+ * its record.
+ *
+ * File layout, little endian:
+ *
+ * Header (56 bytes): magic "sfpkgeo" and version 1 (8 bytes), uint32
+ * geometry count, uint16 node size, uint8 z and m flags, uint8 reserved,
+ * double min x, min y, max x, and max y, and uint64 records byte length.
+ *
+ * Index: packed R-tree nodes of 40 bytes, double min x, min y, max x, and
+ * max y followed by a uint64 offset, stored root level first with the leaf
+ * level last. Branch offsets are the node index of their first child and
+ * leaf offsets are the byte offset of their record from the start of the
+ * records.
+ *
+ * Records: uint8 geometry type, uint8 z and m flags, uint16 reserved, uint32
+ * part count, uint32 end count, and uint32 coordinate count, followed by the
+ * ring count of each polygon part, the exclusive coordinate end of each line
+ * or ring, the interleaved x and y values, the z values, and the m values.
+ *
+ * Points, line strings, polygons, triangles, multi points, multi line
+ * strings, multi polygons, polyhedral surfaces, and TINs are supported.
+ */
+@interface SFPackedGeometryWriter : NSObject
+
+/**
+ * Number of children per R-tree node
+ */
+@property (nonatomic, readonly) int nodeSize;
+
+/**
+ * Number of added geometries
+ */
+@property (nonatomic, readonly) int count;
+
+/**
+ * Initialize, writing into memory with the default node size
+ *
+ * @return new writer
+ */
+-(instancetype) init;
+
+/**
+ * Initialize, writing to the file with the default node size
+ *
+ * @param path
+ *            file path
+ *
+ * @return new writer
+ */
+-(instancetype) initWithPath: (NSString *) path;
+
+/**
+ * Initialize, opening the stream if not open
+ *
+ * @param stream
+ *            output stream, nil to write into memory
+ * @param nodeSize
+ *            number of children per R-tree node, at least 2
+ *
+ * @return new writer
+ */
+-(instancetype) initWithStream: (NSOutputStream *) stream andNodeSize: (int) nodeSize;
+
+/**
+ * Add a geometry record
+ *
+ * @param geometry
+ *            geometry
+ */
+-(void) addGeometry: (SFGeometry *) geometry;
+
+/**
+ * Add geometry records
+ *
+ * @param geometries
+ *            geometries
+ */
+-(void) addGeometries: (NSArray<SFGeometry *> *) geometries;
+
+/**
+ * Sort the records, build the index, and write the file. No geometries can
+ * be added after finishing.
+ */
+-(void) finish;
+
+/**
+ * Get the written bytes when writing into memory, finishing if needed
+ *
+ * @return bytes, nil when writing to a stream
+ */
+-(NSData *) data;
+
+/**
+ * Finish if needed and close the stream
+ */
+-(void) close;
+
+/**
+ * Get the number of R-tree nodes for the geometry count
+ *
+ * @param count
+ *            geometry count
+ * @param nodeSize
+ *            number of children per node
+ * @return node count
+ */
++(uint64_t) nodeCountWithCount: (uint64_t) count andNodeSize: (int) nodeSize;
+
+/**
+ * Write the geometries into memory
+ *
+ * @param geometries
+ *            geometries
+ * @return bytes
+ */
++(NSData *) dataWithGeometries: (NSArray<SFGeometry *> *) geometries;
+
+/**
+ * Write the geometries to the file
+ *
+ * @param geometries
+ *            geometries
+ * @param path
+ *            file path
+ */
++(void) writeGeometries: (NSArray<SFGeometry *> *) geometries toPath: (NSString *) path;
+
+@end
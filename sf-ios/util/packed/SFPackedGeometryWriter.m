@@ -0,0 +1,542 @@
+//
+//  SFPackedGeometryWriter.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFPackedGeometryWriter.h"
+#import "SFHilbertSort.h"
+#import "SFPackedGeometryFormat.h"
+#import "SFGeometryTypes.h"
+#import "SFMultiPoint.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+#import "SFPolyhedralSurface.h"
+
+int const SF_PACKED_DEFAULT_NODE_SIZE = 16;
+
+/**
+ * Buffered byte count at which bytes are flushed to the output stream
+ */
+#define SF_PACKED_BUFFER_SIZE 65536
+
+/**
+ * Growable byte buffer
+ */
+typedef struct SFPackedBuffer{
+    uint8_t *bytes;
+    size_t length;
+    size_t capacity;
+} SFPackedBuffer;
+
+/**
+ * Packed R-tree node
+ */
+typedef struct SFPackedNode{
+    double bounds[4];
+    uint64_t offset;
+} SFPackedNode;
+
+/**
+ * Write bytes
+ *
+ * @param buffer
+ *            buffer
+ * @param bytes
+ *            bytes
+ * @param count
+ *            number of bytes
+ */
+static void SFPackedWriteBytes(SFPackedBuffer *buffer, const void *bytes, size_t count){
+    if(buffer->length + count > buffer->capacity){
+        buffer->capacity = MAX(buffer->capacity * 2, buffer->length + count);
+        buffer->bytes = realloc(buffer->bytes, buffer->capacity);
+    }
+    memcpy(buffer->bytes + buffer->length, bytes, count);
+    buffer->length += count;
+}
+
+/**
+ * Write a little endian uint16
+ *
+ * @param buffer
+ *            buffer
+ * @param value
+ *            value
+ */
+static void SFPackedWriteUInt16(SFPackedBuffer *buffer, uint16_t value){
+    value = CFSwapInt16HostToLittle(value);
+    SFPackedWriteBytes(buffer, &value, sizeof(value));
+}
+
+/**
+ * Write a little endian uint32
+ *
+ * @param buffer
+ *            buffer
+ * @param value
+ *            value
+ */
+static void SFPackedWriteUInt32(SFPackedBuffer *buffer, uint32_t value){
+    value = CFSwapInt32HostToLittle(value);
+    SFPackedWriteBytes(buffer, &value, sizeof(value));
+}
+
+/**
+ * Write a little endian uint64
+ *
+ * @param buffer
+ *            buffer
+ * @param value
+ *            value
+ */
+static void SFPackedWriteUInt64(SFPackedBuffer *buffer, uint64_t value){
+    value = CFSwapInt64HostToLittle(value);
+    SFPackedWriteBytes(buffer, &value, sizeof(value));
+}
+
+/**
+ * Write a little endian double
+ *
+ * @param buffer
+ *            buffer
+ * @param value
+ *            value
+ */
+static void SFPackedWriteDouble(SFPackedBuffer *buffer, double value){
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    SFPackedWriteUInt64(buffer, bits);
+}
+
+/**
+ * Build the branch levels of the R-tree over the filled leaf level
+ *
+ * @param nodes
+ *            nodes, with the leaf level filled
+ * @param levels
+ *            number of levels
+ * @param starts
+ *            first node index of each level
+ * @param ends
+ *            exclusive end node index of each level
+ * @param nodeSize
+ *            number of children per node
+ */
+static void SFPackedBuildBranches(SFPackedNode *nodes, int levels, const uint64_t *starts, const uint64_t *ends, int nodeSize){
+    for(int level = 1; level < levels; level++){
+        uint64_t child = starts[level - 1];
+        for(uint64_t index = starts[level]; index < ends[level]; index++){
+            SFPackedNode *node = nodes + index;
+            node->bounds[0] = INFINITY;
+            node->bounds[1] = INFINITY;
+            node->bounds[2] = -INFINITY;
+            node->bounds[3] = -INFINITY;
+            node->offset = child;
+            uint64_t end = MIN(child + nodeSize, ends[level - 1]);
+            for(; child < end; child++){
+                const double *bounds = nodes[child].bounds;
+                node->bounds[0] = MIN(node->bounds[0], bounds[0]);
+                node->bounds[1] = MIN(node->bounds[1], bounds[1]);
+                node->bounds[2] = MAX(node->bounds[2], bounds[2]);
+                node->bounds[3] = MAX(node->bounds[3], bounds[3]);
+            }
+        }
+    }
+}
+
+@interface SFPackedGeometryWriter(){
+    SFPackedBuffer _output;
+    SFPackedBuffer _records;
+    SFPackedBuffer _parts;
+    SFPackedBuffer _ends;
+    SFPackedBuffer _xy;
+    SFPackedBuffer _z;
+    SFPackedBuffer _m;
+    uint64_t *_offsets;
+    double *_bounds;
+    int _capacity;
+    uint32_t _coordinateCount;
+    double _recordBounds[4];
+}
+
+/**
+ * Output stream, nil when writing into memory
+ */
+@property (nonatomic, strong) NSOutputStream *stream;
+
+/**
+ * Number of children per R-tree node
+ */
+@property (nonatomic) int nodeSize;
+
+/**
+ * Number of added geometries
+ */
+@property (nonatomic) int count;
+
+/**
+ * True when finished
+ */
+@property (nonatomic) BOOL finished;
+
+@end
+
+@implementation SFPackedGeometryWriter
+
+-(instancetype) init{
+    return [self initWithStream:nil andNodeSize:SF_PACKED_DEFAULT_NODE_SIZE];
+}
+
+-(instancetype) initWithPath: (NSString *) path{
+    NSOutputStream *stream = [NSOutputStream outputStreamToFileAtPath:path append:NO];
+    if(stream == nil){
+        [NSException raise:@"File Write" format:@"Failed to open packed geometry file: %@", path];
+    }
+    return [self initWithStream:stream andNodeSize:SF_PACKED_DEFAULT_NODE_SIZE];
+}
+
+-(instancetype) initWithStream: (NSOutputStream *) stream andNodeSize: (int) nodeSize{
+    self = [super init];
+    if(self != nil){
+        if(nodeSize < 2 || nodeSize > UINT16_MAX){
+            [NSException raise:@"Invalid Node Size" format:@"Node size must be between 2 and %d: %d", UINT16_MAX, nodeSize];
+        }
+        self.stream = stream;
+        if(stream != nil && stream.streamStatus == NSStreamStatusNotOpen){
+            [stream open];
+        }
+        self.nodeSize = nodeSize;
+        self.count = 0;
+        self.finished = NO;
+        _capacity = 64;
+        _offsets = malloc(sizeof(uint64_t) * (_capacity + 1));
+        _offsets[0] = 0;
+        _bounds = malloc(sizeof(double) * 4 * _capacity);
+    }
+    return self;
+}
+
+-(void) dealloc{
+    free(_output.bytes);
+    free(_records.bytes);
+    free(_parts.bytes);
+    free(_ends.bytes);
+    free(_xy.bytes);
+    free(_z.bytes);
+    free(_m.bytes);
+    free(_offsets);
+    free(_bounds);
+}
+
+-(void) addGeometry: (SFGeometry *) geometry{
+    
+    if(self.finished){
+        [NSException raise:NSInternalInconsistencyException format:@"Packed geometry writer already finished"];
+    }
+    if(self.count == INT_MAX){
+        [NSException raise:@"Invalid Count" format:@"Max packed geometry count exceeded: %d", INT_MAX];
+    }
+    
+    _parts.length = 0;
+    _ends.length = 0;
+    _xy.length = 0;
+    _z.length = 0;
+    _m.length = 0;
+    _coordinateCount = 0;
+    _recordBounds[0] = INFINITY;
+    _recordBounds[1] = INFINITY;
+    _recordBounds[2] = -INFINITY;
+    _recordBounds[3] = -INFINITY;
+    
+    BOOL hasZ = geometry.hasZ;
+    BOOL hasM = geometry.hasM;
+    enum SFGeometryType geometryType = geometry.geometryType;
+    
+    switch(geometryType){
+        case SF_POINT:
+            [self addPoint:(SFPoint *) geometry withZ:hasZ andM:hasM];
+            break;
+        case SF_LINESTRING:
+            [self addLineString:(SFLineString *) geometry withZ:hasZ andM:hasM];
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            [self addPolygon:(SFPolygon *) geometry withZ:hasZ andM:hasM];
+            break;
+        case SF_MULTIPOINT:
+            for(SFPoint *point in [((SFMultiPoint *) geometry) points]){
+                [self addPoint:point withZ:hasZ andM:hasM];
+            }
+            break;
+        case SF_MULTILINESTRING:
+            for(SFLineString *lineString in [((SFMultiLineString *) geometry) lineStrings]){
+                [self addLineString:lineString withZ:hasZ andM:hasM];
+            }
+            break;
+        case SF_MULTIPOLYGON:
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            {
+                NSArray<SFPolygon *> *polygons = geometryType == SF_MULTIPOLYGON ? [((SFMultiPolygon *) geometry) polygons] : ((SFPolyhedralSurface *) geometry).polygons;
+                for(SFPolygon *polygon in polygons){
+                    [self addPolygon:polygon withZ:hasZ andM:hasM];
+                    SFPackedWriteUInt32(&_parts, (uint32_t) polygon.rings.count);
+                }
+            }
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for Packed Geometry: %@", [SFGeometryTypes name:geometryType]];
+    }
+    
+    int count = self.count;
+    if(count == _capacity){
+        _capacity *= 2;
+        _offsets = realloc(_offsets, sizeof(uint64_t) * (_capacity + 1));
+        _bounds = realloc(_bounds, sizeof(double) * 4 * _capacity);
+    }
+    
+    uint8_t flags = (hasZ ? SF_PACKED_FLAG_Z : 0) | (hasM ? SF_PACKED_FLAG_M : 0);
+    SFPackedWriteBytes(&_records, &(uint8_t){geometryType}, 1);
+    SFPackedWriteBytes(&_records, &flags, 1);
+    SFPackedWriteUInt16(&_records, 0);
+    SFPackedWriteUInt32(&_records, (uint32_t) (_parts.length / sizeof(uint32_t)));
+    SFPackedWriteUInt32(&_records, (uint32_t) (_ends.length / sizeof(uint32_t)));
+    SFPackedWriteUInt32(&_records, _coordinateCount);
+    SFPackedWriteBytes(&_records, _parts.bytes, _parts.length);
+    SFPackedWriteBytes(&_records, _ends.bytes, _ends.length);
+    SFPackedWriteBytes(&_records, _xy.bytes, _xy.length);
+    SFPackedWriteBytes(&_records, _z.bytes, _z.length);
+    SFPackedWriteBytes(&_records, _m.bytes, _m.length);
+    
+    memcpy(_bounds + 4 * count, _recordBounds, sizeof(_recordBounds));
+    _offsets[count + 1] = _records.length;
+    self.count = count + 1;
+}
+
+-(void) addGeometries: (NSArray<SFGeometry *> *) geometries{
+    for(SFGeometry *geometry in geometries){
+        [self addGeometry:geometry];
+    }
+}
+
+-(void) finish{
+    
+    if(self.finished){
+        return;
+    }
+    self.finished = YES;
+    
+    int count = self.count;
+    int nodeSize = self.nodeSize;
+    uint64_t starts[SF_PACKED_MAX_LEVELS];
+    uint64_t ends[SF_PACKED_MAX_LEVELS];
+    int levels = SFPackedLevelBounds(count, nodeSize, starts, ends);
+    uint64_t nodeCount = levels > 0 ? ends[0] : 0;
+    
+    double *centers = malloc(sizeof(double) * 2 * MAX(count, 1));
+    for(int i = 0; i < count; i++){
+        const double *bounds = _bounds + 4 * i;
+        centers[2 * i] = (bounds[0] + bounds[2]) / 2.0;
+        centers[2 * i + 1] = (bounds[1] + bounds[3]) / 2.0;
+    }
+    NSData *orderData = [SFHilbertSort orderOfCenters:centers withCount:count];
+    const int *order = orderData.bytes;
+    free(centers);
+    
+    SFPackedNode *nodes = malloc(sizeof(SFPackedNode) * MAX(nodeCount, 1));
+    uint64_t offset = 0;
+    for(int i = 0; i < count; i++){
+        int record = order[i];
+        SFPackedNode *leaf = nodes + starts[0] + i;
+        memcpy(leaf->bounds, _bounds + 4 * record, sizeof(leaf->bounds));
+        leaf->offset = offset;
+        offset += _offsets[record + 1] - _offsets[record];
+    }
+    SFPackedBuildBranches(nodes, levels, starts, ends, nodeSize);
+    
+    double extent[4] = {INFINITY, INFINITY, -INFINITY, -INFINITY};
+    if(levels > 0){
+        memcpy(extent, nodes[0].bounds, sizeof(extent));
+    }
+    
+    uint8_t flags = 0;
+    for(int i = 0; i < count; i++){
+        flags |= _records.bytes[_offsets[i] + 1];
+    }
+    
+    @try {
+        
+        SFPackedWriteBytes(&_output, SF_PACKED_MAGIC, sizeof(SF_PACKED_MAGIC));
+        SFPackedWriteUInt32(&_output, count);
+        SFPackedWriteUInt16(&_output, nodeSize);
+        SFPackedWriteBytes(&_output, &flags, 1);
+        SFPackedWriteBytes(&_output, &(uint8_t){0}, 1);
+        for(int i = 0; i < 4; i++){
+            SFPackedWriteDouble(&_output, extent[i]);
+        }
+        SFPackedWriteUInt64(&_output, _records.length);
+        
+        for(uint64_t i = 0; i < nodeCount; i++){
+            for(int j = 0; j < 4; j++){
+                SFPackedWriteDouble(&_output, nodes[i].bounds[j]);
+            }
+            SFPackedWriteUInt64(&_output, nodes[i].offset);
+            [self flushIfFull];
+        }
+        
+        for(int i = 0; i < count; i++){
+            int record = order[i];
+            SFPackedWriteBytes(&_output, _records.bytes + _offsets[record], _offsets[record + 1] - _offsets[record]);
+            [self flushIfFull];
+        }
+        
+        if(self.stream != nil){
+            [self flush];
+        }
+        
+    } @finally {
+        free(nodes);
+    }
+    
+    free(_records.bytes);
+    _records.bytes = NULL;
+    _records.length = 0;
+    _records.capacity = 0;
+}
+
+-(NSData *) data{
+    NSData *data = nil;
+    if(self.stream == nil){
+        [self finish];
+        data = [NSData dataWithBytes:_output.bytes length:_output.length];
+    }
+    return data;
+}
+
+-(void) close{
+    [self finish];
+    [self.stream close];
+}
+
++(uint64_t) nodeCountWithCount: (uint64_t) count andNodeSize: (int) nodeSize{
+    uint64_t starts[SF_PACKED_MAX_LEVELS];
+    uint64_t ends[SF_PACKED_MAX_LEVELS];
+    int levels = SFPackedLevelBounds(count, MAX(nodeSize, 2), starts, ends);
+    return levels > 0 ? ends[0] : 0;
+}
+
++(NSData *) dataWithGeometries: (NSArray<SFGeometry *> *) geometries{
+    SFPackedGeometryWriter *writer = [[SFPackedGeometryWriter alloc] init];
+    [writer addGeometries:geometries];
+    return [writer data];
+}
+
++(void) writeGeometries: (NSArray<SFGeometry *> *) geometries toPath: (NSString *) path{
+    SFPackedGeometryWriter *writer = [[SFPackedGeometryWriter alloc] initWithPath:path];
+    @try {
+        [writer addGeometries:geometries];
+    } @finally {
+        [writer close];
+    }
+}
+
+/**
+ * Flush the output buffer to the output stream
+ */
+-(void) flush{
+    size_t offset = 0;
+    while(offset < _output.length){
+        NSInteger written = [self.stream write:_output.bytes + offset maxLength:_output.length - offset];
+        if(written <= 0){
+            [NSException raise:@"File Write" format:@"Failed to write packed geometries to stream, Error: %@", self.stream.streamError];
+        }
+        offset += written;
+    }
+    _output.length = 0;
+}
+
+/**
+ * Flush to the output stream when the buffer is full
+ */
+-(void) flushIfFull{
+    if(self.stream != nil && _output.length >= SF_PACKED_BUFFER_SIZE){
+        [self flush];
+    }
+}
+
+/**
+ * Add a point coordinate
+ *
+ * @param point
+ *            point
+ * @param hasZ
+ *            true if writing z values
+ * @param hasM
+ *            true if writing m values
+ */
+-(void) addPoint: (SFPoint *) point withZ: (BOOL) hasZ andM: (BOOL) hasM{
+    if(_coordinateCount == UINT32_MAX){
+        [NSException raise:@"Invalid Count" format:@"Max packed geometry coordinate count exceeded: %u", UINT32_MAX];
+    }
+    double x = [point.x doubleValue];
+    double y = [point.y doubleValue];
+    SFPackedWriteDouble(&_xy, x);
+    SFPackedWriteDouble(&_xy, y);
+    if(hasZ){
+        SFPackedWriteDouble(&_z, point.z != nil ? [point.z doubleValue] : NAN);
+    }
+    if(hasM){
+        SFPackedWriteDouble(&_m, point.m != nil ? [point.m doubleValue] : NAN);
+    }
+    if(x < _recordBounds[0]){
+        _recordBounds[0] = x;
+    }
+    if(y < _recordBounds[1]){
+        _recordBounds[1] = y;
+    }
+    if(x > _recordBounds[2]){
+        _recordBounds[2] = x;
+    }
+    if(y > _recordBounds[3]){
+        _recordBounds[3] = y;
+    }
+    _coordinateCount++;
+}
+
+/**
+ * Add a line string coordinates and end
+ *
+ * @param lineString
+ *            line string
+ * @param hasZ
+ *            true if writing z values
+ * @param hasM
+ *            true if writing m values
+ */
+-(void) addLineString: (SFLineString *) lineString withZ: (BOOL) hasZ andM: (BOOL) hasM{
+    for(SFPoint *point in lineString.points){
+        [self addPoint:point withZ:hasZ andM:hasM];
+    }
+    SFPackedWriteUInt32(&_ends, _coordinateCount);
+}
+
+/**
+ * Add a polygon ring coordinates and ends
+ *
+ * @param polygon
+ *            polygon
+ * @param hasZ
+ *            true if writing z values
+ * @param hasM
+ *            true if writing m values
+ */
+-(void) addPolygon: (SFPolygon *) polygon withZ: (BOOL) hasZ andM: (BOOL) hasM{
+    for(SFLineString *ring in [polygon lineStrings]){
+        [self addLineString:ring withZ:hasZ andM:hasM];
+    }
+}
+
+@end
@@ -0,0 +1,48 @@
+//
+//  SFGeometryRepair.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+#import "SFMultiPolygon.h"
+
+/**
+ * Make valid repair of invalid polygons and multi polygons.
+ *
+ * Polygon rings are resolved by the even-odd rule in a Martinez-Rueda plane
+ * sweep that subdivides the edges at every intersection, including self
+ * intersections of a ring, running in O((n + k) log n) for n edges and k
+ * intersections. The subdivided edges are connected into simple rings and
+ * holes are assigned to the exterior ring below them. Overlapping edges
+ * cancel in pairs, removing spikes and collapsed rings.
+ *
+ * Members of an invalid multi polygon are resolved individually and merged
+ * by a cascaded union, joining overlapping members. Results are two dimensional multi polygons
+ * with counter clockwise exterior rings and clockwise holes, and points with
+ * non-finite coordinates are skipped.
+ */
+@interface SFGeometryRepair : NSObject
+
+/**
+ * Make the polygon, triangle, or multi polygon valid
+ *
+ * @param geometry
+ *            polygon, triangle, or multi polygon
+ * @return valid multi polygon, empty when no area remains
+ */
++(SFMultiPolygon *) makeValidGeometry: (SFGeometry *) geometry;
+
+/**
+ * Make the polygon, triangle, or multi polygon geometries valid concurrently
+ *
+ * @param geometries
+ *            polygon, triangle, and multi polygon geometries
+ * @return valid multi polygons in geometry order
+ */
++(NSArray<SFMultiPolygon *> *) makeValidGeometries: (NSArray<SFGeometry *> *) geometries;
+
+@end
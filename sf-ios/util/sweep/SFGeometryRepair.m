@@ -0,0 +1,104 @@
+//
+//  SFGeometryRepair.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFGeometryRepair.h"
+#import "SFGeometryValidator.h"
+#import "SFMartinezRueda.h"
+#import "SFGeometryTypes.h"
+
+/**
+ * Number of geometries repaired per concurrent chunk
+ */
+#define SF_GEOMETRY_REPAIR_CHUNK 16
+
+@implementation SFGeometryRepair
+
++(SFMultiPolygon *) makeValidGeometry: (SFGeometry *) geometry{
+    
+    [self validateGeometry:geometry];
+    
+    SFMultiPolygon *result = nil;
+    if(geometry.geometryType == SF_MULTIPOLYGON){
+        result = [self makeValidMultiPolygon:(SFMultiPolygon *)geometry];
+    }else{
+        result = [SFMartinezRueda evenOddWithGeometry:geometry];
+    }
+    
+    return result;
+}
+
++(NSArray<SFMultiPolygon *> *) makeValidGeometries: (NSArray<SFGeometry *> *) geometries{
+    
+    for(SFGeometry *geometry in geometries){
+        [self validateGeometry:geometry];
+    }
+    
+    int count = (int)geometries.count;
+    SFMultiPolygon * __strong *results = (SFMultiPolygon * __strong *) calloc(MAX(count, 1), sizeof(SFMultiPolygon *));
+    
+    size_t chunks = (count + SF_GEOMETRY_REPAIR_CHUNK - 1) / SF_GEOMETRY_REPAIR_CHUNK;
+    dispatch_apply(chunks, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t chunk) {
+        int start = (int)chunk * SF_GEOMETRY_REPAIR_CHUNK;
+        int end = MIN(start + SF_GEOMETRY_REPAIR_CHUNK, count);
+        for(int i = start; i < end; i++){
+            results[i] = [self makeValidGeometry:[geometries objectAtIndex:i]];
+        }
+    });
+    
+    NSMutableArray<SFMultiPolygon *> *result = [[NSMutableArray alloc] initWithCapacity:count];
+    for(int i = 0; i < count; i++){
+        [result addObject:results[i]];
+        results[i] = nil;
+    }
+    free(results);
+    
+    return result;
+}
+
+/**
+ * Make the multi polygon valid. Members of a valid multi polygon do not
+ * overlap and are resolved together, otherwise the members are resolved
+ * individually and merged.
+ *
+ * @param multiPolygon
+ *            multi polygon
+ * @return valid multi polygon
+ */
++(SFMultiPolygon *) makeValidMultiPolygon: (SFMultiPolygon *) multiPolygon{
+    
+    SFMultiPolygon *result = nil;
+    
+    NSArray<SFPolygon *> *polygons = [multiPolygon polygons];
+    if(polygons.count <= 1 || [SFGeometryValidator isValidGeometry:multiPolygon]){
+        result = [SFMartinezRueda evenOddWithGeometry:multiPolygon];
+    }else{
+        result = [SFMartinezRueda unionWithGeometries:[self makeValidGeometries:polygons]];
+    }
+    
+    return result;
+}
+
+/**
+ * Validate the geometry is a polygon, triangle, or multi polygon
+ *
+ * @param geometry
+ *            geometry
+ */
++(void) validateGeometry: (SFGeometry *) geometry{
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch(geometryType){
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+        case SF_MULTIPOLYGON:
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for make valid: %@", [SFGeometryTypes name:geometryType]];
+    }
+}
+
+@end
@@ -0,0 +1,68 @@
+//
+//  SFGeometryValidator.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+#import "SFValidityError.h"
+
+/**
+ * OGC Simple Features geometry validation, reporting the first validity
+ * error with its reason and location.
+ *
+ * Polygon rings must have finite coordinates, be closed, and have at least
+ * three distinct points. Rings may not cross or self touch, holes must be
+ * inside their shell without nesting, the polygon interior must be
+ * connected, and multi polygon members may not overlap or nest, but rings
+ * may touch other rings at points. Ring intersections, touches, and ring
+ * nesting are found in a single Shamos-Hoey style plane sweep of left and
+ * right edge events, running in O(n log n) for n edges.
+ *
+ * Curve polygon rings are validated by their control points.
+ */
+@interface SFGeometryValidator : NSObject
+
+/**
+ * Determine if the geometry is valid
+ *
+ * @param geometry
+ *            geometry
+ * @return true if valid
+ */
++(BOOL) isValidGeometry: (SFGeometry *) geometry;
+
+/**
+ * Validate the geometry
+ *
+ * @param geometry
+ *            geometry
+ * @return first validity error, nil when valid
+ */
++(SFValidityError *) validateGeometry: (SFGeometry *) geometry;
+
+/**
+ * Validate the geometry, optionally requiring counter clockwise polygon
+ * shells and clockwise holes
+ *
+ * @param geometry
+ *            geometry
+ * @param orientation
+ *            true to validate ring orientation
+ * @return first validity error, nil when valid
+ */
++(SFValidityError *) validateGeometry: (SFGeometry *) geometry withOrientation: (BOOL) orientation;
+
+/**
+ * Validate the geometries concurrently
+ *
+ * @param geometries
+ *            geometries
+ * @return validity errors of the invalid geometries by geometry index
+ */
++(NSDictionary<NSNumber *, SFValidityError *> *) validateGeometries: (NSArray<SFGeometry *> *) geometries;
+
+@end
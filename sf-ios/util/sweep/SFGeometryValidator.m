@@ -0,0 +1,1309 @@
+//
+//  SFGeometryValidator.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFGeometryValidator.h"
+#import "SFEventTypes.h"
+#import "SFGeometryTypes.h"
+#import "SFLineString.h"
+#import "SFCompoundCurve.h"
+#import "SFCurvePolygon.h"
+#import "SFMultiPoint.h"
+#import "SFGeometryCollection.h"
+#import "SFPolyhedralSurface.h"
+#import "SFGeometryPredicates.h"
+
+/**
+ * Number of geometries validated per concurrent chunk
+ */
+#define SF_GEOMETRY_VALIDATOR_CHUNK 64
+
+/**
+ * Edge pair intersection classifications
+ */
+enum SFGeometryValidatorIntersection{
+    SF_GEOMETRY_VALIDATOR_DISJOINT = 0,
+    SF_GEOMETRY_VALIDATOR_TOUCH,
+    SF_GEOMETRY_VALIDATOR_CROSS,
+    SF_GEOMETRY_VALIDATOR_OVERLAP
+};
+
+/**
+ * Unassigned ring parent
+ */
+#define SF_GEOMETRY_VALIDATOR_UNASSIGNED -2
+
+/**
+ * Ring parent pending assignment at the current sweep point
+ */
+#define SF_GEOMETRY_VALIDATOR_PENDING -3
+
+/**
+ * Ring touching another ring at a coordinate, with the previous and next
+ * ring coordinates around the touch
+ */
+typedef struct SFGeometryValidatorTouch{
+    double x;
+    double y;
+    double previousX;
+    double previousY;
+    double nextX;
+    double nextY;
+    int polygon;
+    int ring;
+} SFGeometryValidatorTouch;
+
+/**
+ * Sweep event at the left or right end point of an edge
+ */
+typedef struct SFGeometryValidatorEvent{
+    double x;
+    double y;
+    int edge;
+    int type;
+} SFGeometryValidatorEvent;
+
+/**
+ * Sweep line of edges ordered from below to above, as a treap of edge
+ * indexed nodes with subtree sizes for sweep line positions
+ */
+typedef struct SFGeometryValidatorTree{
+    int *left;
+    int *right;
+    int *parent;
+    int *size;
+    unsigned int *priority;
+    int root;
+    unsigned int seed;
+} SFGeometryValidatorTree;
+
+/**
+ * Validation state of flat ring vertices. Rings are stored consecutively
+ * without closing points and edge i runs from vertex i to the next vertex
+ * of its ring.
+ */
+typedef struct SFGeometryValidatorState{
+    const double *x;
+    const double *y;
+    int count;
+    const int *ringStarts;
+    const int *ringPolygons;
+    const BOOL *ringHoles;
+    int ringCount;
+    int *vertexRings;
+    double *areas;
+    int *minimums;
+    int *parents;
+    SFGeometryValidatorTouch *touches;
+    int touchCount;
+    int touchCapacity;
+    int error;
+    double errorX;
+    double errorY;
+} SFGeometryValidatorState;
+
+/**
+ * Next vertex in the ring of the vertex
+ */
+static int SFGeometryValidatorNext(SFGeometryValidatorState *state, int vertex){
+    int ring = state->vertexRings[vertex];
+    return vertex + 1 < state->ringStarts[ring + 1] ? vertex + 1 : state->ringStarts[ring];
+}
+
+/**
+ * Previous vertex in the ring of the vertex
+ */
+static int SFGeometryValidatorPrevious(SFGeometryValidatorState *state, int vertex){
+    int ring = state->vertexRings[vertex];
+    return vertex > state->ringStarts[ring] ? vertex - 1 : state->ringStarts[ring + 1] - 1;
+}
+
+/**
+ * Compare two vertices in sweep order, by x and then y
+ */
+static int SFGeometryValidatorCompareVertices(SFGeometryValidatorState *state, int vertex1, int vertex2){
+    const double *x = state->x;
+    const double *y = state->y;
+    if(x[vertex1] != x[vertex2]){
+        return x[vertex1] < x[vertex2] ? -1 : 1;
+    }
+    if(y[vertex1] != y[vertex2]){
+        return y[vertex1] < y[vertex2] ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * Orientation of point c relative to the line from a to b, positive when
+ * counter clockwise, with an exact sign
+ */
+static double SFGeometryValidatorOrient(double ax, double ay, double bx, double by, double cx, double cy){
+    return [SFGeometryPredicates orientationWithX1:ax andY1:ay andX2:bx andY2:by andX3:cx andY3:cy];
+}
+
+/**
+ * Record the first validation error
+ */
+static void SFGeometryValidatorError(SFGeometryValidatorState *state, enum SFValidityErrorType type, double x, double y){
+    if(state->error < 0){
+        state->error = type;
+        state->errorX = x;
+        state->errorY = y;
+    }
+}
+
+/**
+ * Set the touch of an edge at a coordinate on the edge
+ */
+static void SFGeometryValidatorSetTouch(SFGeometryValidatorState *state, SFGeometryValidatorTouch *touch, int edge, double x, double y){
+    int previous = edge;
+    int next = SFGeometryValidatorNext(state, edge);
+    if(x == state->x[edge] && y == state->y[edge]){
+        previous = SFGeometryValidatorPrevious(state, edge);
+    }else if(x == state->x[next] && y == state->y[next]){
+        next = SFGeometryValidatorNext(state, next);
+    }
+    touch->x = x;
+    touch->y = y;
+    touch->previousX = state->x[previous];
+    touch->previousY = state->y[previous];
+    touch->nextX = state->x[next];
+    touch->nextY = state->y[next];
+    touch->ring = state->vertexRings[edge];
+    touch->polygon = state->ringPolygons[touch->ring];
+}
+
+/**
+ * Record an edge touching another ring at a coordinate on the edge
+ */
+static void SFGeometryValidatorAddTouch(SFGeometryValidatorState *state, int edge, double x, double y){
+    if(state->touchCount == state->touchCapacity){
+        state->touchCapacity = state->touchCapacity > 0 ? state->touchCapacity * 2 : 16;
+        state->touches = realloc(state->touches, state->touchCapacity * sizeof(SFGeometryValidatorTouch));
+    }
+    SFGeometryValidatorSetTouch(state, &state->touches[state->touchCount++], edge, x, y);
+}
+
+/**
+ * Determine if the point is within the bounding box of a segment
+ */
+static BOOL SFGeometryValidatorInBox(double x, double y, double ax, double ay, double bx, double by){
+    return x >= fmin(ax, bx) && x <= fmax(ax, bx) && y >= fmin(ay, by) && y <= fmax(ay, by);
+}
+
+/**
+ * Classify the intersection of two edges, setting the first intersection
+ * coordinate
+ */
+static enum SFGeometryValidatorIntersection SFGeometryValidatorClassify(SFGeometryValidatorState *state, int edge1, int edge2, double *x, double *y){
+    
+    const double *xs = state->x;
+    const double *ys = state->y;
+    int b = SFGeometryValidatorNext(state, edge1);
+    int d = SFGeometryValidatorNext(state, edge2);
+    double ax = xs[edge1], ay = ys[edge1], bx = xs[b], by = ys[b];
+    double cx = xs[edge2], cy = ys[edge2], dx = xs[d], dy = ys[d];
+    
+    if(fmax(ax, bx) < fmin(cx, dx) || fmax(cx, dx) < fmin(ax, bx)
+       || fmax(ay, by) < fmin(cy, dy) || fmax(cy, dy) < fmin(ay, by)){
+        return SF_GEOMETRY_VALIDATOR_DISJOINT;
+    }
+    
+    double d1 = SFGeometryValidatorOrient(cx, cy, dx, dy, ax, ay);
+    double d2 = SFGeometryValidatorOrient(cx, cy, dx, dy, bx, by);
+    double d3 = SFGeometryValidatorOrient(ax, ay, bx, by, cx, cy);
+    double d4 = SFGeometryValidatorOrient(ax, ay, bx, by, dx, dy);
+    
+    if(d1 == 0.0 && d2 == 0.0 && d3 == 0.0 && d4 == 0.0){
+        
+        // Collinear edges, compare along the dominant axis
+        BOOL xAxis = fabs(bx - ax) >= fabs(by - ay);
+        double a = xAxis ? ax : ay, bValue = xAxis ? bx : by;
+        double c = xAxis ? cx : cy, dValue = xAxis ? dx : dy;
+        double min1 = fmin(a, bValue), max1 = fmax(a, bValue);
+        double min2 = fmin(c, dValue), max2 = fmax(c, dValue);
+        double low = fmax(min1, min2);
+        double high = fmin(max1, max2);
+        if(low > high){
+            return SF_GEOMETRY_VALIDATOR_DISJOINT;
+        }
+        if(min1 >= min2){
+            *x = a == min1 ? ax : bx;
+            *y = a == min1 ? ay : by;
+        }else{
+            *x = c == min2 ? cx : dx;
+            *y = c == min2 ? cy : dy;
+        }
+        return low < high ? SF_GEOMETRY_VALIDATOR_OVERLAP : SF_GEOMETRY_VALIDATOR_TOUCH;
+    }
+    
+    if(((d1 > 0.0 && d2 < 0.0) || (d1 < 0.0 && d2 > 0.0))
+       && ((d3 > 0.0 && d4 < 0.0) || (d3 < 0.0 && d4 > 0.0))){
+        double t = d1 / (d1 - d2);
+        *x = ax + (bx - ax) * t;
+        *y = ay + (by - ay) * t;
+        return SF_GEOMETRY_VALIDATOR_CROSS;
+    }
+    
+    if(d1 == 0.0 && SFGeometryValidatorInBox(ax, ay, cx, cy, dx, dy)){
+        *x = ax;
+        *y = ay;
+    }else if(d2 == 0.0 && SFGeometryValidatorInBox(bx, by, cx, cy, dx, dy)){
+        *x = bx;
+        *y = by;
+    }else if(d3 == 0.0 && SFGeometryValidatorInBox(cx, cy, ax, ay, bx, by)){
+        *x = cx;
+        *y = cy;
+    }else if(d4 == 0.0 && SFGeometryValidatorInBox(dx, dy, ax, ay, bx, by)){
+        *x = dx;
+        *y = dy;
+    }else{
+        return SF_GEOMETRY_VALIDATOR_DISJOINT;
+    }
+    return SF_GEOMETRY_VALIDATOR_TOUCH;
+}
+
+/**
+ * Check two edges that are neighbors in the sweep line, recording an error
+ * for crossing, overlapping, or ring self touching edges and recording
+ * touches between rings
+ */
+static void SFGeometryValidatorCheck(SFGeometryValidatorState *state, int edge1, int edge2){
+    
+    double x = 0.0, y = 0.0;
+    enum SFGeometryValidatorIntersection intersection = SFGeometryValidatorClassify(state, edge1, edge2, &x, &y);
+    if(intersection == SF_GEOMETRY_VALIDATOR_DISJOINT){
+        return;
+    }
+    
+    int ring1 = state->vertexRings[edge1];
+    int ring2 = state->vertexRings[edge2];
+    
+    if(ring1 == ring2){
+        BOOL consecutive = SFGeometryValidatorNext(state, edge1) == edge2 || SFGeometryValidatorNext(state, edge2) == edge1;
+        if(intersection == SF_GEOMETRY_VALIDATOR_TOUCH){
+            if(!consecutive){
+                SFGeometryValidatorError(state, SF_VET_RING_SELF_INTERSECTION, x, y);
+            }
+        }else{
+            SFGeometryValidatorError(state, SF_VET_SELF_INTERSECTION, x, y);
+        }
+    }else if(intersection == SF_GEOMETRY_VALIDATOR_TOUCH){
+        SFGeometryValidatorAddTouch(state, edge1, x, y);
+        SFGeometryValidatorAddTouch(state, edge2, x, y);
+    }else{
+        SFGeometryValidatorError(state, SF_VET_SELF_INTERSECTION, x, y);
+    }
+    
+}
+
+/**
+ * Left end point vertex of an edge
+ */
+static int SFGeometryValidatorLeft(SFGeometryValidatorState *state, int edge){
+    int next = SFGeometryValidatorNext(state, edge);
+    return SFGeometryValidatorCompareVertices(state, edge, next) < 0 ? edge : next;
+}
+
+/**
+ * Compare an edge being inserted at its left end point against an edge in
+ * the sweep line, positive when above
+ */
+static int SFGeometryValidatorCompareEdges(SFGeometryValidatorState *state, int edge1, int edge2){
+    
+    const double *x = state->x;
+    const double *y = state->y;
+    int left1 = SFGeometryValidatorLeft(state, edge1);
+    int right1 = left1 == edge1 ? SFGeometryValidatorNext(state, edge1) : edge1;
+    int left2 = SFGeometryValidatorLeft(state, edge2);
+    int right2 = left2 == edge2 ? SFGeometryValidatorNext(state, edge2) : edge2;
+    
+    double orientation = SFGeometryValidatorOrient(x[left2], y[left2], x[right2], y[right2], x[left1], y[left1]);
+    if(orientation == 0.0){
+        orientation = SFGeometryValidatorOrient(x[left2], y[left2], x[right2], y[right2], x[right1], y[right1]);
+    }
+    if(orientation == 0.0){
+        return edge1 < edge2 ? -1 : 1;
+    }
+    return orientation > 0.0 ? 1 : -1;
+}
+
+/**
+ * Compare sweep events by point, with right events first at a point
+ */
+static int SFGeometryValidatorCompareEvents(const void *value1, const void *value2){
+    const SFGeometryValidatorEvent *event1 = value1;
+    const SFGeometryValidatorEvent *event2 = value2;
+    if(event1->x != event2->x){
+        return event1->x < event2->x ? -1 : 1;
+    }
+    if(event1->y != event2->y){
+        return event1->y < event2->y ? -1 : 1;
+    }
+    if(event1->type != event2->type){
+        return event1->type == SF_ET_RIGHT ? -1 : 1;
+    }
+    return event1->edge - event2->edge;
+}
+
+/**
+ * Initialize an empty sweep line for the edges
+ */
+static void SFGeometryValidatorTreeInit(SFGeometryValidatorTree *tree, int count){
+    tree->left = malloc(4 * MAX(count, 1) * sizeof(int));
+    tree->right = tree->left + count;
+    tree->parent = tree->right + count;
+    tree->size = tree->parent + count;
+    tree->priority = malloc(MAX(count, 1) * sizeof(unsigned int));
+    tree->root = -1;
+    tree->seed = 2463534242u;
+}
+
+/**
+ * Free the sweep line buffers
+ */
+static void SFGeometryValidatorTreeFree(SFGeometryValidatorTree *tree){
+    free(tree->left);
+    free(tree->priority);
+}
+
+/**
+ * Subtree size of the node, 0 for no node
+ */
+static int SFGeometryValidatorTreeSize(const SFGeometryValidatorTree *tree, int node){
+    return node >= 0 ? tree->size[node] : 0;
+}
+
+/**
+ * Rotate the treap node above its parent
+ */
+static void SFGeometryValidatorTreeRotateUp(SFGeometryValidatorTree *tree, int node){
+    int parent = tree->parent[node];
+    int grandparent = tree->parent[parent];
+    if(tree->left[parent] == node){
+        tree->left[parent] = tree->right[node];
+        if(tree->right[node] >= 0){
+            tree->parent[tree->right[node]] = parent;
+        }
+        tree->right[node] = parent;
+    }else{
+        tree->right[parent] = tree->left[node];
+        if(tree->left[node] >= 0){
+            tree->parent[tree->left[node]] = parent;
+        }
+        tree->left[node] = parent;
+    }
+    tree->parent[parent] = node;
+    tree->parent[node] = grandparent;
+    if(grandparent < 0){
+        tree->root = node;
+    }else if(tree->left[grandparent] == parent){
+        tree->left[grandparent] = node;
+    }else{
+        tree->right[grandparent] = node;
+    }
+    tree->size[parent] = 1 + SFGeometryValidatorTreeSize(tree, tree->left[parent]) + SFGeometryValidatorTreeSize(tree, tree->right[parent]);
+    tree->size[node] = 1 + SFGeometryValidatorTreeSize(tree, tree->left[node]) + SFGeometryValidatorTreeSize(tree, tree->right[node]);
+}
+
+/**
+ * Insert the edge into the sweep line at its left end point
+ */
+static void SFGeometryValidatorTreeInsert(SFGeometryValidatorState *state, SFGeometryValidatorTree *tree, int edge){
+    tree->seed ^= tree->seed << 13;
+    tree->seed ^= tree->seed >> 17;
+    tree->seed ^= tree->seed << 5;
+    tree->left[edge] = -1;
+    tree->right[edge] = -1;
+    tree->parent[edge] = -1;
+    tree->size[edge] = 1;
+    tree->priority[edge] = tree->seed;
+    if(tree->root < 0){
+        tree->root = edge;
+        return;
+    }
+    int current = tree->root;
+    while(YES){
+        tree->size[current]++;
+        if(SFGeometryValidatorCompareEdges(state, edge, current) > 0){
+            if(tree->right[current] < 0){
+                tree->right[current] = edge;
+                break;
+            }
+            current = tree->right[current];
+        }else{
+            if(tree->left[current] < 0){
+                tree->left[current] = edge;
+                break;
+            }
+            current = tree->left[current];
+        }
+    }
+    tree->parent[edge] = current;
+    while(tree->parent[edge] >= 0 && tree->priority[edge] < tree->priority[tree->parent[edge]]){
+        SFGeometryValidatorTreeRotateUp(tree, edge);
+    }
+}
+
+/**
+ * Remove the edge from the sweep line
+ */
+static void SFGeometryValidatorTreeRemove(SFGeometryValidatorTree *tree, int edge){
+    while(tree->left[edge] >= 0 && tree->right[edge] >= 0){
+        int left = tree->left[edge];
+        int right = tree->right[edge];
+        SFGeometryValidatorTreeRotateUp(tree, tree->priority[left] < tree->priority[right] ? left : right);
+    }
+    int child = tree->left[edge] >= 0 ? tree->left[edge] : tree->right[edge];
+    int parent = tree->parent[edge];
+    if(child >= 0){
+        tree->parent[child] = parent;
+    }
+    if(parent < 0){
+        tree->root = child;
+    }else if(tree->left[parent] == edge){
+        tree->left[parent] = child;
+    }else{
+        tree->right[parent] = child;
+    }
+    for(int node = parent; node >= 0; node = tree->parent[node]){
+        tree->size[node]--;
+    }
+}
+
+/**
+ * Edge below the edge in the sweep line, -1 if none
+ */
+static int SFGeometryValidatorTreePrevious(const SFGeometryValidatorTree *tree, int edge){
+    if(tree->left[edge] >= 0){
+        edge = tree->left[edge];
+        while(tree->right[edge] >= 0){
+            edge = tree->right[edge];
+        }
+        return edge;
+    }
+    int parent = tree->parent[edge];
+    while(parent >= 0 && tree->left[parent] == edge){
+        edge = parent;
+        parent = tree->parent[edge];
+    }
+    return parent;
+}
+
+/**
+ * Edge above the edge in the sweep line, -1 if none
+ */
+static int SFGeometryValidatorTreeNext(const SFGeometryValidatorTree *tree, int edge){
+    if(tree->right[edge] >= 0){
+        edge = tree->right[edge];
+        while(tree->left[edge] >= 0){
+            edge = tree->left[edge];
+        }
+        return edge;
+    }
+    int parent = tree->parent[edge];
+    while(parent >= 0 && tree->right[parent] == edge){
+        edge = parent;
+        parent = tree->parent[edge];
+    }
+    return parent;
+}
+
+/**
+ * Position of an edge in the sweep line, counted from below
+ */
+static int SFGeometryValidatorPosition(const SFGeometryValidatorTree *tree, int edge){
+    int position = SFGeometryValidatorTreeSize(tree, tree->left[edge]);
+    for(int parent = tree->parent[edge]; parent >= 0; edge = parent, parent = tree->parent[edge]){
+        if(tree->right[parent] == edge){
+            position += SFGeometryValidatorTreeSize(tree, tree->left[parent]) + 1;
+        }
+    }
+    return position;
+}
+
+/**
+ * Assign the parent ring of rings whose minimum vertex is at the current
+ * sweep point, from the nearest edge below the lower edge of the ring
+ */
+static void SFGeometryValidatorAssignParents(SFGeometryValidatorState *state, const SFGeometryValidatorTree *tree, int *pending, int *lower, int *lowerEdges, int pendingCount){
+    
+    for(int i = 0; i < pendingCount; i++){
+        int ring = pending[i];
+        int minimum = state->minimums[ring];
+        int previous = SFGeometryValidatorPrevious(state, minimum);
+        int position1 = SFGeometryValidatorPosition(tree, minimum);
+        int position2 = SFGeometryValidatorPosition(tree, previous);
+        int position = position1 < position2 ? position1 : position2;
+        int lowerEdge = position1 < position2 ? minimum : previous;
+        int j = i;
+        while(j > 0 && lower[j - 1] > position){
+            lower[j] = lower[j - 1];
+            lowerEdges[j] = lowerEdges[j - 1];
+            pending[j] = pending[j - 1];
+            j--;
+        }
+        lower[j] = position;
+        lowerEdges[j] = lowerEdge;
+        pending[j] = ring;
+    }
+    
+    for(int i = 0; i < pendingCount; i++){
+        int parent = -1;
+        int below = SFGeometryValidatorTreePrevious(tree, lowerEdges[i]);
+        if(below >= 0){
+            int belowRing = state->vertexRings[below];
+            BOOL leftToRight = SFGeometryValidatorCompareVertices(state, below, SFGeometryValidatorNext(state, below)) < 0;
+            BOOL interiorAbove = (state->areas[belowRing] > 0.0) == leftToRight;
+            parent = interiorAbove ? belowRing : state->parents[belowRing];
+        }
+        state->parents[pending[i]] = parent;
+    }
+    
+}
+
+/**
+ * Sweep the edges in a single pass, checking sweep line neighbors for
+ * intersections and assigning the parent ring of each ring
+ */
+static void SFGeometryValidatorSweep(SFGeometryValidatorState *state){
+    
+    int count = state->count;
+    int eventCount = 2 * count;
+    SFGeometryValidatorEvent *events = malloc(eventCount * sizeof(SFGeometryValidatorEvent));
+    for(int edge = 0; edge < count; edge++){
+        int left = SFGeometryValidatorLeft(state, edge);
+        int right = left == edge ? SFGeometryValidatorNext(state, edge) : edge;
+        SFGeometryValidatorEvent *leftEvent = &events[2 * edge];
+        leftEvent->x = state->x[left];
+        leftEvent->y = state->y[left];
+        leftEvent->edge = edge;
+        leftEvent->type = SF_ET_LEFT;
+        SFGeometryValidatorEvent *rightEvent = &events[2 * edge + 1];
+        rightEvent->x = state->x[right];
+        rightEvent->y = state->y[right];
+        rightEvent->edge = edge;
+        rightEvent->type = SF_ET_RIGHT;
+    }
+    qsort(events, eventCount, sizeof(SFGeometryValidatorEvent), SFGeometryValidatorCompareEvents);
+    
+    SFGeometryValidatorTree sweepLine;
+    SFGeometryValidatorTreeInit(&sweepLine, count);
+    int *pending = malloc(3 * state->ringCount * sizeof(int));
+    int *lower = pending + state->ringCount;
+    int *lowerEdges = lower + state->ringCount;
+    
+    int start = 0;
+    while(start < eventCount && state->error < 0){
+        
+        int end = start;
+        int pendingCount = 0;
+        while(end < eventCount && events[end].x == events[start].x && events[end].y == events[start].y){
+            
+            int edge = events[end].edge;
+            if(events[end].type == SF_ET_RIGHT){
+                int below = SFGeometryValidatorTreePrevious(&sweepLine, edge);
+                int above = SFGeometryValidatorTreeNext(&sweepLine, edge);
+                SFGeometryValidatorTreeRemove(&sweepLine, edge);
+                if(below >= 0 && above >= 0){
+                    SFGeometryValidatorCheck(state, below, above);
+                }
+            }else{
+                SFGeometryValidatorTreeInsert(state, &sweepLine, edge);
+                int below = SFGeometryValidatorTreePrevious(&sweepLine, edge);
+                int above = SFGeometryValidatorTreeNext(&sweepLine, edge);
+                if(below >= 0){
+                    SFGeometryValidatorCheck(state, below, edge);
+                }
+                if(above >= 0){
+                    SFGeometryValidatorCheck(state, edge, above);
+                }
+                int ring = state->vertexRings[edge];
+                if(state->parents[ring] == SF_GEOMETRY_VALIDATOR_UNASSIGNED
+                   && SFGeometryValidatorLeft(state, edge) == state->minimums[ring]){
+                    state->parents[ring] = SF_GEOMETRY_VALIDATOR_PENDING;
+                    pending[pendingCount++] = ring;
+                }
+            }
+            
+            if(state->error >= 0){
+                break;
+            }
+            end++;
+        }
+        
+        if(pendingCount > 0 && state->error < 0){
+            SFGeometryValidatorAssignParents(state, &sweepLine, pending, lower, lowerEdges, pendingCount);
+        }
+        
+        start = end;
+    }
+    
+    free(events);
+    SFGeometryValidatorTreeFree(&sweepLine);
+    free(pending);
+    
+}
+
+/**
+ * Compare ring touches by coordinate and ring
+ */
+static int SFGeometryValidatorComparePointTouches(const void *value1, const void *value2){
+    const SFGeometryValidatorTouch *touch1 = value1;
+    const SFGeometryValidatorTouch *touch2 = value2;
+    if(touch1->x != touch2->x){
+        return touch1->x < touch2->x ? -1 : 1;
+    }
+    if(touch1->y != touch2->y){
+        return touch1->y < touch2->y ? -1 : 1;
+    }
+    return touch1->ring - touch2->ring;
+}
+
+/**
+ * Compare ring touches by polygon, coordinate, and ring
+ */
+static int SFGeometryValidatorComparePolygonTouches(const void *value1, const void *value2){
+    const SFGeometryValidatorTouch *touch1 = value1;
+    const SFGeometryValidatorTouch *touch2 = value2;
+    if(touch1->polygon != touch2->polygon){
+        return touch1->polygon - touch2->polygon;
+    }
+    return SFGeometryValidatorComparePointTouches(value1, value2);
+}
+
+/**
+ * Check vertices shared by rings, recording an error for a ring touching
+ * itself and recording touches between rings
+ */
+static void SFGeometryValidatorSharedVertices(SFGeometryValidatorState *state){
+    
+    int count = state->count;
+    SFGeometryValidatorTouch *vertices = malloc(count * sizeof(SFGeometryValidatorTouch));
+    for(int vertex = 0; vertex < count; vertex++){
+        SFGeometryValidatorSetTouch(state, &vertices[vertex], vertex, state->x[vertex], state->y[vertex]);
+    }
+    qsort(vertices, count, sizeof(SFGeometryValidatorTouch), SFGeometryValidatorComparePointTouches);
+    
+    int start = 0;
+    while(start < count && state->error < 0){
+        SFGeometryValidatorTouch *first = &vertices[start];
+        int end = start + 1;
+        while(end < count && vertices[end].x == first->x && vertices[end].y == first->y){
+            if(vertices[end].ring == vertices[end - 1].ring){
+                SFGeometryValidatorError(state, SF_VET_RING_SELF_INTERSECTION, first->x, first->y);
+            }
+            end++;
+        }
+        for(int i = start; end - start > 1 && i < end; i++){
+            if(state->touchCount == state->touchCapacity){
+                state->touchCapacity = state->touchCapacity > 0 ? state->touchCapacity * 2 : 16;
+                state->touches = realloc(state->touches, state->touchCapacity * sizeof(SFGeometryValidatorTouch));
+            }
+            state->touches[state->touchCount++] = vertices[i];
+        }
+        start = end;
+    }
+    
+    free(vertices);
+    
+}
+
+/**
+ * Determine if the direction is strictly within the counter clockwise angle
+ * from the first direction to the second direction
+ */
+static BOOL SFGeometryValidatorBetween(double x1, double y1, double x2, double y2, double x, double y){
+    double cross = x1 * y2 - y1 * x2;
+    double cross1 = x1 * y - y1 * x;
+    double cross2 = x * y2 - y * x2;
+    if(cross > 0.0){
+        return cross1 > 0.0 && cross2 > 0.0;
+    }
+    if(cross < 0.0){
+        return cross1 > 0.0 || cross2 > 0.0;
+    }
+    return cross1 > 0.0;
+}
+
+/**
+ * Determine if the direction matches the first or second direction
+ */
+static BOOL SFGeometryValidatorAlong(double x1, double y1, double x2, double y2, double x, double y){
+    return (x1 * y - y1 * x == 0.0 && x1 * x + y1 * y > 0.0)
+        || (x2 * y - y2 * x == 0.0 && x2 * x + y2 * y > 0.0);
+}
+
+/**
+ * Determine if the second ring crosses the first ring at their touch, with
+ * the second ring directions on both sides of the first ring
+ */
+static BOOL SFGeometryValidatorCrosses(SFGeometryValidatorTouch *touch1, SFGeometryValidatorTouch *touch2){
+    double x1 = touch1->previousX - touch1->x, y1 = touch1->previousY - touch1->y;
+    double x2 = touch1->nextX - touch1->x, y2 = touch1->nextY - touch1->y;
+    double x3 = touch2->previousX - touch2->x, y3 = touch2->previousY - touch2->y;
+    double x4 = touch2->nextX - touch2->x, y4 = touch2->nextY - touch2->y;
+    if(SFGeometryValidatorAlong(x1, y1, x2, y2, x3, y3) || SFGeometryValidatorAlong(x1, y1, x2, y2, x4, y4)){
+        return NO;
+    }
+    return SFGeometryValidatorBetween(x1, y1, x2, y2, x3, y3) != SFGeometryValidatorBetween(x1, y1, x2, y2, x4, y4);
+}
+
+/**
+ * Check rings touching at a coordinate for rings crossing through each
+ * other at the coordinate
+ */
+static void SFGeometryValidatorTouchCrossings(SFGeometryValidatorState *state){
+    
+    int touchCount = state->touchCount;
+    if(touchCount == 0){
+        return;
+    }
+    SFGeometryValidatorTouch *touches = state->touches;
+    qsort(touches, touchCount, sizeof(SFGeometryValidatorTouch), SFGeometryValidatorComparePointTouches);
+    
+    int start = 0;
+    while(start < touchCount && state->error < 0){
+        int end = start + 1;
+        while(end < touchCount && touches[end].x == touches[start].x && touches[end].y == touches[start].y){
+            end++;
+        }
+        for(int i = start; i < end && state->error < 0; i++){
+            for(int j = i + 1; j < end; j++){
+                if(touches[i].ring != touches[j].ring && SFGeometryValidatorCrosses(&touches[i], &touches[j])){
+                    SFGeometryValidatorError(state, SF_VET_SELF_INTERSECTION, touches[i].x, touches[i].y);
+                    break;
+                }
+            }
+        }
+        start = end;
+    }
+    
+}
+
+/**
+ * Check the parent ring of each ring for holes outside of their shell,
+ * nested holes, and nested polygon shells
+ */
+static void SFGeometryValidatorNesting(SFGeometryValidatorState *state){
+    
+    for(int ring = 0; ring < state->ringCount && state->error < 0; ring++){
+        int parent = state->parents[ring];
+        int minimum = state->minimums[ring];
+        int polygon = state->ringPolygons[ring];
+        if(state->ringHoles[ring]){
+            if(parent < 0 || state->ringPolygons[parent] != polygon){
+                SFGeometryValidatorError(state, SF_VET_HOLE_OUTSIDE_SHELL, state->x[minimum], state->y[minimum]);
+            }else if(state->ringHoles[parent]){
+                SFGeometryValidatorError(state, SF_VET_NESTED_HOLES, state->x[minimum], state->y[minimum]);
+            }
+        }else if(parent >= 0 && !state->ringHoles[parent]){
+            SFGeometryValidatorError(state, SF_VET_NESTED_SHELLS, state->x[minimum], state->y[minimum]);
+        }
+    }
+    
+}
+
+/**
+ * Find the union find root of a node, compressing the path
+ */
+static int SFGeometryValidatorFind(int *roots, int node){
+    while(roots[node] != node){
+        roots[node] = roots[roots[node]];
+        node = roots[node];
+    }
+    return node;
+}
+
+/**
+ * Check that each polygon interior is connected. Rings and touch points
+ * form a graph with an edge for each ring touching at a point, and a cycle
+ * in the graph encloses part of the interior.
+ */
+static void SFGeometryValidatorConnected(SFGeometryValidatorState *state){
+    
+    int touchCount = state->touchCount;
+    if(touchCount == 0){
+        return;
+    }
+    SFGeometryValidatorTouch *touches = state->touches;
+    qsort(touches, touchCount, sizeof(SFGeometryValidatorTouch), SFGeometryValidatorComparePolygonTouches);
+    
+    int nodes = state->ringCount + touchCount;
+    int *roots = malloc(nodes * sizeof(int));
+    for(int node = 0; node < nodes; node++){
+        roots[node] = node;
+    }
+    
+    int point = -1;
+    for(int i = 0; i < touchCount; i++){
+        SFGeometryValidatorTouch *touch = &touches[i];
+        if(i > 0){
+            SFGeometryValidatorTouch *previous = &touches[i - 1];
+            BOOL samePoint = touch->polygon == previous->polygon && touch->x == previous->x && touch->y == previous->y;
+            if(samePoint && touch->ring == previous->ring){
+                continue;
+            }
+            if(!samePoint){
+                point = -1;
+            }
+        }
+        if(point < 0){
+            point = state->ringCount + i;
+        }
+        int ringRoot = SFGeometryValidatorFind(roots, touch->ring);
+        int pointRoot = SFGeometryValidatorFind(roots, point);
+        if(ringRoot == pointRoot){
+            SFGeometryValidatorError(state, SF_VET_DISCONNECTED_INTERIOR, touch->x, touch->y);
+            break;
+        }
+        roots[ringRoot] = pointRoot;
+    }
+    
+    free(roots);
+    
+}
+
+/**
+ * Check for counter clockwise shells and clockwise holes
+ */
+static void SFGeometryValidatorOrientation(SFGeometryValidatorState *state){
+    for(int ring = 0; ring < state->ringCount && state->error < 0; ring++){
+        if(state->ringHoles[ring] ? state->areas[ring] > 0.0 : state->areas[ring] < 0.0){
+            int start = state->ringStarts[ring];
+            SFGeometryValidatorError(state, SF_VET_RING_ORIENTATION, state->x[start], state->y[start]);
+        }
+    }
+}
+
+/**
+ * Validate the polygon rings, returning the error type or -1 when valid
+ */
+static int SFGeometryValidatorValidate(SFGeometryValidatorState *state, BOOL orientation){
+    
+    int count = state->count;
+    int ringCount = state->ringCount;
+    state->vertexRings = malloc(count * sizeof(int));
+    state->areas = malloc(ringCount * sizeof(double));
+    state->minimums = malloc(ringCount * sizeof(int));
+    state->parents = malloc(ringCount * sizeof(int));
+    state->touches = NULL;
+    state->touchCount = 0;
+    state->touchCapacity = 0;
+    state->error = -1;
+    
+    for(int ring = 0; ring < ringCount; ring++){
+        int start = state->ringStarts[ring];
+        int end = state->ringStarts[ring + 1];
+        double area = 0.0;
+        int minimum = start;
+        for(int vertex = start; vertex < end; vertex++){
+            state->vertexRings[vertex] = ring;
+            int next = vertex + 1 < end ? vertex + 1 : start;
+            area += (state->x[vertex] - state->x[start]) * (state->y[next] - state->y[start])
+                - (state->x[next] - state->x[start]) * (state->y[vertex] - state->y[start]);
+            if(SFGeometryValidatorCompareVertices(state, vertex, minimum) < 0){
+                minimum = vertex;
+            }
+        }
+        state->areas[ring] = area;
+        state->minimums[ring] = minimum;
+        state->parents[ring] = SF_GEOMETRY_VALIDATOR_UNASSIGNED;
+    }
+    
+    SFGeometryValidatorSweep(state);
+    if(state->error < 0){
+        SFGeometryValidatorSharedVertices(state);
+    }
+    if(state->error < 0){
+        SFGeometryValidatorTouchCrossings(state);
+    }
+    if(state->error < 0){
+        SFGeometryValidatorNesting(state);
+    }
+    if(state->error < 0){
+        SFGeometryValidatorConnected(state);
+    }
+    if(state->error < 0 && orientation){
+        SFGeometryValidatorOrientation(state);
+    }
+    
+    free(state->vertexRings);
+    free(state->areas);
+    free(state->minimums);
+    free(state->parents);
+    free(state->touches);
+    
+    return state->error;
+}
+
+/**
+ * Flat polygon rings read for validation
+ */
+typedef struct SFGeometryValidatorRings{
+    double *x;
+    double *y;
+    int count;
+    int capacity;
+    int *ringStarts;
+    int *ringPolygons;
+    BOOL *ringHoles;
+    int ringCount;
+    int ringCapacity;
+} SFGeometryValidatorRings;
+
+/**
+ * Initialize empty rings
+ */
+static void SFGeometryValidatorRingsInit(SFGeometryValidatorRings *rings){
+    memset(rings, 0, sizeof(SFGeometryValidatorRings));
+    rings->ringStarts = malloc(sizeof(int));
+    rings->ringStarts[0] = 0;
+}
+
+/**
+ * Free the rings
+ */
+static void SFGeometryValidatorRingsFree(SFGeometryValidatorRings *rings){
+    free(rings->x);
+    free(rings->y);
+    free(rings->ringStarts);
+    free(rings->ringPolygons);
+    free(rings->ringHoles);
+}
+
+/**
+ * Ensure capacity for additional ring points
+ */
+static void SFGeometryValidatorRingsReserve(SFGeometryValidatorRings *rings, int count){
+    if(rings->count + count > rings->capacity){
+        rings->capacity = MAX(rings->capacity * 2, rings->count + count);
+        rings->x = realloc(rings->x, rings->capacity * sizeof(double));
+        rings->y = realloc(rings->y, rings->capacity * sizeof(double));
+    }
+}
+
+/**
+ * Add a ring ending at the current point count
+ */
+static void SFGeometryValidatorRingsAddRing(SFGeometryValidatorRings *rings, int polygon, BOOL hole){
+    if(rings->ringCount == rings->ringCapacity){
+        rings->ringCapacity = MAX(rings->ringCapacity * 2, 8);
+        rings->ringStarts = realloc(rings->ringStarts, (rings->ringCapacity + 1) * sizeof(int));
+        rings->ringPolygons = realloc(rings->ringPolygons, rings->ringCapacity * sizeof(int));
+        rings->ringHoles = realloc(rings->ringHoles, rings->ringCapacity * sizeof(BOOL));
+    }
+    rings->ringPolygons[rings->ringCount] = polygon;
+    rings->ringHoles[rings->ringCount] = hole;
+    rings->ringCount++;
+    rings->ringStarts[rings->ringCount] = rings->count;
+}
+
+@implementation SFGeometryValidator
+
++(BOOL) isValidGeometry: (SFGeometry *) geometry{
+    return [self validateGeometry:geometry] == nil;
+}
+
++(SFValidityError *) validateGeometry: (SFGeometry *) geometry{
+    return [self validateGeometry:geometry withOrientation:NO];
+}
+
++(SFValidityError *) validateGeometry: (SFGeometry *) geometry withOrientation: (BOOL) orientation{
+    
+    SFValidityError *error = nil;
+    
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch(geometryType){
+        case SF_POINT:
+            error = [self validatePoint:(SFPoint *) geometry];
+            break;
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+        case SF_COMPOUNDCURVE:
+            error = [self validateCurve:(SFCurve *) geometry];
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+        case SF_CURVEPOLYGON:
+            error = [self validatePolygons:@[(SFCurvePolygon *) geometry] withOrientation:orientation];
+            break;
+        case SF_MULTIPOLYGON:
+        case SF_MULTISURFACE:
+            {
+                NSMutableArray<SFCurvePolygon *> *polygons = [[NSMutableArray alloc] init];
+                for(SFGeometry *member in ((SFGeometryCollection *) geometry).geometries){
+                    if([member isKindOfClass:[SFCurvePolygon class]]){
+                        [polygons addObject:(SFCurvePolygon *) member];
+                    }else{
+                        error = [self validateGeometry:member withOrientation:orientation];
+                        if(error != nil){
+                            break;
+                        }
+                    }
+                }
+                if(error == nil){
+                    error = [self validatePolygons:polygons withOrientation:orientation];
+                }
+            }
+            break;
+        case SF_MULTIPOINT:
+        case SF_MULTILINESTRING:
+        case SF_MULTICURVE:
+        case SF_GEOMETRYCOLLECTION:
+            for(SFGeometry *member in ((SFGeometryCollection *) geometry).geometries){
+                error = [self validateGeometry:member withOrientation:orientation];
+                if(error != nil){
+                    break;
+                }
+            }
+            break;
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            for(SFPolygon *polygon in ((SFPolyhedralSurface *) geometry).polygons){
+                error = [self validatePolygons:@[polygon] withOrientation:orientation];
+                if(error != nil){
+                    break;
+                }
+            }
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for validation: %@", [SFGeometryTypes name:geometryType]];
+    }
+    
+    return error;
+}
+
++(NSDictionary<NSNumber *, SFValidityError *> *) validateGeometries: (NSArray<SFGeometry *> *) geometries{
+    
+    int count = (int)geometries.count;
+    SFValidityError * __strong *errors = (SFValidityError * __strong *) calloc(MAX(count, 1), sizeof(SFValidityError *));
+    
+    size_t chunks = (count + SF_GEOMETRY_VALIDATOR_CHUNK - 1) / SF_GEOMETRY_VALIDATOR_CHUNK;
+    dispatch_apply(chunks, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t chunk) {
+        int start = (int)chunk * SF_GEOMETRY_VALIDATOR_CHUNK;
+        int end = MIN(start + SF_GEOMETRY_VALIDATOR_CHUNK, count);
+        for(int i = start; i < end; i++){
+            errors[i] = [self validateGeometry:[geometries objectAtIndex:i]];
+        }
+    });
+    
+    NSMutableDictionary<NSNumber *, SFValidityError *> *result = [[NSMutableDictionary alloc] init];
+    for(int i = 0; i < count; i++){
+        if(errors[i] != nil){
+            [result setObject:errors[i] forKey:[NSNumber numberWithInt:i]];
+            errors[i] = nil;
+        }
+    }
+    free(errors);
+    
+    return result;
+}
+
+/**
+ * Validate the point has finite coordinates
+ *
+ * @param point
+ *            point
+ * @return validity error or nil
+ */
++(SFValidityError *) validatePoint: (SFPoint *) point{
+    SFValidityError *error = nil;
+    if(![point isEmpty] && (!isfinite([point.x doubleValue]) || !isfinite([point.y doubleValue]))){
+        error = [[SFValidityError alloc] initWithType:SF_VET_INVALID_COORDINATE andLocation:[point mutableCopy]];
+    }
+    return error;
+}
+
+/**
+ * Validate the curve has finite coordinates and at least two distinct
+ * points, or three points for a circular string
+ *
+ * @param curve
+ *            curve
+ * @return validity error or nil
+ */
++(SFValidityError *) validateCurve: (SFCurve *) curve{
+    
+    NSArray<SFPoint *> *points = [self pointsOfCurve:curve];
+    if(points.count == 0){
+        return nil;
+    }
+    
+    SFPoint *first = [points objectAtIndex:0];
+    int distinct = 0;
+    double previousX = NAN;
+    double previousY = NAN;
+    for(SFPoint *point in points){
+        double x = [point.x doubleValue];
+        double y = [point.y doubleValue];
+        if(!isfinite(x) || !isfinite(y)){
+            return [[SFValidityError alloc] initWithType:SF_VET_INVALID_COORDINATE andLocation:[point mutableCopy]];
+        }
+        if(x != previousX || y != previousY){
+            distinct++;
+        }
+        previousX = x;
+        previousY = y;
+    }
+    
+    int minimum = curve.geometryType == SF_CIRCULARSTRING ? 3 : 2;
+    if(distinct < 2 || (int)points.count < minimum){
+        return [[SFValidityError alloc] initWithType:SF_VET_TOO_FEW_POINTS andLocation:[self locationOfPoint:first]];
+    }
+    
+    return nil;
+}
+
+/**
+ * Validate the polygons, as a single polygon or the members of a multi
+ * polygon
+ *
+ * @param polygons
+ *            polygons
+ * @param orientation
+ *            true to validate ring orientation
+ * @return validity error or nil
+ */
++(SFValidityError *) validatePolygons: (NSArray<SFCurvePolygon *> *) polygons withOrientation: (BOOL) orientation{
+    
+    SFValidityError *error = nil;
+    
+    SFGeometryValidatorRings rings;
+    SFGeometryValidatorRingsInit(&rings);
+    
+    int polygonIndex = 0;
+    for(SFCurvePolygon *polygon in polygons){
+        NSArray<SFCurve *> *polygonRings = polygon.rings;
+        for(int i = 0; i < polygonRings.count && error == nil; i++){
+            error = [self readRing:[polygonRings objectAtIndex:i] ofPolygon:polygonIndex asHole:i > 0 intoRings:&rings];
+        }
+        if(error != nil){
+            break;
+        }
+        polygonIndex++;
+    }
+    
+    if(error == nil && rings.ringCount > 0){
+        SFGeometryValidatorState state;
+        state.x = rings.x;
+        state.y = rings.y;
+        state.count = rings.count;
+        state.ringStarts = rings.ringStarts;
+        state.ringPolygons = rings.ringPolygons;
+        state.ringHoles = rings.ringHoles;
+        state.ringCount = rings.ringCount;
+        int type = SFGeometryValidatorValidate(&state, orientation);
+        if(type >= 0){
+            error = [[SFValidityError alloc] initWithType:type andLocation:[[SFPoint alloc] initWithXValue:state.errorX andYValue:state.errorY]];
+        }
+    }
+    
+    SFGeometryValidatorRingsFree(&rings);
+    
+    return error;
+}
+
+/**
+ * Read a polygon ring, validating the ring coordinates, closure, and point
+ * count, without the closing point and consecutive duplicate points
+ *
+ * @param ring
+ *            polygon ring
+ * @param polygon
+ *            polygon index
+ * @param hole
+ *            true if a hole
+ * @param rings
+ *            flat rings
+ * @return validity error or nil
+ */
++(SFValidityError *) readRing: (SFCurve *) ring ofPolygon: (int) polygon asHole: (BOOL) hole intoRings: (SFGeometryValidatorRings *) rings{
+    
+    NSArray<SFPoint *> *points = [self pointsOfCurve:ring];
+    int count = (int)points.count;
+    if(count == 0){
+        return [[SFValidityError alloc] initWithType:SF_VET_TOO_FEW_POINTS andLocation:nil];
+    }
+    
+    SFGeometryValidatorRingsReserve(rings, count);
+    int start = rings->count;
+    double *x = rings->x + start;
+    double *y = rings->y + start;
+    for(int i = 0; i < count; i++){
+        SFPoint *point = [points objectAtIndex:i];
+        x[i] = [point.x doubleValue];
+        y[i] = [point.y doubleValue];
+        if(!isfinite(x[i]) || !isfinite(y[i])){
+            return [[SFValidityError alloc] initWithType:SF_VET_INVALID_COORDINATE andLocation:[point mutableCopy]];
+        }
+    }
+    
+    SFPoint *location = [self locationOfPoint:[points objectAtIndex:0]];
+    if(x[0] != x[count - 1] || y[0] != y[count - 1]){
+        return [[SFValidityError alloc] initWithType:SF_VET_RING_NOT_CLOSED andLocation:location];
+    }
+    if(count < 4){
+        return [[SFValidityError alloc] initWithType:SF_VET_TOO_FEW_POINTS andLocation:location];
+    }
+    
+    int distinct = 1;
+    for(int i = 1; i < count - 1; i++){
+        if(x[i] != x[distinct - 1] || y[i] != y[distinct - 1]){
+            x[distinct] = x[i];
+            y[distinct] = y[i];
+            distinct++;
+        }
+    }
+    while(distinct > 1 && x[distinct - 1] == x[0] && y[distinct - 1] == y[0]){
+        distinct--;
+    }
+    if(distinct < 3){
+        return [[SFValidityError alloc] initWithType:SF_VET_TOO_FEW_POINTS andLocation:location];
+    }
+    
+    rings->count += distinct;
+    SFGeometryValidatorRingsAddRing(rings, polygon, hole);
+    
+    return nil;
+}
+
+/**
+ * Get the points of a line string or compound curve
+ *
+ * @param curve
+ *            curve
+ * @return points
+ */
++(NSArray<SFPoint *> *) pointsOfCurve: (SFCurve *) curve{
+    NSArray<SFPoint *> *points = nil;
+    if([curve isKindOfClass:[SFLineString class]]){
+        points = ((SFLineString *) curve).points;
+    }else if([curve isKindOfClass:[SFCompoundCurve class]]){
+        NSMutableArray<SFPoint *> *compoundPoints = [[NSMutableArray alloc] init];
+        for(SFLineString *lineString in ((SFCompoundCurve *) curve).lineStrings){
+            [compoundPoints addObjectsFromArray:lineString.points];
+        }
+        points = compoundPoints;
+    }else{
+        [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for validation: %@", [SFGeometryTypes name:curve.geometryType]];
+    }
+    return points;
+}
+
+/**
+ * Get a two dimensional error location of a point
+ *
+ * @param point
+ *            point
+ * @return location
+ */
++(SFPoint *) locationOfPoint: (SFPoint *) point{
+    return [[SFPoint alloc] initWithX:point.x andY:point.y];
+}
+
+@end
@@ -0,0 +1,137 @@
+//
+//  SFMartinezRueda.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+#import "SFMultiPolygon.h"
+#import "SFOverlayTypes.h"
+
+/**
+ * Martinez-Rueda-Feito polygon overlay (intersection, union, difference, and
+ * xor) of polygons and multi polygons, including holes. Edges are subdivided
+ * at their intersections during a single plane sweep, running in
+ * O((n + k) log n) for n edges and k intersections.
+ *
+ * Results are two dimensional multi polygons with counter clockwise exterior
+ * rings and clockwise holes. Input z and m values are not retained and
+ * points with non-finite coordinates are skipped.
+ *
+ * Based upon the JavaScript implementation:
+ * https://github.com/w8r/martinez
+ *
+ * JavaScript implementation license:
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 Alexander Milevski
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+@interface SFMartinezRueda : NSObject
+
+/**
+ * Overlay the polygon or multi polygon geometries
+ *
+ * @param subject
+ *            subject polygon or multi polygon
+ * @param clipping
+ *            clipping polygon or multi polygon
+ * @param type
+ *            overlay operation type
+ * @return overlay multi polygon, empty when no area remains
+ */
++(SFMultiPolygon *) overlayWithGeometry: (SFGeometry *) subject andGeometry: (SFGeometry *) clipping andType: (enum SFOverlayType) type;
+
+/**
+ * Intersection of the polygon or multi polygon geometries
+ *
+ * @param subject
+ *            subject polygon or multi polygon
+ * @param clipping
+ *            clipping polygon or multi polygon
+ * @return intersection multi polygon
+ */
++(SFMultiPolygon *) intersectionWithGeometry: (SFGeometry *) subject andGeometry: (SFGeometry *) clipping;
+
+/**
+ * Union of the polygon or multi polygon geometries
+ *
+ * @param subject
+ *            subject polygon or multi polygon
+ * @param clipping
+ *            clipping polygon or multi polygon
+ * @return union multi polygon
+ */
++(SFMultiPolygon *) unionWithGeometry: (SFGeometry *) subject andGeometry: (SFGeometry *) clipping;
+
+/**
+ * Difference of the clipping geometry from the subject geometry
+ *
+ * @param subject
+ *            subject polygon or multi polygon
+ * @param clipping
+ *            clipping polygon or multi polygon
+ * @return difference multi polygon
+ */
++(SFMultiPolygon *) differenceWithGeometry: (SFGeometry *) subject andGeometry: (SFGeometry *) clipping;
+
+/**
+ * Symmetric difference (xor) of the polygon or multi polygon geometries
+ *
+ * @param subject
+ *            subject polygon or multi polygon
+ * @param clipping
+ *            clipping polygon or multi polygon
+ * @return symmetric difference multi polygon
+ */
++(SFMultiPolygon *) xorWithGeometry: (SFGeometry *) subject andGeometry: (SFGeometry *) clipping;
+
+/**
+ * Cascaded union of the polygon and multi polygon geometries. Geometries are
+ * ordered by sort tile recursive packing of their bounds and unioned bottom
+ * up in a balanced tree of neighboring pairs, running the pairs of each tree
+ * level concurrently. Polygons within a single multi polygon are expected
+ * not to overlap.
+ *
+ * @param geometries
+ *            polygon and multi polygon geometries
+ * @return union multi polygon, empty when no area remains
+ */
++(SFMultiPolygon *) unionWithGeometries: (NSArray<SFGeometry *> *) geometries;
+
+/**
+ * Resolve the rings of the polygon or multi polygon by the even-odd rule,
+ * repairing self-intersecting rings. Edges are subdivided at every
+ * intersection, including those within a single ring, equal edges cancel in
+ * pairs, and the remaining edges are connected into simple rings with holes.
+ * A point is within the result when it is within an odd number of the
+ * input rings.
+ *
+ * @param geometry
+ *            polygon or multi polygon
+ * @return even-odd multi polygon, empty when no area remains
+ */
++(SFMultiPolygon *) evenOddWithGeometry: (SFGeometry *) geometry;
+
+@end
@@ -0,0 +1,1957 @@
+//
+//  SFMartinezRueda.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFMartinezRueda.h"
+#import "SFPolygon.h"
+#import "SFLineString.h"
+#import "SFPoint.h"
+#import "SFGeometryTypes.h"
+
+/**
+ * Segment parameter tolerance for snapping intersections to endpoints
+ */
+#define SF_OVERLAY_SNAP 0.000000001
+
+/**
+ * Minimum closed contour point count of a result ring, three distinct points
+ * and the closing point
+ */
+#define SF_OVERLAY_MIN_CONTOUR 4
+
+/**
+ * Maximum number of noding sweeps when resolving even-odd rings
+ */
+#define SF_OVERLAY_NODING_PASSES 4
+
+/**
+ * Number of geometries per node when ordering a cascaded union
+ */
+#define SF_OVERLAY_UNION_NODE_CAPACITY 10
+
+/**
+ * Number of geometries read per concurrent chunk in a cascaded union
+ */
+#define SF_OVERLAY_UNION_CHUNK 64
+
+/**
+ * Edge types of left sweep events
+ */
+enum SFOverlayEdgeType{
+    SF_OE_NORMAL = 0,
+    SF_OE_NON_CONTRIBUTING,
+    SF_OE_SAME_TRANSITION,
+    SF_OE_DIFFERENT_TRANSITION
+};
+
+/**
+ * Sweep event, an endpoint of an edge. Events reference other events by index
+ * within the overlay event buffer. Left events also act as the nodes of the
+ * sweep line status treap.
+ */
+typedef struct SFOverlayEvent{
+    double x;
+    double y;
+    int other;
+    int prevInResult;
+    int contourId;
+    int resultTransition;
+    int treeLeft;
+    int treeRight;
+    int treeParent;
+    unsigned int priority;
+    unsigned char left;
+    unsigned char subject;
+    unsigned char edgeType;
+    unsigned char inOut;
+    unsigned char otherInOut;
+    unsigned char inTree;
+} SFOverlayEvent;
+
+/**
+ * Overlay sweep state
+ */
+typedef struct SFOverlay{
+    SFOverlayEvent *events;
+    int eventCount;
+    int eventCapacity;
+    int *queue;
+    int queueCount;
+    int queueCapacity;
+    int root;
+    unsigned int seed;
+    enum SFOverlayType type;
+    BOOL evenOdd;
+} SFOverlay;
+
+/**
+ * Output contour with interleaved x and y coordinates
+ */
+typedef struct SFOverlayContour{
+    double *coordinates;
+    int count;
+    int capacity;
+    int holeOf;
+    int *holes;
+    int holeCount;
+    int holeCapacity;
+} SFOverlayContour;
+
+/**
+ * Directed result edge with the result interior on its left
+ */
+typedef struct SFOverlayEdge{
+    double x1;
+    double y1;
+    double x2;
+    double y2;
+    int event;
+    int ring;
+} SFOverlayEdge;
+
+/**
+ * Vertex coordinate key of an edge or ring position
+ */
+typedef struct SFOverlayVertexKey{
+    double x;
+    double y;
+    int edge;
+} SFOverlayVertexKey;
+
+static double SFOverlaySignedArea(double x0, double y0, double x1, double y1, double x2, double y2){
+    return (x0 - x2) * (y1 - y2) - (x1 - x2) * (y0 - y2);
+}
+
+/**
+ * Create a new event, growing the event buffer as needed. Event pointers are
+ * invalidated by this call.
+ */
+static int SFOverlayNewEvent(SFOverlay *overlay, double x, double y, int left, int subject){
+    if(overlay->eventCount == overlay->eventCapacity){
+        overlay->eventCapacity = MAX(64, overlay->eventCapacity * 2);
+        overlay->events = realloc(overlay->events, sizeof(SFOverlayEvent) * overlay->eventCapacity);
+    }
+    int index = overlay->eventCount++;
+    SFOverlayEvent *event = &overlay->events[index];
+    memset(event, 0, sizeof(SFOverlayEvent));
+    event->x = x;
+    event->y = y;
+    event->other = -1;
+    event->prevInResult = -1;
+    event->treeLeft = -1;
+    event->treeRight = -1;
+    event->treeParent = -1;
+    event->left = left;
+    event->subject = subject;
+    event->edgeType = SF_OE_NORMAL;
+    return index;
+}
+
+/**
+ * Determine if the point is below the event edge
+ */
+static int SFOverlayIsBelow(const SFOverlay *overlay, int index, double x, double y){
+    const SFOverlayEvent *event = &overlay->events[index];
+    const SFOverlayEvent *other = &overlay->events[event->other];
+    return event->left
+        ? SFOverlaySignedArea(event->x, event->y, other->x, other->y, x, y) > 0.0
+        : SFOverlaySignedArea(other->x, other->y, event->x, event->y, x, y) > 0.0;
+}
+
+static int SFOverlayIsVertical(const SFOverlay *overlay, int index){
+    return overlay->events[index].x == overlay->events[overlay->events[index].other].x;
+}
+
+/**
+ * Sweep event processing order
+ *
+ * @return 1 if event 1 is processed after event 2, -1 otherwise
+ */
+static int SFOverlayCompareEvents(const SFOverlay *overlay, int index1, int index2){
+    const SFOverlayEvent *event1 = &overlay->events[index1];
+    const SFOverlayEvent *event2 = &overlay->events[index2];
+    if(event1->x > event2->x){
+        return 1;
+    }
+    if(event1->x < event2->x){
+        return -1;
+    }
+    if(event1->y != event2->y){
+        return event1->y > event2->y ? 1 : -1;
+    }
+    if(event1->left != event2->left){
+        return event1->left ? 1 : -1;
+    }
+    const SFOverlayEvent *other2 = &overlay->events[event2->other];
+    const SFOverlayEvent *other1 = &overlay->events[event1->other];
+    if(SFOverlaySignedArea(event1->x, event1->y, other1->x, other1->y, other2->x, other2->y) != 0.0){
+        return !SFOverlayIsBelow(overlay, index1, other2->x, other2->y) ? 1 : -1;
+    }
+    return (!event1->subject && event2->subject) ? 1 : -1;
+}
+
+/**
+ * Sweep line status order of left events
+ *
+ * @return negative if edge 1 is below edge 2, positive if above
+ */
+static int SFOverlayCompareSegments(const SFOverlay *overlay, int index1, int index2){
+    if(index1 == index2){
+        return 0;
+    }
+    const SFOverlayEvent *event1 = &overlay->events[index1];
+    const SFOverlayEvent *event2 = &overlay->events[index2];
+    const SFOverlayEvent *other1 = &overlay->events[event1->other];
+    const SFOverlayEvent *other2 = &overlay->events[event2->other];
+    if(SFOverlaySignedArea(event1->x, event1->y, other1->x, other1->y, event2->x, event2->y) != 0.0
+       || SFOverlaySignedArea(event1->x, event1->y, other1->x, other1->y, other2->x, other2->y) != 0.0){
+        // Not collinear
+        if(event1->x == event2->x && event1->y == event2->y){
+            return SFOverlayIsBelow(overlay, index1, other2->x, other2->y) ? -1 : 1;
+        }
+        if(event1->x == event2->x){
+            return event1->y < event2->y ? -1 : 1;
+        }
+        if(SFOverlayCompareEvents(overlay, index1, index2) == 1){
+            if(SFOverlaySignedArea(event2->x, event2->y, other2->x, other2->y, event1->x, event1->y) == 0.0){
+                // Edge 1 starts on edge 2, order by the edge 1 right endpoint
+                return SFOverlayIsBelow(overlay, index2, other1->x, other1->y) ? 1 : -1;
+            }
+            return !SFOverlayIsBelow(overlay, index2, event1->x, event1->y) ? -1 : 1;
+        }
+        if(SFOverlaySignedArea(event1->x, event1->y, other1->x, other1->y, event2->x, event2->y) == 0.0){
+            // Edge 2 starts on edge 1, order by the edge 2 right endpoint
+            return SFOverlayIsBelow(overlay, index1, other2->x, other2->y) ? -1 : 1;
+        }
+        return SFOverlayIsBelow(overlay, index1, event2->x, event2->y) ? -1 : 1;
+    }
+    if(event1->subject == event2->subject){
+        if(event1->x == event2->x && event1->y == event2->y){
+            if(other1->x == other2->x && other1->y == other2->y){
+                return index1 < index2 ? -1 : 1;
+            }
+            return event1->contourId > event2->contourId ? 1 : -1;
+        }
+    }else{
+        return event1->subject ? -1 : 1;
+    }
+    return SFOverlayCompareEvents(overlay, index1, index2) == 1 ? 1 : -1;
+}
+
+static void SFOverlayQueuePush(SFOverlay *overlay, int index){
+    if(overlay->queueCount == overlay->queueCapacity){
+        overlay->queueCapacity = MAX(64, overlay->queueCapacity * 2);
+        overlay->queue = realloc(overlay->queue, sizeof(int) * overlay->queueCapacity);
+    }
+    int *queue = overlay->queue;
+    int position = overlay->queueCount++;
+    while(position > 0){
+        int parent = (position - 1) >> 1;
+        if(SFOverlayCompareEvents(overlay, index, queue[parent]) >= 0){
+            break;
+        }
+        queue[position] = queue[parent];
+        position = parent;
+    }
+    queue[position] = index;
+}
+
+static int SFOverlayQueuePop(SFOverlay *overlay){
+    int *queue = overlay->queue;
+    int top = queue[0];
+    int last = queue[--overlay->queueCount];
+    int count = overlay->queueCount;
+    int position = 0;
+    int half = count >> 1;
+    while(position < half){
+        int child = (position << 1) + 1;
+        int right = child + 1;
+        if(right < count && SFOverlayCompareEvents(overlay, queue[right], queue[child]) < 0){
+            child = right;
+        }
+        if(SFOverlayCompareEvents(overlay, queue[child], last) >= 0){
+            break;
+        }
+        queue[position] = queue[child];
+        position = child;
+    }
+    if(count > 0){
+        queue[position] = last;
+    }
+    return top;
+}
+
+/**
+ * Rotate the treap node above its parent
+ */
+static void SFOverlayRotateUp(SFOverlay *overlay, int node){
+    SFOverlayEvent *events = overlay->events;
+    int parent = events[node].treeParent;
+    int grandparent = events[parent].treeParent;
+    if(events[parent].treeLeft == node){
+        events[parent].treeLeft = events[node].treeRight;
+        if(events[node].treeRight >= 0){
+            events[events[node].treeRight].treeParent = parent;
+        }
+        events[node].treeRight = parent;
+    }else{
+        events[parent].treeRight = events[node].treeLeft;
+        if(events[node].treeLeft >= 0){
+            events[events[node].treeLeft].treeParent = parent;
+        }
+        events[node].treeLeft = parent;
+    }
+    events[parent].treeParent = node;
+    events[node].treeParent = grandparent;
+    if(grandparent < 0){
+        overlay->root = node;
+    }else if(events[grandparent].treeLeft == parent){
+        events[grandparent].treeLeft = node;
+    }else{
+        events[grandparent].treeRight = node;
+    }
+}
+
+static void SFOverlayTreeInsert(SFOverlay *overlay, int node){
+    overlay->seed ^= overlay->seed << 13;
+    overlay->seed ^= overlay->seed >> 17;
+    overlay->seed ^= overlay->seed << 5;
+    SFOverlayEvent *events = overlay->events;
+    events[node].treeLeft = -1;
+    events[node].treeRight = -1;
+    events[node].treeParent = -1;
+    events[node].priority = overlay->seed;
+    events[node].inTree = 1;
+    if(overlay->root < 0){
+        overlay->root = node;
+        return;
+    }
+    int current = overlay->root;
+    while(YES){
+        if(SFOverlayCompareSegments(overlay, node, current) < 0){
+            if(events[current].treeLeft < 0){
+                events[current].treeLeft = node;
+                break;
+            }
+            current = events[current].treeLeft;
+        }else{
+            if(events[current].treeRight < 0){
+                events[current].treeRight = node;
+                break;
+            }
+            current = events[current].treeRight;
+        }
+    }
+    events[node].treeParent = current;
+    while(events[node].treeParent >= 0 && events[node].priority < events[events[node].treeParent].priority){
+        SFOverlayRotateUp(overlay, node);
+    }
+}
+
+static void SFOverlayTreeRemove(SFOverlay *overlay, int node){
+    SFOverlayEvent *events = overlay->events;
+    while(events[node].treeLeft >= 0 && events[node].treeRight >= 0){
+        int left = events[node].treeLeft;
+        int right = events[node].treeRight;
+        SFOverlayRotateUp(overlay, events[left].priority < events[right].priority ? left : right);
+    }
+    int child = events[node].treeLeft >= 0 ? events[node].treeLeft : events[node].treeRight;
+    int parent = events[node].treeParent;
+    if(child >= 0){
+        events[child].treeParent = parent;
+    }
+    if(parent < 0){
+        overlay->root = child;
+    }else if(events[parent].treeLeft == node){
+        events[parent].treeLeft = child;
+    }else{
+        events[parent].treeRight = child;
+    }
+    events[node].inTree = 0;
+}
+
+static int SFOverlayTreePrevious(const SFOverlay *overlay, int node){
+    const SFOverlayEvent *events = overlay->events;
+    if(events[node].treeLeft >= 0){
+        node = events[node].treeLeft;
+        while(events[node].treeRight >= 0){
+            node = events[node].treeRight;
+        }
+        return node;
+    }
+    int parent = events[node].treeParent;
+    while(parent >= 0 && events[parent].treeLeft == node){
+        node = parent;
+        parent = events[node].treeParent;
+    }
+    return parent;
+}
+
+static int SFOverlayTreeNext(const SFOverlay *overlay, int node){
+    const SFOverlayEvent *events = overlay->events;
+    if(events[node].treeRight >= 0){
+        node = events[node].treeRight;
+        while(events[node].treeLeft >= 0){
+            node = events[node].treeLeft;
+        }
+        return node;
+    }
+    int parent = events[node].treeParent;
+    while(parent >= 0 && events[parent].treeRight == node){
+        node = parent;
+        parent = events[node].treeParent;
+    }
+    return parent;
+}
+
+/**
+ * Add the edge as sweep events
+ */
+static void SFOverlayAddEdge(SFOverlay *overlay, double x1, double y1, double x2, double y2, int subject, int contourId){
+    int event1 = SFOverlayNewEvent(overlay, x1, y1, 0, subject);
+    int event2 = SFOverlayNewEvent(overlay, x2, y2, 0, subject);
+    overlay->events[event1].other = event2;
+    overlay->events[event2].other = event1;
+    overlay->events[event1].contourId = contourId;
+    overlay->events[event2].contourId = contourId;
+    if(SFOverlayCompareEvents(overlay, event1, event2) > 0){
+        overlay->events[event2].left = 1;
+    }else{
+        overlay->events[event1].left = 1;
+    }
+    SFOverlayQueuePush(overlay, event1);
+    SFOverlayQueuePush(overlay, event2);
+}
+
+/**
+ * Add the contour edges as sweep events
+ *
+ * @param coordinates
+ *            interleaved x and y ring coordinates
+ * @param count
+ *            number of coordinates
+ */
+static void SFOverlayAddContour(SFOverlay *overlay, const double *coordinates, int count, int subject, int contourId){
+    for(int i = 0; i < count; i++){
+        int j = (i + 1) % count;
+        double x1 = coordinates[i * 2];
+        double y1 = coordinates[i * 2 + 1];
+        double x2 = coordinates[j * 2];
+        double y2 = coordinates[j * 2 + 1];
+        if(x1 == x2 && y1 == y2){
+            continue;
+        }
+        SFOverlayAddEdge(overlay, x1, y1, x2, y2, subject, contourId);
+    }
+}
+
+static int SFOverlayInResult(const SFOverlay *overlay, int index){
+    const SFOverlayEvent *event = &overlay->events[index];
+    switch(event->edgeType){
+        case SF_OE_NORMAL:
+            switch(overlay->type){
+                case SF_OT_INTERSECTION:
+                    return !event->otherInOut;
+                case SF_OT_UNION:
+                    return event->otherInOut;
+                case SF_OT_DIFFERENCE:
+                    return (event->subject && event->otherInOut) || (!event->subject && !event->otherInOut);
+                case SF_OT_XOR:
+                    return 1;
+            }
+            break;
+        case SF_OE_SAME_TRANSITION:
+            return overlay->type == SF_OT_INTERSECTION || overlay->type == SF_OT_UNION;
+        case SF_OE_DIFFERENT_TRANSITION:
+            return overlay->type == SF_OT_DIFFERENCE;
+    }
+    return 0;
+}
+
+static int SFOverlayResultTransition(const SFOverlay *overlay, int index){
+    const SFOverlayEvent *event = &overlay->events[index];
+    int thisIn = !event->inOut;
+    int thatIn = !event->otherInOut;
+    int isIn = 0;
+    if(event->edgeType == SF_OE_SAME_TRANSITION){
+        // Coincident edges with the same transition, both polygons are inside on the same side
+        return thisIn ? 1 : -1;
+    }
+    if(event->edgeType == SF_OE_DIFFERENT_TRANSITION){
+        // Coincident edges with opposite transitions, the subject inside side remains
+        return (event->subject ? thisIn : !thisIn) ? 1 : -1;
+    }
+    switch(overlay->type){
+        case SF_OT_INTERSECTION:
+            isIn = thisIn && thatIn;
+            break;
+        case SF_OT_UNION:
+            isIn = thisIn || thatIn;
+            break;
+        case SF_OT_XOR:
+            isIn = thisIn ^ thatIn;
+            break;
+        case SF_OT_DIFFERENCE:
+            isIn = event->subject ? thisIn && !thatIn : thatIn && !thisIn;
+            break;
+    }
+    return isIn ? 1 : -1;
+}
+
+/**
+ * Compute the in-out transition fields of the event from the edge below it
+ */
+static void SFOverlayComputeFields(SFOverlay *overlay, int index, int previous){
+    SFOverlayEvent *events = overlay->events;
+    SFOverlayEvent *event = &events[index];
+    if(previous < 0){
+        event->inOut = 0;
+        event->otherInOut = 1;
+    }else{
+        SFOverlayEvent *below = &events[previous];
+        if(event->subject == below->subject){
+            event->inOut = !below->inOut;
+            event->otherInOut = below->otherInOut;
+        }else{
+            event->inOut = !below->otherInOut;
+            event->otherInOut = SFOverlayIsVertical(overlay, previous) ? !below->inOut : below->inOut;
+        }
+        event->prevInResult = (!SFOverlayInResult(overlay, previous) || SFOverlayIsVertical(overlay, previous)) ? below->prevInResult : previous;
+    }
+    event->resultTransition = SFOverlayInResult(overlay, index) ? SFOverlayResultTransition(overlay, index) : 0;
+}
+
+/**
+ * Divide the edge at the point, queueing the new events
+ */
+static void SFOverlayDivideSegment(SFOverlay *overlay, int index, double x, double y){
+    SFOverlayEvent *start = &overlay->events[index];
+    SFOverlayEvent *end = &overlay->events[start->other];
+    if(overlay->evenOdd){
+        // Keep divided vertical and horizontal edges axis aligned while noding
+        if(start->x == end->x){
+            x = start->x;
+        }
+        if(start->y == end->y){
+            y = start->y;
+        }
+    }
+    if((x - start->x) * (end->x - start->x) + (y - start->y) * (end->y - start->y) <= 0.0
+       || (x - end->x) * (start->x - end->x) + (y - end->y) * (start->y - end->y) <= 0.0){
+        // Rounded intersection outside of or at an endpoint of the edge
+        return;
+    }
+    int subject = overlay->events[index].subject;
+    int right = SFOverlayNewEvent(overlay, x, y, 0, subject);
+    int left = SFOverlayNewEvent(overlay, x, y, 1, subject);
+    SFOverlayEvent *events = overlay->events;
+    int other = events[index].other;
+    events[right].other = index;
+    events[left].other = other;
+    events[right].contourId = events[index].contourId;
+    events[left].contourId = events[index].contourId;
+    // Avoid a rounding error placing the left event after the right event
+    if(SFOverlayCompareEvents(overlay, left, other) > 0){
+        events[other].left = 1;
+        events[left].left = 0;
+    }
+    events[other].other = left;
+    events[index].other = right;
+    SFOverlayQueuePush(overlay, left);
+    SFOverlayQueuePush(overlay, right);
+}
+
+/**
+ * Snap a segment parameter within rounding error of an endpoint
+ */
+static double SFOverlaySnapParameter(double parameter){
+    if(parameter < SF_OVERLAY_SNAP){
+        return 0.0;
+    }
+    if(parameter > 1.0 - SF_OVERLAY_SNAP){
+        return 1.0;
+    }
+    return parameter;
+}
+
+/**
+ * Intersect the segments
+ *
+ * @param points
+ *            intersection points output, up to two interleaved x and y values
+ * @return number of intersection points
+ */
+static int SFOverlaySegmentIntersection(double a1x, double a1y, double a2x, double a2y, double b1x, double b1y, double b2x, double b2y, double *points){
+    double vax = a2x - a1x;
+    double vay = a2y - a1y;
+    double vbx = b2x - b1x;
+    double vby = b2y - b1y;
+    double ex = b1x - a1x;
+    double ey = b1y - a1y;
+    double kross = vax * vby - vay * vbx;
+    double sqrLenA = vax * vax + vay * vay;
+    double sqrLenB = vbx * vbx + vby * vby;
+    double sqrTolerance = SF_OVERLAY_SNAP * SF_OVERLAY_SNAP * sqrLenA;
+    if(kross * kross > sqrTolerance * sqrLenB){
+        double s = (ex * vby - ey * vbx) / kross;
+        if(s < -SF_OVERLAY_SNAP || s > 1.0 + SF_OVERLAY_SNAP){
+            return 0;
+        }
+        double t = (ex * vay - ey * vax) / kross;
+        if(t < -SF_OVERLAY_SNAP || t > 1.0 + SF_OVERLAY_SNAP){
+            return 0;
+        }
+        // Snap intersections within rounding error of an endpoint to the endpoint
+        s = SFOverlaySnapParameter(s);
+        t = SFOverlaySnapParameter(t);
+        if(s == 0.0){
+            points[0] = a1x;
+            points[1] = a1y;
+        }else if(s == 1.0){
+            points[0] = a2x;
+            points[1] = a2y;
+        }else if(t == 0.0){
+            points[0] = b1x;
+            points[1] = b1y;
+        }else if(t == 1.0){
+            points[0] = b2x;
+            points[1] = b2y;
+        }else{
+            points[0] = a1x + s * vax;
+            points[1] = a1y + s * vay;
+            // Use the point computed along the second edge when it lies nearer to both edge lines
+            double x = b1x + t * vbx;
+            double y = b1y + t * vby;
+            if(fabs(SFOverlaySignedArea(a1x, a1y, a2x, a2y, x, y)) + fabs(SFOverlaySignedArea(b1x, b1y, b2x, b2y, x, y))
+               < fabs(SFOverlaySignedArea(a1x, a1y, a2x, a2y, points[0], points[1])) + fabs(SFOverlaySignedArea(b1x, b1y, b2x, b2y, points[0], points[1]))){
+                points[0] = x;
+                points[1] = y;
+            }
+            // Keep intersections exactly on vertical and horizontal edges
+            if(a1x == a2x){
+                points[0] = a1x;
+            }else if(b1x == b2x){
+                points[0] = b1x;
+            }
+            if(a1y == a2y){
+                points[1] = a1y;
+            }else if(b1y == b2y){
+                points[1] = b1y;
+            }
+        }
+        return 1;
+    }
+    kross = ex * vay - ey * vax;
+    if(kross * kross > sqrTolerance * (ex * ex + ey * ey)){
+        // Parallel
+        return 0;
+    }
+    double sa = (vax * ex + vay * ey) / sqrLenA;
+    double sb = sa + (vax * vbx + vay * vby) / sqrLenA;
+    double smin = MIN(sa, sb);
+    double smax = MAX(sa, sb);
+    if(smin <= 1.0 && smax >= 0.0){
+        if(smin == 1.0){
+            points[0] = a2x;
+            points[1] = a2y;
+            return 1;
+        }
+        if(smax == 0.0){
+            points[0] = a1x;
+            points[1] = a1y;
+            return 1;
+        }
+        smin = MAX(smin, 0.0);
+        smax = MIN(smax, 1.0);
+        points[0] = a1x + smin * vax;
+        points[1] = a1y + smin * vay;
+        points[2] = a1x + smax * vax;
+        points[3] = a1y + smax * vay;
+        return 2;
+    }
+    return 0;
+}
+
+/**
+ * Process a possible intersection between two edges, subdividing them
+ *
+ * @return 0 for no intersection, 1 for a point intersection, 2 for
+ *         overlapping edges sharing a left endpoint, 3 for other overlaps
+ */
+static int SFOverlayPossibleIntersection(SFOverlay *overlay, int index1, int index2){
+    SFOverlayEvent *events = overlay->events;
+    int other1 = events[index1].other;
+    int other2 = events[index2].other;
+    double points[4];
+    int intersections = SFOverlaySegmentIntersection(events[index1].x, events[index1].y, events[other1].x, events[other1].y,
+                                                     events[index2].x, events[index2].y, events[other2].x, events[other2].y, points);
+    if(intersections == 0){
+        return 0;
+    }
+    if(intersections == 1
+       && ((events[index1].x == events[index2].x && events[index1].y == events[index2].y)
+           || (events[other1].x == events[other2].x && events[other1].y == events[other2].y))){
+        // Edges share an endpoint
+        return 0;
+    }
+    if(intersections == 2 && events[index1].subject == events[index2].subject && !overlay->evenOdd){
+        // Overlapping edges of the same polygon, subdivided only when resolving even-odd rings
+        return 0;
+    }
+    if(intersections == 1){
+        double x = points[0];
+        double y = points[1];
+        if((events[index1].x != x || events[index1].y != y) && (events[other1].x != x || events[other1].y != y)){
+            SFOverlayDivideSegment(overlay, index1, x, y);
+        }
+        events = overlay->events;
+        if((events[index2].x != x || events[index2].y != y) && (events[other2].x != x || events[other2].y != y)){
+            SFOverlayDivideSegment(overlay, index2, x, y);
+        }
+        return 1;
+    }
+    
+    // Collinear overlapping edges
+    int sorted[4];
+    int sortedCount = 0;
+    int leftCoincide = 0;
+    int rightCoincide = 0;
+    if(events[index1].x == events[index2].x && events[index1].y == events[index2].y){
+        leftCoincide = 1;
+    }else if(SFOverlayCompareEvents(overlay, index1, index2) == 1){
+        sorted[sortedCount++] = index2;
+        sorted[sortedCount++] = index1;
+    }else{
+        sorted[sortedCount++] = index1;
+        sorted[sortedCount++] = index2;
+    }
+    if(events[other1].x == events[other2].x && events[other1].y == events[other2].y){
+        rightCoincide = 1;
+    }else if(SFOverlayCompareEvents(overlay, other1, other2) == 1){
+        sorted[sortedCount++] = other2;
+        sorted[sortedCount++] = other1;
+    }else{
+        sorted[sortedCount++] = other1;
+        sorted[sortedCount++] = other2;
+    }
+    
+    if(leftCoincide){
+        // Both edges are equal or share the left endpoint
+        events[index2].edgeType = SF_OE_NON_CONTRIBUTING;
+        events[index1].edgeType = events[index2].inOut == events[index1].inOut ? SF_OE_SAME_TRANSITION : SF_OE_DIFFERENT_TRANSITION;
+        if(!rightCoincide){
+            SFOverlayDivideSegment(overlay, events[sorted[1]].other, events[sorted[0]].x, events[sorted[0]].y);
+        }
+        return 2;
+    }
+    
+    if(rightCoincide){
+        // Edges share the right endpoint
+        SFOverlayDivideSegment(overlay, sorted[0], events[sorted[1]].x, events[sorted[1]].y);
+        return 3;
+    }
+    
+    if(sorted[0] != events[sorted[3]].other){
+        // No edge includes the other one
+        double x1 = events[sorted[1]].x;
+        double y1 = events[sorted[1]].y;
+        double x2 = events[sorted[2]].x;
+        double y2 = events[sorted[2]].y;
+        SFOverlayDivideSegment(overlay, sorted[0], x1, y1);
+        SFOverlayDivideSegment(overlay, sorted[1], x2, y2);
+        return 3;
+    }
+    
+    // One edge includes the other one
+    double x1 = events[sorted[1]].x;
+    double y1 = events[sorted[1]].y;
+    double x2 = events[sorted[2]].x;
+    double y2 = events[sorted[2]].y;
+    SFOverlayDivideSegment(overlay, sorted[0], x1, y1);
+    // The containing edge remainder now begins at the first division
+    SFOverlayDivideSegment(overlay, overlay->events[sorted[3]].other, x2, y2);
+    return 3;
+}
+
+/**
+ * Determine if the neighbor edge now ends at the left point of the event
+ */
+static BOOL SFOverlayEndsAtEvent(SFOverlay *overlay, int neighbor, int index){
+    SFOverlayEvent *event = &overlay->events[index];
+    SFOverlayEvent *other = &overlay->events[overlay->events[neighbor].other];
+    return other->x == event->x && other->y == event->y;
+}
+
+/**
+ * Determine if the continuation of the neighbor edge divided at the event
+ * left point passes below the event edge
+ */
+static BOOL SFOverlayContinuesBelow(SFOverlay *overlay, int neighbor, int index){
+    SFOverlayEvent *start = &overlay->events[neighbor];
+    SFOverlayEvent *event = &overlay->events[index];
+    SFOverlayEvent *other = &overlay->events[event->other];
+    return SFOverlaySignedArea(start->x, start->y, event->x, event->y, other->x, other->y) > 0.0;
+}
+
+/**
+ * Sweep the queued events, subdividing edges at intersections and computing
+ * the result fields
+ *
+ * @param sortedCount
+ *            number of processed events output
+ * @return processed events in sweep order, caller is responsible for freeing
+ */
+static int *SFOverlaySubdivide(SFOverlay *overlay, double subjectMaxX, double clippingMaxX, int *sortedCount){
+    int capacity = MAX(64, overlay->eventCount);
+    int *sorted = malloc(sizeof(int) * capacity);
+    int count = 0;
+    double rightBound = MIN(subjectMaxX, clippingMaxX);
+    
+    while(overlay->queueCount > 0){
+        int index = SFOverlayQueuePop(overlay);
+        double x = overlay->events[index].x;
+        if((overlay->type == SF_OT_INTERSECTION && x > rightBound) || (overlay->type == SF_OT_DIFFERENCE && x > subjectMaxX)){
+            break;
+        }
+        if(count == capacity){
+            capacity *= 2;
+            sorted = realloc(sorted, sizeof(int) * capacity);
+        }
+        sorted[count++] = index;
+        
+        if(overlay->events[index].left){
+            SFOverlayTreeInsert(overlay, index);
+            int previous = SFOverlayTreePrevious(overlay, index);
+            int next = SFOverlayTreeNext(overlay, index);
+            SFOverlayComputeFields(overlay, index, previous);
+            if(next >= 0 && SFOverlayPossibleIntersection(overlay, index, next) == 2){
+                SFOverlayComputeFields(overlay, index, previous);
+                SFOverlayComputeFields(overlay, next, index);
+            }
+            if(previous >= 0 && SFOverlayPossibleIntersection(overlay, previous, index) == 2){
+                SFOverlayComputeFields(overlay, previous, SFOverlayTreePrevious(overlay, previous));
+                SFOverlayComputeFields(overlay, index, previous);
+            }
+            if(previous >= 0 && SFOverlayEndsAtEvent(overlay, previous, index)
+               && !SFOverlayContinuesBelow(overlay, previous, index)){
+                // Previous edge was divided at the left point and continues above the edge
+                SFOverlayComputeFields(overlay, index, SFOverlayTreePrevious(overlay, previous));
+            }
+            if(next >= 0 && SFOverlayEndsAtEvent(overlay, next, index)
+               && SFOverlayContinuesBelow(overlay, next, index)){
+                // Next edge was divided at the left point and continues below the edge
+                SFOverlayComputeFields(overlay, index, next);
+            }
+        }else{
+            int left = overlay->events[index].other;
+            if(overlay->events[left].inTree){
+                int previous = SFOverlayTreePrevious(overlay, left);
+                int next = SFOverlayTreeNext(overlay, left);
+                SFOverlayTreeRemove(overlay, left);
+                if(previous >= 0 && next >= 0){
+                    SFOverlayPossibleIntersection(overlay, previous, next);
+                }
+            }
+        }
+    }
+    
+    *sortedCount = count;
+    return sorted;
+}
+
+static void SFOverlayContourAdd(SFOverlayContour *contour, double x, double y){
+    if(contour->count == contour->capacity){
+        contour->capacity = MAX(8, contour->capacity * 2);
+        contour->coordinates = realloc(contour->coordinates, sizeof(double) * 2 * contour->capacity);
+    }
+    contour->coordinates[contour->count * 2] = x;
+    contour->coordinates[contour->count * 2 + 1] = y;
+    contour->count++;
+}
+
+static void SFOverlayContourAddHole(SFOverlayContour *contour, int hole){
+    if(contour->holeCount == contour->holeCapacity){
+        contour->holeCapacity = MAX(4, contour->holeCapacity * 2);
+        contour->holes = realloc(contour->holes, sizeof(int) * contour->holeCapacity);
+    }
+    contour->holes[contour->holeCount++] = hole;
+}
+
+static int SFOverlayCompareVertexKeys(const void *key1, const void *key2){
+    const SFOverlayVertexKey *vertex1 = key1;
+    const SFOverlayVertexKey *vertex2 = key2;
+    if(vertex1->x != vertex2->x){
+        return vertex1->x < vertex2->x ? -1 : 1;
+    }
+    if(vertex1->y != vertex2->y){
+        return vertex1->y < vertex2->y ? -1 : 1;
+    }
+    return vertex1->edge - vertex2->edge;
+}
+
+/**
+ * Next edge of the result face at the end of the edge, the first outgoing
+ * edge clockwise from the edge's reverse direction
+ */
+static int SFOverlayNextEdge(const SFOverlayEdge *edges, const SFOverlayVertexKey *keys, int count, int edge){
+    double x = edges[edge].x2;
+    double y = edges[edge].y2;
+    int low = 0;
+    int high = count;
+    while(low < high){
+        int middle = (low + high) >> 1;
+        if(keys[middle].x < x || (keys[middle].x == x && keys[middle].y < y)){
+            low = middle + 1;
+        }else{
+            high = middle;
+        }
+    }
+    double back = atan2(edges[edge].y1 - y, edges[edge].x1 - x);
+    int next = -1;
+    double minAngle = DBL_MAX;
+    for(int i = low; i < count && keys[i].x == x && keys[i].y == y; i++){
+        const SFOverlayEdge *candidate = &edges[keys[i].edge];
+        double angle = back - atan2(candidate->y2 - y, candidate->x2 - x);
+        if(angle <= 0.0){
+            angle += 2.0 * M_PI;
+        }
+        if(angle < minAngle){
+            minAngle = angle;
+            next = keys[i].edge;
+        }
+    }
+    return next;
+}
+
+/**
+ * Split the traced edge cycle into simple rings at repeated vertices
+ *
+ * @param cycle
+ *            traced edge cycle
+ * @param count
+ *            number of cycle edges
+ * @param rings
+ *            ring edges output, appended
+ * @param ringEdgeCount
+ *            ring edges output count
+ * @param ringStarts
+ *            ring start offsets output, appended
+ * @param ringCount
+ *            ring count
+ */
+static void SFOverlaySplitCycle(const SFOverlayEdge *edges, const int *cycle, int count, int *rings, int *ringEdgeCount, int *ringStarts, int *ringCount){
+    
+    int size = 4;
+    while(size < count * 2){
+        size <<= 1;
+    }
+    SFOverlayVertexKey *table = malloc(sizeof(SFOverlayVertexKey) * size);
+    for(int i = 0; i < size; i++){
+        table[i].edge = -1;
+    }
+    int *stack = malloc(sizeof(int) * count);
+    int top = 0;
+    
+    for(int k = 0; k < count; k++){
+        int edge = cycle[k];
+        double x = edges[edge].x1;
+        double y = edges[edge].y1;
+        unsigned long long bitsX;
+        unsigned long long bitsY;
+        memcpy(&bitsX, &x, sizeof(double));
+        memcpy(&bitsY, &y, sizeof(double));
+        unsigned long long hash = (bitsX * 0x9E3779B97F4A7C15ULL) ^ (bitsY * 0xC2B2AE3D27D4EB4FULL);
+        int slot = (int)((hash ^ (hash >> 29)) & (size - 1));
+        while(table[slot].edge >= 0 && (table[slot].x != x || table[slot].y != y)){
+            slot = (slot + 1) & (size - 1);
+        }
+        int previous = table[slot].edge;
+        if(previous >= 0 && previous < top && edges[stack[previous]].x1 == x && edges[stack[previous]].y1 == y){
+            // Repeated vertex, the edges since the previous visit form a ring
+            ringStarts[(*ringCount)++] = *ringEdgeCount;
+            for(int i = previous; i < top; i++){
+                rings[(*ringEdgeCount)++] = stack[i];
+            }
+            top = previous;
+        }
+        table[slot].x = x;
+        table[slot].y = y;
+        table[slot].edge = top;
+        stack[top++] = edge;
+    }
+    
+    if(top > 0){
+        ringStarts[(*ringCount)++] = *ringEdgeCount;
+        for(int i = 0; i < top; i++){
+            rings[(*ringEdgeCount)++] = stack[i];
+        }
+    }
+    
+    free(stack);
+    free(table);
+}
+
+/**
+ * Determine if the point is within the ring edges
+ */
+static int SFOverlayRingContains(const SFOverlayEdge *edges, const int *ring, int count, double x, double y){
+    int inside = 0;
+    for(int i = 0; i < count; i++){
+        const SFOverlayEdge *edge = &edges[ring[i]];
+        if((edge->y1 > y) != (edge->y2 > y)
+           && x < (edge->x2 - edge->x1) * (y - edge->y1) / (edge->y2 - edge->y1) + edge->x1){
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+/**
+ * Connect the result edges into simple rings and assign holes to their
+ * exterior rings
+ *
+ * @param sorted
+ *            processed events in sweep order
+ * @param sortedCount
+ *            number of processed events
+ * @param contourCount
+ *            number of contours output
+ * @return contours, caller is responsible for freeing
+ */
+static SFOverlayContour *SFOverlayConnectEdges(SFOverlay *overlay, const int *sorted, int sortedCount, int *contourCount){
+    
+    SFOverlayEvent *events = overlay->events;
+    int eventCount = overlay->eventCount;
+    
+    // Orient the result edges with the result interior on the left
+    int *position = malloc(sizeof(int) * MAX(eventCount, 1));
+    int *eventEdge = malloc(sizeof(int) * MAX(eventCount, 1));
+    for(int i = 0; i < eventCount; i++){
+        position[i] = -1;
+        eventEdge[i] = -1;
+    }
+    SFOverlayEdge *edges = malloc(sizeof(SFOverlayEdge) * MAX(sortedCount, 1));
+    int edgeCount = 0;
+    for(int i = 0; i < sortedCount; i++){
+        int index = sorted[i];
+        position[index] = i;
+        SFOverlayEvent *event = &events[index];
+        SFOverlayEvent *other = &events[event->other];
+        if(event->left && event->resultTransition != 0 && (event->x != other->x || event->y != other->y)){
+            SFOverlayEdge *edge = &edges[edgeCount];
+            if(event->resultTransition > 0){
+                edge->x1 = event->x;
+                edge->y1 = event->y;
+                edge->x2 = other->x;
+                edge->y2 = other->y;
+            }else{
+                edge->x1 = other->x;
+                edge->y1 = other->y;
+                edge->x2 = event->x;
+                edge->y2 = event->y;
+            }
+            edge->event = index;
+            edge->ring = -1;
+            eventEdge[index] = edgeCount++;
+        }
+    }
+    
+    SFOverlayVertexKey *keys = malloc(sizeof(SFOverlayVertexKey) * MAX(edgeCount, 1));
+    for(int i = 0; i < edgeCount; i++){
+        keys[i].x = edges[i].x1;
+        keys[i].y = edges[i].y1;
+        keys[i].edge = i;
+    }
+    qsort(keys, edgeCount, sizeof(SFOverlayVertexKey), SFOverlayCompareVertexKeys);
+    
+    // Trace the result faces and split them into simple rings
+    unsigned char *used = calloc(MAX(edgeCount, 1), sizeof(unsigned char));
+    int *cycle = malloc(sizeof(int) * MAX(edgeCount, 1));
+    int *rings = malloc(sizeof(int) * MAX(edgeCount, 1));
+    int *ringStarts = malloc(sizeof(int) * (edgeCount + 1));
+    int ringEdgeCount = 0;
+    int ringCount = 0;
+    for(int i = 0; i < edgeCount; i++){
+        int cycleCount = 0;
+        int edge = i;
+        while(edge >= 0 && !used[edge]){
+            used[edge] = 1;
+            cycle[cycleCount++] = edge;
+            edge = SFOverlayNextEdge(edges, keys, edgeCount, edge);
+        }
+        if(cycleCount > 0){
+            SFOverlaySplitCycle(edges, cycle, cycleCount, rings, &ringEdgeCount, ringStarts, &ringCount);
+        }
+    }
+    ringStarts[ringCount] = ringEdgeCount;
+    
+    double *areas = malloc(sizeof(double) * MAX(ringCount, 1));
+    for(int r = 0; r < ringCount; r++){
+        double area = 0.0;
+        for(int i = ringStarts[r]; i < ringStarts[r + 1]; i++){
+            SFOverlayEdge *edge = &edges[rings[i]];
+            edge->ring = r;
+            area += (edge->x1 - edge->x2) * (edge->y1 + edge->y2);
+        }
+        areas[r] = area / 2.0;
+    }
+    
+    // Assign each clockwise hole to the exterior ring of the result face below it
+    int *parents = malloc(sizeof(int) * MAX(ringCount, 1));
+    for(int r = 0; r < ringCount; r++){
+        parents[r] = -1;
+    }
+    for(int r = 0; r < ringCount; r++){
+        if(areas[r] >= 0.0){
+            continue;
+        }
+        int ring = r;
+        int steps = 0;
+        while(ring >= 0 && areas[ring] < 0.0 && steps++ < ringCount){
+            int lowest = -1;
+            for(int i = ringStarts[ring]; i < ringStarts[ring + 1]; i++){
+                int event = edges[rings[i]].event;
+                if(lowest < 0 || position[event] < position[lowest]){
+                    lowest = event;
+                }
+            }
+            int below = events[lowest].prevInResult;
+            if(below < 0 || eventEdge[below] < 0 || edges[eventEdge[below]].ring == ring){
+                ring = -1;
+            }else{
+                ring = edges[eventEdge[below]].ring;
+            }
+        }
+        if(ring < 0 || areas[ring] < 0.0){
+            // Fall back to the smallest containing exterior ring
+            ring = -1;
+            const SFOverlayEdge *edge = &edges[rings[ringStarts[r]]];
+            double x = (edge->x1 + edge->x2) / 2.0;
+            double y = (edge->y1 + edge->y2) / 2.0;
+            for(int exterior = 0; exterior < ringCount; exterior++){
+                if(areas[exterior] > 0.0 && (ring < 0 || areas[exterior] < areas[ring])
+                   && SFOverlayRingContains(edges, &rings[ringStarts[exterior]], ringStarts[exterior + 1] - ringStarts[exterior], x, y)){
+                    ring = exterior;
+                }
+            }
+        }
+        parents[r] = ring;
+    }
+    
+    SFOverlayContour *contours = calloc(MAX(ringCount, 1), sizeof(SFOverlayContour));
+    for(int r = 0; r < ringCount; r++){
+        SFOverlayContour *contour = &contours[r];
+        for(int i = ringStarts[r]; i < ringStarts[r + 1]; i++){
+            SFOverlayContourAdd(contour, edges[rings[i]].x1, edges[rings[i]].y1);
+        }
+        SFOverlayContourAdd(contour, edges[rings[ringStarts[r]]].x1, edges[rings[ringStarts[r]]].y1);
+        contour->holeOf = parents[r];
+        if(parents[r] >= 0){
+            SFOverlayContourAddHole(&contours[parents[r]], r);
+        }
+    }
+    
+    free(parents);
+    free(areas);
+    free(ringStarts);
+    free(rings);
+    free(cycle);
+    free(used);
+    free(keys);
+    free(edges);
+    free(eventEdge);
+    free(position);
+    
+    *contourCount = ringCount;
+    return contours;
+}
+
+/**
+ * Signed area of the contour, positive when counter clockwise
+ */
+static double SFOverlayContourArea(const SFOverlayContour *contour){
+    double area = 0.0;
+    const double *coordinates = contour->coordinates;
+    for(int i = 0, j = contour->count - 1; i < contour->count; j = i++){
+        area += (coordinates[j * 2] - coordinates[i * 2]) * (coordinates[j * 2 + 1] + coordinates[i * 2 + 1]);
+    }
+    return area / 2.0;
+}
+
+/**
+ * Flat polygon set of rings with interleaved x and y coordinates. Ring
+ * points are not closed, the first point is not repeated.
+ */
+typedef struct SFOverlayPolygons{
+    double *coordinates;
+    int pointCount;
+    int pointCapacity;
+    int *rings;
+    int ringCount;
+    int ringCapacity;
+    int *polygons;
+    int polygonCount;
+    int polygonCapacity;
+    double bounds[4];
+} SFOverlayPolygons;
+
+/**
+ * Initialize an empty polygon set
+ */
+static void SFOverlayPolygonsInit(SFOverlayPolygons *polygons){
+    memset(polygons, 0, sizeof(SFOverlayPolygons));
+    polygons->bounds[0] = DBL_MAX;
+    polygons->bounds[1] = DBL_MAX;
+    polygons->bounds[2] = -DBL_MAX;
+    polygons->bounds[3] = -DBL_MAX;
+}
+
+/**
+ * Free the polygon set buffers
+ */
+static void SFOverlayPolygonsFree(SFOverlayPolygons *polygons){
+    free(polygons->coordinates);
+    free(polygons->rings);
+    free(polygons->polygons);
+    SFOverlayPolygonsInit(polygons);
+}
+
+/**
+ * Determine if the polygon set has no polygons
+ */
+static BOOL SFOverlayPolygonsEmpty(const SFOverlayPolygons *polygons){
+    return polygons->bounds[0] > polygons->bounds[2];
+}
+
+/**
+ * Start a new polygon in the polygon set
+ */
+static void SFOverlayPolygonsStartPolygon(SFOverlayPolygons *polygons){
+    if(polygons->polygonCount == polygons->polygonCapacity){
+        polygons->polygonCapacity = MAX(4, polygons->polygonCapacity * 2);
+        polygons->polygons = realloc(polygons->polygons, sizeof(int) * polygons->polygonCapacity);
+    }
+    polygons->polygons[polygons->polygonCount++] = polygons->ringCount;
+}
+
+/**
+ * Start a new ring in the current polygon of the polygon set
+ */
+static void SFOverlayPolygonsStartRing(SFOverlayPolygons *polygons){
+    if(polygons->ringCount == polygons->ringCapacity){
+        polygons->ringCapacity = MAX(4, polygons->ringCapacity * 2);
+        polygons->rings = realloc(polygons->rings, sizeof(int) * polygons->ringCapacity);
+    }
+    polygons->rings[polygons->ringCount++] = polygons->pointCount;
+}
+
+/**
+ * Add a point to the current ring of the polygon set
+ */
+static void SFOverlayPolygonsAddPoint(SFOverlayPolygons *polygons, double x, double y){
+    if(polygons->pointCount == polygons->pointCapacity){
+        polygons->pointCapacity = MAX(16, polygons->pointCapacity * 2);
+        polygons->coordinates = realloc(polygons->coordinates, sizeof(double) * 2 * polygons->pointCapacity);
+    }
+    polygons->coordinates[polygons->pointCount * 2] = x;
+    polygons->coordinates[polygons->pointCount * 2 + 1] = y;
+    polygons->pointCount++;
+    polygons->bounds[0] = MIN(polygons->bounds[0], x);
+    polygons->bounds[1] = MIN(polygons->bounds[1], y);
+    polygons->bounds[2] = MAX(polygons->bounds[2], x);
+    polygons->bounds[3] = MAX(polygons->bounds[3], y);
+}
+
+/**
+ * Ring point range end of the polygon set ring
+ */
+static int SFOverlayPolygonsRingEnd(const SFOverlayPolygons *polygons, int ring){
+    return ring + 1 < polygons->ringCount ? polygons->rings[ring + 1] : polygons->pointCount;
+}
+
+/**
+ * Ring range end of the polygon set polygon
+ */
+static int SFOverlayPolygonsPolygonEnd(const SFOverlayPolygons *polygons, int polygon){
+    return polygon + 1 < polygons->polygonCount ? polygons->polygons[polygon + 1] : polygons->ringCount;
+}
+
+/**
+ * Append the polygons of the source polygon set to the polygon set, with
+ * counter clockwise exterior rings and clockwise holes
+ */
+static void SFOverlayPolygonsAppend(SFOverlayPolygons *polygons, const SFOverlayPolygons *source){
+    for(int polygon = 0; polygon < source->polygonCount; polygon++){
+        SFOverlayPolygonsStartPolygon(polygons);
+        for(int ring = source->polygons[polygon]; ring < SFOverlayPolygonsPolygonEnd(source, polygon); ring++){
+            int start = source->rings[ring];
+            int count = SFOverlayPolygonsRingEnd(source, ring) - start;
+            const double *coordinates = &source->coordinates[start * 2];
+            double area = 0.0;
+            for(int i = 0, j = count - 1; i < count; j = i++){
+                area += (coordinates[j * 2] - coordinates[i * 2]) * (coordinates[j * 2 + 1] + coordinates[i * 2 + 1]);
+            }
+            BOOL reverse = (area > 0.0) != (ring == source->polygons[polygon]);
+            SFOverlayPolygonsStartRing(polygons);
+            for(int i = 0; i < count; i++){
+                int index = reverse ? (count - i) % count : i;
+                SFOverlayPolygonsAddPoint(polygons, coordinates[index * 2], coordinates[index * 2 + 1]);
+            }
+        }
+    }
+}
+
+/**
+ * Add the contour as an open ring of the polygon set in the orientation
+ *
+ * @param counterClockwise
+ *            true for a counter clockwise ring, false for clockwise
+ */
+static void SFOverlayPolygonsAddContour(SFOverlayPolygons *polygons, const SFOverlayContour *contour, BOOL counterClockwise){
+    const double *coordinates = contour->coordinates;
+    int count = contour->count;
+    if(count > 1 && coordinates[0] == coordinates[(count - 1) * 2] && coordinates[1] == coordinates[(count - 1) * 2 + 1]){
+        count--;
+    }
+    BOOL reverse = (SFOverlayContourArea(contour) > 0.0) != counterClockwise;
+    SFOverlayPolygonsStartRing(polygons);
+    for(int i = 0; i < count; i++){
+        int index = reverse ? (count - i) % count : i;
+        SFOverlayPolygonsAddPoint(polygons, coordinates[index * 2], coordinates[index * 2 + 1]);
+    }
+}
+
+/**
+ * Add the polygon set rings as overlay contours
+ */
+static void SFOverlayAddPolygons(SFOverlay *overlay, const SFOverlayPolygons *polygons, int subject, int *contourId){
+    for(int ring = 0; ring < polygons->ringCount; ring++){
+        int start = polygons->rings[ring];
+        SFOverlayAddContour(overlay, &polygons->coordinates[start * 2], SFOverlayPolygonsRingEnd(polygons, ring) - start, subject, (*contourId)++);
+    }
+}
+
+/**
+ * Sweep the overlay contours and connect the result edges into polygons
+ *
+ * @param subjectMaxX
+ *            subject maximum x
+ * @param clippingMaxX
+ *            clipping maximum x
+ * @param result
+ *            initialized result polygons, appended
+ */
+static void SFOverlayResult(SFOverlay *overlay, double subjectMaxX, double clippingMaxX, SFOverlayPolygons *result){
+    
+    int sortedCount = 0;
+    int *sorted = SFOverlaySubdivide(overlay, subjectMaxX, clippingMaxX, &sortedCount);
+    
+    int contourCount = 0;
+    SFOverlayContour *contours = SFOverlayConnectEdges(overlay, sorted, sortedCount, &contourCount);
+    
+    for(int i = 0; i < contourCount; i++){
+        SFOverlayContour *contour = &contours[i];
+        // Skip collapsed rings of fewer than three points left by rounding and
+        // clockwise holes without an exterior ring
+        if(contour->holeOf < 0 && contour->count >= SF_OVERLAY_MIN_CONTOUR && SFOverlayContourArea(contour) > 0.0){
+            SFOverlayPolygonsStartPolygon(result);
+            SFOverlayPolygonsAddContour(result, contour, YES);
+            for(int j = 0; j < contour->holeCount; j++){
+                if(contours[contour->holes[j]].count >= SF_OVERLAY_MIN_CONTOUR){
+                    SFOverlayPolygonsAddContour(result, &contours[contour->holes[j]], NO);
+                }
+            }
+        }
+    }
+    
+    for(int i = 0; i < contourCount; i++){
+        free(contours[i].coordinates);
+        free(contours[i].holes);
+    }
+    free(contours);
+    free(sorted);
+    free(overlay->events);
+    free(overlay->queue);
+}
+
+/**
+ * Overlay the polygon sets
+ *
+ * @param subject
+ *            subject polygons
+ * @param clipping
+ *            clipping polygons
+ * @param type
+ *            overlay operation type
+ * @param result
+ *            initialized result polygons, appended
+ */
+static void SFOverlayPolygonSets(const SFOverlayPolygons *subject, const SFOverlayPolygons *clipping, enum SFOverlayType type, SFOverlayPolygons *result){
+    
+    const double *subjectBounds = subject->bounds;
+    const double *clippingBounds = clipping->bounds;
+    if(SFOverlayPolygonsEmpty(subject) || SFOverlayPolygonsEmpty(clipping)
+       || subjectBounds[0] > clippingBounds[2] || clippingBounds[0] > subjectBounds[2]
+       || subjectBounds[1] > clippingBounds[3] || clippingBounds[1] > subjectBounds[3]){
+        
+        // Trivial result when either geometry is empty or the bounds are disjoint
+        switch(type){
+            case SF_OT_INTERSECTION:
+                break;
+            case SF_OT_DIFFERENCE:
+                SFOverlayPolygonsAppend(result, subject);
+                break;
+            case SF_OT_UNION:
+            case SF_OT_XOR:
+                SFOverlayPolygonsAppend(result, subject);
+                SFOverlayPolygonsAppend(result, clipping);
+                break;
+        }
+        return;
+    }
+    
+    SFOverlay overlay;
+    memset(&overlay, 0, sizeof(SFOverlay));
+    overlay.root = -1;
+    overlay.seed = 2463534242u;
+    overlay.type = type;
+    
+    int contourId = 0;
+    SFOverlayAddPolygons(&overlay, subject, 1, &contourId);
+    SFOverlayAddPolygons(&overlay, clipping, 0, &contourId);
+    
+    SFOverlayResult(&overlay, subjectBounds[2], clippingBounds[2], result);
+}
+
+static int SFOverlayCompareEdges(const void *edge1, const void *edge2){
+    const SFOverlayEdge *e1 = edge1;
+    const SFOverlayEdge *e2 = edge2;
+    if(e1->x1 != e2->x1){
+        return e1->x1 < e2->x1 ? -1 : 1;
+    }
+    if(e1->y1 != e2->y1){
+        return e1->y1 < e2->y1 ? -1 : 1;
+    }
+    if(e1->x2 != e2->x2){
+        return e1->x2 < e2->x2 ? -1 : 1;
+    }
+    if(e1->y2 != e2->y2){
+        return e1->y2 < e2->y2 ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * Snap noded edge endpoints within the tolerance of each other to a single
+ * vertex, preferring input ring vertices. An edge passing through the vertex
+ * of another edge can otherwise be divided at an intersection rounded to a
+ * point just off of the vertex, leaving slivers and overlaps that no longer
+ * cancel.
+ *
+ * @param edges
+ *            noded edges, endpoints updated
+ * @param edgeCount
+ *            number of edges
+ * @param polygons
+ *            input polygons
+ * @param tolerance
+ *            snap distance along each axis
+ */
+static void SFOverlaySnapVertices(SFOverlayEdge *edges, int edgeCount, const SFOverlayPolygons *polygons, double tolerance){
+    
+    // Edge endpoint keys reference twice the edge plus the endpoint, input vertices -1
+    int count = edgeCount * 2 + polygons->pointCount;
+    SFOverlayVertexKey *keys = malloc(sizeof(SFOverlayVertexKey) * MAX(count, 1));
+    for(int i = 0; i < edgeCount; i++){
+        keys[i * 2].x = edges[i].x1;
+        keys[i * 2].y = edges[i].y1;
+        keys[i * 2].edge = i * 2;
+        keys[i * 2 + 1].x = edges[i].x2;
+        keys[i * 2 + 1].y = edges[i].y2;
+        keys[i * 2 + 1].edge = i * 2 + 1;
+    }
+    for(int i = 0; i < polygons->pointCount; i++){
+        SFOverlayVertexKey *key = &keys[edgeCount * 2 + i];
+        key->x = polygons->coordinates[i * 2];
+        key->y = polygons->coordinates[i * 2 + 1];
+        key->edge = -1;
+    }
+    qsort(keys, count, sizeof(SFOverlayVertexKey), SFOverlayCompareVertexKeys);
+    
+    unsigned char *snapped = calloc(MAX(count, 1), sizeof(unsigned char));
+    for(int i = 0; i < count; i++){
+        if(snapped[i]){
+            continue;
+        }
+        double x = keys[i].x;
+        double y = keys[i].y;
+        double snapX = x;
+        double snapY = y;
+        BOOL input = keys[i].edge < 0;
+        int end = i + 1;
+        while(end < count && keys[end].x - x <= tolerance){
+            if(!input && !snapped[end] && keys[end].edge < 0 && fabs(keys[end].y - y) <= tolerance){
+                snapX = keys[end].x;
+                snapY = keys[end].y;
+                input = YES;
+            }
+            end++;
+        }
+        for(int j = i; j < end; j++){
+            if(snapped[j] || fabs(keys[j].y - y) > tolerance){
+                continue;
+            }
+            snapped[j] = 1;
+            int edge = keys[j].edge;
+            if(edge >= 0){
+                if(edge & 1){
+                    edges[edge >> 1].x2 = snapX;
+                    edges[edge >> 1].y2 = snapY;
+                }else{
+                    edges[edge >> 1].x1 = snapX;
+                    edges[edge >> 1].y1 = snapY;
+                }
+            }
+        }
+    }
+    
+    free(snapped);
+    free(keys);
+}
+
+/**
+ * Subdivide the queued noding overlay edges at every intersection, including
+ * intersections and overlaps of edges from the same ring. Subdivided edge
+ * endpoints within rounding error of each other are snapped together and
+ * equal edges cancel in pairs.
+ *
+ * @param noding
+ *            noding overlay with queued edges, freed
+ * @param polygons
+ *            input polygons
+ * @param tolerance
+ *            snap distance along each axis
+ * @param edgeCount
+ *            number of remaining edges output
+ * @return remaining edges ordered left to right, caller is responsible for
+ *         freeing
+ */
+static SFOverlayEdge *SFOverlayNodeEvenOdd(SFOverlay *noding, const SFOverlayPolygons *polygons, double tolerance, int *edgeCount){
+    
+    double maxX = polygons->bounds[2];
+    int sortedCount = 0;
+    int *sorted = SFOverlaySubdivide(noding, maxX, maxX, &sortedCount);
+    
+    SFOverlayEdge *edges = malloc(sizeof(SFOverlayEdge) * MAX(sortedCount, 1));
+    int count = 0;
+    for(int i = 0; i < sortedCount; i++){
+        SFOverlayEvent *event = &noding->events[sorted[i]];
+        SFOverlayEvent *other = &noding->events[event->other];
+        if(event->left){
+            SFOverlayEdge *edge = &edges[count++];
+            edge->x1 = event->x;
+            edge->y1 = event->y;
+            edge->x2 = other->x;
+            edge->y2 = other->y;
+        }
+    }
+    free(sorted);
+    free(noding->events);
+    free(noding->queue);
+    
+    SFOverlaySnapVertices(edges, count, polygons, tolerance);
+    
+    // Drop edges collapsed by snapping and orient the rest left to right
+    int snappedCount = 0;
+    for(int i = 0; i < count; i++){
+        SFOverlayEdge edge = edges[i];
+        if(edge.x1 == edge.x2 && edge.y1 == edge.y2){
+            continue;
+        }
+        if(edge.x1 > edge.x2 || (edge.x1 == edge.x2 && edge.y1 > edge.y2)){
+            double x = edge.x1;
+            double y = edge.y1;
+            edge.x1 = edge.x2;
+            edge.y1 = edge.y2;
+            edge.x2 = x;
+            edge.y2 = y;
+        }
+        edges[snappedCount++] = edge;
+    }
+    qsort(edges, snappedCount, sizeof(SFOverlayEdge), SFOverlayCompareEdges);
+    
+    // Cancel equal edges in pairs
+    int remaining = 0;
+    int start = 0;
+    while(start < snappedCount){
+        int end = start + 1;
+        while(end < snappedCount && SFOverlayCompareEdges(&edges[start], &edges[end]) == 0){
+            end++;
+        }
+        if((end - start) % 2 == 1){
+            edges[remaining++] = edges[start];
+        }
+        start = end;
+    }
+    
+    *edgeCount = remaining;
+    return edges;
+}
+
+/**
+ * Initialize an overlay for resolving even-odd rings
+ *
+ * @param overlay
+ *            overlay
+ * @param noding
+ *            true to subdivide overlapping edges of the same ring
+ */
+static void SFOverlayInitEvenOdd(SFOverlay *overlay, BOOL noding){
+    memset(overlay, 0, sizeof(SFOverlay));
+    overlay->root = -1;
+    overlay->seed = 2463534242u;
+    overlay->type = SF_OT_XOR;
+    overlay->evenOdd = noding;
+}
+
+/**
+ * Resolve the polygon set rings by the even-odd rule. Noding sweeps
+ * subdivide the edges at every intersection, snap nearby endpoints, and
+ * cancel equal edges, repeating over the remaining edges until no further
+ * subdivision occurs. Collinear overlaps within a ring and intersections
+ * rounded near existing vertices can take more than one pass. A final sweep
+ * of the remaining edges connects the result polygons.
+ *
+ * @param polygons
+ *            polygons
+ * @param result
+ *            initialized result polygons, appended
+ */
+static void SFOverlayEvenOdd(const SFOverlayPolygons *polygons, SFOverlayPolygons *result){
+    
+    if(SFOverlayPolygonsEmpty(polygons)){
+        return;
+    }
+    double maxX = polygons->bounds[2];
+    double extent = MAX(polygons->bounds[2] - polygons->bounds[0], polygons->bounds[3] - polygons->bounds[1]);
+    double tolerance = SF_OVERLAY_SNAP * extent;
+    
+    SFOverlay noding;
+    SFOverlayInitEvenOdd(&noding, YES);
+    int contourId = 0;
+    SFOverlayAddPolygons(&noding, polygons, 1, &contourId);
+    
+    int edgeCount = 0;
+    SFOverlayEdge *edges = SFOverlayNodeEvenOdd(&noding, polygons, tolerance, &edgeCount);
+    
+    for(int pass = 1; pass < SF_OVERLAY_NODING_PASSES; pass++){
+        SFOverlayInitEvenOdd(&noding, YES);
+        for(int i = 0; i < edgeCount; i++){
+            SFOverlayAddEdge(&noding, edges[i].x1, edges[i].y1, edges[i].x2, edges[i].y2, 1, i);
+        }
+        int nodedCount = 0;
+        SFOverlayEdge *noded = SFOverlayNodeEvenOdd(&noding, polygons, tolerance, &nodedCount);
+        BOOL stable = nodedCount == edgeCount;
+        for(int i = 0; stable && i < edgeCount; i++){
+            stable = SFOverlayCompareEdges(&noded[i], &edges[i]) == 0;
+        }
+        free(edges);
+        edges = noded;
+        edgeCount = nodedCount;
+        if(stable){
+            break;
+        }
+    }
+    
+    SFOverlay overlay;
+    SFOverlayInitEvenOdd(&overlay, NO);
+    for(int i = 0; i < edgeCount; i++){
+        SFOverlayAddEdge(&overlay, edges[i].x1, edges[i].y1, edges[i].x2, edges[i].y2, 1, i);
+    }
+    free(edges);
+    
+    SFOverlayResult(&overlay, maxX, maxX, result);
+}
+
+/**
+ * Geometry bounds center for ordering the cascaded union
+ */
+typedef struct SFOverlayCenter{
+    double x;
+    double y;
+    int index;
+} SFOverlayCenter;
+
+static int SFOverlayCompareCenterX(const void *center1, const void *center2){
+    double x1 = ((const SFOverlayCenter *)center1)->x;
+    double x2 = ((const SFOverlayCenter *)center2)->x;
+    return x1 < x2 ? -1 : (x1 > x2 ? 1 : 0);
+}
+
+static int SFOverlayCompareCenterY(const void *center1, const void *center2){
+    double y1 = ((const SFOverlayCenter *)center1)->y;
+    double y2 = ((const SFOverlayCenter *)center2)->y;
+    return y1 < y2 ? -1 : (y1 > y2 ? 1 : 0);
+}
+
+/**
+ * Order the centers by sort tile recursive packing, sorting by x into
+ * vertical slices and then each slice by y, so that neighboring centers
+ * fill the same tree nodes
+ *
+ * @param centers
+ *            centers
+ * @param count
+ *            number of centers
+ */
+static void SFOverlaySortTileRecursive(SFOverlayCenter *centers, int count){
+    qsort(centers, count, sizeof(SFOverlayCenter), SFOverlayCompareCenterX);
+    int leafCount = (count + SF_OVERLAY_UNION_NODE_CAPACITY - 1) / SF_OVERLAY_UNION_NODE_CAPACITY;
+    int sliceCount = MAX(1, (int)ceil(sqrt(leafCount)));
+    int sliceCapacity = MAX(1, (count + sliceCount - 1) / sliceCount);
+    for(int start = 0; start < count; start += sliceCapacity){
+        qsort(&centers[start], MIN(sliceCapacity, count - start), sizeof(SFOverlayCenter), SFOverlayCompareCenterY);
+    }
+}
+
+@implementation SFMartinezRueda
+
++(SFMultiPolygon *) intersectionWithGeometry: (SFGeometry *) subject andGeometry: (SFGeometry *) clipping{
+    return [self overlayWithGeometry:subject andGeometry:clipping andType:SF_OT_INTERSECTION];
+}
+
++(SFMultiPolygon *) unionWithGeometry: (SFGeometry *) subject andGeometry: (SFGeometry *) clipping{
+    return [self overlayWithGeometry:subject andGeometry:clipping andType:SF_OT_UNION];
+}
+
++(SFMultiPolygon *) differenceWithGeometry: (SFGeometry *) subject andGeometry: (SFGeometry *) clipping{
+    return [self overlayWithGeometry:subject andGeometry:clipping andType:SF_OT_DIFFERENCE];
+}
+
++(SFMultiPolygon *) xorWithGeometry: (SFGeometry *) subject andGeometry: (SFGeometry *) clipping{
+    return [self overlayWithGeometry:subject andGeometry:clipping andType:SF_OT_XOR];
+}
+
++(SFMultiPolygon *) overlayWithGeometry: (SFGeometry *) subject andGeometry: (SFGeometry *) clipping andType: (enum SFOverlayType) type{
+    
+    [self validateGeometry:subject];
+    [self validateGeometry:clipping];
+    
+    SFOverlayPolygons subjectPolygons;
+    SFOverlayPolygons clippingPolygons;
+    SFOverlayPolygons resultPolygons;
+    SFOverlayPolygonsInit(&subjectPolygons);
+    SFOverlayPolygonsInit(&clippingPolygons);
+    SFOverlayPolygonsInit(&resultPolygons);
+    
+    [self readGeometry:subject intoPolygons:&subjectPolygons];
+    [self readGeometry:clipping intoPolygons:&clippingPolygons];
+    
+    SFOverlayPolygonSets(&subjectPolygons, &clippingPolygons, type, &resultPolygons);
+    
+    SFMultiPolygon *result = [self multiPolygonOfPolygons:&resultPolygons];
+    
+    SFOverlayPolygonsFree(&subjectPolygons);
+    SFOverlayPolygonsFree(&clippingPolygons);
+    SFOverlayPolygonsFree(&resultPolygons);
+    
+    return result;
+}
+
++(SFMultiPolygon *) unionWithGeometries: (NSArray<SFGeometry *> *) geometries{
+    
+    for(SFGeometry *geometry in geometries){
+        [self validateGeometry:geometry];
+    }
+    
+    int count = (int)geometries.count;
+    SFOverlayPolygons *polygons = malloc(sizeof(SFOverlayPolygons) * MAX(count, 1));
+    dispatch_queue_t queue = dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0);
+    
+    // Read the geometries concurrently across chunks
+    size_t chunks = (count + SF_OVERLAY_UNION_CHUNK - 1) / SF_OVERLAY_UNION_CHUNK;
+    dispatch_apply(chunks, queue, ^(size_t chunk) {
+        int start = (int)chunk * SF_OVERLAY_UNION_CHUNK;
+        int end = MIN(start + SF_OVERLAY_UNION_CHUNK, count);
+        for(int i = start; i < end; i++){
+            SFOverlayPolygonsInit(&polygons[i]);
+            [self readGeometry:[geometries objectAtIndex:i] intoPolygons:&polygons[i]];
+        }
+    });
+    
+    // Order the non empty geometries by sort tile recursive packing
+    SFOverlayCenter *centers = malloc(sizeof(SFOverlayCenter) * MAX(count, 1));
+    int centerCount = 0;
+    for(int i = 0; i < count; i++){
+        if(SFOverlayPolygonsEmpty(&polygons[i])){
+            SFOverlayPolygonsFree(&polygons[i]);
+        }else{
+            SFOverlayCenter *center = &centers[centerCount++];
+            center->x = (polygons[i].bounds[0] + polygons[i].bounds[2]) / 2.0;
+            center->y = (polygons[i].bounds[1] + polygons[i].bounds[3]) / 2.0;
+            center->index = i;
+        }
+    }
+    SFOverlaySortTileRecursive(centers, centerCount);
+    
+    int levelCount = centerCount;
+    SFOverlayPolygons *level = malloc(sizeof(SFOverlayPolygons) * MAX(levelCount, 1));
+    for(int i = 0; i < levelCount; i++){
+        level[i] = polygons[centers[i].index];
+    }
+    free(centers);
+    free(polygons);
+    
+    // Union neighboring pairs bottom up, each level of independent subtrees concurrently
+    while(levelCount > 1){
+        int nextCount = (levelCount + 1) / 2;
+        SFOverlayPolygons *next = malloc(sizeof(SFOverlayPolygons) * nextCount);
+        SFOverlayPolygons *current = level;
+        int currentCount = levelCount;
+        dispatch_apply(nextCount, queue, ^(size_t i) {
+            int left = (int)i * 2;
+            if(left + 1 < currentCount){
+                SFOverlayPolygonsInit(&next[i]);
+                SFOverlayPolygonSets(&current[left], &current[left + 1], SF_OT_UNION, &next[i]);
+                SFOverlayPolygonsFree(&current[left]);
+                SFOverlayPolygonsFree(&current[left + 1]);
+            }else{
+                next[i] = current[left];
+            }
+        });
+        free(level);
+        level = next;
+        levelCount = nextCount;
+    }
+    
+    SFMultiPolygon *result = nil;
+    if(levelCount > 0){
+        result = [self multiPolygonOfPolygons:&level[0]];
+        SFOverlayPolygonsFree(&level[0]);
+    }else{
+        result = [[SFMultiPolygon alloc] init];
+    }
+    free(level);
+    
+    return result;
+}
+
++(SFMultiPolygon *) evenOddWithGeometry: (SFGeometry *) geometry{
+    
+    [self validateGeometry:geometry];
+    
+    SFOverlayPolygons polygons;
+    SFOverlayPolygons resultPolygons;
+    SFOverlayPolygonsInit(&polygons);
+    SFOverlayPolygonsInit(&resultPolygons);
+    
+    [self readGeometry:geometry intoPolygons:&polygons];
+    
+    SFOverlayEvenOdd(&polygons, &resultPolygons);
+    
+    SFMultiPolygon *result = [self multiPolygonOfPolygons:&resultPolygons];
+    
+    SFOverlayPolygonsFree(&polygons);
+    SFOverlayPolygonsFree(&resultPolygons);
+    
+    return result;
+}
+
+/**
+ * Validate the geometry is a polygon or multi polygon
+ *
+ * @param geometry
+ *            geometry
+ */
++(void) validateGeometry: (SFGeometry *) geometry{
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch(geometryType){
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+        case SF_MULTIPOLYGON:
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for polygon overlay: %@", [SFGeometryTypes name:geometryType]];
+    }
+}
+
+/**
+ * Read the polygon or multi polygon into the polygon set
+ *
+ * @param geometry
+ *            polygon or multi polygon
+ * @param polygons
+ *            polygon set
+ */
++(void) readGeometry: (SFGeometry *) geometry intoPolygons: (SFOverlayPolygons *) polygons{
+    if(geometry.geometryType == SF_MULTIPOLYGON){
+        for(SFPolygon *polygon in [((SFMultiPolygon *)geometry) polygons]){
+            [self readPolygon:polygon intoPolygons:polygons];
+        }
+    }else{
+        [self readPolygon:(SFPolygon *)geometry intoPolygons:polygons];
+    }
+}
+
+/**
+ * Read the polygon rings into the polygon set
+ *
+ * @param polygon
+ *            polygon
+ * @param polygons
+ *            polygon set
+ */
++(void) readPolygon: (SFPolygon *) polygon intoPolygons: (SFOverlayPolygons *) polygons{
+    if([polygon isEmpty]){
+        return;
+    }
+    SFOverlayPolygonsStartPolygon(polygons);
+    for(SFLineString *ring in polygon.rings){
+        NSArray<SFPoint *> *points = ring.points;
+        int count = (int)points.count;
+        if(count > 1 && [[points objectAtIndex:0] isEqual:[points objectAtIndex:count - 1]]){
+            count--;
+        }
+        SFOverlayPolygonsStartRing(polygons);
+        for(int i = 0; i < count; i++){
+            SFPoint *point = [points objectAtIndex:i];
+            double x = [point.x doubleValue];
+            double y = [point.y doubleValue];
+            if(isfinite(x) && isfinite(y)){
+                SFOverlayPolygonsAddPoint(polygons, x, y);
+            }
+        }
+    }
+}
+
+/**
+ * Create a multi polygon from the polygon set
+ *
+ * @param polygons
+ *            polygon set
+ * @return multi polygon
+ */
++(SFMultiPolygon *) multiPolygonOfPolygons: (SFOverlayPolygons *) polygons{
+    SFMultiPolygon *multiPolygon = [[SFMultiPolygon alloc] init];
+    for(int polygonIndex = 0; polygonIndex < polygons->polygonCount; polygonIndex++){
+        SFPolygon *polygon = [[SFPolygon alloc] init];
+        for(int ring = polygons->polygons[polygonIndex]; ring < SFOverlayPolygonsPolygonEnd(polygons, polygonIndex); ring++){
+            int start = polygons->rings[ring];
+            int end = SFOverlayPolygonsRingEnd(polygons, ring);
+            SFLineString *lineString = [[SFLineString alloc] init];
+            for(int i = start; i <= end; i++){
+                int index = i < end ? i : start;
+                [lineString addPoint:[[SFPoint alloc] initWithXValue:polygons->coordinates[index * 2] andYValue:polygons->coordinates[index * 2 + 1]]];
+            }
+            [polygon addRing:lineString];
+        }
+        [multiPolygon addPolygon:polygon];
+    }
+    return multiPolygon;
+}
+
+@end
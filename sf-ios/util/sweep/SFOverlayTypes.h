@@ -0,0 +1,23 @@
+//
+//  SFOverlayTypes.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Polygon overlay (boolean) operation type
+ */
+enum SFOverlayType{
+    SF_OT_INTERSECTION = 0,
+    SF_OT_UNION,
+    SF_OT_DIFFERENCE,
+    SF_OT_XOR
+};
+
+@interface SFOverlayTypes : NSObject
+
+@end
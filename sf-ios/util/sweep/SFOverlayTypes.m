@@ -0,0 +1,13 @@
+//
+//  SFOverlayTypes.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFOverlayTypes.h"
+
+@implementation SFOverlayTypes
+
+@end
@@ -7,6 +7,7 @@
 //
 
 #import "SFSweepLine.h"
+#import "SFGeometryPredicates.h"
 
 @interface SFSweepLine()
 
@@ -201,12 +202,12 @@
             double left = [SFSweepLine isPoint:segment2.leftPoint leftOfSegment:segment1];
             double right = [SFSweepLine isPoint:segment2.rightPoint leftOfSegment:segment1];
             
-            if (left * right <= 0) {
+            if ((left <= 0 && right >= 0) || (left >= 0 && right <= 0)) {
                 
                 left = [SFSweepLine isPoint:segment1.leftPoint leftOfSegment:segment2];
                 right = [SFSweepLine isPoint:segment1.rightPoint leftOfSegment:segment2];
                 
-                if (left * right <= 0) {
+                if ((left <= 0 && right >= 0) || (left >= 0 && right <= 0)) {
                     intersect = YES;
                 }
             }
@@ -325,10 +326,7 @@
  * @return > 0 if left, 0 if on, < 0 if right
  */
 +(double) isPoint: (SFPoint *) point leftOfPoint1: (SFPoint *) point1 toPoint2: (SFPoint *) point2{
-    return ([point2.x doubleValue] - [point1.x doubleValue])
-    * ([point.y doubleValue] - [point1.y doubleValue])
-    - ([point.x doubleValue] - [point1.x doubleValue])
-    * ([point2.y doubleValue] - [point1.y doubleValue]);
+    return [SFGeometryPredicates orientationWithPoint1:point1 andPoint2:point2 andPoint3:point];
 }
 
 @end
@@ -0,0 +1,46 @@
+//
+//  SFValidityError.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFValidityErrorTypes.h"
+#import "SFPoint.h"
+
+/**
+ * Geometry validity error, with the reason and the coordinate location
+ */
+@interface SFValidityError : NSObject
+
+/**
+ * Validity error type
+ */
+@property (nonatomic) enum SFValidityErrorType type;
+
+/**
+ * Location of the error, nil when no coordinate applies
+ */
+@property (nonatomic, strong) SFPoint *location;
+
+/**
+ * Initialize
+ *
+ * @param type
+ *            validity error type
+ * @param location
+ *            error location
+ * @return new validity error
+ */
+-(instancetype) initWithType: (enum SFValidityErrorType) type andLocation: (SFPoint *) location;
+
+/**
+ * Get the reason of the validity error
+ *
+ * @return reason
+ */
+-(NSString *) reason;
+
+@end
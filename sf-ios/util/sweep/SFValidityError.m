@@ -0,0 +1,34 @@
+//
+//  SFValidityError.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFValidityError.h"
+
+@implementation SFValidityError
+
+-(instancetype) initWithType: (enum SFValidityErrorType) type andLocation: (SFPoint *) location{
+    self = [super init];
+    if(self != nil){
+        self.type = type;
+        self.location = location;
+    }
+    return self;
+}
+
+-(NSString *) reason{
+    return [SFValidityErrorTypes name:self.type];
+}
+
+-(NSString *) description{
+    NSString *description = [self reason];
+    if(self.location != nil){
+        description = [NSString stringWithFormat:@"%@ at or near point %@ %@", description, self.location.x, self.location.y];
+    }
+    return description;
+}
+
+@end
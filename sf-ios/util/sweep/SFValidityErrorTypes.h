@@ -0,0 +1,38 @@
+//
+//  SFValidityErrorTypes.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Geometry validity error type, the reason a geometry is not valid
+ */
+enum SFValidityErrorType{
+    SF_VET_INVALID_COORDINATE = 0,
+    SF_VET_TOO_FEW_POINTS,
+    SF_VET_RING_NOT_CLOSED,
+    SF_VET_RING_SELF_INTERSECTION,
+    SF_VET_SELF_INTERSECTION,
+    SF_VET_HOLE_OUTSIDE_SHELL,
+    SF_VET_NESTED_HOLES,
+    SF_VET_DISCONNECTED_INTERIOR,
+    SF_VET_NESTED_SHELLS,
+    SF_VET_RING_ORIENTATION
+};
+
+@interface SFValidityErrorTypes : NSObject
+
+/**
+ *  Get the name of the validity error type
+ *
+ *  @param type validity error type enum
+ *
+ *  @return validity error type name
+ */
++(NSString *) name: (enum SFValidityErrorType) type;
+
+@end
@@ -0,0 +1,52 @@
+//
+//  SFValidityErrorTypes.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFValidityErrorTypes.h"
+
+@implementation SFValidityErrorTypes
+
++(NSString *) name: (enum SFValidityErrorType) type{
+    NSString * name = nil;
+    
+    switch(type){
+        case SF_VET_INVALID_COORDINATE:
+            name = @"Invalid Coordinate";
+            break;
+        case SF_VET_TOO_FEW_POINTS:
+            name = @"Too Few Points";
+            break;
+        case SF_VET_RING_NOT_CLOSED:
+            name = @"Ring Not Closed";
+            break;
+        case SF_VET_RING_SELF_INTERSECTION:
+            name = @"Ring Self-intersection";
+            break;
+        case SF_VET_SELF_INTERSECTION:
+            name = @"Self-intersection";
+            break;
+        case SF_VET_HOLE_OUTSIDE_SHELL:
+            name = @"Hole Outside Shell";
+            break;
+        case SF_VET_NESTED_HOLES:
+            name = @"Nested Holes";
+            break;
+        case SF_VET_DISCONNECTED_INTERIOR:
+            name = @"Disconnected Interior";
+            break;
+        case SF_VET_NESTED_SHELLS:
+            name = @"Nested Shells";
+            break;
+        case SF_VET_RING_ORIENTATION:
+            name = @"Ring Orientation";
+            break;
+    }
+    
+    return name;
+}
+
+@end
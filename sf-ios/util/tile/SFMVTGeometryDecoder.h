@@ -0,0 +1,81 @@
+//
+//  SFMVTGeometryDecoder.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFMVTGeometryEncoder.h"
+
+/**
+ * Mapbox Vector Tile feature geometry decoder. MoveTo, LineTo, and ClosePath
+ * commands with zigzag delta parameters are decoded from integer tile
+ * coordinates within the extent, with y increasing down, into the tile
+ * envelope coordinate system. Polygon rings with a positive tile coordinate
+ * area start a new polygon and rings with a negative area are interior rings
+ * of the preceding polygon. Single part geometries are decoded as points,
+ * line strings, and polygons, and multiple parts as multi geometries.
+ *
+ * https://github.com/mapbox/vector-tile-spec/tree/master/2.1
+ */
+@interface SFMVTGeometryDecoder : NSObject
+
+/**
+ * Tile envelope, in the decoded geometry coordinate system
+ */
+@property (nonatomic, strong) SFGeometryEnvelope *envelope;
+
+/**
+ * Tile extent, the number of integer tile coordinates per side
+ */
+@property (nonatomic, readonly) int extent;
+
+/**
+ * Initialize, with the default extent
+ *
+ * @param envelope
+ *            tile envelope, in the decoded geometry coordinate system
+ *
+ * @return new decoder
+ */
+-(instancetype) initWithEnvelope: (SFGeometryEnvelope *) envelope;
+
+/**
+ * Initialize
+ *
+ * @param envelope
+ *            tile envelope, in the decoded geometry coordinate system
+ * @param extent
+ *            tile extent
+ *
+ * @return new decoder
+ */
+-(instancetype) initWithEnvelope: (SFGeometryEnvelope *) envelope andExtent: (int) extent;
+
+/**
+ * Decode the feature geometry commands
+ *
+ * @param commands
+ *            command and parameter integers
+ * @param count
+ *            number of command and parameter integers
+ * @param type
+ *            feature geometry type
+ * @return geometry, nil when there are no commands
+ */
+-(SFGeometry *) decodeCommands: (const uint32_t *) commands withCount: (int) count andType: (enum SFMVTGeometryType) type;
+
+/**
+ * Decode the feature geometry commands
+ *
+ * @param data
+ *            command and parameter uint32 data
+ * @param type
+ *            feature geometry type
+ * @return geometry, nil when there are no commands
+ */
+-(SFGeometry *) decodeData: (NSData *) data withType: (enum SFMVTGeometryType) type;
+
+@end
@@ -0,0 +1,207 @@
+//
+//  SFMVTGeometryDecoder.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFMVTGeometryDecoder.h"
+#import "SFPoint.h"
+#import "SFPolygon.h"
+#import "SFMultiPoint.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+
+/**
+ * MoveTo command id
+ */
+#define SF_MVT_MOVE_TO 1
+
+/**
+ * LineTo command id
+ */
+#define SF_MVT_LINE_TO 2
+
+/**
+ * ClosePath command id
+ */
+#define SF_MVT_CLOSE_PATH 7
+
+/**
+ * Decode a zigzag parameter integer
+ *
+ * @param parameter
+ *            parameter integer
+ * @return signed value
+ */
+static int32_t SFMVTUnzigzag(uint32_t parameter){
+    return (int32_t) (parameter >> 1) ^ -(int32_t) (parameter & 1);
+}
+
+@interface SFMVTGeometryDecoder(){
+    double _minX;
+    double _maxY;
+    double _unitX;
+    double _unitY;
+}
+
+/**
+ * Tile extent, the number of integer tile coordinates per side
+ */
+@property (nonatomic) int extent;
+
+@end
+
+@implementation SFMVTGeometryDecoder
+
+-(instancetype) initWithEnvelope: (SFGeometryEnvelope *) envelope{
+    return [self initWithEnvelope:envelope andExtent:SF_MVT_DEFAULT_EXTENT];
+}
+
+-(instancetype) initWithEnvelope: (SFGeometryEnvelope *) envelope andExtent: (int) extent{
+    self = [super init];
+    if(self != nil){
+        if(extent <= 0){
+            [NSException raise:@"Invalid Extent" format:@"Extent must be positive: %d", extent];
+        }
+        self.extent = extent;
+        [self setEnvelope:envelope];
+    }
+    return self;
+}
+
+-(void) setEnvelope: (SFGeometryEnvelope *) envelope{
+    double width = [envelope.maxX doubleValue] - [envelope.minX doubleValue];
+    double height = [envelope.maxY doubleValue] - [envelope.minY doubleValue];
+    if(!(width > 0) || !(height > 0)){
+        [NSException raise:@"Invalid Envelope" format:@"Tile envelope must have a positive width and height: %@", envelope];
+    }
+    _envelope = envelope;
+    _minX = [envelope.minX doubleValue];
+    _maxY = [envelope.maxY doubleValue];
+    _unitX = width / self.extent;
+    _unitY = height / self.extent;
+}
+
+-(SFGeometry *) decodeData: (NSData *) data withType: (enum SFMVTGeometryType) type{
+    return [self decodeCommands:data.bytes withCount:(int) (data.length / sizeof(uint32_t)) andType:type];
+}
+
+-(SFGeometry *) decodeCommands: (const uint32_t *) commands withCount: (int) count andType: (enum SFMVTGeometryType) type{
+    
+    if(type != SF_MVT_POINT && type != SF_MVT_LINESTRING && type != SF_MVT_POLYGON){
+        if(count > 0){
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported MVT geometry type: %d", type];
+        }
+        return nil;
+    }
+    
+    NSMutableArray *parts = [NSMutableArray array];
+    SFLineString *lineString = nil;
+    SFPolygon *polygon = nil;
+    int32_t x = 0;
+    int32_t y = 0;
+    int32_t startX = 0;
+    int32_t startY = 0;
+    int64_t area = 0;
+    
+    int index = 0;
+    while(index < count){
+        
+        uint32_t command = commands[index++];
+        uint32_t commandId = command & 0x7;
+        uint32_t commandCount = command >> 3;
+        
+        switch(commandId){
+            
+            case SF_MVT_MOVE_TO:
+            case SF_MVT_LINE_TO:
+                if(commandCount == 0 || commandCount > (count - index) / 2
+                   || (commandId == SF_MVT_MOVE_TO && type != SF_MVT_POINT && (commandCount != 1 || lineString != nil))
+                   || (commandId == SF_MVT_LINE_TO && lineString == nil)){
+                    [self raiseInvalidAtIndex:index - 1];
+                }
+                for(uint32_t i = 0; i < commandCount; i++){
+                    int32_t previousX = x;
+                    int32_t previousY = y;
+                    x = (int32_t) ((uint32_t) x + (uint32_t) SFMVTUnzigzag(commands[index++]));
+                    y = (int32_t) ((uint32_t) y + (uint32_t) SFMVTUnzigzag(commands[index++]));
+                    SFPoint *point = [[SFPoint alloc] initWithXValue:_minX + x * _unitX andYValue:_maxY - y * _unitY];
+                    if(type == SF_MVT_POINT){
+                        [parts addObject:point];
+                    }else{
+                        if(commandId == SF_MVT_MOVE_TO){
+                            lineString = [[SFLineString alloc] init];
+                            startX = x;
+                            startY = y;
+                            area = 0;
+                        }else{
+                            area += (int64_t) previousX * y - (int64_t) x * previousY;
+                        }
+                        [lineString addPoint:point];
+                    }
+                }
+                if(type == SF_MVT_LINESTRING && commandId == SF_MVT_LINE_TO){
+                    [parts addObject:lineString];
+                    lineString = nil;
+                }
+                break;
+            
+            case SF_MVT_CLOSE_PATH:
+                if(commandCount != 1 || type != SF_MVT_POLYGON || lineString == nil || [lineString numPoints] < 3){
+                    [self raiseInvalidAtIndex:index - 1];
+                }
+                area += (int64_t) x * startY - (int64_t) startX * y;
+                [lineString addPoint:[[SFPoint alloc] initWithXValue:_minX + startX * _unitX andYValue:_maxY - startY * _unitY]];
+                if(area != 0){
+                    if(area > 0 || polygon == nil){
+                        polygon = [[SFPolygon alloc] initWithRing:lineString];
+                        [parts addObject:polygon];
+                    }else{
+                        [polygon addRing:lineString];
+                    }
+                }
+                lineString = nil;
+                break;
+            
+            default:
+                [self raiseInvalidAtIndex:index - 1];
+        }
+    }
+    
+    if(lineString != nil){
+        [self raiseInvalidAtIndex:count];
+    }
+    
+    SFGeometry *geometry = nil;
+    if(parts.count == 1){
+        geometry = [parts firstObject];
+    }else if(parts.count > 1){
+        switch(type){
+            case SF_MVT_POINT:
+                geometry = [[SFMultiPoint alloc] initWithPoints:parts];
+                break;
+            case SF_MVT_LINESTRING:
+                geometry = [[SFMultiLineString alloc] initWithLineStrings:parts];
+                break;
+            default:
+                geometry = [[SFMultiPolygon alloc] initWithPolygons:parts];
+                break;
+        }
+    }
+    
+    return geometry;
+}
+
+/**
+ * Raise an invalid MVT exception
+ *
+ * @param index
+ *            command index
+ */
+-(void) raiseInvalidAtIndex: (int) index{
+    [NSException raise:@"Invalid MVT" format:@"Invalid MVT geometry command at index: %d", index];
+}
+
+@end
@@ -0,0 +1,110 @@
+//
+//  SFMVTGeometryEncoder.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+#import "SFGeometryEnvelope.h"
+
+/**
+ * Default vector tile extent
+ */
+extern int const SF_MVT_DEFAULT_EXTENT;
+
+/**
+ * Mapbox Vector Tile feature geometry types
+ */
+enum SFMVTGeometryType{
+    SF_MVT_UNKNOWN = 0,
+    SF_MVT_POINT,
+    SF_MVT_LINESTRING,
+    SF_MVT_POLYGON
+};
+
+/**
+ * Mapbox Vector Tile feature geometry encoder. Geometries are quantized from
+ * the tile envelope to integer tile coordinates within the extent, with y
+ * increasing down, and encoded as MoveTo, LineTo, and ClosePath commands
+ * with zigzag delta parameters. Repeated points are removed after
+ * quantization, along with lines, rings, and polygons that collapse, and
+ * rings are reversed as needed so exterior rings have a positive and
+ * interior rings a negative tile coordinate area. Geometries are not
+ * clipped to the tile.
+ *
+ * Commands are written into a buffer reused across geometries, so encoding
+ * the features of a tile allocates only while the buffer grows.
+ *
+ * https://github.com/mapbox/vector-tile-spec/tree/master/2.1
+ */
+@interface SFMVTGeometryEncoder : NSObject
+
+/**
+ * Tile envelope, in the geometry coordinate system
+ */
+@property (nonatomic, strong) SFGeometryEnvelope *envelope;
+
+/**
+ * Tile extent, the number of integer tile coordinates per side
+ */
+@property (nonatomic, readonly) int extent;
+
+/**
+ * Initialize, with the default extent
+ *
+ * @param envelope
+ *            tile envelope, in the geometry coordinate system
+ *
+ * @return new encoder
+ */
+-(instancetype) initWithEnvelope: (SFGeometryEnvelope *) envelope;
+
+/**
+ * Initialize
+ *
+ * @param envelope
+ *            tile envelope, in the geometry coordinate system
+ * @param extent
+ *            tile extent
+ *
+ * @return new encoder
+ */
+-(instancetype) initWithEnvelope: (SFGeometryEnvelope *) envelope andExtent: (int) extent;
+
+/**
+ * Encode the geometry, replacing the previously encoded commands. Points,
+ * line strings, polygons, triangles, and their multi geometries are
+ * supported.
+ *
+ * @param geometry
+ *            geometry
+ * @return feature geometry type, unknown with no commands when the geometry
+ *         is empty or collapses after quantization
+ */
+-(enum SFMVTGeometryType) encodeGeometry: (SFGeometry *) geometry;
+
+/**
+ * Get the encoded commands, valid until the next encode
+ *
+ * @return command and parameter integers
+ */
+-(const uint32_t *) commands;
+
+/**
+ * Get the number of encoded command and parameter integers
+ *
+ * @return count
+ */
+-(int) commandCount;
+
+/**
+ * Get a copy of the encoded commands
+ *
+ * @return command and parameter uint32 data
+ */
+-(NSData *) commandData;
+
+@end
@@ -0,0 +1,403 @@
+//
+//  SFMVTGeometryEncoder.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFMVTGeometryEncoder.h"
+#import "SFPoint.h"
+#import "SFPolygon.h"
+#import "SFMultiPoint.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+#import "SFGeometryTypes.h"
+
+int const SF_MVT_DEFAULT_EXTENT = 4096;
+
+/**
+ * MoveTo command id
+ */
+#define SF_MVT_MOVE_TO 1
+
+/**
+ * LineTo command id
+ */
+#define SF_MVT_LINE_TO 2
+
+/**
+ * ClosePath command id
+ */
+#define SF_MVT_CLOSE_PATH 7
+
+/**
+ * Max magnitude of quantized tile coordinates, keeping coordinate deltas
+ * within 32 bits
+ */
+#define SF_MVT_MAX_COORDINATE 1073741823
+
+/**
+ * Growable command buffer
+ */
+typedef struct SFMVTBuffer{
+    uint32_t *commands;
+    size_t count;
+    size_t capacity;
+} SFMVTBuffer;
+
+/**
+ * Quantize a tile coordinate value
+ *
+ * @param value
+ *            unrounded tile coordinate value
+ * @return tile coordinate
+ */
+static int32_t SFMVTQuantize(double value){
+    return (int32_t) lround(fmin(fmax(value, -SF_MVT_MAX_COORDINATE), SF_MVT_MAX_COORDINATE));
+}
+
+/**
+ * Remove consecutive repeated tile coordinates in place, and for rings the
+ * trailing coordinates repeating the first
+ *
+ * @param points
+ *            x and y tile coordinates
+ * @param count
+ *            number of points
+ * @param ring
+ *            true if a ring
+ * @return number of remaining points
+ */
+static size_t SFMVTRemoveRepeated(int32_t *points, size_t count, BOOL ring){
+    size_t length = MIN(count, 1);
+    for(size_t i = 1; i < count; i++){
+        int32_t x = points[2 * i];
+        int32_t y = points[2 * i + 1];
+        if(x != points[2 * length - 2] || y != points[2 * length - 1]){
+            points[2 * length] = x;
+            points[2 * length + 1] = y;
+            length++;
+        }
+    }
+    if(ring){
+        while(length > 1 && points[2 * length - 2] == points[0] && points[2 * length - 1] == points[1]){
+            length--;
+        }
+    }
+    return length;
+}
+
+/**
+ * Twice the signed area of an implicitly closed ring of tile coordinates,
+ * positive when clockwise with y increasing down
+ *
+ * @param points
+ *            x and y tile coordinates
+ * @param count
+ *            number of points
+ * @return twice the signed area
+ */
+static int64_t SFMVTRingArea(const int32_t *points, size_t count){
+    int64_t area = 0;
+    for(size_t i = 0, j = count - 1; i < count; j = i++){
+        area += (int64_t) points[2 * j] * points[2 * i + 1] - (int64_t) points[2 * i] * points[2 * j + 1];
+    }
+    return area;
+}
+
+/**
+ * Reverse the points in place
+ *
+ * @param points
+ *            x and y tile coordinates
+ * @param count
+ *            number of points
+ */
+static void SFMVTReverse(int32_t *points, size_t count){
+    for(size_t i = 0, j = count - 1; i < j; i++, j--){
+        int32_t x = points[2 * i];
+        int32_t y = points[2 * i + 1];
+        points[2 * i] = points[2 * j];
+        points[2 * i + 1] = points[2 * j + 1];
+        points[2 * j] = x;
+        points[2 * j + 1] = y;
+    }
+}
+
+/**
+ * Write a command integer
+ *
+ * @param buffer
+ *            buffer
+ * @param command
+ *            command id
+ * @param count
+ *            command count
+ */
+static void SFMVTWriteCommand(SFMVTBuffer *buffer, uint32_t command, size_t count){
+    if(buffer->count == buffer->capacity){
+        buffer->capacity = MAX(64, buffer->capacity * 2);
+        buffer->commands = realloc(buffer->commands, sizeof(uint32_t) * buffer->capacity);
+    }
+    buffer->commands[buffer->count++] = (command & 0x7) | ((uint32_t) count << 3);
+}
+
+/**
+ * Write zigzag delta point parameters, moving the cursor
+ *
+ * @param buffer
+ *            buffer
+ * @param cursor
+ *            x and y cursor
+ * @param points
+ *            x and y tile coordinates
+ * @param count
+ *            number of points
+ */
+static void SFMVTWriteParameters(SFMVTBuffer *buffer, int32_t *cursor, const int32_t *points, size_t count){
+    if(buffer->count + 2 * count > buffer->capacity){
+        buffer->capacity = MAX(buffer->capacity * 2, buffer->count + 2 * count);
+        buffer->commands = realloc(buffer->commands, sizeof(uint32_t) * buffer->capacity);
+    }
+    uint32_t *parameters = buffer->commands + buffer->count;
+    for(size_t i = 0; i < 2 * count; i++){
+        int32_t delta = (int32_t) ((int64_t) points[i] - cursor[i & 1]);
+        parameters[i] = ((uint32_t) delta << 1) ^ (uint32_t) (delta >> 31);
+        cursor[i & 1] = points[i];
+    }
+    buffer->count += 2 * count;
+}
+
+@interface SFMVTGeometryEncoder(){
+    SFMVTBuffer _buffer;
+    int32_t *_points;
+    size_t _pointsCapacity;
+    int32_t _cursor[2];
+    double _minX;
+    double _maxY;
+    double _scaleX;
+    double _scaleY;
+}
+
+/**
+ * Tile extent, the number of integer tile coordinates per side
+ */
+@property (nonatomic) int extent;
+
+@end
+
+@implementation SFMVTGeometryEncoder
+
+-(instancetype) initWithEnvelope: (SFGeometryEnvelope *) envelope{
+    return [self initWithEnvelope:envelope andExtent:SF_MVT_DEFAULT_EXTENT];
+}
+
+-(instancetype) initWithEnvelope: (SFGeometryEnvelope *) envelope andExtent: (int) extent{
+    self = [super init];
+    if(self != nil){
+        if(extent <= 0){
+            [NSException raise:@"Invalid Extent" format:@"Extent must be positive: %d", extent];
+        }
+        self.extent = extent;
+        [self setEnvelope:envelope];
+    }
+    return self;
+}
+
+-(void) dealloc{
+    free(_buffer.commands);
+    free(_points);
+}
+
+-(void) setEnvelope: (SFGeometryEnvelope *) envelope{
+    double width = [envelope.maxX doubleValue] - [envelope.minX doubleValue];
+    double height = [envelope.maxY doubleValue] - [envelope.minY doubleValue];
+    if(!(width > 0) || !(height > 0)){
+        [NSException raise:@"Invalid Envelope" format:@"Tile envelope must have a positive width and height: %@", envelope];
+    }
+    _envelope = envelope;
+    _minX = [envelope.minX doubleValue];
+    _maxY = [envelope.maxY doubleValue];
+    _scaleX = self.extent / width;
+    _scaleY = self.extent / height;
+}
+
+-(enum SFMVTGeometryType) encodeGeometry: (SFGeometry *) geometry{
+    
+    _buffer.count = 0;
+    _cursor[0] = 0;
+    _cursor[1] = 0;
+    
+    enum SFMVTGeometryType type = SF_MVT_UNKNOWN;
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch(geometryType){
+        case SF_POINT:
+            [self encodePoint:(SFPoint *) geometry];
+            type = SF_MVT_POINT;
+            break;
+        case SF_MULTIPOINT:
+            [self encodePoints:((SFMultiPoint *) geometry).points];
+            type = SF_MVT_POINT;
+            break;
+        case SF_LINESTRING:
+            [self encodeLineString:(SFLineString *) geometry];
+            type = SF_MVT_LINESTRING;
+            break;
+        case SF_MULTILINESTRING:
+            for(SFLineString *lineString in ((SFMultiLineString *) geometry).lineStrings){
+                [self encodeLineString:lineString];
+            }
+            type = SF_MVT_LINESTRING;
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            [self encodePolygon:(SFPolygon *) geometry];
+            type = SF_MVT_POLYGON;
+            break;
+        case SF_MULTIPOLYGON:
+            for(SFPolygon *polygon in ((SFMultiPolygon *) geometry).polygons){
+                [self encodePolygon:polygon];
+            }
+            type = SF_MVT_POLYGON;
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for MVT: %@", [SFGeometryTypes name:geometryType]];
+    }
+    
+    if(_buffer.count == 0){
+        type = SF_MVT_UNKNOWN;
+    }
+    
+    return type;
+}
+
+-(const uint32_t *) commands{
+    return _buffer.commands;
+}
+
+-(int) commandCount{
+    return (int) _buffer.count;
+}
+
+-(NSData *) commandData{
+    return [NSData dataWithBytes:_buffer.commands length:sizeof(uint32_t) * _buffer.count];
+}
+
+/**
+ * Encode a point with a MoveTo command
+ *
+ * @param point
+ *            point, skipped when empty
+ */
+-(void) encodePoint: (SFPoint *) point{
+    double x = [point.x doubleValue];
+    double y = [point.y doubleValue];
+    if(!isnan(x) && !isnan(y)){
+        int32_t coordinate[2] = {SFMVTQuantize((x - _minX) * _scaleX), SFMVTQuantize((_maxY - y) * _scaleY)};
+        SFMVTWriteCommand(&_buffer, SF_MVT_MOVE_TO, 1);
+        SFMVTWriteParameters(&_buffer, _cursor, coordinate, 1);
+    }
+}
+
+/**
+ * Encode points with a single MoveTo command
+ *
+ * @param points
+ *            points, empty points are skipped
+ */
+-(void) encodePoints: (NSArray<SFPoint *> *) points{
+    size_t count = [self quantizePoints:points];
+    if(count > 0){
+        SFMVTWriteCommand(&_buffer, SF_MVT_MOVE_TO, count);
+        SFMVTWriteParameters(&_buffer, _cursor, _points, count);
+    }
+}
+
+/**
+ * Encode a line string, skipped when fewer than 2 distinct tile coordinates
+ *
+ * @param lineString
+ *            line string
+ */
+-(void) encodeLineString: (SFLineString *) lineString{
+    size_t count = SFMVTRemoveRepeated(_points, [self quantizePoints:lineString.points], NO);
+    if(count >= 2){
+        SFMVTWriteCommand(&_buffer, SF_MVT_MOVE_TO, 1);
+        SFMVTWriteParameters(&_buffer, _cursor, _points, 1);
+        SFMVTWriteCommand(&_buffer, SF_MVT_LINE_TO, count - 1);
+        SFMVTWriteParameters(&_buffer, _cursor, _points + 2, count - 1);
+    }
+}
+
+/**
+ * Encode a polygon, skipped when the exterior ring collapses
+ *
+ * @param polygon
+ *            polygon
+ */
+-(void) encodePolygon: (SFPolygon *) polygon{
+    NSArray<SFLineString *> *rings = [polygon lineStrings];
+    if(rings.count > 0 && [self encodeRing:[rings objectAtIndex:0] asExterior:YES]){
+        for(int i = 1; i < rings.count; i++){
+            [self encodeRing:[rings objectAtIndex:i] asExterior:NO];
+        }
+    }
+}
+
+/**
+ * Encode a ring with corrected winding, skipped when fewer than 3 distinct
+ * tile coordinates or no area
+ *
+ * @param ring
+ *            ring
+ * @param exterior
+ *            true if an exterior ring
+ * @return true if encoded
+ */
+-(BOOL) encodeRing: (SFLineString *) ring asExterior: (BOOL) exterior{
+    size_t count = SFMVTRemoveRepeated(_points, [self quantizePoints:ring.points], YES);
+    if(count < 3){
+        return NO;
+    }
+    int64_t area = SFMVTRingArea(_points, count);
+    if(area == 0){
+        return NO;
+    }
+    if(exterior != (area > 0)){
+        SFMVTReverse(_points, count);
+    }
+    SFMVTWriteCommand(&_buffer, SF_MVT_MOVE_TO, 1);
+    SFMVTWriteParameters(&_buffer, _cursor, _points, 1);
+    SFMVTWriteCommand(&_buffer, SF_MVT_LINE_TO, count - 1);
+    SFMVTWriteParameters(&_buffer, _cursor, _points + 2, count - 1);
+    SFMVTWriteCommand(&_buffer, SF_MVT_CLOSE_PATH, 1);
+    return YES;
+}
+
+/**
+ * Quantize the points into the reused tile coordinate buffer
+ *
+ * @param points
+ *            points, empty points are skipped
+ * @return number of quantized points
+ */
+-(size_t) quantizePoints: (NSArray<SFPoint *> *) points{
+    size_t count = points.count;
+    if(2 * count > _pointsCapacity){
+        _pointsCapacity = MAX(2 * count, 2 * _pointsCapacity);
+        _points = realloc(_points, sizeof(int32_t) * _pointsCapacity);
+    }
+    size_t length = 0;
+    for(SFPoint *point in points){
+        double x = [point.x doubleValue];
+        double y = [point.y doubleValue];
+        if(!isnan(x) && !isnan(y)){
+            _points[length++] = SFMVTQuantize((x - _minX) * _scaleX);
+            _points[length++] = SFMVTQuantize((_maxY - y) * _scaleY);
+        }
+    }
+    return length / 2;
+}
+
+@end
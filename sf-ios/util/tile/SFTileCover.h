@@ -0,0 +1,63 @@
+//
+//  SFTileCover.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+
+/**
+ * Max supported tile cover zoom level
+ */
+extern int const SF_TILE_COVER_MAX_ZOOM;
+
+/**
+ * Web Mercator slippy map (z/x/y) tile cover of WGS84 geometries. Only the
+ * tiles a geometry touches are included: line segments and ring boundaries
+ * are rasterized by a grid traversal (DDA) walk and polygon interiors are
+ * filled between the sorted edge crossings of each tile row. Segments are
+ * straight in Web Mercator and are not split at the antimeridian.
+ *
+ * Tiles are returned sorted by y and then x, either as individual tiles or
+ * as runs of consecutive x tiles within a row.
+ */
+@interface SFTileCover : NSObject
+
+/**
+ * Get the tiles touched by the geometry
+ *
+ * @param geometry
+ *            geometry in WGS84 longitude and latitude
+ * @param zoom
+ *            zoom level, 0 through SF_TILE_COVER_MAX_ZOOM
+ * @return int tile data, x and y per tile, sorted by y and then x
+ */
++(NSData *) tilesOfGeometry: (SFGeometry *) geometry atZoom: (int) zoom;
+
+/**
+ * Get the tile runs touched by the geometry
+ *
+ * @param geometry
+ *            geometry in WGS84 longitude and latitude
+ * @param zoom
+ *            zoom level, 0 through SF_TILE_COVER_MAX_ZOOM
+ * @return int tile run data, y, min x, and max x per run, sorted by y and
+ *         then x with no overlapping or adjacent runs in a row
+ */
++(NSData *) tileRunsOfGeometry: (SFGeometry *) geometry atZoom: (int) zoom;
+
+/**
+ * Get the number of tiles touched by the geometry
+ *
+ * @param geometry
+ *            geometry in WGS84 longitude and latitude
+ * @param zoom
+ *            zoom level, 0 through SF_TILE_COVER_MAX_ZOOM
+ * @return tile count
+ */
++(long long) tileCountOfGeometry: (SFGeometry *) geometry atZoom: (int) zoom;
+
+@end
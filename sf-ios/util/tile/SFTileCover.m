@@ -0,0 +1,495 @@
+//
+//  SFTileCover.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFTileCover.h"
+#import "SFGeometryTransform.h"
+#import "SFCurveUtils.h"
+#import "SFPoint.h"
+#import "SFCircularString.h"
+#import "SFCompoundCurve.h"
+#import "SFCurvePolygon.h"
+#import "SFPolyhedralSurface.h"
+#import "SFGeometryCollection.h"
+
+int const SF_TILE_COVER_MAX_ZOOM = 30;
+
+/**
+ * Number of coordinates buffered on the stack before falling back to the heap
+ */
+#define SF_TILE_BUFFER_SIZE 256
+
+/**
+ * Initial capacity of growable span and crossing buffers
+ */
+#define SF_TILE_INITIAL_CAPACITY 64
+
+/**
+ * Growable row spans of tiles, stored as y, min x, and max x triples
+ */
+typedef struct SFTileSpans{
+    int *values;
+    int count;
+    int capacity;
+} SFTileSpans;
+
+/**
+ * Tile row crossing of a ring edge at the row center
+ */
+typedef struct SFTileCrossing{
+    int row;
+    double x;
+} SFTileCrossing;
+
+/**
+ * Growable tile row crossings
+ */
+typedef struct SFTileCrossings{
+    SFTileCrossing *values;
+    int count;
+    int capacity;
+} SFTileCrossings;
+
+/**
+ * Add a span of tiles, extending the previous span when in the same row and
+ * overlapping or adjacent
+ *
+ * @param spans
+ *            spans
+ * @param y
+ *            tile row
+ * @param minX
+ *            min tile column
+ * @param maxX
+ *            max tile column
+ */
+static void SFTileSpansAdd(SFTileSpans *spans, int y, int minX, int maxX){
+    if(spans->count > 0){
+        int *last = spans->values + 3 * (spans->count - 1);
+        if(last[0] == y && minX <= last[2] + 1 && maxX >= last[1] - 1){
+            last[1] = MIN(last[1], minX);
+            last[2] = MAX(last[2], maxX);
+            return;
+        }
+    }
+    if(spans->count == spans->capacity){
+        spans->capacity = MAX(SF_TILE_INITIAL_CAPACITY, spans->capacity * 2);
+        spans->values = realloc(spans->values, sizeof(int) * 3 * spans->capacity);
+    }
+    int *span = spans->values + 3 * spans->count++;
+    span[0] = y;
+    span[1] = minX;
+    span[2] = maxX;
+}
+
+/**
+ * Compare spans by row and then min column
+ *
+ * @param a
+ *            first span
+ * @param b
+ *            second span
+ * @return comparison
+ */
+static int SFTileSpanCompare(const void *a, const void *b){
+    const int *span1 = a;
+    const int *span2 = b;
+    if(span1[0] != span2[0]){
+        return span1[0] < span2[0] ? -1 : 1;
+    }
+    return span1[1] < span2[1] ? -1 : (span1[1] > span2[1] ? 1 : 0);
+}
+
+/**
+ * Sort the spans and merge overlapping and adjacent spans in place
+ *
+ * @param spans
+ *            spans
+ */
+static void SFTileSpansMerge(SFTileSpans *spans){
+    if(spans->count > 1){
+        qsort(spans->values, spans->count, sizeof(int) * 3, SFTileSpanCompare);
+        int count = 1;
+        for(int i = 1; i < spans->count; i++){
+            int *last = spans->values + 3 * (count - 1);
+            int *span = spans->values + 3 * i;
+            if(span[0] == last[0] && span[1] <= last[2] + 1){
+                last[2] = MAX(last[2], span[2]);
+            }else{
+                memmove(spans->values + 3 * count++, span, sizeof(int) * 3);
+            }
+        }
+        spans->count = count;
+    }
+}
+
+/**
+ * Add a ring edge crossing
+ *
+ * @param crossings
+ *            crossings
+ * @param row
+ *            tile row
+ * @param x
+ *            fractional tile x at the row center
+ */
+static void SFTileCrossingsAdd(SFTileCrossings *crossings, int row, double x){
+    if(crossings->count == crossings->capacity){
+        crossings->capacity = MAX(SF_TILE_INITIAL_CAPACITY, crossings->capacity * 2);
+        crossings->values = realloc(crossings->values, sizeof(SFTileCrossing) * crossings->capacity);
+    }
+    SFTileCrossing *crossing = crossings->values + crossings->count++;
+    crossing->row = row;
+    crossing->x = x;
+}
+
+/**
+ * Compare crossings by row and then x
+ *
+ * @param a
+ *            first crossing
+ * @param b
+ *            second crossing
+ * @return comparison
+ */
+static int SFTileCrossingCompare(const void *a, const void *b){
+    const SFTileCrossing *crossing1 = a;
+    const SFTileCrossing *crossing2 = b;
+    if(crossing1->row != crossing2->row){
+        return crossing1->row < crossing2->row ? -1 : 1;
+    }
+    return crossing1->x < crossing2->x ? -1 : (crossing1->x > crossing2->x ? 1 : 0);
+}
+
+/**
+ * Convert WGS84 coordinates to fractional tile coordinates in place,
+ * clamped within the tile grid
+ *
+ * @param coordinates
+ *            interleaved longitude and latitude values
+ * @param count
+ *            number of coordinates
+ * @param tiles
+ *            number of tiles per axis
+ */
+static void SFTileCoordinates(double *coordinates, int count, double tiles){
+    double max = nextafter(tiles, 0.0);
+    for(int i = 0; i < count; i++){
+        double *coordinate = coordinates + 2 * i;
+        double x = (coordinate[0] + 180.0) / 360.0 * tiles;
+        double latitude = MAX(-SF_WEB_MERCATOR_MAX_LATITUDE, MIN(SF_WEB_MERCATOR_MAX_LATITUDE, coordinate[1]));
+        double y = (0.5 - atanh(sin(latitude * M_PI / 180.0)) / (2.0 * M_PI)) * tiles;
+        coordinate[0] = MAX(0.0, MIN(max, x));
+        coordinate[1] = MAX(0.0, MIN(max, y));
+    }
+}
+
+/**
+ * Add the tiles touched by the segment with a grid traversal walk
+ *
+ * @param spans
+ *            spans
+ * @param x0
+ *            fractional tile x of the start
+ * @param y0
+ *            fractional tile y of the start
+ * @param x1
+ *            fractional tile x of the end
+ * @param y1
+ *            fractional tile y of the end
+ */
+static void SFTileCoverSegment(SFTileSpans *spans, double x0, double y0, double x1, double y1){
+    
+    int x = (int) floor(x0);
+    int y = (int) floor(y0);
+    int endX = (int) floor(x1);
+    int endY = (int) floor(y1);
+    
+    SFTileSpansAdd(spans, y, x, x);
+    
+    double dx = x1 - x0;
+    double dy = y1 - y0;
+    int stepX = dx > 0.0 ? 1 : -1;
+    int stepY = dy > 0.0 ? 1 : -1;
+    double deltaX = dx != 0.0 ? fabs(1.0 / dx) : INFINITY;
+    double deltaY = dy != 0.0 ? fabs(1.0 / dy) : INFINITY;
+    // Segment fraction at the next column and row boundaries
+    double nextX = dx > 0.0 ? (x + 1 - x0) / dx : (dx < 0.0 ? (x0 - x) / -dx : INFINITY);
+    double nextY = dy > 0.0 ? (y + 1 - y0) / dy : (dy < 0.0 ? (y0 - y) / -dy : INFINITY);
+    
+    int steps = abs(endX - x) + abs(endY - y);
+    for(int i = 0; i < steps; i++){
+        // Step toward the end cell, guarding against rounding past it on one axis
+        if(y == endY || (x != endX && nextX < nextY)){
+            x += stepX;
+            nextX += deltaX;
+        }else{
+            y += stepY;
+            nextY += deltaY;
+        }
+        SFTileSpansAdd(spans, y, x, x);
+    }
+    
+}
+
+/**
+ * Add the tiles touched by the path
+ *
+ * @param spans
+ *            spans
+ * @param coordinates
+ *            interleaved fractional tile coordinates
+ * @param count
+ *            number of coordinates
+ * @param closed
+ *            true to close the path back to the first coordinate
+ */
+static void SFTileCoverPath(SFTileSpans *spans, const double *coordinates, int count, BOOL closed){
+    if(count == 1){
+        SFTileCoverSegment(spans, coordinates[0], coordinates[1], coordinates[0], coordinates[1]);
+    }
+    for(int i = 1; i < count; i++){
+        SFTileCoverSegment(spans, coordinates[2 * i - 2], coordinates[2 * i - 1], coordinates[2 * i], coordinates[2 * i + 1]);
+    }
+    if(closed && count > 2){
+        SFTileCoverSegment(spans, coordinates[2 * count - 2], coordinates[2 * count - 1], coordinates[0], coordinates[1]);
+    }
+}
+
+/**
+ * Add the crossings of the implicitly closed ring edges with the tile row
+ * centers. An edge crosses the rows with centers in [min y, max y).
+ *
+ * @param crossings
+ *            crossings
+ * @param coordinates
+ *            interleaved fractional tile coordinates
+ * @param count
+ *            number of coordinates
+ */
+static void SFTileRingCrossings(SFTileCrossings *crossings, const double *coordinates, int count){
+    for(int i = 0; i < count; i++){
+        const double *start = coordinates + 2 * i;
+        const double *end = coordinates + 2 * ((i + 1) % count);
+        if(start[1] != end[1]){
+            if(start[1] > end[1]){
+                const double *swap = start;
+                start = end;
+                end = swap;
+            }
+            int firstRow = (int) ceil(start[1] - 0.5);
+            int lastRow = (int) ceil(end[1] - 0.5) - 1;
+            double slope = (end[0] - start[0]) / (end[1] - start[1]);
+            for(int row = firstRow; row <= lastRow; row++){
+                SFTileCrossingsAdd(crossings, row, start[0] + (row + 0.5 - start[1]) * slope);
+            }
+        }
+    }
+}
+
+/**
+ * Fill the tiles between even odd pairs of sorted row crossings
+ *
+ * @param spans
+ *            spans
+ * @param crossings
+ *            crossings, sorted in place
+ */
+static void SFTileFillCrossings(SFTileSpans *spans, SFTileCrossings *crossings){
+    qsort(crossings->values, crossings->count, sizeof(SFTileCrossing), SFTileCrossingCompare);
+    for(int i = 0; i + 1 < crossings->count; i += 2){
+        SFTileCrossing *crossing1 = crossings->values + i;
+        SFTileCrossing *crossing2 = crossings->values + i + 1;
+        if(crossing1->row != crossing2->row){
+            // Unpaired crossing from non finite coordinates, realign to the next row
+            i--;
+            continue;
+        }
+        SFTileSpansAdd(spans, crossing1->row, (int) floor(crossing1->x), (int) floor(crossing2->x));
+    }
+}
+
+@implementation SFTileCover
+
++(NSData *) tilesOfGeometry: (SFGeometry *) geometry atZoom: (int) zoom{
+    
+    SFTileSpans spans = [self spansOfGeometry:geometry atZoom:zoom];
+    
+    long long count = 0;
+    for(int i = 0; i < spans.count; i++){
+        count += spans.values[3 * i + 2] - spans.values[3 * i + 1] + 1;
+    }
+    
+    NSMutableData *data = [NSMutableData dataWithLength:sizeof(int) * 2 * count];
+    int *tiles = data.mutableBytes;
+    for(int i = 0; i < spans.count; i++){
+        int *span = spans.values + 3 * i;
+        for(int x = span[1]; x <= span[2]; x++){
+            *tiles++ = x;
+            *tiles++ = span[0];
+        }
+    }
+    
+    free(spans.values);
+    
+    return data;
+}
+
++(NSData *) tileRunsOfGeometry: (SFGeometry *) geometry atZoom: (int) zoom{
+    SFTileSpans spans = [self spansOfGeometry:geometry atZoom:zoom];
+    NSData *data = [NSData dataWithBytes:spans.values length:sizeof(int) * 3 * spans.count];
+    free(spans.values);
+    return data;
+}
+
++(long long) tileCountOfGeometry: (SFGeometry *) geometry atZoom: (int) zoom{
+    SFTileSpans spans = [self spansOfGeometry:geometry atZoom:zoom];
+    long long count = 0;
+    for(int i = 0; i < spans.count; i++){
+        count += spans.values[3 * i + 2] - spans.values[3 * i + 1] + 1;
+    }
+    free(spans.values);
+    return count;
+}
+
+/**
+ * Get the sorted and merged tile spans of the geometry, values must be freed
+ *
+ * @param geometry
+ *            geometry
+ * @param zoom
+ *            zoom level
+ * @return spans
+ */
++(SFTileSpans) spansOfGeometry: (SFGeometry *) geometry atZoom: (int) zoom{
+    if(zoom < 0 || zoom > SF_TILE_COVER_MAX_ZOOM){
+        [NSException raise:@"Invalid Zoom" format:@"Zoom level must be between 0 and %d: %d", SF_TILE_COVER_MAX_ZOOM, zoom];
+    }
+    SFTileSpans spans = {NULL, 0, 0};
+    [self addGeometry:geometry toSpans:&spans withTiles:(double) (1 << zoom)];
+    SFTileSpansMerge(&spans);
+    return spans;
+}
+
+/**
+ * Add the tiles touched by the geometry
+ *
+ * @param geometry
+ *            geometry
+ * @param spans
+ *            spans
+ * @param tiles
+ *            number of tiles per axis
+ */
++(void) addGeometry: (SFGeometry *) geometry toSpans: (SFTileSpans *) spans withTiles: (double) tiles{
+    
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch(geometryType){
+        case SF_POINT:
+            {
+                SFPoint *point = (SFPoint *) geometry;
+                double coordinate[2] = {[point.x doubleValue], [point.y doubleValue]};
+                SFTileCoordinates(coordinate, 1, tiles);
+                SFTileCoverPath(spans, coordinate, 1, NO);
+            }
+            break;
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+        case SF_COMPOUNDCURVE:
+            [self addCurves:@[(SFCurve *) geometry] toSpans:spans withTiles:tiles andFill:NO];
+            break;
+        case SF_POLYGON:
+        case SF_CURVEPOLYGON:
+        case SF_TRIANGLE:
+            [self addCurves:((SFCurvePolygon *) geometry).rings toSpans:spans withTiles:tiles andFill:YES];
+            break;
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            for(SFPolygon *polygon in ((SFPolyhedralSurface *) geometry).polygons){
+                [self addGeometry:polygon toSpans:spans withTiles:tiles];
+            }
+            break;
+        case SF_MULTIPOINT:
+        case SF_MULTILINESTRING:
+        case SF_MULTIPOLYGON:
+        case SF_MULTICURVE:
+        case SF_MULTISURFACE:
+        case SF_GEOMETRYCOLLECTION:
+            for(SFGeometry *subGeometry in ((SFGeometryCollection *) geometry).geometries){
+                [self addGeometry:subGeometry toSpans:spans withTiles:tiles];
+            }
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for tile cover: %@", [SFGeometryTypes name:geometryType]];
+    }
+    
+}
+
+/**
+ * Add the tiles touched by the curves, optionally as the rings of a polygon
+ * with the interior filled
+ *
+ * @param curves
+ *            line curves or polygon rings
+ * @param spans
+ *            spans
+ * @param tiles
+ *            number of tiles per axis
+ * @param fill
+ *            true to close the curves as rings and fill the interior
+ */
++(void) addCurves: (NSArray<SFCurve *> *) curves toSpans: (SFTileSpans *) spans withTiles: (double) tiles andFill: (BOOL) fill{
+    
+    SFTileCrossings crossings = {NULL, 0, 0};
+    
+    for(SFCurve *curve in curves){
+        
+        NSArray<SFPoint *> *points = nil;
+        switch(curve.geometryType){
+            case SF_CIRCULARSTRING:
+                points = [((SFCircularString *) curve) linearize].points;
+                break;
+            case SF_COMPOUNDCURVE:
+                points = [SFCurveUtils linearizeCompoundCurve:(SFCompoundCurve *) curve withSegmentsPerQuadrant:SF_CURVE_DEFAULT_SEGMENTS_PER_QUADRANT].points;
+                break;
+            default:
+                points = ((SFLineString *) curve).points;
+                break;
+        }
+        
+        int count = (int) points.count;
+        if(count > 0){
+            
+            double stackCoordinates[SF_TILE_BUFFER_SIZE * 2];
+            double *coordinates = count <= SF_TILE_BUFFER_SIZE ? stackCoordinates : malloc(sizeof(double) * 2 * count);
+            
+            int i = 0;
+            for(SFPoint *point in points){
+                coordinates[i++] = [point.x doubleValue];
+                coordinates[i++] = [point.y doubleValue];
+            }
+            SFTileCoordinates(coordinates, count, tiles);
+            
+            SFTileCoverPath(spans, coordinates, count, fill);
+            if(fill){
+                SFTileRingCrossings(&crossings, coordinates, count);
+            }
+            
+            if(coordinates != stackCoordinates){
+                free(coordinates);
+            }
+        }
+    }
+    
+    if(crossings.count > 0){
+        SFTileFillCrossings(spans, &crossings);
+    }
+    free(crossings.values);
+    
+}
+
+@end
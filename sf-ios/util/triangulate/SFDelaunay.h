@@ -0,0 +1,137 @@
+//
+//  SFDelaunay.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFMultiPoint.h"
+#import "SFLineString.h"
+#import "SFTIN.h"
+
+/**
+ * Delaunay triangulation of points with a sweep hull, adding points in
+ * order of distance from a seed triangle and flipping edges until every
+ * triangle satisfies the empty circumcircle condition. Triangles are built
+ * in flat vertex index and opposite half edge arrays, with in circle and
+ * orientation tests falling back to exact arithmetic only for nearly
+ * degenerate points.
+ *
+ * Constrained triangulations insert breakline edges by flipping the edges
+ * they cross and then restoring the Delaunay condition around the new
+ * edges. Points lying on a breakline split it. Breaklines crossing other
+ * breaklines without a shared vertex are not honored where they cross and
+ * are reported as failed edges.
+ *
+ * Triangles are counter clockwise. Duplicate points are triangulated once.
+ *
+ * Based upon the JavaScript implementation:
+ * https://github.com/mapbox/delaunator
+ *
+ * JavaScript implementation license:
+ *
+ * ISC License
+ *
+ * Copyright (c) 2021, Mapbox
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+@interface SFDelaunay : NSObject
+
+/**
+ * Triangulate the multi point into a triangulated irregular network.
+ * Triangle points are copies of the multi point points, retaining z and m
+ * values.
+ *
+ * @param multiPoint
+ *            multi point
+ * @return TIN of triangles
+ */
++(SFTIN *) triangulateMultiPoint: (SFMultiPoint *) multiPoint;
+
+/**
+ * Triangulate the multi point into a constrained triangulated irregular
+ * network honoring the breakline edges. Breakline points are triangulated
+ * along with the multi point points.
+ *
+ * @param multiPoint
+ *            multi point
+ * @param breaklines
+ *            breaklines
+ * @return TIN of triangles
+ */
++(SFTIN *) triangulateMultiPoint: (SFMultiPoint *) multiPoint withBreaklines: (NSArray<SFLineString *> *) breaklines;
+
+/**
+ * Triangulate the multi point into a constrained triangulated irregular
+ * network honoring the breakline edges. Breakline points are triangulated
+ * along with the multi point points.
+ *
+ * @param multiPoint
+ *            multi point
+ * @param breaklines
+ *            breaklines
+ * @param failedEdges
+ *            set to the number of breakline edges not honored due to
+ *            crossing other breaklines, may be NULL
+ * @return TIN of triangles
+ */
++(SFTIN *) triangulateMultiPoint: (SFMultiPoint *) multiPoint withBreaklines: (NSArray<SFLineString *> *) breaklines andFailedEdges: (int *) failedEdges;
+
+/**
+ * Triangulate flat points into triangle vertex indices
+ *
+ * @param vertices
+ *            interleaved x and y vertex values
+ * @param count
+ *            number of vertices
+ * @return int vertex index data, three per triangle
+ */
++(NSData *) triangleIndicesOfVertices: (const double *) vertices withCount: (int) count;
+
+/**
+ * Triangulate flat points into constrained triangle vertex indices
+ *
+ * @param vertices
+ *            interleaved x and y vertex values
+ * @param count
+ *            number of vertices
+ * @param edges
+ *            constraint edge vertex index pairs
+ * @param edgeCount
+ *            number of constraint edges
+ * @return int vertex index data, three per triangle
+ */
++(NSData *) triangleIndicesOfVertices: (const double *) vertices withCount: (int) count andEdges: (const int *) edges andEdgeCount: (int) edgeCount;
+
+/**
+ * Triangulate flat points into constrained triangle vertex indices
+ *
+ * @param vertices
+ *            interleaved x and y vertex values
+ * @param count
+ *            number of vertices
+ * @param edges
+ *            constraint edge vertex index pairs
+ * @param edgeCount
+ *            number of constraint edges
+ * @param failedEdges
+ *            set to the number of constraint edges not honored due to
+ *            crossing other constraint edges, may be NULL
+ * @return int vertex index data, three per triangle
+ */
++(NSData *) triangleIndicesOfVertices: (const double *) vertices withCount: (int) count andEdges: (const int *) edges andEdgeCount: (int) edgeCount andFailedEdges: (int *) failedEdges;
+
+@end
@@ -0,0 +1,1053 @@
+//
+//  SFDelaunay.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFDelaunay.h"
+#import "SFPoint.h"
+#import "SFTriangle.h"
+#import "SFGeometryPredicates.h"
+
+/**
+ * Number of pending edges held while legalizing a new triangle
+ */
+#define SF_DELAUNAY_EDGE_STACK_SIZE 512
+
+/**
+ * Coordinate difference within which consecutive sorted points are skipped
+ * as duplicates, machine epsilon
+ */
+#define SF_DELAUNAY_DUPLICATE_EPSILON 2.220446049250313e-16
+
+/**
+ * Delaunay triangulation of flat coordinates, with counter clockwise
+ * triangles of three vertex indices and the opposite half edge of each
+ * triangle edge. The half edge e runs from triangles[e] to the next
+ * vertex of its triangle, -1 opposite half edges are on the hull.
+ */
+typedef struct SFDelaunayMesh{
+    const double *coordinates;
+    int count;
+    int *triangles;
+    int *halfedges;
+    int trianglesLength;
+    int *hullPrev;
+    int *hullNext;
+    int *hullTri;
+    int *hullHash;
+    int hashSize;
+    int hullStart;
+    double cx;
+    double cy;
+} SFDelaunayMesh;
+
+/**
+ * Orientation of the points, positive when counter clockwise, negative
+ * when clockwise, and zero when collinear
+ */
+static inline double SFDelaunayOrient(double ax, double ay, double bx, double by, double cx, double cy){
+    return [SFGeometryPredicates orientationWithX1:ax andY1:ay andX2:bx andY2:by andX3:cx andY3:cy];
+}
+
+/**
+ * In circle test, positive when point d lies inside the circle through the
+ * counter clockwise points a, b, and c, negative when outside, and zero
+ * when cocircular
+ */
+static inline double SFDelaunayInCircle(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy){
+    return [SFGeometryPredicates inCircleWithX1:ax andY1:ay andX2:bx andY2:by andX3:cx andY3:cy andX4:dx andY4:dy];
+}
+
+static inline int SFDelaunayNextHalfedge(int e){
+    return e % 3 == 2 ? e - 2 : e + 1;
+}
+
+static inline int SFDelaunayPrevHalfedge(int e){
+    return e % 3 == 0 ? e + 2 : e - 1;
+}
+
+static inline void SFDelaunayLink(SFDelaunayMesh *delaunay, int a, int b){
+    delaunay->halfedges[a] = b;
+    if(b != -1){
+        delaunay->halfedges[b] = a;
+    }
+}
+
+static int SFDelaunayAddTriangle(SFDelaunayMesh *delaunay, int i0, int i1, int i2, int a, int b, int c){
+    int t = delaunay->trianglesLength;
+    delaunay->triangles[t] = i0;
+    delaunay->triangles[t + 1] = i1;
+    delaunay->triangles[t + 2] = i2;
+    SFDelaunayLink(delaunay, t, a);
+    SFDelaunayLink(delaunay, t + 1, b);
+    SFDelaunayLink(delaunay, t + 2, c);
+    delaunay->trianglesLength += 3;
+    return t;
+}
+
+/**
+ * Monotonic pseudo angle of the vector in [0, 1)
+ */
+static inline double SFDelaunayPseudoAngle(double dx, double dy){
+    double p = dx / (fabs(dx) + fabs(dy));
+    return (dy > 0.0 ? 3.0 - p : 1.0 + p) / 4.0;
+}
+
+static inline int SFDelaunayHashKey(const SFDelaunayMesh *delaunay, double x, double y){
+    return (int)floor(SFDelaunayPseudoAngle(x - delaunay->cx, y - delaunay->cy) * delaunay->hashSize) % delaunay->hashSize;
+}
+
+static double SFDelaunayCircumradius(double ax, double ay, double bx, double by, double cx, double cy){
+    double dx = bx - ax;
+    double dy = by - ay;
+    double ex = cx - ax;
+    double ey = cy - ay;
+    double bl = dx * dx + dy * dy;
+    double cl = ex * ex + ey * ey;
+    double d = 0.5 / (dx * ey - dy * ex);
+    double x = (ey * bl - dy * cl) * d;
+    double y = (dx * cl - ex * bl) * d;
+    return x * x + y * y;
+}
+
+static void SFDelaunayCircumcenter(double ax, double ay, double bx, double by, double cx, double cy, double *x, double *y){
+    double dx = bx - ax;
+    double dy = by - ay;
+    double ex = cx - ax;
+    double ey = cy - ay;
+    double bl = dx * dx + dy * dy;
+    double cl = ex * ex + ey * ey;
+    double d = 0.5 / (dx * ey - dy * ex);
+    *x = ax + (ey * bl - dy * cl) * d;
+    *y = ay + (dx * cl - ex * bl) * d;
+}
+
+static inline void SFDelaunaySwap(int *ids, int i, int j){
+    int temp = ids[i];
+    ids[i] = ids[j];
+    ids[j] = temp;
+}
+
+/**
+ * Sort the point ids by their distances
+ */
+static void SFDelaunaySort(int *ids, const double *dists, int left, int right){
+    while(right - left > 20){
+        int median = (left + right) >> 1;
+        int i = left + 1;
+        int j = right;
+        SFDelaunaySwap(ids, median, i);
+        if(dists[ids[left]] > dists[ids[right]]){
+            SFDelaunaySwap(ids, left, right);
+        }
+        if(dists[ids[i]] > dists[ids[right]]){
+            SFDelaunaySwap(ids, i, right);
+        }
+        if(dists[ids[left]] > dists[ids[i]]){
+            SFDelaunaySwap(ids, left, i);
+        }
+        int temp = ids[i];
+        double tempDist = dists[temp];
+        while(YES){
+            do{
+                i++;
+            }while(dists[ids[i]] < tempDist);
+            do{
+                j--;
+            }while(dists[ids[j]] > tempDist);
+            if(j < i){
+                break;
+            }
+            SFDelaunaySwap(ids, i, j);
+        }
+        ids[left + 1] = ids[j];
+        ids[j] = temp;
+        // Recurse into the smaller partition and loop on the larger
+        if(right - i + 1 >= j - left){
+            SFDelaunaySort(ids, dists, left, j - 1);
+            left = i;
+        }else{
+            SFDelaunaySort(ids, dists, i, right);
+            right = j - 1;
+        }
+    }
+    for(int i = left + 1; i <= right; i++){
+        int temp = ids[i];
+        double tempDist = dists[temp];
+        int j = i - 1;
+        while(j >= left && dists[ids[j]] > tempDist){
+            ids[j + 1] = ids[j];
+            j--;
+        }
+        ids[j + 1] = temp;
+    }
+}
+
+/**
+ * Flip the triangle edges from the half edge until all satisfy the
+ * Delaunay condition
+ *
+ * @return half edge of the new triangle opposite the hull
+ */
+static int SFDelaunayLegalize(SFDelaunayMesh *delaunay, int a){
+    const double *coordinates = delaunay->coordinates;
+    int *triangles = delaunay->triangles;
+    int *halfedges = delaunay->halfedges;
+    int stack[SF_DELAUNAY_EDGE_STACK_SIZE];
+    int i = 0;
+    int ar = 0;
+    
+    while(YES){
+        int b = halfedges[a];
+        int a0 = a - a % 3;
+        ar = a0 + (a + 2) % 3;
+        
+        if(b == -1){
+            if(i == 0){
+                break;
+            }
+            a = stack[--i];
+            continue;
+        }
+        
+        int b0 = b - b % 3;
+        int al = a0 + (a + 1) % 3;
+        int bl = b0 + (b + 2) % 3;
+        
+        int p0 = triangles[ar];
+        int pr = triangles[a];
+        int pl = triangles[al];
+        int p1 = triangles[bl];
+        
+        // Triangles are clockwise during construction, p1 is inside the
+        // circle of p0, pr, and pl when the determinant is negative
+        BOOL illegal = SFDelaunayInCircle(coordinates[2 * p0], coordinates[2 * p0 + 1],
+                                          coordinates[2 * pr], coordinates[2 * pr + 1],
+                                          coordinates[2 * pl], coordinates[2 * pl + 1],
+                                          coordinates[2 * p1], coordinates[2 * p1 + 1]) < 0.0;
+        
+        if(illegal){
+            triangles[a] = p1;
+            triangles[b] = p0;
+            
+            int hbl = halfedges[bl];
+            
+            // Edge swapped on the other side of the hull, fix the hull reference
+            if(hbl == -1){
+                int e = delaunay->hullStart;
+                do{
+                    if(delaunay->hullTri[e] == bl){
+                        delaunay->hullTri[e] = a;
+                        break;
+                    }
+                    e = delaunay->hullPrev[e];
+                }while(e != delaunay->hullStart);
+            }
+            SFDelaunayLink(delaunay, a, hbl);
+            SFDelaunayLink(delaunay, b, halfedges[ar]);
+            SFDelaunayLink(delaunay, ar, bl);
+            
+            int br = b0 + (b + 1) % 3;
+            if(i < SF_DELAUNAY_EDGE_STACK_SIZE){
+                stack[i++] = br;
+            }
+        }else{
+            if(i == 0){
+                break;
+            }
+            a = stack[--i];
+        }
+    }
+    
+    return ar;
+}
+
+/**
+ * Triangulate the coordinates with a sweep hull, adding points in order of
+ * distance from a seed triangle center and legalizing new triangles
+ *
+ * @param delaunay
+ *            delaunay with coordinates and count set
+ */
+static void SFDelaunayTriangulate(SFDelaunayMesh *delaunay){
+    
+    const double *coordinates = delaunay->coordinates;
+    int n = delaunay->count;
+    int maxTriangles = MAX(2 * n - 5, 0);
+    delaunay->triangles = malloc(sizeof(int) * MAX(maxTriangles * 3, 1));
+    delaunay->halfedges = malloc(sizeof(int) * MAX(maxTriangles * 3, 1));
+    delaunay->trianglesLength = 0;
+    if(n < 3){
+        return;
+    }
+    
+    delaunay->hashSize = (int)ceil(sqrt(n));
+    delaunay->hullPrev = malloc(sizeof(int) * n);
+    delaunay->hullNext = malloc(sizeof(int) * n);
+    delaunay->hullTri = malloc(sizeof(int) * n);
+    delaunay->hullHash = malloc(sizeof(int) * delaunay->hashSize);
+    int *ids = malloc(sizeof(int) * n);
+    double *dists = malloc(sizeof(double) * n);
+    
+    double minX = DBL_MAX;
+    double minY = DBL_MAX;
+    double maxX = -DBL_MAX;
+    double maxY = -DBL_MAX;
+    for(int i = 0; i < n; i++){
+        double x = coordinates[2 * i];
+        double y = coordinates[2 * i + 1];
+        minX = MIN(minX, x);
+        minY = MIN(minY, y);
+        maxX = MAX(maxX, x);
+        maxY = MAX(maxY, y);
+        ids[i] = i;
+    }
+    double centerX = (minX + maxX) / 2.0;
+    double centerY = (minY + maxY) / 2.0;
+    
+    // Seed point closest to the center
+    int i0 = 0;
+    double minDist = DBL_MAX;
+    for(int i = 0; i < n; i++){
+        double dx = centerX - coordinates[2 * i];
+        double dy = centerY - coordinates[2 * i + 1];
+        double d = dx * dx + dy * dy;
+        if(d < minDist){
+            i0 = i;
+            minDist = d;
+        }
+    }
+    double i0x = coordinates[2 * i0];
+    double i0y = coordinates[2 * i0 + 1];
+    
+    // Point closest to the seed
+    int i1 = 0;
+    minDist = DBL_MAX;
+    for(int i = 0; i < n; i++){
+        if(i == i0){
+            continue;
+        }
+        double dx = i0x - coordinates[2 * i];
+        double dy = i0y - coordinates[2 * i + 1];
+        double d = dx * dx + dy * dy;
+        if(d < minDist && d > 0.0){
+            i1 = i;
+            minDist = d;
+        }
+    }
+    double i1x = coordinates[2 * i1];
+    double i1y = coordinates[2 * i1 + 1];
+    
+    // Third point forming the smallest circumcircle with the first two
+    int i2 = 0;
+    double minRadius = DBL_MAX;
+    for(int i = 0; i < n; i++){
+        if(i == i0 || i == i1){
+            continue;
+        }
+        double r = SFDelaunayCircumradius(i0x, i0y, i1x, i1y, coordinates[2 * i], coordinates[2 * i + 1]);
+        if(r < minRadius){
+            i2 = i;
+            minRadius = r;
+        }
+    }
+    
+    if(minRadius != DBL_MAX && SFDelaunayOrient(i0x, i0y, i1x, i1y, coordinates[2 * i2], coordinates[2 * i2 + 1]) != 0.0){
+        
+        double i2x = coordinates[2 * i2];
+        double i2y = coordinates[2 * i2 + 1];
+        
+        // Clockwise seed triangle during construction
+        if(SFDelaunayOrient(i0x, i0y, i1x, i1y, i2x, i2y) > 0.0){
+            int i = i1;
+            double x = i1x;
+            double y = i1y;
+            i1 = i2;
+            i1x = i2x;
+            i1y = i2y;
+            i2 = i;
+            i2x = x;
+            i2y = y;
+        }
+        
+        SFDelaunayCircumcenter(i0x, i0y, i1x, i1y, i2x, i2y, &delaunay->cx, &delaunay->cy);
+        
+        for(int i = 0; i < n; i++){
+            double dx = coordinates[2 * i] - delaunay->cx;
+            double dy = coordinates[2 * i + 1] - delaunay->cy;
+            dists[i] = dx * dx + dy * dy;
+        }
+        
+        // Sort the points by distance from the seed triangle circumcenter
+        SFDelaunaySort(ids, dists, 0, n - 1);
+        
+        int *hullPrev = delaunay->hullPrev;
+        int *hullNext = delaunay->hullNext;
+        int *hullTri = delaunay->hullTri;
+        int *hullHash = delaunay->hullHash;
+        
+        delaunay->hullStart = i0;
+        
+        hullNext[i0] = hullPrev[i2] = i1;
+        hullNext[i1] = hullPrev[i0] = i2;
+        hullNext[i2] = hullPrev[i1] = i0;
+        
+        hullTri[i0] = 0;
+        hullTri[i1] = 1;
+        hullTri[i2] = 2;
+        
+        for(int i = 0; i < delaunay->hashSize; i++){
+            hullHash[i] = -1;
+        }
+        hullHash[SFDelaunayHashKey(delaunay, i0x, i0y)] = i0;
+        hullHash[SFDelaunayHashKey(delaunay, i1x, i1y)] = i1;
+        hullHash[SFDelaunayHashKey(delaunay, i2x, i2y)] = i2;
+        
+        SFDelaunayAddTriangle(delaunay, i0, i1, i2, -1, -1, -1);
+        
+        double xp = 0.0;
+        double yp = 0.0;
+        for(int k = 0; k < n; k++){
+            int i = ids[k];
+            double x = coordinates[2 * i];
+            double y = coordinates[2 * i + 1];
+            
+            // Skip near duplicate points
+            if(k > 0 && fabs(x - xp) <= SF_DELAUNAY_DUPLICATE_EPSILON && fabs(y - yp) <= SF_DELAUNAY_DUPLICATE_EPSILON){
+                continue;
+            }
+            xp = x;
+            yp = y;
+            
+            // Skip seed triangle points
+            if(i == i0 || i == i1 || i == i2){
+                continue;
+            }
+            
+            // Find a visible edge on the convex hull using the edge hash
+            int start = 0;
+            int key = SFDelaunayHashKey(delaunay, x, y);
+            for(int j = 0; j < delaunay->hashSize; j++){
+                start = hullHash[(key + j) % delaunay->hashSize];
+                if(start != -1 && start != hullNext[start]){
+                    break;
+                }
+            }
+            
+            start = hullPrev[start];
+            int e = start;
+            int q = hullNext[e];
+            while(SFDelaunayOrient(x, y, coordinates[2 * e], coordinates[2 * e + 1], coordinates[2 * q], coordinates[2 * q + 1]) <= 0.0){
+                e = q;
+                if(e == start){
+                    e = -1;
+                    break;
+                }
+                q = hullNext[e];
+            }
+            if(e == -1){
+                // Likely a near duplicate point
+                continue;
+            }
+            
+            // Add the first triangle from the point
+            int t = SFDelaunayAddTriangle(delaunay, e, i, hullNext[e], -1, -1, hullTri[e]);
+            
+            // Recursively flip triangles from the point until they satisfy the Delaunay condition
+            hullTri[i] = SFDelaunayLegalize(delaunay, t + 2);
+            hullTri[e] = t;
+            
+            // Walk forward through the hull, adding more triangles and flipping recursively
+            int next = hullNext[e];
+            q = hullNext[next];
+            while(SFDelaunayOrient(x, y, coordinates[2 * next], coordinates[2 * next + 1], coordinates[2 * q], coordinates[2 * q + 1]) > 0.0){
+                t = SFDelaunayAddTriangle(delaunay, next, i, q, hullTri[i], -1, hullTri[next]);
+                hullTri[i] = SFDelaunayLegalize(delaunay, t + 2);
+                hullNext[next] = next;
+                next = q;
+                q = hullNext[next];
+            }
+            
+            // Walk backward from the other side, adding more triangles and flipping
+            if(e == start){
+                q = hullPrev[e];
+                while(SFDelaunayOrient(x, y, coordinates[2 * q], coordinates[2 * q + 1], coordinates[2 * e], coordinates[2 * e + 1]) > 0.0){
+                    t = SFDelaunayAddTriangle(delaunay, q, i, e, -1, hullTri[e], hullTri[q]);
+                    SFDelaunayLegalize(delaunay, t + 2);
+                    hullTri[q] = t;
+                    hullNext[e] = e;
+                    e = q;
+                    q = hullPrev[e];
+                }
+            }
+            
+            // Update the hull indices
+            delaunay->hullStart = hullPrev[i] = e;
+            hullNext[e] = hullPrev[next] = i;
+            hullNext[i] = next;
+            
+            // Save the two new edges in the hash table
+            hullHash[SFDelaunayHashKey(delaunay, x, y)] = i;
+            hullHash[SFDelaunayHashKey(delaunay, coordinates[2 * e], coordinates[2 * e + 1])] = e;
+        }
+        
+        // Reverse the triangles to counter clockwise, swapping the first two
+        // vertices moves the second and third half edges
+        int *triangles = delaunay->triangles;
+        int *halfedges = delaunay->halfedges;
+        for(int t = 0; t < delaunay->trianglesLength; t += 3){
+            int vertex = triangles[t];
+            triangles[t] = triangles[t + 1];
+            triangles[t + 1] = vertex;
+            int h0 = halfedges[t];
+            int h1 = halfedges[t + 1];
+            int h2 = halfedges[t + 2];
+            halfedges[t] = h0 < 0 || h0 % 3 == 0 ? h0 : (h0 % 3 == 1 ? h0 + 1 : h0 - 1);
+            halfedges[t + 1] = h2 < 0 || h2 % 3 == 0 ? h2 : (h2 % 3 == 1 ? h2 + 1 : h2 - 1);
+            halfedges[t + 2] = h1 < 0 || h1 % 3 == 0 ? h1 : (h1 % 3 == 1 ? h1 + 1 : h1 - 1);
+        }
+    }
+    
+    free(dists);
+    free(ids);
+    free(delaunay->hullHash);
+    free(delaunay->hullTri);
+    free(delaunay->hullNext);
+    free(delaunay->hullPrev);
+    delaunay->hullHash = NULL;
+    delaunay->hullTri = NULL;
+    delaunay->hullNext = NULL;
+    delaunay->hullPrev = NULL;
+}
+
+/**
+ * Growable list of edges as vertex index pairs
+ */
+typedef struct SFDelaunayEdges{
+    int *vertices;
+    int head;
+    int count;
+    int capacity;
+} SFDelaunayEdges;
+
+static void SFDelaunayEdgesAdd(SFDelaunayEdges *edges, int u, int v){
+    if(edges->head > 0 && edges->head >= edges->count / 2){
+        memmove(edges->vertices, edges->vertices + 2 * edges->head, sizeof(int) * 2 * (edges->count - edges->head));
+        edges->count -= edges->head;
+        edges->head = 0;
+    }
+    if(edges->count == edges->capacity){
+        edges->capacity = MAX(16, edges->capacity * 2);
+        edges->vertices = realloc(edges->vertices, sizeof(int) * 2 * edges->capacity);
+    }
+    edges->vertices[2 * edges->count] = u;
+    edges->vertices[2 * edges->count + 1] = v;
+    edges->count++;
+}
+
+/**
+ * Delaunay triangulation state for inserting constraint edges
+ */
+typedef struct SFDelaunayConstraints{
+    SFDelaunayMesh *delaunay;
+    int *vertexEdges;
+    unsigned char *constrained;
+    SFDelaunayEdges crossing;
+    SFDelaunayEdges created;
+} SFDelaunayConstraints;
+
+/**
+ * Find a half edge between the two vertices by rotating around the first
+ *
+ * @return half edge in either direction, or -1 when not an edge
+ */
+static int SFDelaunayFindEdge(SFDelaunayConstraints *constraints, int u, int v){
+    const int *triangles = constraints->delaunay->triangles;
+    const int *halfedges = constraints->delaunay->halfedges;
+    int start = constraints->vertexEdges[u];
+    int e = start;
+    while(YES){
+        if(triangles[SFDelaunayNextHalfedge(e)] == v){
+            return e;
+        }
+        int prev = SFDelaunayPrevHalfedge(e);
+        if(triangles[prev] == v){
+            return prev;
+        }
+        e = halfedges[prev];
+        if(e == -1 || e == start){
+            break;
+        }
+    }
+    if(e == -1){
+        // Reached the hull, rotate the other way from the start
+        e = start;
+        while(halfedges[e] != -1){
+            e = SFDelaunayNextHalfedge(halfedges[e]);
+            if(e == start){
+                break;
+            }
+            if(triangles[SFDelaunayNextHalfedge(e)] == v){
+                return e;
+            }
+            int prev = SFDelaunayPrevHalfedge(e);
+            if(triangles[prev] == v){
+                return prev;
+            }
+        }
+    }
+    return -1;
+}
+
+/**
+ * Flip the edge shared by two triangles, keeping vertex edges and
+ * constraint flags current
+ *
+ * @return half edge of the new diagonal
+ */
+static int SFDelaunayFlip(SFDelaunayConstraints *constraints, int a){
+    int *triangles = constraints->delaunay->triangles;
+    int *halfedges = constraints->delaunay->halfedges;
+    unsigned char *constrained = constraints->constrained;
+    
+    int b = halfedges[a];
+    int a0 = a - a % 3;
+    int b0 = b - b % 3;
+    int al = a0 + (a + 1) % 3;
+    int ar = a0 + (a + 2) % 3;
+    int bl = b0 + (b + 2) % 3;
+    int br = b0 + (b + 1) % 3;
+    
+    int p0 = triangles[ar];
+    int pr = triangles[a];
+    int pl = triangles[al];
+    int p1 = triangles[bl];
+    
+    triangles[a] = p1;
+    triangles[b] = p0;
+    
+    constrained[a] = constrained[bl];
+    constrained[b] = constrained[ar];
+    constrained[ar] = 0;
+    constrained[bl] = 0;
+    
+    SFDelaunayLink(constraints->delaunay, a, halfedges[bl]);
+    SFDelaunayLink(constraints->delaunay, b, halfedges[ar]);
+    SFDelaunayLink(constraints->delaunay, ar, bl);
+    
+    constraints->vertexEdges[p0] = ar;
+    constraints->vertexEdges[p1] = bl;
+    constraints->vertexEdges[pr] = br;
+    constraints->vertexEdges[pl] = al;
+    
+    return ar;
+}
+
+static inline void SFDelaunayConstrainEdge(SFDelaunayConstraints *constraints, int e){
+    constraints->constrained[e] = 1;
+    int twin = constraints->delaunay->halfedges[e];
+    if(twin != -1){
+        constraints->constrained[twin] = 1;
+    }
+}
+
+/**
+ * Check if the segments properly intersect, crossing at a single interior point
+ */
+static BOOL SFDelaunayCrosses(const double *coordinates, int p, int q, int u, int v){
+    if(u == p || u == q || v == p || v == q){
+        return NO;
+    }
+    double px = coordinates[2 * p];
+    double py = coordinates[2 * p + 1];
+    double qx = coordinates[2 * q];
+    double qy = coordinates[2 * q + 1];
+    double ux = coordinates[2 * u];
+    double uy = coordinates[2 * u + 1];
+    double vx = coordinates[2 * v];
+    double vy = coordinates[2 * v + 1];
+    double u1 = SFDelaunayOrient(px, py, qx, qy, ux, uy);
+    double v1 = SFDelaunayOrient(px, py, qx, qy, vx, vy);
+    if(!((u1 > 0.0 && v1 < 0.0) || (u1 < 0.0 && v1 > 0.0))){
+        return NO;
+    }
+    double p2 = SFDelaunayOrient(ux, uy, vx, vy, px, py);
+    double q2 = SFDelaunayOrient(ux, uy, vx, vy, qx, qy);
+    return (p2 > 0.0 && q2 < 0.0) || (p2 < 0.0 && q2 > 0.0);
+}
+
+/**
+ * Insert the constraint edge between two vertices, flipping the crossing
+ * edges until the edge exists and then restoring the Delaunay condition
+ * around the new edges. Vertices lying on the constraint split it.
+ *
+ * @return true if inserted, false if crossing another constraint
+ */
+static BOOL SFDelaunayConstrain(SFDelaunayConstraints *constraints, int p, int q){
+    
+    SFDelaunayMesh *delaunay = constraints->delaunay;
+    const double *coordinates = delaunay->coordinates;
+    const int *triangles = delaunay->triangles;
+    const int *halfedges = delaunay->halfedges;
+    double qx = coordinates[2 * q];
+    double qy = coordinates[2 * q + 1];
+    
+    while(p != q){
+        
+        double px = coordinates[2 * p];
+        double py = coordinates[2 * p + 1];
+        
+        // Rotate around the start vertex for the edge to, or the triangle toward, the end vertex
+        int crossing = -1;
+        int next = -1;
+        int start = constraints->vertexEdges[p];
+        int e = start;
+        BOOL clockwise = NO;
+        while(YES){
+            int a = triangles[SFDelaunayNextHalfedge(e)];
+            int c = triangles[SFDelaunayPrevHalfedge(e)];
+            double ax = coordinates[2 * a];
+            double ay = coordinates[2 * a + 1];
+            double sideA = SFDelaunayOrient(px, py, qx, qy, ax, ay);
+            if(a == q || (sideA == 0.0 && (ax - px) * (qx - px) + (ay - py) * (qy - py) > 0.0)){
+                SFDelaunayConstrainEdge(constraints, e);
+                next = a;
+                break;
+            }
+            double cx = coordinates[2 * c];
+            double cy = coordinates[2 * c + 1];
+            double sideC = SFDelaunayOrient(px, py, qx, qy, cx, cy);
+            if(c == q || (sideC == 0.0 && (cx - px) * (qx - px) + (cy - py) * (qy - py) > 0.0)){
+                SFDelaunayConstrainEdge(constraints, SFDelaunayPrevHalfedge(e));
+                next = c;
+                break;
+            }
+            if(sideA < 0.0 && sideC > 0.0){
+                crossing = SFDelaunayNextHalfedge(e);
+                break;
+            }
+            if(clockwise){
+                int twin = halfedges[e];
+                e = twin == -1 ? -1 : SFDelaunayNextHalfedge(twin);
+            }else{
+                e = halfedges[SFDelaunayPrevHalfedge(e)];
+                if(e == -1){
+                    // Reached the hull, rotate the other way from the start
+                    clockwise = YES;
+                    int twin = halfedges[start];
+                    e = twin == -1 ? -1 : SFDelaunayNextHalfedge(twin);
+                }
+            }
+            if(e == -1 || e == start){
+                break;
+            }
+        }
+        
+        if(next != -1){
+            p = next;
+            continue;
+        }
+        if(crossing == -1){
+            return NO;
+        }
+        
+        // Collect the edges crossed by the constraint up to the end or a vertex on the constraint
+        constraints->crossing.head = 0;
+        constraints->crossing.count = 0;
+        int target = -1;
+        e = crossing;
+        while(target == -1){
+            int twin = halfedges[e];
+            if(twin == -1 || constraints->constrained[e]){
+                return NO;
+            }
+            SFDelaunayEdgesAdd(&constraints->crossing, triangles[e], triangles[SFDelaunayNextHalfedge(e)]);
+            int u = triangles[twin];
+            int v = triangles[SFDelaunayPrevHalfedge(twin)];
+            double sideV = SFDelaunayOrient(px, py, qx, qy, coordinates[2 * v], coordinates[2 * v + 1]);
+            if(v == q || sideV == 0.0){
+                target = v;
+            }else{
+                double sideU = SFDelaunayOrient(px, py, qx, qy, coordinates[2 * u], coordinates[2 * u + 1]);
+                if((sideU < 0.0) == (sideV > 0.0)){
+                    e = SFDelaunayPrevHalfedge(twin);
+                }else{
+                    e = SFDelaunayNextHalfedge(twin);
+                }
+            }
+        }
+        
+        // Flip crossing edges of convex quadrilaterals until none cross the constraint
+        constraints->created.head = 0;
+        constraints->created.count = 0;
+        SFDelaunayEdges *queue = &constraints->crossing;
+        while(queue->head < queue->count){
+            int u = queue->vertices[2 * queue->head];
+            int v = queue->vertices[2 * queue->head + 1];
+            queue->head++;
+            int edge = SFDelaunayFindEdge(constraints, u, v);
+            int twin = halfedges[edge];
+            int p0 = triangles[SFDelaunayPrevHalfedge(edge)];
+            int p1 = triangles[SFDelaunayPrevHalfedge(twin)];
+            double p0x = coordinates[2 * p0];
+            double p0y = coordinates[2 * p0 + 1];
+            double p1x = coordinates[2 * p1];
+            double p1y = coordinates[2 * p1 + 1];
+            int pr = triangles[edge];
+            int pl = triangles[SFDelaunayNextHalfedge(edge)];
+            if(SFDelaunayOrient(p0x, p0y, p1x, p1y, coordinates[2 * pl], coordinates[2 * pl + 1]) > 0.0
+               && SFDelaunayOrient(p0x, p0y, p1x, p1y, coordinates[2 * pr], coordinates[2 * pr + 1]) < 0.0){
+                SFDelaunayFlip(constraints, edge);
+                if(SFDelaunayCrosses(coordinates, p, target, p0, p1)){
+                    SFDelaunayEdgesAdd(queue, p0, p1);
+                }else{
+                    SFDelaunayEdgesAdd(&constraints->created, p0, p1);
+                }
+            }else{
+                SFDelaunayEdgesAdd(queue, u, v);
+            }
+        }
+        
+        SFDelaunayConstrainEdge(constraints, SFDelaunayFindEdge(constraints, p, target));
+        
+        // Restore the Delaunay condition of the new unconstrained edges
+        SFDelaunayEdges *created = &constraints->created;
+        BOOL flipped = YES;
+        while(flipped){
+            flipped = NO;
+            for(int i = 0; i < created->count; i++){
+                int u = created->vertices[2 * i];
+                int v = created->vertices[2 * i + 1];
+                int edge = SFDelaunayFindEdge(constraints, u, v);
+                if(edge == -1 || constraints->constrained[edge] || halfedges[edge] == -1){
+                    continue;
+                }
+                int pr = triangles[edge];
+                int pl = triangles[SFDelaunayNextHalfedge(edge)];
+                int p0 = triangles[SFDelaunayPrevHalfedge(edge)];
+                int p1 = triangles[SFDelaunayPrevHalfedge(halfedges[edge])];
+                if(SFDelaunayInCircle(coordinates[2 * pr], coordinates[2 * pr + 1],
+                                      coordinates[2 * pl], coordinates[2 * pl + 1],
+                                      coordinates[2 * p0], coordinates[2 * p0 + 1],
+                                      coordinates[2 * p1], coordinates[2 * p1 + 1]) > 0.0){
+                    SFDelaunayFlip(constraints, edge);
+                    created->vertices[2 * i] = p0;
+                    created->vertices[2 * i + 1] = p1;
+                    flipped = YES;
+                }
+            }
+        }
+        
+        p = target;
+    }
+    
+    return YES;
+}
+
+/**
+ * Point coordinate with its vertex index, for sorting duplicates together
+ */
+typedef struct SFDelaunayVertex{
+    double x;
+    double y;
+    int index;
+} SFDelaunayVertex;
+
+static int SFDelaunayCompareVertices(const void *a, const void *b){
+    const SFDelaunayVertex *vertex1 = a;
+    const SFDelaunayVertex *vertex2 = b;
+    int compare = vertex1->x < vertex2->x ? -1 : (vertex1->x > vertex2->x ? 1 : 0);
+    if(compare == 0){
+        compare = vertex1->y < vertex2->y ? -1 : (vertex1->y > vertex2->y ? 1 : 0);
+    }
+    return compare;
+}
+
+/**
+ * Insert constraint edges into the triangulation
+ *
+ * @param delaunay
+ *            triangulated delaunay
+ * @param edges
+ *            constraint edge vertex index pairs
+ * @param edgeCount
+ *            number of constraint edges
+ * @return number of constraint edges not inserted due to crossing constraints
+ */
+static int SFDelaunayConstrainEdges(SFDelaunayMesh *delaunay, const int *edges, int edgeCount){
+    
+    int n = delaunay->count;
+    if(delaunay->trianglesLength == 0 || edgeCount == 0){
+        return 0;
+    }
+    
+    SFDelaunayConstraints constraints;
+    memset(&constraints, 0, sizeof(SFDelaunayConstraints));
+    constraints.delaunay = delaunay;
+    constraints.vertexEdges = malloc(sizeof(int) * n);
+    constraints.constrained = calloc(delaunay->trianglesLength, sizeof(unsigned char));
+    for(int i = 0; i < n; i++){
+        constraints.vertexEdges[i] = -1;
+    }
+    for(int e = 0; e < delaunay->trianglesLength; e++){
+        constraints.vertexEdges[delaunay->triangles[e]] = e;
+    }
+    
+    // Map skipped duplicate points to the triangulated point at the same location
+    int *vertices = malloc(sizeof(int) * n);
+    SFDelaunayVertex *sorted = malloc(sizeof(SFDelaunayVertex) * n);
+    for(int i = 0; i < n; i++){
+        vertices[i] = i;
+        sorted[i].x = delaunay->coordinates[2 * i];
+        sorted[i].y = delaunay->coordinates[2 * i + 1];
+        sorted[i].index = i;
+    }
+    qsort(sorted, n, sizeof(SFDelaunayVertex), SFDelaunayCompareVertices);
+    for(int i = 0; i < n;){
+        int j = i;
+        int vertex = -1;
+        while(j < n && sorted[j].x == sorted[i].x && sorted[j].y == sorted[i].y){
+            if(vertex == -1 && constraints.vertexEdges[sorted[j].index] != -1){
+                vertex = sorted[j].index;
+            }
+            j++;
+        }
+        if(vertex != -1){
+            for(int k = i; k < j; k++){
+                vertices[sorted[k].index] = vertex;
+            }
+        }
+        i = j;
+    }
+    free(sorted);
+    
+    int failed = 0;
+    for(int i = 0; i < edgeCount; i++){
+        int p = vertices[edges[2 * i]];
+        int q = vertices[edges[2 * i + 1]];
+        if(p != q && constraints.vertexEdges[p] != -1 && constraints.vertexEdges[q] != -1
+           && !SFDelaunayConstrain(&constraints, p, q)){
+            failed++;
+        }
+    }
+    
+    free(vertices);
+    free(constraints.crossing.vertices);
+    free(constraints.created.vertices);
+    free(constraints.constrained);
+    free(constraints.vertexEdges);
+    
+    return failed;
+}
+
+/**
+ * Triangulate the vertices, inserting constraint edges when provided
+ *
+ * @param delaunay
+ *            delaunay to populate, caller is responsible for freeing the triangles and half edges
+ * @param vertices
+ *            interleaved x and y vertex values
+ * @param count
+ *            number of vertices
+ * @param edges
+ *            constraint edge vertex index pairs
+ * @param edgeCount
+ *            number of constraint edges
+ * @return number of constraint edges not inserted due to crossing constraints
+ */
+static int SFDelaunayTriangulateVertices(SFDelaunayMesh *delaunay, const double *vertices, int count, const int *edges, int edgeCount){
+    memset(delaunay, 0, sizeof(SFDelaunayMesh));
+    delaunay->coordinates = vertices;
+    delaunay->count = count;
+    SFDelaunayTriangulate(delaunay);
+    return SFDelaunayConstrainEdges(delaunay, edges, edgeCount);
+}
+
+@implementation SFDelaunay
+
++(SFTIN *) triangulateMultiPoint: (SFMultiPoint *) multiPoint{
+    return [self triangulateMultiPoint:multiPoint withBreaklines:nil];
+}
+
++(SFTIN *) triangulateMultiPoint: (SFMultiPoint *) multiPoint withBreaklines: (NSArray<SFLineString *> *) breaklines{
+    return [self triangulateMultiPoint:multiPoint withBreaklines:breaklines andFailedEdges:NULL];
+}
+
++(SFTIN *) triangulateMultiPoint: (SFMultiPoint *) multiPoint withBreaklines: (NSArray<SFLineString *> *) breaklines andFailedEdges: (int *) failedEdges{
+    
+    NSMutableArray<SFPoint *> *points = [[NSMutableArray alloc] initWithArray:[multiPoint points]];
+    int edgeCount = 0;
+    for(SFLineString *breakline in breaklines){
+        edgeCount += MAX([breakline numPoints] - 1, 0);
+    }
+    int *edges = malloc(sizeof(int) * 2 * MAX(edgeCount, 1));
+    edgeCount = 0;
+    for(SFLineString *breakline in breaklines){
+        NSArray<SFPoint *> *breaklinePoints = breakline.points;
+        for(int i = 0; i < breaklinePoints.count; i++){
+            if(i > 0){
+                edges[2 * edgeCount] = (int)points.count - 1;
+                edges[2 * edgeCount + 1] = (int)points.count;
+                edgeCount++;
+            }
+            [points addObject:[breaklinePoints objectAtIndex:i]];
+        }
+    }
+    
+    int count = (int)points.count;
+    double *vertices = malloc(sizeof(double) * 2 * MAX(count, 1));
+    int i = 0;
+    for(SFPoint *point in points){
+        vertices[i++] = [point.x doubleValue];
+        vertices[i++] = [point.y doubleValue];
+    }
+    
+    SFDelaunayMesh delaunay;
+    int failed = SFDelaunayTriangulateVertices(&delaunay, vertices, count, edges, edgeCount);
+    if(failedEdges != NULL){
+        *failedEdges = failed;
+    }
+    
+    SFTIN *tin = [[SFTIN alloc] initWithHasZ:multiPoint.hasZ andHasM:multiPoint.hasM];
+    const int *triangles = delaunay.triangles;
+    for(int t = 0; t < delaunay.trianglesLength; t += 3){
+        SFLineString *ring = [[SFLineString alloc] initWithHasZ:multiPoint.hasZ andHasM:multiPoint.hasM];
+        [ring addPoint:[[points objectAtIndex:triangles[t]] mutableCopy]];
+        [ring addPoint:[[points objectAtIndex:triangles[t + 1]] mutableCopy]];
+        [ring addPoint:[[points objectAtIndex:triangles[t + 2]] mutableCopy]];
+        [ring addPoint:[[points objectAtIndex:triangles[t]] mutableCopy]];
+        SFTriangle *triangle = [[SFTriangle alloc] initWithHasZ:multiPoint.hasZ andHasM:multiPoint.hasM];
+        [triangle addRing:ring];
+        [tin addPolygon:triangle];
+    }
+    
+    free(delaunay.halfedges);
+    free(delaunay.triangles);
+    free(vertices);
+    free(edges);
+    
+    return tin;
+}
+
++(NSData *) triangleIndicesOfVertices: (const double *) vertices withCount: (int) count{
+    return [self triangleIndicesOfVertices:vertices withCount:count andEdges:NULL andEdgeCount:0];
+}
+
++(NSData *) triangleIndicesOfVertices: (const double *) vertices withCount: (int) count andEdges: (const int *) edges andEdgeCount: (int) edgeCount{
+    return [self triangleIndicesOfVertices:vertices withCount:count andEdges:edges andEdgeCount:edgeCount andFailedEdges:NULL];
+}
+
++(NSData *) triangleIndicesOfVertices: (const double *) vertices withCount: (int) count andEdges: (const int *) edges andEdgeCount: (int) edgeCount andFailedEdges: (int *) failedEdges{
+    SFDelaunayMesh delaunay;
+    int failed = SFDelaunayTriangulateVertices(&delaunay, vertices, count, edges, edgeCount);
+    if(failedEdges != NULL){
+        *failedEdges = failed;
+    }
+    free(delaunay.halfedges);
+    return [NSData dataWithBytesNoCopy:delaunay.triangles length:sizeof(int) * delaunay.trianglesLength freeWhenDone:YES];
+}
+
+@end
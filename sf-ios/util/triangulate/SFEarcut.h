@@ -0,0 +1,101 @@
+//
+//  SFEarcut.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFPolygon.h"
+#import "SFTIN.h"
+
+/**
+ * Ear clipping polygon triangulation with holes. Holes are bridged into the
+ * exterior ring and ears are found with a z-order curve hash of the
+ * vertices for polygons with more than 80 vertices, keeping large polygons
+ * near linear instead of quadratic.
+ *
+ * Triangles are counter clockwise. Triangle vertex indices refer to the
+ * polygon vertices in ring order, exterior ring first, without repeating
+ * the closing point of each ring.
+ *
+ * Based upon the JavaScript implementation:
+ * https://github.com/mapbox/earcut
+ *
+ * JavaScript implementation license:
+ *
+ * ISC License
+ *
+ * Copyright (c) 2016, Mapbox
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE
+ * OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+@interface SFEarcut : NSObject
+
+/**
+ * Triangulate the polygon into a triangulated irregular network. Triangle
+ * points are copies of the polygon points, retaining z and m values.
+ *
+ * @param polygon
+ *            polygon
+ * @return TIN of triangles
+ */
++(SFTIN *) triangulatePolygon: (SFPolygon *) polygon;
+
+/**
+ * Triangulate the polygon, triangle, or multi polygon into a triangulated
+ * irregular network
+ *
+ * @param geometry
+ *            polygon, triangle, or multi polygon
+ * @return TIN of triangles
+ */
++(SFTIN *) triangulateGeometry: (SFGeometry *) geometry;
+
+/**
+ * Get the flat vertices of the polygon as interleaved x and y double
+ * values, in the vertex order referenced by the triangle indices
+ *
+ * @param polygon
+ *            polygon
+ * @return vertex data
+ */
++(NSData *) verticesOfPolygon: (SFPolygon *) polygon;
+
+/**
+ * Triangulate the polygon into flat triangle vertex indices
+ *
+ * @param polygon
+ *            polygon
+ * @return int vertex index data, three per triangle
+ */
++(NSData *) triangleIndicesOfPolygon: (SFPolygon *) polygon;
+
+/**
+ * Triangulate flat polygon vertices into triangle vertex indices
+ *
+ * @param vertices
+ *            interleaved x and y vertex values, exterior ring followed by
+ *            the hole rings, without closing points
+ * @param count
+ *            number of vertices
+ * @param holes
+ *            vertex start index of each hole ring
+ * @param holeCount
+ *            number of holes
+ * @return int vertex index data, three per triangle
+ */
++(NSData *) triangleIndicesOfVertices: (const double *) vertices withCount: (int) count andHoles: (const int *) holes andHoleCount: (int) holeCount;
+
+@end
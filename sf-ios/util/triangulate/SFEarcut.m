@@ -0,0 +1,872 @@
+//
+//  SFEarcut.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFEarcut.h"
+#import "SFLineString.h"
+#import "SFPoint.h"
+#import "SFTriangle.h"
+#import "SFMultiPolygon.h"
+#import "SFGeometryTypes.h"
+
+/**
+ * Number of nodes allocated per node pool block
+ */
+#define SF_EARCUT_BLOCK_SIZE 1024
+
+/**
+ * Vertex count above which ears are found with the z-order curve hash
+ */
+#define SF_EARCUT_HASH_THRESHOLD 80
+
+/**
+ * Vertex node of a circular doubly linked polygon ring, with a second
+ * linked list in z-order curve order
+ */
+typedef struct SFEarcutNode{
+    int i;
+    double x;
+    double y;
+    struct SFEarcutNode *prev;
+    struct SFEarcutNode *next;
+    int z;
+    struct SFEarcutNode *prevZ;
+    struct SFEarcutNode *nextZ;
+    BOOL steiner;
+} SFEarcutNode;
+
+/**
+ * Node pool block, nodes are never moved once allocated
+ */
+typedef struct SFEarcutBlock{
+    SFEarcutNode nodes[SF_EARCUT_BLOCK_SIZE];
+    int count;
+    struct SFEarcutBlock *next;
+} SFEarcutBlock;
+
+/**
+ * Triangulation state
+ */
+typedef struct SFEarcutState{
+    const double *vertices;
+    SFEarcutBlock *blocks;
+    int *indices;
+    int indexCount;
+    int indexCapacity;
+    double minX;
+    double minY;
+    double invSize;
+} SFEarcutState;
+
+static SFEarcutNode *SFEarcutCreateNode(SFEarcutState *earcut, int i, double x, double y){
+    if(earcut->blocks == NULL || earcut->blocks->count == SF_EARCUT_BLOCK_SIZE){
+        SFEarcutBlock *block = malloc(sizeof(SFEarcutBlock));
+        block->count = 0;
+        block->next = earcut->blocks;
+        earcut->blocks = block;
+    }
+    SFEarcutNode *node = &earcut->blocks->nodes[earcut->blocks->count++];
+    node->i = i;
+    node->x = x;
+    node->y = y;
+    node->prev = NULL;
+    node->next = NULL;
+    node->z = 0;
+    node->prevZ = NULL;
+    node->nextZ = NULL;
+    node->steiner = NO;
+    return node;
+}
+
+static void SFEarcutFreeNodes(SFEarcutState *earcut){
+    SFEarcutBlock *block = earcut->blocks;
+    while(block != NULL){
+        SFEarcutBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    earcut->blocks = NULL;
+}
+
+static void SFEarcutAddTriangle(SFEarcutState *earcut, SFEarcutNode *a, SFEarcutNode *b, SFEarcutNode *c){
+    if(earcut->indexCount + 3 > earcut->indexCapacity){
+        earcut->indexCapacity = MAX(earcut->indexCapacity * 2, 48);
+        earcut->indices = realloc(earcut->indices, sizeof(int) * earcut->indexCapacity);
+    }
+    earcut->indices[earcut->indexCount++] = a->i;
+    earcut->indices[earcut->indexCount++] = b->i;
+    earcut->indices[earcut->indexCount++] = c->i;
+}
+
+/**
+ * Create a node and link it after the last node
+ */
+static SFEarcutNode *SFEarcutInsertNode(SFEarcutState *earcut, int i, double x, double y, SFEarcutNode *last){
+    SFEarcutNode *node = SFEarcutCreateNode(earcut, i, x, y);
+    if(last == NULL){
+        node->prev = node;
+        node->next = node;
+    }else{
+        node->next = last->next;
+        node->prev = last;
+        last->next->prev = node;
+        last->next = node;
+    }
+    return node;
+}
+
+static void SFEarcutRemoveNode(SFEarcutNode *node){
+    node->next->prev = node->prev;
+    node->prev->next = node->next;
+    if(node->prevZ != NULL){
+        node->prevZ->nextZ = node->nextZ;
+    }
+    if(node->nextZ != NULL){
+        node->nextZ->prevZ = node->prevZ;
+    }
+}
+
+/**
+ * Signed area of the triangle, negative when counter clockwise
+ */
+static double SFEarcutArea(const SFEarcutNode *p, const SFEarcutNode *q, const SFEarcutNode *r){
+    return (q->y - p->y) * (r->x - q->x) - (q->x - p->x) * (r->y - q->y);
+}
+
+static BOOL SFEarcutEquals(const SFEarcutNode *p1, const SFEarcutNode *p2){
+    return p1->x == p2->x && p1->y == p2->y;
+}
+
+static int SFEarcutSign(double value){
+    return value > 0.0 ? 1 : (value < 0.0 ? -1 : 0);
+}
+
+/**
+ * Determine if the point is within the triangle, inclusive of edges
+ */
+static BOOL SFEarcutPointInTriangle(double ax, double ay, double bx, double by, double cx, double cy, double px, double py){
+    return (cx - px) * (ay - py) >= (ax - px) * (cy - py)
+        && (ax - px) * (by - py) >= (bx - px) * (ay - py)
+        && (bx - px) * (cy - py) >= (cx - px) * (by - py);
+}
+
+/**
+ * Determine if point q lies on segment pr, for collinear points
+ */
+static BOOL SFEarcutOnSegment(const SFEarcutNode *p, const SFEarcutNode *q, const SFEarcutNode *r){
+    return q->x <= MAX(p->x, r->x) && q->x >= MIN(p->x, r->x) && q->y <= MAX(p->y, r->y) && q->y >= MIN(p->y, r->y);
+}
+
+static BOOL SFEarcutIntersects(const SFEarcutNode *p1, const SFEarcutNode *q1, const SFEarcutNode *p2, const SFEarcutNode *q2){
+    int o1 = SFEarcutSign(SFEarcutArea(p1, q1, p2));
+    int o2 = SFEarcutSign(SFEarcutArea(p1, q1, q2));
+    int o3 = SFEarcutSign(SFEarcutArea(p2, q2, p1));
+    int o4 = SFEarcutSign(SFEarcutArea(p2, q2, q1));
+    return (o1 != o2 && o3 != o4)
+        || (o1 == 0 && SFEarcutOnSegment(p1, p2, q1))
+        || (o2 == 0 && SFEarcutOnSegment(p1, q2, q1))
+        || (o3 == 0 && SFEarcutOnSegment(p2, p1, q2))
+        || (o4 == 0 && SFEarcutOnSegment(p2, q1, q2));
+}
+
+/**
+ * Determine if the diagonal ab intersects any ring edge
+ */
+static BOOL SFEarcutIntersectsPolygon(const SFEarcutNode *a, const SFEarcutNode *b){
+    const SFEarcutNode *p = a;
+    do{
+        if(p->i != a->i && p->next->i != a->i && p->i != b->i && p->next->i != b->i
+           && SFEarcutIntersects(p, p->next, a, b)){
+            return YES;
+        }
+        p = p->next;
+    }while(p != a);
+    return NO;
+}
+
+/**
+ * Determine if the diagonal ab is locally inside the ring at a
+ */
+static BOOL SFEarcutLocallyInside(const SFEarcutNode *a, const SFEarcutNode *b){
+    return SFEarcutArea(a->prev, a, a->next) < 0.0
+        ? SFEarcutArea(a, b, a->next) >= 0.0 && SFEarcutArea(a, a->prev, b) >= 0.0
+        : SFEarcutArea(a, b, a->prev) < 0.0 || SFEarcutArea(a, a->next, b) < 0.0;
+}
+
+/**
+ * Determine if the middle of the diagonal ab is inside the ring
+ */
+static BOOL SFEarcutMiddleInside(const SFEarcutNode *a, const SFEarcutNode *b){
+    const SFEarcutNode *p = a;
+    BOOL inside = NO;
+    double px = (a->x + b->x) / 2.0;
+    double py = (a->y + b->y) / 2.0;
+    do{
+        if(((p->y > py) != (p->next->y > py)) && p->next->y != p->y
+           && px < (p->next->x - p->x) * (py - p->y) / (p->next->y - p->y) + p->x){
+            inside = !inside;
+        }
+        p = p->next;
+    }while(p != a);
+    return inside;
+}
+
+/**
+ * Determine if the diagonal ab can split the ring into two valid rings
+ */
+static BOOL SFEarcutIsValidDiagonal(const SFEarcutNode *a, const SFEarcutNode *b){
+    return a->next->i != b->i && a->prev->i != b->i && !SFEarcutIntersectsPolygon(a, b)
+        && ((SFEarcutLocallyInside(a, b) && SFEarcutLocallyInside(b, a) && SFEarcutMiddleInside(a, b)
+             && (SFEarcutArea(a->prev, a, b->prev) != 0.0 || SFEarcutArea(a, b->prev, b) != 0.0))
+            || (SFEarcutEquals(a, b) && SFEarcutArea(a->prev, a, a->next) > 0.0 && SFEarcutArea(b->prev, b, b->next) > 0.0));
+}
+
+/**
+ * Split the ring along the diagonal ab into two rings, returning the new
+ * node copy of b in the second ring
+ */
+static SFEarcutNode *SFEarcutSplitPolygon(SFEarcutState *earcut, SFEarcutNode *a, SFEarcutNode *b){
+    SFEarcutNode *a2 = SFEarcutCreateNode(earcut, a->i, a->x, a->y);
+    SFEarcutNode *b2 = SFEarcutCreateNode(earcut, b->i, b->x, b->y);
+    SFEarcutNode *an = a->next;
+    SFEarcutNode *bp = b->prev;
+    
+    a->next = b;
+    b->prev = a;
+    
+    a2->next = an;
+    an->prev = a2;
+    
+    b2->next = a2;
+    a2->prev = b2;
+    
+    bp->next = b2;
+    b2->prev = bp;
+    
+    return b2;
+}
+
+/**
+ * Signed area of the ring vertices, positive when counter clockwise
+ */
+static double SFEarcutSignedArea(const double *vertices, int start, int end){
+    double sum = 0.0;
+    for(int i = start, j = end - 1; i < end; j = i++){
+        sum += (vertices[j * 2] - vertices[i * 2]) * (vertices[i * 2 + 1] + vertices[j * 2 + 1]);
+    }
+    return sum;
+}
+
+/**
+ * Create a circular linked ring from the vertex range in the orientation
+ *
+ * @param counterClockwise
+ *            true for a counter clockwise ring, false for clockwise
+ */
+static SFEarcutNode *SFEarcutLinkedList(SFEarcutState *earcut, int start, int end, BOOL counterClockwise){
+    const double *vertices = earcut->vertices;
+    SFEarcutNode *last = NULL;
+    if(counterClockwise == (SFEarcutSignedArea(vertices, start, end) > 0.0)){
+        for(int i = start; i < end; i++){
+            last = SFEarcutInsertNode(earcut, i, vertices[i * 2], vertices[i * 2 + 1], last);
+        }
+    }else{
+        for(int i = end - 1; i >= start; i--){
+            last = SFEarcutInsertNode(earcut, i, vertices[i * 2], vertices[i * 2 + 1], last);
+        }
+    }
+    if(last != NULL && SFEarcutEquals(last, last->next)){
+        SFEarcutRemoveNode(last);
+        last = last->next;
+    }
+    return last;
+}
+
+/**
+ * Remove duplicate and collinear points from the ring
+ */
+static SFEarcutNode *SFEarcutFilterPoints(SFEarcutNode *start, SFEarcutNode *end){
+    if(start == NULL){
+        return start;
+    }
+    if(end == NULL){
+        end = start;
+    }
+    SFEarcutNode *p = start;
+    BOOL again;
+    do{
+        again = NO;
+        if(!p->steiner && (SFEarcutEquals(p, p->next) || SFEarcutArea(p->prev, p, p->next) == 0.0)){
+            SFEarcutRemoveNode(p);
+            p = end = p->prev;
+            if(p == p->next){
+                break;
+            }
+            again = YES;
+        }else{
+            p = p->next;
+        }
+    }while(again || p != end);
+    return end;
+}
+
+/**
+ * Z-order curve value of the point, from coordinates scaled into 15 bits
+ */
+static int SFEarcutZOrder(double x, double y, double minX, double minY, double invSize){
+    unsigned int ux = (unsigned int)((x - minX) * invSize);
+    unsigned int uy = (unsigned int)((y - minY) * invSize);
+    
+    ux = (ux | (ux << 8)) & 0x00FF00FF;
+    ux = (ux | (ux << 4)) & 0x0F0F0F0F;
+    ux = (ux | (ux << 2)) & 0x33333333;
+    ux = (ux | (ux << 1)) & 0x55555555;
+    
+    uy = (uy | (uy << 8)) & 0x00FF00FF;
+    uy = (uy | (uy << 4)) & 0x0F0F0F0F;
+    uy = (uy | (uy << 2)) & 0x33333333;
+    uy = (uy | (uy << 1)) & 0x55555555;
+    
+    return (int)(ux | (uy << 1));
+}
+
+/**
+ * Merge sort the z-order linked list by z value
+ */
+static SFEarcutNode *SFEarcutSortLinked(SFEarcutNode *list){
+    int inSize = 1;
+    int numMerges;
+    do{
+        SFEarcutNode *p = list;
+        SFEarcutNode *tail = NULL;
+        list = NULL;
+        numMerges = 0;
+        while(p != NULL){
+            numMerges++;
+            SFEarcutNode *q = p;
+            int pSize = 0;
+            for(int i = 0; i < inSize; i++){
+                pSize++;
+                q = q->nextZ;
+                if(q == NULL){
+                    break;
+                }
+            }
+            int qSize = inSize;
+            while(pSize > 0 || (qSize > 0 && q != NULL)){
+                SFEarcutNode *e;
+                if(pSize != 0 && (qSize == 0 || q == NULL || p->z <= q->z)){
+                    e = p;
+                    p = p->nextZ;
+                    pSize--;
+                }else{
+                    e = q;
+                    q = q->nextZ;
+                    qSize--;
+                }
+                if(tail != NULL){
+                    tail->nextZ = e;
+                }else{
+                    list = e;
+                }
+                e->prevZ = tail;
+                tail = e;
+            }
+            p = q;
+        }
+        tail->nextZ = NULL;
+        inSize *= 2;
+    }while(numMerges > 1);
+    return list;
+}
+
+/**
+ * Link the ring nodes in z-order curve order
+ */
+static void SFEarcutIndexCurve(SFEarcutState *earcut, SFEarcutNode *start){
+    SFEarcutNode *p = start;
+    do{
+        if(p->z == 0){
+            p->z = SFEarcutZOrder(p->x, p->y, earcut->minX, earcut->minY, earcut->invSize);
+        }
+        p->prevZ = p->prev;
+        p->nextZ = p->next;
+        p = p->next;
+    }while(p != start);
+    p->prevZ->nextZ = NULL;
+    p->prevZ = NULL;
+    SFEarcutSortLinked(p);
+}
+
+/**
+ * Determine if the node is a reflex free ear with no ring vertices inside
+ */
+static BOOL SFEarcutIsEar(const SFEarcutNode *ear){
+    const SFEarcutNode *a = ear->prev;
+    const SFEarcutNode *b = ear;
+    const SFEarcutNode *c = ear->next;
+    if(SFEarcutArea(a, b, c) >= 0.0){
+        return NO;
+    }
+    double x0 = MIN(a->x, MIN(b->x, c->x));
+    double y0 = MIN(a->y, MIN(b->y, c->y));
+    double x1 = MAX(a->x, MAX(b->x, c->x));
+    double y1 = MAX(a->y, MAX(b->y, c->y));
+    const SFEarcutNode *p = c->next;
+    while(p != a){
+        if(p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1
+           && SFEarcutPointInTriangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y)
+           && SFEarcutArea(p->prev, p, p->next) >= 0.0){
+            return NO;
+        }
+        p = p->next;
+    }
+    return YES;
+}
+
+/**
+ * Determine if the ring node blocks the ear triangle abc
+ */
+static BOOL SFEarcutBlocksEar(const SFEarcutNode *p, const SFEarcutNode *a, const SFEarcutNode *b, const SFEarcutNode *c,
+                              double x0, double y0, double x1, double y1){
+    return p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 && p != a && p != c
+        && SFEarcutPointInTriangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y)
+        && SFEarcutArea(p->prev, p, p->next) >= 0.0;
+}
+
+/**
+ * Determine if the node is an ear, only checking the vertices within the
+ * ear bounds by walking the z-order list in both directions
+ */
+static BOOL SFEarcutIsEarHashed(const SFEarcutState *earcut, const SFEarcutNode *ear){
+    const SFEarcutNode *a = ear->prev;
+    const SFEarcutNode *b = ear;
+    const SFEarcutNode *c = ear->next;
+    if(SFEarcutArea(a, b, c) >= 0.0){
+        return NO;
+    }
+    double x0 = MIN(a->x, MIN(b->x, c->x));
+    double y0 = MIN(a->y, MIN(b->y, c->y));
+    double x1 = MAX(a->x, MAX(b->x, c->x));
+    double y1 = MAX(a->y, MAX(b->y, c->y));
+    
+    int minZ = SFEarcutZOrder(x0, y0, earcut->minX, earcut->minY, earcut->invSize);
+    int maxZ = SFEarcutZOrder(x1, y1, earcut->minX, earcut->minY, earcut->invSize);
+    
+    const SFEarcutNode *p = ear->prevZ;
+    const SFEarcutNode *n = ear->nextZ;
+    
+    while(p != NULL && p->z >= minZ && n != NULL && n->z <= maxZ){
+        if(SFEarcutBlocksEar(p, a, b, c, x0, y0, x1, y1)){
+            return NO;
+        }
+        p = p->prevZ;
+        if(SFEarcutBlocksEar(n, a, b, c, x0, y0, x1, y1)){
+            return NO;
+        }
+        n = n->nextZ;
+    }
+    while(p != NULL && p->z >= minZ){
+        if(SFEarcutBlocksEar(p, a, b, c, x0, y0, x1, y1)){
+            return NO;
+        }
+        p = p->prevZ;
+    }
+    while(n != NULL && n->z <= maxZ){
+        if(SFEarcutBlocksEar(n, a, b, c, x0, y0, x1, y1)){
+            return NO;
+        }
+        n = n->nextZ;
+    }
+    return YES;
+}
+
+/**
+ * Clip the local self intersections of the ring as triangles
+ */
+static SFEarcutNode *SFEarcutCureLocalIntersections(SFEarcutState *earcut, SFEarcutNode *start){
+    SFEarcutNode *p = start;
+    do{
+        SFEarcutNode *a = p->prev;
+        SFEarcutNode *b = p->next->next;
+        if(!SFEarcutEquals(a, b) && SFEarcutIntersects(a, p, p->next, b)
+           && SFEarcutLocallyInside(a, b) && SFEarcutLocallyInside(b, a)){
+            SFEarcutAddTriangle(earcut, a, p, b);
+            SFEarcutRemoveNode(p);
+            SFEarcutRemoveNode(p->next);
+            p = start = b;
+        }
+        p = p->next;
+    }while(p != start);
+    return SFEarcutFilterPoints(p, NULL);
+}
+
+static void SFEarcutLinked(SFEarcutState *earcut, SFEarcutNode *ear, int pass);
+
+/**
+ * Split the ring along a valid diagonal and triangulate both halves
+ */
+static void SFEarcutSplit(SFEarcutState *earcut, SFEarcutNode *start){
+    SFEarcutNode *a = start;
+    do{
+        SFEarcutNode *b = a->next->next;
+        while(b != a->prev){
+            if(a->i != b->i && SFEarcutIsValidDiagonal(a, b)){
+                SFEarcutNode *c = SFEarcutSplitPolygon(earcut, a, b);
+                a = SFEarcutFilterPoints(a, a->next);
+                c = SFEarcutFilterPoints(c, c->next);
+                SFEarcutLinked(earcut, a, 0);
+                SFEarcutLinked(earcut, c, 0);
+                return;
+            }
+            b = b->next;
+        }
+        a = a->next;
+    }while(a != start);
+}
+
+/**
+ * Clip ears from the ring. When no ear remains, retry after filtering
+ * points, then after curing local intersections, then by splitting the ring.
+ */
+static void SFEarcutLinked(SFEarcutState *earcut, SFEarcutNode *ear, int pass){
+    if(ear == NULL){
+        return;
+    }
+    BOOL hashed = earcut->invSize != 0.0;
+    if(pass == 0 && hashed){
+        SFEarcutIndexCurve(earcut, ear);
+    }
+    SFEarcutNode *stop = ear;
+    while(ear->prev != ear->next){
+        SFEarcutNode *prev = ear->prev;
+        SFEarcutNode *next = ear->next;
+        if(hashed ? SFEarcutIsEarHashed(earcut, ear) : SFEarcutIsEar(ear)){
+            SFEarcutAddTriangle(earcut, prev, ear, next);
+            SFEarcutRemoveNode(ear);
+            ear = next->next;
+            stop = next->next;
+            continue;
+        }
+        ear = next;
+        if(ear == stop){
+            if(pass == 0){
+                SFEarcutLinked(earcut, SFEarcutFilterPoints(ear, NULL), 1);
+            }else if(pass == 1){
+                ear = SFEarcutCureLocalIntersections(earcut, SFEarcutFilterPoints(ear, NULL));
+                SFEarcutLinked(earcut, ear, 2);
+            }else if(pass == 2){
+                SFEarcutSplit(earcut, ear);
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * Determine if sector of m contains the sector of p, both at the same point
+ */
+static BOOL SFEarcutSectorContainsSector(const SFEarcutNode *m, const SFEarcutNode *p){
+    return SFEarcutArea(m->prev, m, p->prev) < 0.0 && SFEarcutArea(p->next, m, m->next) < 0.0;
+}
+
+/**
+ * Find the outer ring vertex to bridge to the leftmost hole vertex
+ */
+static SFEarcutNode *SFEarcutFindHoleBridge(SFEarcutNode *hole, SFEarcutNode *outerNode){
+    SFEarcutNode *p = outerNode;
+    double hx = hole->x;
+    double hy = hole->y;
+    double qx = -DBL_MAX;
+    SFEarcutNode *m = NULL;
+    
+    // Find the segment intersected by a ray from the hole point to the left
+    do{
+        if(hy <= p->y && hy >= p->next->y && p->next->y != p->y){
+            double x = p->x + (hy - p->y) * (p->next->x - p->x) / (p->next->y - p->y);
+            if(x <= hx && x > qx){
+                qx = x;
+                m = p->x < p->next->x ? p : p->next;
+                if(x == hx){
+                    // Hole touches the outer segment
+                    return m;
+                }
+            }
+        }
+        p = p->next;
+    }while(p != outerNode);
+    
+    if(m == NULL){
+        return NULL;
+    }
+    
+    // Choose the visible vertex inside the triangle of the hole point, the
+    // ray intersection, and the segment endpoint with the smallest angle
+    SFEarcutNode *stop = m;
+    double mx = m->x;
+    double my = m->y;
+    double tanMin = DBL_MAX;
+    p = m;
+    do{
+        if(hx >= p->x && p->x >= mx && hx != p->x
+           && SFEarcutPointInTriangle(hy < my ? hx : qx, hy, mx, my, hy < my ? qx : hx, hy, p->x, p->y)){
+            double tan = fabs(hy - p->y) / (hx - p->x);
+            if(SFEarcutLocallyInside(p, hole)
+               && (tan < tanMin || (tan == tanMin && (p->x > m->x || (p->x == m->x && SFEarcutSectorContainsSector(m, p)))))){
+                m = p;
+                tanMin = tan;
+            }
+        }
+        p = p->next;
+    }while(p != stop);
+    
+    return m;
+}
+
+/**
+ * Link the hole into the outer ring with a bridge
+ */
+static SFEarcutNode *SFEarcutEliminateHole(SFEarcutState *earcut, SFEarcutNode *hole, SFEarcutNode *outerNode){
+    SFEarcutNode *bridge = SFEarcutFindHoleBridge(hole, outerNode);
+    if(bridge == NULL){
+        return outerNode;
+    }
+    SFEarcutNode *bridgeReverse = SFEarcutSplitPolygon(earcut, bridge, hole);
+    SFEarcutFilterPoints(bridgeReverse, bridgeReverse->next);
+    return SFEarcutFilterPoints(bridge, bridge->next);
+}
+
+static SFEarcutNode *SFEarcutLeftmost(SFEarcutNode *start){
+    SFEarcutNode *p = start;
+    SFEarcutNode *leftmost = start;
+    do{
+        if(p->x < leftmost->x || (p->x == leftmost->x && p->y < leftmost->y)){
+            leftmost = p;
+        }
+        p = p->next;
+    }while(p != start);
+    return leftmost;
+}
+
+static int SFEarcutCompareX(const void *node1, const void *node2){
+    double x1 = (*(SFEarcutNode * const *)node1)->x;
+    double x2 = (*(SFEarcutNode * const *)node2)->x;
+    return x1 < x2 ? -1 : (x1 > x2 ? 1 : 0);
+}
+
+/**
+ * Link each hole into the outer ring, from left to right
+ */
+static SFEarcutNode *SFEarcutEliminateHoles(SFEarcutState *earcut, const int *holes, int holeCount, int vertexCount, SFEarcutNode *outerNode){
+    SFEarcutNode **queue = malloc(sizeof(SFEarcutNode *) * holeCount);
+    int queueCount = 0;
+    for(int h = 0; h < holeCount; h++){
+        int start = holes[h];
+        int end = h < holeCount - 1 ? holes[h + 1] : vertexCount;
+        SFEarcutNode *list = SFEarcutLinkedList(earcut, start, end, NO);
+        if(list != NULL){
+            if(list == list->next){
+                list->steiner = YES;
+            }
+            queue[queueCount++] = SFEarcutLeftmost(list);
+        }
+    }
+    qsort(queue, queueCount, sizeof(SFEarcutNode *), SFEarcutCompareX);
+    for(int h = 0; h < queueCount; h++){
+        outerNode = SFEarcutEliminateHole(earcut, queue[h], outerNode);
+    }
+    free(queue);
+    return outerNode;
+}
+
+/**
+ * Triangulate the polygon vertices
+ *
+ * @param vertices
+ *            interleaved x and y vertex coordinates
+ * @param vertexCount
+ *            number of vertices
+ * @param holes
+ *            vertex start index of each hole ring
+ * @param holeCount
+ *            number of holes
+ * @param indexCount
+ *            number of triangle vertex indices output
+ * @return triangle vertex indices, caller is responsible for freeing
+ */
+static int *SFEarcutTriangulate(const double *vertices, int vertexCount, const int *holes, int holeCount, int *indexCount){
+    
+    SFEarcutState earcut;
+    memset(&earcut, 0, sizeof(SFEarcutState));
+    earcut.vertices = vertices;
+    // A simple polygon triangulates into n + 2h - 2 triangles
+    earcut.indexCapacity = MAX(vertexCount + 2 * holeCount - 2, 1) * 3;
+    earcut.indices = malloc(sizeof(int) * earcut.indexCapacity);
+    
+    int outerCount = holeCount > 0 ? holes[0] : vertexCount;
+    SFEarcutNode *outerNode = SFEarcutLinkedList(&earcut, 0, outerCount, YES);
+    
+    if(outerNode != NULL && outerNode->next != outerNode->prev){
+        
+        if(holeCount > 0){
+            outerNode = SFEarcutEliminateHoles(&earcut, holes, holeCount, vertexCount, outerNode);
+        }
+        
+        // Hash the ears with a z-order curve for larger polygons
+        if(vertexCount > SF_EARCUT_HASH_THRESHOLD){
+            double minX = vertices[0];
+            double minY = vertices[1];
+            double maxX = minX;
+            double maxY = minY;
+            for(int i = 1; i < outerCount; i++){
+                double x = vertices[i * 2];
+                double y = vertices[i * 2 + 1];
+                minX = MIN(minX, x);
+                minY = MIN(minY, y);
+                maxX = MAX(maxX, x);
+                maxY = MAX(maxY, y);
+            }
+            double size = MAX(maxX - minX, maxY - minY);
+            earcut.minX = minX;
+            earcut.minY = minY;
+            earcut.invSize = size != 0.0 ? 32767.0 / size : 0.0;
+        }
+        
+        SFEarcutLinked(&earcut, outerNode, 0);
+    }
+    
+    SFEarcutFreeNodes(&earcut);
+    
+    *indexCount = earcut.indexCount;
+    return earcut.indices;
+}
+
+@implementation SFEarcut
+
++(SFTIN *) triangulatePolygon: (SFPolygon *) polygon{
+    
+    SFTIN *tin = [[SFTIN alloc] initWithHasZ:polygon.hasZ andHasM:polygon.hasM];
+    
+    NSMutableArray<SFPoint *> *points = [[NSMutableArray alloc] init];
+    int holeCount = 0;
+    int *holes = NULL;
+    double *vertices = [self readPolygon:polygon intoPoints:points andHoles:&holes withCount:&holeCount];
+    
+    int indexCount = 0;
+    int *indices = SFEarcutTriangulate(vertices, (int)points.count, holes, holeCount, &indexCount);
+    
+    for(int i = 0; i < indexCount; i += 3){
+        SFLineString *ring = [[SFLineString alloc] initWithHasZ:polygon.hasZ andHasM:polygon.hasM];
+        [ring addPoint:[[points objectAtIndex:indices[i]] mutableCopy]];
+        [ring addPoint:[[points objectAtIndex:indices[i + 1]] mutableCopy]];
+        [ring addPoint:[[points objectAtIndex:indices[i + 2]] mutableCopy]];
+        [ring addPoint:[[points objectAtIndex:indices[i]] mutableCopy]];
+        SFTriangle *triangle = [[SFTriangle alloc] initWithHasZ:polygon.hasZ andHasM:polygon.hasM];
+        [triangle addRing:ring];
+        [tin addPolygon:triangle];
+    }
+    
+    free(indices);
+    free(holes);
+    free(vertices);
+    
+    return tin;
+}
+
++(SFTIN *) triangulateGeometry: (SFGeometry *) geometry{
+    SFTIN *tin = nil;
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch(geometryType){
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            tin = [self triangulatePolygon:(SFPolygon *)geometry];
+            break;
+        case SF_MULTIPOLYGON:
+            tin = [[SFTIN alloc] initWithHasZ:geometry.hasZ andHasM:geometry.hasM];
+            for(SFPolygon *polygon in [((SFMultiPolygon *)geometry) polygons]){
+                [tin addPolygons:[self triangulatePolygon:polygon].polygons];
+            }
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for triangulation: %@", [SFGeometryTypes name:geometryType]];
+    }
+    return tin;
+}
+
++(NSData *) verticesOfPolygon: (SFPolygon *) polygon{
+    NSMutableArray<SFPoint *> *points = [[NSMutableArray alloc] init];
+    int holeCount = 0;
+    int *holes = NULL;
+    double *vertices = [self readPolygon:polygon intoPoints:points andHoles:&holes withCount:&holeCount];
+    free(holes);
+    return [NSData dataWithBytesNoCopy:vertices length:sizeof(double) * 2 * points.count freeWhenDone:YES];
+}
+
++(NSData *) triangleIndicesOfPolygon: (SFPolygon *) polygon{
+    NSMutableArray<SFPoint *> *points = [[NSMutableArray alloc] init];
+    int holeCount = 0;
+    int *holes = NULL;
+    double *vertices = [self readPolygon:polygon intoPoints:points andHoles:&holes withCount:&holeCount];
+    NSData *indices = [self triangleIndicesOfVertices:vertices withCount:(int)points.count andHoles:holes andHoleCount:holeCount];
+    free(holes);
+    free(vertices);
+    return indices;
+}
+
++(NSData *) triangleIndicesOfVertices: (const double *) vertices withCount: (int) count andHoles: (const int *) holes andHoleCount: (int) holeCount{
+    int indexCount = 0;
+    int *indices = SFEarcutTriangulate(vertices, count, holes, holeCount, &indexCount);
+    return [NSData dataWithBytesNoCopy:indices length:sizeof(int) * indexCount freeWhenDone:YES];
+}
+
+/**
+ * Read the polygon ring points, without closing points, into flat vertices
+ *
+ * @param polygon
+ *            polygon
+ * @param points
+ *            points array to populate in vertex order
+ * @param holes
+ *            hole ring vertex start indices output, caller is responsible for freeing
+ * @param holeCount
+ *            number of holes output
+ * @return interleaved x and y vertices, caller is responsible for freeing
+ */
++(double *) readPolygon: (SFPolygon *) polygon intoPoints: (NSMutableArray<SFPoint *> *) points andHoles: (int **) holes withCount: (int *) holeCount{
+    
+    NSArray<SFLineString *> *rings = polygon.rings;
+    *holes = malloc(sizeof(int) * MAX((int)rings.count, 1));
+    *holeCount = 0;
+    
+    for(SFLineString *ring in rings){
+        NSArray<SFPoint *> *ringPoints = ring.points;
+        NSUInteger count = ringPoints.count;
+        if(count > 1 && [[ringPoints objectAtIndex:0] isEqual:[ringPoints objectAtIndex:count - 1]]){
+            count--;
+        }
+        if(points.count == 0){
+            if(count == 0){
+                // Nothing to triangulate without an exterior ring
+                break;
+            }
+        }else if(count > 0){
+            (*holes)[(*holeCount)++] = (int)points.count;
+        }
+        [points addObjectsFromArray:[ringPoints subarrayWithRange:NSMakeRange(0, count)]];
+    }
+    
+    double *vertices = malloc(sizeof(double) * 2 * MAX(points.count, 1));
+    int i = 0;
+    for(SFPoint *point in points){
+        vertices[i++] = [point.x doubleValue];
+        vertices[i++] = [point.y doubleValue];
+    }
+    
+    return vertices;
+}
+
+@end
@@ -0,0 +1,155 @@
+//
+//  SFPreparedTIN.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFTIN.h"
+#import "SFTriangle.h"
+#import "SFPoint.h"
+
+/**
+ * Prepared triangulated irregular network for repeated point location and
+ * z and m interpolation, such as draping geometries over a surface.
+ *
+ * Preparing welds the triangle vertices to find adjacent triangles across
+ * shared edges and buckets the triangles into a uniform grid. Points are
+ * located by jumping to their grid cell, and consecutive points of a batch
+ * first walk across adjacent triangles from the previous location. Values
+ * are interpolated with the barycentric coordinates of the point within
+ * its containing triangle.
+ *
+ * Prepared TINs are immutable and thread safe. Later changes to the TIN
+ * are not reflected.
+ */
+@interface SFPreparedTIN : NSObject
+
+/**
+ * Prepared TIN
+ */
+@property (nonatomic, strong, readonly) SFTIN *tin;
+
+/**
+ * Initialize
+ *
+ * @param tin
+ *            TIN
+ * @return new prepared TIN
+ */
+-(instancetype) initWithTIN: (SFTIN *) tin;
+
+/**
+ * Get the number of triangles
+ *
+ * @return triangle count
+ */
+-(int) numTriangles;
+
+/**
+ * Get the index of the triangle containing the location
+ *
+ * @param x
+ *            x coordinate
+ * @param y
+ *            y coordinate
+ * @return triangle index, or -1 when not within the TIN
+ */
+-(int) indexOfTriangleAtX: (double) x andY: (double) y;
+
+/**
+ * Get the triangle containing the location
+ *
+ * @param x
+ *            x coordinate
+ * @param y
+ *            y coordinate
+ * @return triangle, or nil when not within the TIN
+ */
+-(SFTriangle *) triangleAtX: (double) x andY: (double) y;
+
+/**
+ * Get the triangle containing the point
+ *
+ * @param point
+ *            point
+ * @return triangle, or nil when not within the TIN
+ */
+-(SFTriangle *) triangleAtPoint: (SFPoint *) point;
+
+/**
+ * Get the index of the triangle adjacent across an edge of a triangle
+ *
+ * @param index
+ *            triangle index
+ * @param edge
+ *            edge from the triangle point at the edge index, 0 through 2
+ * @return adjacent triangle index, or -1 when the edge is on the boundary
+ */
+-(int) indexOfTriangleAdjacentToIndex: (int) index atEdge: (int) edge;
+
+/**
+ * Interpolate the z and m values at the location
+ *
+ * @param x
+ *            x coordinate
+ * @param y
+ *            y coordinate
+ * @param z
+ *            interpolated z value output, NAN when the TIN has no z values
+ * @param m
+ *            interpolated m value output, NAN when the TIN has no m values
+ * @return true if within the TIN and values were interpolated
+ */
+-(BOOL) interpolateAtX: (double) x andY: (double) y withZ: (double *) z andM: (double *) m;
+
+/**
+ * Interpolate the z value at the location
+ *
+ * @param x
+ *            x coordinate
+ * @param y
+ *            y coordinate
+ * @return z value, or nil when not within the TIN or the TIN has no z values
+ */
+-(NSDecimalNumber *) zAtX: (double) x andY: (double) y;
+
+/**
+ * Interpolate the m value at the location
+ *
+ * @param x
+ *            x coordinate
+ * @param y
+ *            y coordinate
+ * @return m value, or nil when not within the TIN or the TIN has no m values
+ */
+-(NSDecimalNumber *) mAtX: (double) x andY: (double) y;
+
+/**
+ * Interpolate a point on the TIN surface
+ *
+ * @param point
+ *            point
+ * @return new point with the interpolated z and m values of the TIN, or nil
+ *         when not within the TIN
+ */
+-(SFPoint *) interpolatePoint: (SFPoint *) point;
+
+/**
+ * Interpolate the z values at many locations, concurrently for large
+ * counts. Locations not within the TIN are interpolated as NAN.
+ *
+ * @param x
+ *            x coordinates
+ * @param y
+ *            y coordinates
+ * @param count
+ *            number of locations
+ * @param z
+ *            z values output with capacity for each location
+ */
+-(void) interpolateZAtX: (const double *) x andY: (const double *) y withCount: (int) count intoZ: (double *) z;
+
+@end
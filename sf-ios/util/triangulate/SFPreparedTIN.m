@@ -0,0 +1,516 @@
+//
+//  SFPreparedTIN.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFPreparedTIN.h"
+#import "SFLineString.h"
+
+/**
+ * Target number of triangles per grid index cell
+ */
+#define SF_PREPARED_TIN_CELL_TRIANGLES 2
+
+/**
+ * Maximum number of adjacent triangle steps walked from a previous location
+ */
+#define SF_PREPARED_TIN_WALK_STEPS 4
+
+/**
+ * Number of locations interpolated per concurrent chunk
+ */
+#define SF_PREPARED_TIN_CHUNK 1024
+
+/**
+ * Triangle corner coordinates with adjacency and a grid of triangles by
+ * cell. The edge at corner c runs to the next corner of its triangle.
+ */
+typedef struct SFPreparedTINIndex{
+    int count;
+    double *x;
+    double *y;
+    double *z;
+    double *m;
+    int *adjacent;
+    double minX;
+    double minY;
+    double maxX;
+    double maxY;
+    double cellWidth;
+    double cellHeight;
+    int columns;
+    int rows;
+    int *cellStarts;
+    int *cellTriangles;
+} SFPreparedTINIndex;
+
+/**
+ * Triangle corner or edge sort key
+ */
+typedef struct SFPreparedTINKey{
+    double x;
+    double y;
+    int corner;
+} SFPreparedTINKey;
+
+static int SFPreparedTINCompareKeys(const void *a, const void *b){
+    const SFPreparedTINKey *key1 = a;
+    const SFPreparedTINKey *key2 = b;
+    int compare = key1->x < key2->x ? -1 : (key1->x > key2->x ? 1 : 0);
+    if(compare == 0){
+        compare = key1->y < key2->y ? -1 : (key1->y > key2->y ? 1 : 0);
+    }
+    return compare;
+}
+
+static inline int SFPreparedTINNextCorner(int c){
+    return c % 3 == 2 ? c - 2 : c + 1;
+}
+
+static inline double SFPreparedTINOrient(const SFPreparedTINIndex *index, int c1, int c2, double x, double y){
+    return (index->x[c2] - index->x[c1]) * (y - index->y[c1]) - (index->y[c2] - index->y[c1]) * (x - index->x[c1]);
+}
+
+/**
+ * Signed double area of the triangle, positive when counter clockwise
+ */
+static inline double SFPreparedTINArea(const SFPreparedTINIndex *index, int triangle){
+    int c = 3 * triangle;
+    return SFPreparedTINOrient(index, c, c + 1, index->x[c + 2], index->y[c + 2]);
+}
+
+/**
+ * Find adjacent triangles by welding corners at equal locations into
+ * vertices and matching edges between the same two vertices
+ */
+static void SFPreparedTINBuildAdjacency(SFPreparedTINIndex *index){
+    
+    int corners = 3 * index->count;
+    index->adjacent = malloc(sizeof(int) * MAX(corners, 1));
+    SFPreparedTINKey *keys = malloc(sizeof(SFPreparedTINKey) * MAX(corners, 1));
+    int *vertices = malloc(sizeof(int) * MAX(corners, 1));
+    
+    for(int c = 0; c < corners; c++){
+        index->adjacent[c] = -1;
+        keys[c].x = index->x[c];
+        keys[c].y = index->y[c];
+        keys[c].corner = c;
+    }
+    qsort(keys, corners, sizeof(SFPreparedTINKey), SFPreparedTINCompareKeys);
+    for(int i = 0, vertex = -1; i < corners; i++){
+        if(i == 0 || SFPreparedTINCompareKeys(&keys[i - 1], &keys[i]) != 0){
+            vertex++;
+        }
+        vertices[keys[i].corner] = vertex;
+    }
+    
+    // Sort edges by their lower and higher vertex to place shared edges together
+    for(int c = 0; c < corners; c++){
+        int v1 = vertices[c];
+        int v2 = vertices[SFPreparedTINNextCorner(c)];
+        keys[c].x = MIN(v1, v2);
+        keys[c].y = MAX(v1, v2);
+        keys[c].corner = c;
+    }
+    qsort(keys, corners, sizeof(SFPreparedTINKey), SFPreparedTINCompareKeys);
+    for(int i = 0; i < corners;){
+        int j = i + 1;
+        while(j < corners && SFPreparedTINCompareKeys(&keys[i], &keys[j]) == 0){
+            j++;
+        }
+        // Only manifold edges shared by exactly two triangles are adjacent
+        if(j - i == 2 && keys[i].x != keys[i].y){
+            index->adjacent[keys[i].corner] = keys[i + 1].corner;
+            index->adjacent[keys[i + 1].corner] = keys[i].corner;
+        }
+        i = j;
+    }
+    
+    free(vertices);
+    free(keys);
+}
+
+static inline int SFPreparedTINColumn(const SFPreparedTINIndex *index, double x){
+    return MIN(MAX((int)((x - index->minX) / index->cellWidth), 0), index->columns - 1);
+}
+
+static inline int SFPreparedTINRow(const SFPreparedTINIndex *index, double y){
+    return MIN(MAX((int)((y - index->minY) / index->cellHeight), 0), index->rows - 1);
+}
+
+/**
+ * Bucket the non degenerate triangles into the grid cells overlapped by
+ * their bounding boxes
+ */
+static void SFPreparedTINBuildGrid(SFPreparedTINIndex *index){
+    
+    index->minX = DBL_MAX;
+    index->minY = DBL_MAX;
+    index->maxX = -DBL_MAX;
+    index->maxY = -DBL_MAX;
+    int triangles = 0;
+    for(int t = 0; t < index->count; t++){
+        double area = SFPreparedTINArea(index, t);
+        if(area > 0.0 || area < 0.0){
+            triangles++;
+            for(int c = 3 * t; c < 3 * t + 3; c++){
+                index->minX = MIN(index->minX, index->x[c]);
+                index->minY = MIN(index->minY, index->y[c]);
+                index->maxX = MAX(index->maxX, index->x[c]);
+                index->maxY = MAX(index->maxY, index->y[c]);
+            }
+        }
+    }
+    
+    index->columns = 1;
+    index->rows = 1;
+    if(triangles > 0){
+        double width = index->maxX - index->minX;
+        double height = index->maxY - index->minY;
+        double cellSize = sqrt(width * height * SF_PREPARED_TIN_CELL_TRIANGLES / triangles);
+        index->columns = MIN(MAX((int)ceil(width / cellSize), 1), triangles);
+        index->rows = MIN(MAX((int)ceil(height / cellSize), 1), triangles);
+        index->cellWidth = width / index->columns;
+        index->cellHeight = height / index->rows;
+    }else{
+        index->cellWidth = 1.0;
+        index->cellHeight = 1.0;
+    }
+    
+    int cells = index->columns * index->rows;
+    index->cellStarts = calloc(cells + 1, sizeof(int));
+    
+    // Count the triangles of each cell, then fill the cells from their start offsets
+    for(int pass = 0; pass < 2; pass++){
+        for(int t = 0; t < index->count; t++){
+            double area = SFPreparedTINArea(index, t);
+            if(!(area > 0.0 || area < 0.0)){
+                continue;
+            }
+            int c = 3 * t;
+            int minColumn = SFPreparedTINColumn(index, MIN(index->x[c], MIN(index->x[c + 1], index->x[c + 2])));
+            int maxColumn = SFPreparedTINColumn(index, MAX(index->x[c], MAX(index->x[c + 1], index->x[c + 2])));
+            int minRow = SFPreparedTINRow(index, MIN(index->y[c], MIN(index->y[c + 1], index->y[c + 2])));
+            int maxRow = SFPreparedTINRow(index, MAX(index->y[c], MAX(index->y[c + 1], index->y[c + 2])));
+            for(int row = minRow; row <= maxRow; row++){
+                for(int column = minColumn; column <= maxColumn; column++){
+                    int cell = row * index->columns + column;
+                    if(pass == 0){
+                        index->cellStarts[cell + 1]++;
+                    }else{
+                        index->cellTriangles[index->cellStarts[cell]++] = t;
+                    }
+                }
+            }
+        }
+        if(pass == 0){
+            for(int cell = 0; cell < cells; cell++){
+                index->cellStarts[cell + 1] += index->cellStarts[cell];
+            }
+            index->cellTriangles = malloc(sizeof(int) * MAX(index->cellStarts[cells], 1));
+        }else{
+            // Filling advanced each start to the next cell start
+            for(int cell = cells; cell > 0; cell--){
+                index->cellStarts[cell] = index->cellStarts[cell - 1];
+            }
+            index->cellStarts[0] = 0;
+        }
+    }
+}
+
+static void SFPreparedTINFree(SFPreparedTINIndex *index){
+    if(index != NULL){
+        free(index->x);
+        free(index->y);
+        free(index->z);
+        free(index->m);
+        free(index->adjacent);
+        free(index->cellStarts);
+        free(index->cellTriangles);
+        free(index);
+    }
+}
+
+/**
+ * Check if the non degenerate triangle contains the location, including
+ * its edges
+ */
+static BOOL SFPreparedTINContains(const SFPreparedTINIndex *index, int triangle, double x, double y){
+    int c = 3 * triangle;
+    double area = SFPreparedTINOrient(index, c, c + 1, index->x[c + 2], index->y[c + 2]);
+    BOOL contains = NO;
+    if(area > 0.0){
+        contains = SFPreparedTINOrient(index, c, c + 1, x, y) >= 0.0
+            && SFPreparedTINOrient(index, c + 1, c + 2, x, y) >= 0.0
+            && SFPreparedTINOrient(index, c + 2, c, x, y) >= 0.0;
+    }else if(area < 0.0){
+        contains = SFPreparedTINOrient(index, c, c + 1, x, y) <= 0.0
+            && SFPreparedTINOrient(index, c + 1, c + 2, x, y) <= 0.0
+            && SFPreparedTINOrient(index, c + 2, c, x, y) <= 0.0;
+    }
+    return contains;
+}
+
+/**
+ * Walk across adjacent triangles toward the location, leaving each
+ * triangle through an edge the location is outside of
+ *
+ * @return containing triangle, or -1 when the walk reaches the boundary or step limit
+ */
+static int SFPreparedTINWalk(const SFPreparedTINIndex *index, int triangle, double x, double y){
+    for(int step = 0; step < SF_PREPARED_TIN_WALK_STEPS && triangle != -1; step++){
+        int c = 3 * triangle;
+        double area = SFPreparedTINArea(index, triangle);
+        if(!(area > 0.0 || area < 0.0)){
+            return -1;
+        }
+        int exit = -1;
+        for(int corner = c; corner < c + 3; corner++){
+            double side = SFPreparedTINOrient(index, corner, SFPreparedTINNextCorner(corner), x, y);
+            if(area > 0.0 ? side < 0.0 : side > 0.0){
+                exit = corner;
+                break;
+            }
+        }
+        if(exit == -1){
+            return triangle;
+        }
+        int adjacent = index->adjacent[exit];
+        triangle = adjacent == -1 ? -1 : adjacent / 3;
+    }
+    return -1;
+}
+
+/**
+ * Locate the triangle containing the location
+ *
+ * @param index
+ *            prepared index
+ * @param x
+ *            x coordinate
+ * @param y
+ *            y coordinate
+ * @param hint
+ *            triangle to walk from, such as the previous location, or -1
+ * @return triangle, or -1 when not within the TIN
+ */
+static int SFPreparedTINLocate(const SFPreparedTINIndex *index, double x, double y, int hint){
+    if(hint != -1){
+        int triangle = SFPreparedTINWalk(index, hint, x, y);
+        if(triangle != -1){
+            return triangle;
+        }
+    }
+    if(!(x >= index->minX && x <= index->maxX && y >= index->minY && y <= index->maxY)){
+        return -1;
+    }
+    int cell = SFPreparedTINRow(index, y) * index->columns + SFPreparedTINColumn(index, x);
+    for(int i = index->cellStarts[cell]; i < index->cellStarts[cell + 1]; i++){
+        int triangle = index->cellTriangles[i];
+        if(SFPreparedTINContains(index, triangle, x, y)){
+            return triangle;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Interpolate the corner values at the location with barycentric weights
+ */
+static double SFPreparedTINInterpolate(const SFPreparedTINIndex *index, const double *values, int triangle, double x, double y){
+    int c = 3 * triangle;
+    double ax = index->x[c];
+    double ay = index->y[c];
+    double bx = index->x[c + 1];
+    double by = index->y[c + 1];
+    double cx = index->x[c + 2];
+    double cy = index->y[c + 2];
+    double determinant = (by - cy) * (ax - cx) + (cx - bx) * (ay - cy);
+    double weight1 = ((by - cy) * (x - cx) + (cx - bx) * (y - cy)) / determinant;
+    double weight2 = ((cy - ay) * (x - cx) + (ax - cx) * (y - cy)) / determinant;
+    double weight3 = 1.0 - weight1 - weight2;
+    return weight1 * values[c] + weight2 * values[c + 1] + weight3 * values[c + 2];
+}
+
+@interface SFPreparedTIN()
+
+/**
+ * Triangle corner, adjacency, and grid index
+ */
+@property (nonatomic) SFPreparedTINIndex *index;
+
+@end
+
+@implementation SFPreparedTIN
+
+-(instancetype) initWithTIN: (SFTIN *) tin{
+    self = [super init];
+    if(self != nil){
+        _tin = tin;
+        _index = [self indexOfTIN:tin];
+    }
+    return self;
+}
+
+-(void) dealloc{
+    SFPreparedTINFree(_index);
+}
+
+-(int) numTriangles{
+    return _index->count;
+}
+
+-(int) indexOfTriangleAtX: (double) x andY: (double) y{
+    return SFPreparedTINLocate(_index, x, y, -1);
+}
+
+-(SFTriangle *) triangleAtX: (double) x andY: (double) y{
+    SFTriangle *triangle = nil;
+    int triangleIndex = SFPreparedTINLocate(_index, x, y, -1);
+    if(triangleIndex != -1){
+        triangle = (SFTriangle *)[_tin.polygons objectAtIndex:triangleIndex];
+    }
+    return triangle;
+}
+
+-(SFTriangle *) triangleAtPoint: (SFPoint *) point{
+    return [self triangleAtX:[point.x doubleValue] andY:[point.y doubleValue]];
+}
+
+-(int) indexOfTriangleAdjacentToIndex: (int) index atEdge: (int) edge{
+    int adjacent = _index->adjacent[3 * index + edge];
+    return adjacent == -1 ? -1 : adjacent / 3;
+}
+
+-(BOOL) interpolateAtX: (double) x andY: (double) y withZ: (double *) z andM: (double *) m{
+    int triangle = SFPreparedTINLocate(_index, x, y, -1);
+    BOOL found = triangle != -1;
+    if(z != NULL){
+        *z = found && _index->z != NULL ? SFPreparedTINInterpolate(_index, _index->z, triangle, x, y) : NAN;
+    }
+    if(m != NULL){
+        *m = found && _index->m != NULL ? SFPreparedTINInterpolate(_index, _index->m, triangle, x, y) : NAN;
+    }
+    return found;
+}
+
+-(NSDecimalNumber *) zAtX: (double) x andY: (double) y{
+    NSDecimalNumber *value = nil;
+    double z = NAN;
+    if([self interpolateAtX:x andY:y withZ:&z andM:NULL] && !isnan(z)){
+        value = [[NSDecimalNumber alloc] initWithDouble:z];
+    }
+    return value;
+}
+
+-(NSDecimalNumber *) mAtX: (double) x andY: (double) y{
+    NSDecimalNumber *value = nil;
+    double m = NAN;
+    if([self interpolateAtX:x andY:y withZ:NULL andM:&m] && !isnan(m)){
+        value = [[NSDecimalNumber alloc] initWithDouble:m];
+    }
+    return value;
+}
+
+-(SFPoint *) interpolatePoint: (SFPoint *) point{
+    SFPoint *interpolated = nil;
+    double z = NAN;
+    double m = NAN;
+    if([self interpolateAtX:[point.x doubleValue] andY:[point.y doubleValue] withZ:&z andM:&m]){
+        interpolated = [[SFPoint alloc] initWithHasZ:!isnan(z) andHasM:!isnan(m) andX:point.x andY:point.y];
+        if(!isnan(z)){
+            [interpolated setZValue:z];
+        }
+        if(!isnan(m)){
+            [interpolated setMValue:m];
+        }
+    }
+    return interpolated;
+}
+
+-(void) interpolateZAtX: (const double *) x andY: (const double *) y withCount: (int) count intoZ: (double *) z{
+    const SFPreparedTINIndex *index = _index;
+    void (^interpolate)(int, int) = ^(int start, int end) {
+        int hint = -1;
+        for(int i = start; i < end; i++){
+            int triangle = SFPreparedTINLocate(index, x[i], y[i], hint);
+            if(triangle != -1 && index->z != NULL){
+                z[i] = SFPreparedTINInterpolate(index, index->z, triangle, x[i], y[i]);
+                hint = triangle;
+            }else{
+                z[i] = NAN;
+            }
+        }
+    };
+    if(count < SF_PREPARED_TIN_CHUNK * 2){
+        interpolate(0, count);
+    }else{
+        size_t chunks = (count + SF_PREPARED_TIN_CHUNK - 1) / SF_PREPARED_TIN_CHUNK;
+        dispatch_apply(chunks, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t chunk) {
+            int start = (int)chunk * SF_PREPARED_TIN_CHUNK;
+            interpolate(start, MIN(start + SF_PREPARED_TIN_CHUNK, count));
+        });
+    }
+}
+
+/**
+ * Read the TIN triangle corners and build the adjacency and grid index
+ *
+ * @param tin
+ *            TIN
+ * @return index, freed with the prepared TIN
+ */
+-(SFPreparedTINIndex *) indexOfTIN: (SFTIN *) tin{
+    
+    NSArray<SFPolygon *> *triangles = tin.polygons;
+    int count = (int)triangles.count;
+    
+    SFPreparedTINIndex *index = calloc(1, sizeof(SFPreparedTINIndex));
+    index->count = count;
+    index->x = malloc(sizeof(double) * 3 * MAX(count, 1));
+    index->y = malloc(sizeof(double) * 3 * MAX(count, 1));
+    if(tin.hasZ){
+        index->z = malloc(sizeof(double) * 3 * MAX(count, 1));
+    }
+    if(tin.hasM){
+        index->m = malloc(sizeof(double) * 3 * MAX(count, 1));
+    }
+    
+    int c = 0;
+    for(SFPolygon *triangle in triangles){
+        NSArray<SFPoint *> *points = [triangle exteriorRing].points;
+        for(int i = 0; i < 3; i++, c++){
+            if(i < points.count){
+                SFPoint *point = [points objectAtIndex:i];
+                index->x[c] = [point.x doubleValue];
+                index->y[c] = [point.y doubleValue];
+                if(index->z != NULL){
+                    index->z[c] = point.z != nil ? [point.z doubleValue] : NAN;
+                }
+                if(index->m != NULL){
+                    index->m[c] = point.m != nil ? [point.m doubleValue] : NAN;
+                }
+            }else{
+                // Repeat the previous corner, degenerate triangles are never located
+                index->x[c] = i > 0 ? index->x[c - 1] : 0.0;
+                index->y[c] = i > 0 ? index->y[c - 1] : 0.0;
+                if(index->z != NULL){
+                    index->z[c] = NAN;
+                }
+                if(index->m != NULL){
+                    index->m[c] = NAN;
+                }
+            }
+        }
+    }
+    
+    SFPreparedTINBuildAdjacency(index);
+    SFPreparedTINBuildGrid(index);
+    
+    return index;
+}
+
+@end
@@ -0,0 +1,76 @@
+//
+//  SFTWKBGeometryReader.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+#import "SFByteReader.h"
+
+/**
+ * Tiny Well-Known Binary (TWKB) geometry reader. Delta encoded zigzag varint
+ * coordinates are decoded in batches directly from the bytes. Empty points
+ * are read as points with NaN coordinates.
+ *
+ * https://github.com/TWKB/Specification
+ */
+@interface SFTWKBGeometryReader : NSObject
+
+/**
+ * Read a geometry from the data
+ *
+ * @param data
+ *            TWKB data
+ * @return geometry
+ */
++(SFGeometry *) readGeometryWithData: (NSData *) data;
+
+/**
+ * Read a geometry from the data
+ *
+ * @param data
+ *            TWKB data
+ * @param ids
+ *            array to add the ID list of a multi geometry or geometry
+ *            collection to, when present
+ * @return geometry
+ */
++(SFGeometry *) readGeometryWithData: (NSData *) data andIds: (NSMutableArray<NSNumber *> *) ids;
+
+/**
+ * Read a geometry from the byte reader, advancing the next byte past the
+ * geometry
+ *
+ * @param reader
+ *            byte reader
+ * @return geometry
+ */
++(SFGeometry *) readGeometryWithReader: (SFByteReader *) reader;
+
+/**
+ * Read a geometry from the byte reader, advancing the next byte past the
+ * geometry
+ *
+ * @param reader
+ *            byte reader
+ * @param ids
+ *            array to add the ID list of a multi geometry or geometry
+ *            collection to, when present
+ * @return geometry
+ */
++(SFGeometry *) readGeometryWithReader: (SFByteReader *) reader andIds: (NSMutableArray<NSNumber *> *) ids;
+
+/**
+ * Read the bounding box from the geometry header without reading the
+ * geometry
+ *
+ * @param data
+ *            TWKB data
+ * @return envelope, nil when the geometry has no bounding box
+ */
++(SFGeometryEnvelope *) boundingBoxWithData: (NSData *) data;
+
+@end
@@ -0,0 +1,536 @@
+//
+//  SFTWKBGeometryReader.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFTWKBGeometryReader.h"
+#import "SFPoint.h"
+#import "SFPolygon.h"
+#import "SFMultiPoint.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+
+/**
+ * Number of coordinate values buffered on the stack before falling back to
+ * the heap
+ */
+#define SF_TWKB_BUFFER_SIZE 1024
+
+/**
+ * Bounding box metadata flag
+ */
+#define SF_TWKB_BBOX_FLAG 0x01
+
+/**
+ * Size metadata flag
+ */
+#define SF_TWKB_SIZE_FLAG 0x02
+
+/**
+ * ID list metadata flag
+ */
+#define SF_TWKB_IDS_FLAG 0x04
+
+/**
+ * Extended precision metadata flag
+ */
+#define SF_TWKB_EXTENDED_FLAG 0x08
+
+/**
+ * Empty geometry metadata flag
+ */
+#define SF_TWKB_EMPTY_FLAG 0x10
+
+/**
+ * Maximum geometry collection nesting depth, guarding the recursive reader
+ * against stack exhaustion from malicious or corrupt collections
+ */
+#define SF_TWKB_MAX_DEPTH 64
+
+/**
+ * Byte cursor over TWKB bytes
+ */
+typedef struct SFTWKBCursor{
+    const uint8_t *bytes;
+    size_t length;
+    size_t offset;
+    BOOL error;
+    int depth;
+} SFTWKBCursor;
+
+/**
+ * TWKB geometry header
+ */
+typedef struct SFTWKBHeader{
+    enum SFGeometryType geometryType;
+    uint8_t metadata;
+    BOOL hasZ;
+    BOOL hasM;
+    int dimensions;
+    double scales[4];
+    int64_t bounds[8];
+    size_t end;
+} SFTWKBHeader;
+
+/**
+ * Read an unsigned varint
+ *
+ * @param cursor
+ *            cursor
+ * @return value, 0 on error
+ */
+static uint64_t SFTWKBReadVarint(SFTWKBCursor *cursor){
+    uint64_t value = 0;
+    for(int shift = 0; shift < 64 && cursor->offset < cursor->length; shift += 7){
+        uint8_t byte = cursor->bytes[cursor->offset++];
+        value |= (uint64_t) (byte & 0x7F) << shift;
+        if(byte < 0x80){
+            return value;
+        }
+    }
+    cursor->error = YES;
+    return 0;
+}
+
+/**
+ * Read a zigzag varint signed value
+ *
+ * @param cursor
+ *            cursor
+ * @return value, 0 on error
+ */
+static int64_t SFTWKBReadSigned(SFTWKBCursor *cursor){
+    uint64_t value = SFTWKBReadVarint(cursor);
+    return (int64_t) (value >> 1) ^ -(int64_t) (value & 1);
+}
+
+/**
+ * Read a count, flagging an error when the count exceeds the remaining bytes
+ * at the minimum number of bytes per counted element
+ *
+ * @param cursor
+ *            cursor
+ * @param elementBytes
+ *            minimum bytes per counted element
+ * @return count, 0 on error
+ */
+static size_t SFTWKBReadCount(SFTWKBCursor *cursor, size_t elementBytes){
+    uint64_t count = SFTWKBReadVarint(cursor);
+    if(!cursor->error && count > (cursor->length - cursor->offset) / elementBytes){
+        cursor->error = YES;
+        count = 0;
+    }
+    return (size_t) count;
+}
+
+/**
+ * Enter a nested geometry collection, flagging an error when the maximum
+ * depth is exceeded
+ *
+ * @param cursor
+ *            cursor
+ * @return true if entered
+ */
+static BOOL SFTWKBEnter(SFTWKBCursor *cursor){
+    if(cursor->error || cursor->depth >= SF_TWKB_MAX_DEPTH){
+        cursor->error = YES;
+        return NO;
+    }
+    cursor->depth++;
+    return YES;
+}
+
+/**
+ * Read a geometry header
+ *
+ * @param cursor
+ *            cursor
+ * @param header
+ *            header to populate
+ * @return true if read
+ */
+static BOOL SFTWKBReadHeader(SFTWKBCursor *cursor, SFTWKBHeader *header){
+    
+    if(cursor->error || cursor->length - cursor->offset < 2){
+        cursor->error = YES;
+        return NO;
+    }
+    uint8_t typeAndPrecision = cursor->bytes[cursor->offset++];
+    header->metadata = cursor->bytes[cursor->offset++];
+    
+    int type = typeAndPrecision & 0x0F;
+    if(type < SF_POINT || type > SF_GEOMETRYCOLLECTION){
+        cursor->error = YES;
+        return NO;
+    }
+    header->geometryType = type;
+    int zigzag = typeAndPrecision >> 4;
+    int precision = (zigzag >> 1) ^ -(zigzag & 1);
+    
+    int zPrecision = 0;
+    int mPrecision = 0;
+    header->hasZ = NO;
+    header->hasM = NO;
+    if(header->metadata & SF_TWKB_EXTENDED_FLAG){
+        if(cursor->offset >= cursor->length){
+            cursor->error = YES;
+            return NO;
+        }
+        uint8_t extended = cursor->bytes[cursor->offset++];
+        header->hasZ = (extended & 0x01) != 0;
+        header->hasM = (extended & 0x02) != 0;
+        zPrecision = (extended >> 2) & 0x07;
+        mPrecision = (extended >> 5) & 0x07;
+    }
+    
+    header->dimensions = 2;
+    header->scales[0] = pow(10.0, precision);
+    header->scales[1] = header->scales[0];
+    if(header->hasZ){
+        header->scales[header->dimensions++] = pow(10.0, zPrecision);
+    }
+    if(header->hasM){
+        header->scales[header->dimensions++] = pow(10.0, mPrecision);
+    }
+    
+    header->end = 0;
+    if(header->metadata & SF_TWKB_SIZE_FLAG){
+        size_t size = SFTWKBReadCount(cursor, 1);
+        header->end = cursor->offset + size;
+    }
+    
+    if(header->metadata & SF_TWKB_BBOX_FLAG){
+        for(int d = 0; d < header->dimensions; d++){
+            header->bounds[d] = SFTWKBReadSigned(cursor);
+            header->bounds[4 + d] = header->bounds[d] + SFTWKBReadSigned(cursor);
+        }
+    }
+    
+    return !cursor->error;
+}
+
+/**
+ * Read delta encoded coordinates, decoding single byte varints inline
+ *
+ * @param cursor
+ *            cursor
+ * @param previous
+ *            previous quantized coordinate of each dimension, updated
+ * @param dimensions
+ *            number of dimensions
+ * @param scales
+ *            precision scale of each dimension
+ * @param values
+ *            values with capacity for count interleaved coordinates
+ * @param count
+ *            number of coordinates
+ */
+static void SFTWKBReadCoordinates(SFTWKBCursor *cursor, int64_t *previous, int dimensions, const double *scales, double *values, size_t count){
+    const uint8_t *bytes = cursor->bytes;
+    size_t length = cursor->length;
+    size_t valueCount = count * dimensions;
+    int d = 0;
+    for(size_t i = 0; i < valueCount && !cursor->error; i++){
+        int64_t delta;
+        uint8_t byte;
+        if(cursor->offset < length && (byte = bytes[cursor->offset]) < 0x80){
+            cursor->offset++;
+            delta = (int64_t) (byte >> 1) ^ -(int64_t) (byte & 1);
+        }else{
+            delta = SFTWKBReadSigned(cursor);
+        }
+        previous[d] += delta;
+        values[i] = previous[d] / scales[d];
+        if(++d == dimensions){
+            d = 0;
+        }
+    }
+}
+
+@implementation SFTWKBGeometryReader
+
++(SFGeometry *) readGeometryWithData: (NSData *) data{
+    return [self readGeometryWithData:data andIds:nil];
+}
+
++(SFGeometry *) readGeometryWithData: (NSData *) data andIds: (NSMutableArray<NSNumber *> *) ids{
+    SFTWKBCursor cursor = {data.bytes, data.length, 0, NO};
+    return [self readGeometryWithCursor:&cursor andIds:ids];
+}
+
++(SFGeometry *) readGeometryWithReader: (SFByteReader *) reader{
+    return [self readGeometryWithReader:reader andIds:nil];
+}
+
++(SFGeometry *) readGeometryWithReader: (SFByteReader *) reader andIds: (NSMutableArray<NSNumber *> *) ids{
+    NSData *data = reader.bytes;
+    size_t offset = reader.nextByte;
+    SFTWKBCursor cursor = {data.bytes, data.length, MIN(offset, data.length), offset > data.length};
+    SFGeometry *geometry = [self readGeometryWithCursor:&cursor andIds:ids];
+    reader.nextByte = (int) cursor.offset;
+    return geometry;
+}
+
++(SFGeometryEnvelope *) boundingBoxWithData: (NSData *) data{
+    SFTWKBCursor cursor = {data.bytes, data.length, 0, NO};
+    SFTWKBHeader header;
+    if(!SFTWKBReadHeader(&cursor, &header)){
+        [self raiseInvalidWithCursor:&cursor];
+    }
+    SFGeometryEnvelope *envelope = nil;
+    if(header.metadata & SF_TWKB_BBOX_FLAG){
+        envelope = [[SFGeometryEnvelope alloc] initWithHasZ:header.hasZ andHasM:header.hasM];
+        [envelope setMinX:[[NSDecimalNumber alloc] initWithDouble:header.bounds[0] / header.scales[0]]];
+        [envelope setMinY:[[NSDecimalNumber alloc] initWithDouble:header.bounds[1] / header.scales[1]]];
+        [envelope setMaxX:[[NSDecimalNumber alloc] initWithDouble:header.bounds[4] / header.scales[0]]];
+        [envelope setMaxY:[[NSDecimalNumber alloc] initWithDouble:header.bounds[5] / header.scales[1]]];
+        int d = 2;
+        if(header.hasZ){
+            [envelope setMinZ:[[NSDecimalNumber alloc] initWithDouble:header.bounds[d] / header.scales[d]]];
+            [envelope setMaxZ:[[NSDecimalNumber alloc] initWithDouble:header.bounds[4 + d] / header.scales[d]]];
+            d++;
+        }
+        if(header.hasM){
+            [envelope setMinM:[[NSDecimalNumber alloc] initWithDouble:header.bounds[d] / header.scales[d]]];
+            [envelope setMaxM:[[NSDecimalNumber alloc] initWithDouble:header.bounds[4 + d] / header.scales[d]]];
+        }
+    }
+    return envelope;
+}
+
+/**
+ * Read a geometry with a header
+ *
+ * @param cursor
+ *            cursor
+ * @param ids
+ *            array to add an ID list to, or nil
+ * @return geometry
+ */
++(SFGeometry *) readGeometryWithCursor: (SFTWKBCursor *) cursor andIds: (NSMutableArray<NSNumber *> *) ids{
+    
+    SFTWKBHeader header;
+    if(!SFTWKBReadHeader(cursor, &header)){
+        [self raiseInvalidWithCursor:cursor];
+    }
+    if(header.end > cursor->length){
+        cursor->error = YES;
+        [self raiseInvalidWithCursor:cursor];
+    }
+    
+    enum SFGeometryType geometryType = header.geometryType;
+    BOOL hasZ = header.hasZ;
+    BOOL hasM = header.hasM;
+    BOOL empty = (header.metadata & SF_TWKB_EMPTY_FLAG) != 0;
+    int64_t previous[4] = {0, 0, 0, 0};
+    
+    SFGeometry *geometry = nil;
+    switch(geometryType){
+        case SF_POINT:
+            if(empty){
+                geometry = [[SFPoint alloc] initWithHasZ:hasZ andHasM:hasM andXValue:NAN andYValue:NAN];
+            }else{
+                geometry = [[self readPointsWithCursor:cursor andCount:1 andHeader:&header andPrevious:previous] firstObject];
+            }
+            break;
+        case SF_LINESTRING:
+            {
+                SFLineString *lineString = [[SFLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+                if(!empty){
+                    [lineString addPoints:[self readPointsWithCursor:cursor andHeader:&header andPrevious:previous]];
+                }
+                geometry = lineString;
+            }
+            break;
+        case SF_POLYGON:
+            {
+                SFPolygon *polygon = [[SFPolygon alloc] initWithHasZ:hasZ andHasM:hasM];
+                if(!empty){
+                    [self readRingsOfPolygon:polygon withCursor:cursor andHeader:&header andPrevious:previous];
+                }
+                geometry = polygon;
+            }
+            break;
+        case SF_MULTIPOINT:
+        case SF_MULTILINESTRING:
+        case SF_MULTIPOLYGON:
+        case SF_GEOMETRYCOLLECTION:
+            {
+                SFGeometryCollection *collection = nil;
+                switch(geometryType){
+                    case SF_MULTIPOINT:
+                        collection = [[SFMultiPoint alloc] initWithHasZ:hasZ andHasM:hasM];
+                        break;
+                    case SF_MULTILINESTRING:
+                        collection = [[SFMultiLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+                        break;
+                    case SF_MULTIPOLYGON:
+                        collection = [[SFMultiPolygon alloc] initWithHasZ:hasZ andHasM:hasM];
+                        break;
+                    default:
+                        collection = [[SFGeometryCollection alloc] initWithHasZ:hasZ andHasM:hasM];
+                        break;
+                }
+                if(!empty){
+                    size_t count = SFTWKBReadCount(cursor, 1);
+                    if(header.metadata & SF_TWKB_IDS_FLAG){
+                        for(size_t i = 0; i < count && !cursor->error; i++){
+                            int64_t identifier = SFTWKBReadSigned(cursor);
+                            [ids addObject:[NSNumber numberWithLongLong:identifier]];
+                        }
+                    }
+                    BOOL nested = geometryType == SF_GEOMETRYCOLLECTION && count > 0 && SFTWKBEnter(cursor);
+                    for(size_t i = 0; i < count && !cursor->error; i++){
+                        switch(geometryType){
+                            case SF_MULTIPOINT:
+                                [collection addGeometry:[[self readPointsWithCursor:cursor andCount:1 andHeader:&header andPrevious:previous] firstObject]];
+                                break;
+                            case SF_MULTILINESTRING:
+                                {
+                                    SFLineString *lineString = [[SFLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+                                    [lineString addPoints:[self readPointsWithCursor:cursor andHeader:&header andPrevious:previous]];
+                                    [collection addGeometry:lineString];
+                                }
+                                break;
+                            case SF_MULTIPOLYGON:
+                                {
+                                    SFPolygon *polygon = [[SFPolygon alloc] initWithHasZ:hasZ andHasM:hasM];
+                                    [self readRingsOfPolygon:polygon withCursor:cursor andHeader:&header andPrevious:previous];
+                                    [collection addGeometry:polygon];
+                                }
+                                break;
+                            default:
+                                [collection addGeometry:[self readGeometryWithCursor:cursor andIds:nil]];
+                                break;
+                        }
+                    }
+                    if(nested){
+                        cursor->depth--;
+                    }
+                }
+                geometry = collection;
+            }
+            break;
+        default:
+            break;
+    }
+    
+    if(header.end > 0 && !cursor->error){
+        if(cursor->offset > header.end){
+            cursor->error = YES;
+        }else{
+            cursor->offset = header.end;
+        }
+    }
+    if(cursor->error){
+        [self raiseInvalidWithCursor:cursor];
+    }
+    
+    return geometry;
+}
+
+/**
+ * Read the counted rings of a polygon
+ *
+ * @param polygon
+ *            polygon
+ * @param cursor
+ *            cursor
+ * @param header
+ *            geometry header
+ * @param previous
+ *            previous quantized coordinate of each dimension, updated
+ */
++(void) readRingsOfPolygon: (SFPolygon *) polygon withCursor: (SFTWKBCursor *) cursor andHeader: (SFTWKBHeader *) header andPrevious: (int64_t *) previous{
+    size_t rings = SFTWKBReadCount(cursor, 1);
+    for(size_t i = 0; i < rings && !cursor->error; i++){
+        SFLineString *ring = [[SFLineString alloc] initWithHasZ:header->hasZ andHasM:header->hasM];
+        [ring addPoints:[self readPointsWithCursor:cursor andHeader:header andPrevious:previous]];
+        [polygon addRing:ring];
+    }
+}
+
+/**
+ * Read a counted run of points
+ *
+ * @param cursor
+ *            cursor
+ * @param header
+ *            geometry header
+ * @param previous
+ *            previous quantized coordinate of each dimension, updated
+ * @return points
+ */
++(NSArray<SFPoint *> *) readPointsWithCursor: (SFTWKBCursor *) cursor andHeader: (SFTWKBHeader *) header andPrevious: (int64_t *) previous{
+    size_t count = SFTWKBReadCount(cursor, header->dimensions);
+    return [self readPointsWithCursor:cursor andCount:count andHeader:header andPrevious:previous];
+}
+
+/**
+ * Read points
+ *
+ * @param cursor
+ *            cursor
+ * @param count
+ *            number of points
+ * @param header
+ *            geometry header
+ * @param previous
+ *            previous quantized coordinate of each dimension, updated
+ * @return points
+ */
++(NSArray<SFPoint *> *) readPointsWithCursor: (SFTWKBCursor *) cursor andCount: (size_t) count andHeader: (SFTWKBHeader *) header andPrevious: (int64_t *) previous{
+    
+    if(cursor->error){
+        [self raiseInvalidWithCursor:cursor];
+    }
+    
+    BOOL hasZ = header->hasZ;
+    BOOL hasM = header->hasM;
+    int dimensions = header->dimensions;
+    size_t valueCount = dimensions * count;
+    double stackValues[SF_TWKB_BUFFER_SIZE];
+    double *values = valueCount <= SF_TWKB_BUFFER_SIZE ? stackValues : malloc(sizeof(double) * valueCount);
+    
+    SFTWKBReadCoordinates(cursor, previous, dimensions, header->scales, values, count);
+    
+    NSMutableArray<SFPoint *> *points = [NSMutableArray arrayWithCapacity:count];
+    if(!cursor->error){
+        for(size_t i = 0; i < count; i++){
+            const double *coordinate = values + i * dimensions;
+            SFPoint *point = [[SFPoint alloc] initWithHasZ:hasZ andHasM:hasM andXValue:coordinate[0] andYValue:coordinate[1]];
+            if(hasZ){
+                [point setZValue:coordinate[2]];
+            }
+            if(hasM){
+                [point setMValue:coordinate[hasZ ? 3 : 2]];
+            }
+            [points addObject:point];
+        }
+    }
+    
+    if(values != stackValues){
+        free(values);
+    }
+    
+    if(cursor->error){
+        [self raiseInvalidWithCursor:cursor];
+    }
+    
+    return points;
+}
+
+/**
+ * Raise an invalid TWKB exception
+ *
+ * @param cursor
+ *            cursor
+ */
++(void) raiseInvalidWithCursor: (SFTWKBCursor *) cursor{
+    [NSException raise:@"Invalid TWKB" format:@"Failed to read TWKB geometry at byte offset: %zu of length: %zu", cursor->offset, cursor->length];
+}
+
+@end
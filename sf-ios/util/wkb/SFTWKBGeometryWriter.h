@@ -0,0 +1,108 @@
+//
+//  SFTWKBGeometryWriter.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+#import "SFByteWriter.h"
+
+/**
+ * Tiny Well-Known Binary (TWKB) geometry writer. Coordinates are scaled by
+ * their decimal precision, rounded to integers, delta encoded from the
+ * previous coordinate, and written as zigzag varints. Points, line strings,
+ * polygons, multi points, multi line strings, multi polygons, and geometry
+ * collections are supported, with optional bounding boxes, sizes, and ID
+ * lists.
+ *
+ * https://github.com/TWKB/Specification
+ */
+@interface SFTWKBGeometryWriter : NSObject
+
+/**
+ * Number of decimal digits of x and y precision, -8 through 7
+ */
+@property (nonatomic) int precision;
+
+/**
+ * Number of decimal digits of z precision, 0 through 7
+ */
+@property (nonatomic) int zPrecision;
+
+/**
+ * Number of decimal digits of m precision, 0 through 7
+ */
+@property (nonatomic) int mPrecision;
+
+/**
+ * Include bounding boxes
+ */
+@property (nonatomic) BOOL includeBoundingBox;
+
+/**
+ * Include geometry byte sizes, allowing readers to skip geometries
+ */
+@property (nonatomic) BOOL includeSize;
+
+/**
+ * Initialize, with 0 decimal digits of precision
+ *
+ * @return new writer
+ */
+-(instancetype) init;
+
+/**
+ * Initialize
+ *
+ * @param precision
+ *            number of decimal digits of x and y precision, -8 through 7
+ *
+ * @return new writer
+ */
+-(instancetype) initWithPrecision: (int) precision;
+
+/**
+ * Write the geometry
+ *
+ * @param geometry
+ *            geometry
+ * @return TWKB data
+ */
+-(NSData *) writeGeometry: (SFGeometry *) geometry;
+
+/**
+ * Write the multi geometry or geometry collection with an ID list
+ *
+ * @param geometry
+ *            multi geometry or geometry collection
+ * @param ids
+ *            ID of each child geometry, nil for no ID list
+ * @return TWKB data
+ */
+-(NSData *) writeGeometry: (SFGeometry *) geometry withIds: (NSArray<NSNumber *> *) ids;
+
+/**
+ * Write the geometry to the byte writer
+ *
+ * @param geometry
+ *            geometry
+ * @param writer
+ *            byte writer
+ */
+-(void) writeGeometry: (SFGeometry *) geometry toWriter: (SFByteWriter *) writer;
+
+/**
+ * Write the geometry
+ *
+ * @param geometry
+ *            geometry
+ * @param precision
+ *            number of decimal digits of x and y precision, -8 through 7
+ * @return TWKB data
+ */
++(NSData *) bytesWithGeometry: (SFGeometry *) geometry andPrecision: (int) precision;
+
+@end
@@ -0,0 +1,502 @@
+//
+//  SFTWKBGeometryWriter.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFTWKBGeometryWriter.h"
+#import "SFPoint.h"
+#import "SFPolygon.h"
+#import "SFGeometryCollection.h"
+
+/**
+ * Number of coordinate values buffered on the stack before falling back to
+ * the heap
+ */
+#define SF_TWKB_BUFFER_SIZE 1024
+
+/**
+ * Bounding box metadata flag
+ */
+#define SF_TWKB_BBOX_FLAG 0x01
+
+/**
+ * Size metadata flag
+ */
+#define SF_TWKB_SIZE_FLAG 0x02
+
+/**
+ * ID list metadata flag
+ */
+#define SF_TWKB_IDS_FLAG 0x04
+
+/**
+ * Extended precision metadata flag
+ */
+#define SF_TWKB_EXTENDED_FLAG 0x08
+
+/**
+ * Empty geometry metadata flag
+ */
+#define SF_TWKB_EMPTY_FLAG 0x10
+
+/**
+ * Growable byte buffer
+ */
+typedef struct SFTWKBBuffer{
+    uint8_t *bytes;
+    size_t length;
+    size_t capacity;
+} SFTWKBBuffer;
+
+/**
+ * Coordinate encoding state of a geometry with a header
+ */
+typedef struct SFTWKBEncoder{
+    BOOL hasZ;
+    BOOL hasM;
+    int dimensions;
+    double scales[4];
+    int64_t previous[4];
+    int64_t min[4];
+    int64_t max[4];
+} SFTWKBEncoder;
+
+/**
+ * Ensure the buffer has capacity for additional bytes
+ *
+ * @param buffer
+ *            buffer
+ * @param count
+ *            number of additional bytes
+ */
+static void SFTWKBBufferReserve(SFTWKBBuffer *buffer, size_t count){
+    if(buffer->length + count > buffer->capacity){
+        buffer->capacity = MAX(64, MAX(buffer->capacity * 2, buffer->length + count));
+        buffer->bytes = realloc(buffer->bytes, buffer->capacity);
+    }
+}
+
+/**
+ * Write a byte
+ *
+ * @param buffer
+ *            buffer
+ * @param value
+ *            byte value
+ */
+static void SFTWKBWriteByte(SFTWKBBuffer *buffer, uint8_t value){
+    SFTWKBBufferReserve(buffer, 1);
+    buffer->bytes[buffer->length++] = value;
+}
+
+/**
+ * Write an unsigned varint, 7 bits per byte with a continuation high bit
+ *
+ * @param buffer
+ *            buffer
+ * @param value
+ *            value
+ */
+static void SFTWKBWriteVarint(SFTWKBBuffer *buffer, uint64_t value){
+    SFTWKBBufferReserve(buffer, 10);
+    uint8_t *bytes = buffer->bytes + buffer->length;
+    int count = 0;
+    while(value >= 0x80){
+        bytes[count++] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+    bytes[count++] = (uint8_t) value;
+    buffer->length += count;
+}
+
+/**
+ * Write a signed value as a zigzag varint
+ *
+ * @param buffer
+ *            buffer
+ * @param value
+ *            value
+ */
+static void SFTWKBWriteSigned(SFTWKBBuffer *buffer, int64_t value){
+    SFTWKBWriteVarint(buffer, ((uint64_t) value << 1) ^ (uint64_t) (value >> 63));
+}
+
+/**
+ * Initialize the encoder
+ *
+ * @param encoder
+ *            encoder
+ * @param hasZ
+ *            has z
+ * @param hasM
+ *            has m
+ * @param precision
+ *            x and y precision
+ * @param zPrecision
+ *            z precision
+ * @param mPrecision
+ *            m precision
+ */
+static void SFTWKBEncoderInit(SFTWKBEncoder *encoder, BOOL hasZ, BOOL hasM, int precision, int zPrecision, int mPrecision){
+    encoder->hasZ = hasZ;
+    encoder->hasM = hasM;
+    encoder->dimensions = 2;
+    encoder->scales[0] = pow(10.0, precision);
+    encoder->scales[1] = encoder->scales[0];
+    if(hasZ){
+        encoder->scales[encoder->dimensions++] = pow(10.0, zPrecision);
+    }
+    if(hasM){
+        encoder->scales[encoder->dimensions++] = pow(10.0, mPrecision);
+    }
+    for(int i = 0; i < 4; i++){
+        encoder->previous[i] = 0;
+        encoder->min[i] = INT64_MAX;
+        encoder->max[i] = INT64_MIN;
+    }
+}
+
+/**
+ * Write delta encoded coordinates, tracking the bounds
+ *
+ * @param buffer
+ *            buffer
+ * @param encoder
+ *            encoder
+ * @param values
+ *            interleaved coordinate values of the encoder dimensions
+ * @param count
+ *            number of coordinates
+ */
+static void SFTWKBWriteCoordinates(SFTWKBBuffer *buffer, SFTWKBEncoder *encoder, const double *values, size_t count){
+    int dimensions = encoder->dimensions;
+    SFTWKBBufferReserve(buffer, 10 * dimensions * count);
+    for(size_t i = 0; i < count; i++){
+        for(int d = 0; d < dimensions; d++){
+            int64_t value = llround(values[i * dimensions + d] * encoder->scales[d]);
+            SFTWKBWriteSigned(buffer, value - encoder->previous[d]);
+            encoder->previous[d] = value;
+            encoder->min[d] = MIN(encoder->min[d], value);
+            encoder->max[d] = MAX(encoder->max[d], value);
+        }
+    }
+}
+
+@implementation SFTWKBGeometryWriter
+
+-(instancetype) init{
+    return [self initWithPrecision:0];
+}
+
+-(instancetype) initWithPrecision: (int) precision{
+    self = [super init];
+    if(self != nil){
+        [self setPrecision:precision];
+        _zPrecision = 0;
+        _mPrecision = 0;
+        _includeBoundingBox = NO;
+        _includeSize = NO;
+    }
+    return self;
+}
+
+-(void) setPrecision: (int) precision{
+    if(precision < -8 || precision > 7){
+        [NSException raise:@"Invalid Precision" format:@"Precision must be from -8 through 7: %d", precision];
+    }
+    _precision = precision;
+}
+
+-(void) setZPrecision: (int) zPrecision{
+    if(zPrecision < 0 || zPrecision > 7){
+        [NSException raise:@"Invalid Precision" format:@"Z precision must be from 0 through 7: %d", zPrecision];
+    }
+    _zPrecision = zPrecision;
+}
+
+-(void) setMPrecision: (int) mPrecision{
+    if(mPrecision < 0 || mPrecision > 7){
+        [NSException raise:@"Invalid Precision" format:@"M precision must be from 0 through 7: %d", mPrecision];
+    }
+    _mPrecision = mPrecision;
+}
+
+-(NSData *) writeGeometry: (SFGeometry *) geometry{
+    return [self writeGeometry:geometry withIds:nil];
+}
+
+-(NSData *) writeGeometry: (SFGeometry *) geometry withIds: (NSArray<NSNumber *> *) ids{
+    SFTWKBBuffer buffer = {NULL, 0, 0};
+    int64_t min[4];
+    int64_t max[4];
+    @try {
+        [self encodeGeometry:geometry withIds:ids intoBuffer:&buffer withMin:min andMax:max];
+    } @catch (NSException *exception) {
+        free(buffer.bytes);
+        @throw exception;
+    }
+    return [NSData dataWithBytesNoCopy:buffer.bytes length:buffer.length freeWhenDone:YES];
+}
+
+-(void) writeGeometry: (SFGeometry *) geometry toWriter: (SFByteWriter *) writer{
+    [writer writeData:[self writeGeometry:geometry]];
+}
+
++(NSData *) bytesWithGeometry: (SFGeometry *) geometry andPrecision: (int) precision{
+    return [[[SFTWKBGeometryWriter alloc] initWithPrecision:precision] writeGeometry:geometry];
+}
+
+/**
+ * Encode a geometry with a header
+ *
+ * @param geometry
+ *            geometry
+ * @param ids
+ *            child geometry IDs or nil
+ * @param buffer
+ *            buffer
+ * @param min
+ *            set to the quantized min of each dimension
+ * @param max
+ *            set to the quantized max of each dimension
+ */
+-(void) encodeGeometry: (SFGeometry *) geometry withIds: (NSArray<NSNumber *> *) ids intoBuffer: (SFTWKBBuffer *) buffer withMin: (int64_t *) min andMax: (int64_t *) max{
+    
+    enum SFGeometryType geometryType = geometry.geometryType;
+    uint8_t typeCode = 0;
+    switch(geometryType){
+        case SF_POINT:
+        case SF_LINESTRING:
+        case SF_POLYGON:
+        case SF_MULTIPOINT:
+        case SF_MULTILINESTRING:
+        case SF_MULTIPOLYGON:
+        case SF_GEOMETRYCOLLECTION:
+            typeCode = geometryType;
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for TWKB: %@", [SFGeometryTypes name:geometryType]];
+    }
+    
+    BOOL hasZ = geometry.hasZ;
+    BOOL hasM = geometry.hasM;
+    BOOL empty = NO;
+    if(geometryType == SF_POINT){
+        SFPoint *point = (SFPoint *) geometry;
+        empty = isnan([point.x doubleValue]) || isnan([point.y doubleValue]);
+    }else{
+        empty = [geometry isEmpty];
+    }
+    
+    int count = 0;
+    if(ids != nil){
+        if(geometryType < SF_MULTIPOINT || geometryType > SF_GEOMETRYCOLLECTION){
+            [NSException raise:@"Invalid Ids" format:@"ID lists are only supported for multi geometries and geometry collections, not: %@", [SFGeometryTypes name:geometryType]];
+        }
+        count = [((SFGeometryCollection *) geometry) numGeometries];
+        if(ids.count != count){
+            [NSException raise:@"Invalid Ids" format:@"ID count: %lu does not match geometry count: %d", (unsigned long) ids.count, count];
+        }
+    }
+    
+    SFTWKBEncoder encoder;
+    SFTWKBEncoderInit(&encoder, hasZ, hasM, self.precision, self.zPrecision, self.mPrecision);
+    
+    SFTWKBBuffer body = {NULL, 0, 0};
+    SFTWKBBuffer bounds = {NULL, 0, 0};
+    @try {
+        
+        if(!empty){
+            [self encodeContentsOfGeometry:geometry withIds:ids intoBuffer:&body withEncoder:&encoder];
+        }
+        
+        uint8_t metadata = 0;
+        if(self.includeBoundingBox && encoder.min[0] <= encoder.max[0]){
+            metadata |= SF_TWKB_BBOX_FLAG;
+            for(int d = 0; d < encoder.dimensions; d++){
+                SFTWKBWriteSigned(&bounds, encoder.min[d]);
+                SFTWKBWriteSigned(&bounds, encoder.max[d] - encoder.min[d]);
+            }
+        }
+        if(self.includeSize){
+            metadata |= SF_TWKB_SIZE_FLAG;
+        }
+        if(ids != nil && !empty){
+            metadata |= SF_TWKB_IDS_FLAG;
+        }
+        if(hasZ || hasM){
+            metadata |= SF_TWKB_EXTENDED_FLAG;
+        }
+        if(empty){
+            metadata |= SF_TWKB_EMPTY_FLAG;
+        }
+        
+        SFTWKBWriteByte(buffer, typeCode | (uint8_t) (((self.precision << 1) ^ (self.precision >> 31)) << 4));
+        SFTWKBWriteByte(buffer, metadata);
+        if(hasZ || hasM){
+            SFTWKBWriteByte(buffer, (hasZ ? 0x01 : 0) | (hasM ? 0x02 : 0) | (self.zPrecision << 2) | (self.mPrecision << 5));
+        }
+        if(self.includeSize){
+            SFTWKBWriteVarint(buffer, bounds.length + body.length);
+        }
+        SFTWKBBufferReserve(buffer, bounds.length + body.length);
+        if(bounds.length > 0){
+            memcpy(buffer->bytes + buffer->length, bounds.bytes, bounds.length);
+            buffer->length += bounds.length;
+        }
+        if(body.length > 0){
+            memcpy(buffer->bytes + buffer->length, body.bytes, body.length);
+            buffer->length += body.length;
+        }
+        
+    } @finally {
+        free(bounds.bytes);
+        free(body.bytes);
+    }
+    
+    for(int d = 0; d < 4; d++){
+        min[d] = d < encoder.dimensions ? encoder.min[d] : INT64_MAX;
+        max[d] = d < encoder.dimensions ? encoder.max[d] : INT64_MIN;
+    }
+    
+}
+
+/**
+ * Encode the contents of a non empty geometry following its header
+ *
+ * @param geometry
+ *            geometry
+ * @param ids
+ *            child geometry IDs or nil
+ * @param buffer
+ *            buffer
+ * @param encoder
+ *            encoder
+ */
+-(void) encodeContentsOfGeometry: (SFGeometry *) geometry withIds: (NSArray<NSNumber *> *) ids intoBuffer: (SFTWKBBuffer *) buffer withEncoder: (SFTWKBEncoder *) encoder{
+    
+    enum SFGeometryType geometryType = geometry.geometryType;
+    switch(geometryType){
+        case SF_POINT:
+            [self encodePoints:@[(SFPoint *) geometry] intoBuffer:buffer withEncoder:encoder];
+            break;
+        case SF_LINESTRING:
+            {
+                NSArray<SFPoint *> *points = ((SFLineString *) geometry).points;
+                SFTWKBWriteVarint(buffer, points.count);
+                [self encodePoints:points intoBuffer:buffer withEncoder:encoder];
+            }
+            break;
+        case SF_POLYGON:
+            [self encodeRingsOfPolygon:(SFPolygon *) geometry intoBuffer:buffer withEncoder:encoder];
+            break;
+        case SF_MULTIPOINT:
+        case SF_MULTILINESTRING:
+        case SF_MULTIPOLYGON:
+        case SF_GEOMETRYCOLLECTION:
+            {
+                NSArray<SFGeometry *> *geometries = ((SFGeometryCollection *) geometry).geometries;
+                SFTWKBWriteVarint(buffer, geometries.count);
+                for(NSNumber *identifier in ids){
+                    SFTWKBWriteSigned(buffer, [identifier longLongValue]);
+                }
+                for(SFGeometry *child in geometries){
+                    switch(geometryType){
+                        case SF_MULTIPOINT:
+                            [self encodePoints:@[(SFPoint *) child] intoBuffer:buffer withEncoder:encoder];
+                            break;
+                        case SF_MULTILINESTRING:
+                            {
+                                NSArray<SFPoint *> *points = ((SFLineString *) child).points;
+                                SFTWKBWriteVarint(buffer, points.count);
+                                [self encodePoints:points intoBuffer:buffer withEncoder:encoder];
+                            }
+                            break;
+                        case SF_MULTIPOLYGON:
+                            [self encodeRingsOfPolygon:(SFPolygon *) child intoBuffer:buffer withEncoder:encoder];
+                            break;
+                        default:
+                            {
+                                int64_t min[4];
+                                int64_t max[4];
+                                [self encodeGeometry:child withIds:nil intoBuffer:buffer withMin:min andMax:max];
+                                int dimensions = child.hasZ == encoder->hasZ && child.hasM == encoder->hasM ? encoder->dimensions : 2;
+                                for(int d = 0; d < dimensions; d++){
+                                    encoder->min[d] = MIN(encoder->min[d], min[d]);
+                                    encoder->max[d] = MAX(encoder->max[d], max[d]);
+                                }
+                            }
+                            break;
+                    }
+                }
+            }
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for TWKB: %@", [SFGeometryTypes name:geometryType]];
+    }
+    
+}
+
+/**
+ * Encode the counted rings of a polygon
+ *
+ * @param polygon
+ *            polygon
+ * @param buffer
+ *            buffer
+ * @param encoder
+ *            encoder
+ */
+-(void) encodeRingsOfPolygon: (SFPolygon *) polygon intoBuffer: (SFTWKBBuffer *) buffer withEncoder: (SFTWKBEncoder *) encoder{
+    NSArray<SFLineString *> *rings = polygon.lineStrings;
+    SFTWKBWriteVarint(buffer, rings.count);
+    for(SFLineString *ring in rings){
+        NSArray<SFPoint *> *points = ring.points;
+        SFTWKBWriteVarint(buffer, points.count);
+        [self encodePoints:points intoBuffer:buffer withEncoder:encoder];
+    }
+}
+
+/**
+ * Encode the point coordinates in the encoder dimensions, missing z and m
+ * values are encoded as 0
+ *
+ * @param points
+ *            points
+ * @param buffer
+ *            buffer
+ * @param encoder
+ *            encoder
+ */
+-(void) encodePoints: (NSArray<SFPoint *> *) points intoBuffer: (SFTWKBBuffer *) buffer withEncoder: (SFTWKBEncoder *) encoder{
+    
+    int dimensions = encoder->dimensions;
+    size_t count = points.count;
+    size_t valueCount = dimensions * count;
+    double stackValues[SF_TWKB_BUFFER_SIZE];
+    double *values = valueCount <= SF_TWKB_BUFFER_SIZE ? stackValues : malloc(sizeof(double) * valueCount);
+    
+    int index = 0;
+    for(SFPoint *point in points){
+        values[index++] = [point.x doubleValue];
+        values[index++] = [point.y doubleValue];
+        if(encoder->hasZ){
+            values[index++] = point.z != nil ? [point.z doubleValue] : 0.0;
+        }
+        if(encoder->hasM){
+            values[index++] = point.m != nil ? [point.m doubleValue] : 0.0;
+        }
+    }
+    
+    SFTWKBWriteCoordinates(buffer, encoder, values, count);
+    
+    if(values != stackValues){
+        free(values);
+    }
+    
+}
+
+@end
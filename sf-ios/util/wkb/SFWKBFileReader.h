@@ -0,0 +1,152 @@
+//
+//  SFWKBFileReader.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+#import "SFByteReader.h"
+#import "SFGeometryFilter.h"
+
+/**
+ * Streaming reader of WKB geometry records from a memory mapped file. Records
+ * are either concatenated WKB geometries or WKB geometries each preceded by
+ * a 4 byte length. Geometries are decoded one at a time directly from the
+ * mapped bytes, and records can be skipped by reading only their headers.
+ */
+@interface SFWKBFileReader : NSEnumerator<SFGeometry *>
+
+/**
+ * Mapped file data
+ */
+@property (nonatomic, strong, readonly) NSData *data;
+
+/**
+ * True if each record is preceded by a 4 byte length
+ */
+@property (nonatomic, readonly) BOOL lengthPrefixed;
+
+/**
+ * Byte order of the record length prefixes
+ */
+@property (nonatomic) CFByteOrder byteOrder;
+
+/**
+ * Geometry filter applied to read geometries, filtered records are skipped
+ */
+@property (nonatomic, strong) NSObject<SFGeometryFilter> *filter;
+
+/**
+ * Byte offset of the next record
+ */
+@property (nonatomic) unsigned long long offset;
+
+/**
+ * Initialize, memory mapping the file of concatenated WKB geometries
+ *
+ * @param path
+ *            file path
+ *
+ * @return new reader
+ */
+-(instancetype) initWithPath: (NSString *) path;
+
+/**
+ * Initialize, memory mapping the file
+ *
+ * @param path
+ *            file path
+ * @param lengthPrefixed
+ *            true if each record is preceded by a 4 byte length
+ *
+ * @return new reader
+ */
+-(instancetype) initWithPath: (NSString *) path andLengthPrefixed: (BOOL) lengthPrefixed;
+
+/**
+ * Initialize
+ *
+ * @param data
+ *            record data
+ * @param lengthPrefixed
+ *            true if each record is preceded by a 4 byte length
+ *
+ * @return new reader
+ */
+-(instancetype) initWithData: (NSData *) data andLengthPrefixed: (BOOL) lengthPrefixed;
+
+/**
+ * Determine if there is another record
+ *
+ * @return true if another record
+ */
+-(BOOL) hasNext;
+
+/**
+ * Read the next geometry passing the filter
+ *
+ * @return geometry, nil when no records remain
+ */
+-(SFGeometry *) nextObject;
+
+/**
+ * Get the next geometry as a lazy geometry backed by the data, ignoring the
+ * filter
+ *
+ * @return lazy geometry, nil when no records remain
+ */
+-(SFGeometry *) nextLazyGeometry;
+
+/**
+ * Get the geometry type of the next record without reading it
+ *
+ * @return geometry type, SF_NONE when no records remain
+ */
+-(enum SFGeometryType) peekGeometryType;
+
+/**
+ * Skip the next record without decoding coordinates
+ *
+ * @return skipped geometry type, SF_NONE when no records remain
+ */
+-(enum SFGeometryType) skip;
+
+/**
+ * Read the x and y envelope of the next record without creating geometries,
+ * ignoring the filter
+ *
+ * @return envelope, nil when empty or no records remain
+ */
+-(SFGeometryEnvelope *) nextEnvelope;
+
+/**
+ * Read the x and y bounds of the next record without creating geometries or
+ * envelope objects, ignoring the filter
+ *
+ * @param bounds
+ *            bounds with capacity for min x, min y, max x, and max y
+ * @return true if bounds were read, false when empty or no records remain
+ */
+-(BOOL) nextBounds: (double *) bounds;
+
+/**
+ * Read the next record as a byte reader over the record bytes. The record
+ * bytes are not copied and retain the file data, remaining valid after this
+ * reader is released.
+ *
+ * @return byte reader, nil when no records remain
+ */
+-(SFByteReader *) readRecord;
+
+/**
+ * Enumerate the remaining geometries passing the filter
+ *
+ * @param block
+ *            geometry block, set stop to true to stop enumerating
+ */
+-(void) enumerateGeometriesUsingBlock: (void (^)(SFGeometry *geometry, BOOL *stop)) block;
+
+@end
@@ -0,0 +1,186 @@
+//
+//  SFWKBFileReader.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFWKBFileReader.h"
+#import "SFWKBGeometryReader.h"
+#import "SFWKBGeometryBytes.h"
+
+@interface SFWKBFileReader()
+
+/**
+ * Mapped file data
+ */
+@property (nonatomic, strong) NSData *data;
+
+/**
+ * True if each record is preceded by a 4 byte length
+ */
+@property (nonatomic) BOOL lengthPrefixed;
+
+@end
+
+@implementation SFWKBFileReader
+
+-(instancetype) initWithPath: (NSString *) path{
+    return [self initWithPath:path andLengthPrefixed:NO];
+}
+
+-(instancetype) initWithPath: (NSString *) path andLengthPrefixed: (BOOL) lengthPrefixed{
+    NSError *error = nil;
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedAlways error:&error];
+    if(data == nil){
+        [NSException raise:@"File Read" format:@"Failed to map WKB file: %@, Error: %@", path, error];
+    }
+    return [self initWithData:data andLengthPrefixed:lengthPrefixed];
+}
+
+-(instancetype) initWithData: (NSData *) data andLengthPrefixed: (BOOL) lengthPrefixed{
+    self = [super init];
+    if(self != nil){
+        self.data = data;
+        self.lengthPrefixed = lengthPrefixed;
+        self.byteOrder = DEFAULT_READ_BYTE_ORDER;
+        self.offset = 0;
+    }
+    return self;
+}
+
+-(BOOL) hasNext{
+    return self.offset < self.data.length;
+}
+
+-(SFGeometry *) nextObject{
+    SFGeometry *geometry = nil;
+    while(geometry == nil && [self hasNext]){
+        size_t offset = (size_t) self.offset;
+        size_t end = [self recordEndWithOffset:&offset];
+        geometry = [SFWKBGeometryReader readGeometryWithBytes:self.data.bytes andLength:end andOffset:&offset andFilter:self.filter];
+        self.offset = self.lengthPrefixed ? end : offset;
+    }
+    return geometry;
+}
+
+-(SFGeometry *) nextLazyGeometry{
+    SFGeometry *geometry = nil;
+    if([self hasNext]){
+        size_t offset = (size_t) self.offset;
+        size_t end = [self recordEndWithOffset:&offset];
+        SFWKBGeometryBytes *wkb = [[SFWKBGeometryBytes alloc] initWithData:self.data andOffset:offset];
+        if(offset + wkb.length > end){
+            [NSException raise:@"Invalid WKB" format:@"Geometry exceeds record at byte offset: %zu", offset];
+        }
+        geometry = [wkb lazyGeometry];
+        self.offset = self.lengthPrefixed ? end : offset + wkb.length;
+    }
+    return geometry;
+}
+
+-(enum SFGeometryType) peekGeometryType{
+    enum SFGeometryType geometryType = SF_NONE;
+    if([self hasNext]){
+        size_t offset = (size_t) self.offset;
+        size_t end = [self recordEndWithOffset:&offset];
+        geometryType = [SFWKBGeometryReader geometryTypeWithBytes:self.data.bytes andLength:end andOffset:offset];
+    }
+    return geometryType;
+}
+
+-(enum SFGeometryType) skip{
+    enum SFGeometryType geometryType = SF_NONE;
+    if([self hasNext]){
+        size_t offset = (size_t) self.offset;
+        size_t end = [self recordEndWithOffset:&offset];
+        if(self.lengthPrefixed){
+            geometryType = [SFWKBGeometryReader geometryTypeWithBytes:self.data.bytes andLength:end andOffset:offset];
+            offset = end;
+        }else{
+            geometryType = [SFWKBGeometryReader skipGeometryWithBytes:self.data.bytes andLength:end andOffset:&offset];
+        }
+        self.offset = offset;
+    }
+    return geometryType;
+}
+
+-(SFGeometryEnvelope *) nextEnvelope{
+    SFGeometryEnvelope *envelope = nil;
+    if([self hasNext]){
+        size_t offset = (size_t) self.offset;
+        size_t end = [self recordEndWithOffset:&offset];
+        envelope = [SFWKBGeometryReader envelopeWithBytes:self.data.bytes andLength:end andOffset:&offset andZ:NO andM:NO];
+        self.offset = self.lengthPrefixed ? end : offset;
+    }
+    return envelope;
+}
+
+-(BOOL) nextBounds: (double *) bounds{
+    BOOL read = NO;
+    if([self hasNext]){
+        size_t offset = (size_t) self.offset;
+        size_t end = [self recordEndWithOffset:&offset];
+        read = [SFWKBGeometryReader readBounds:bounds withBytes:self.data.bytes andLength:end andOffset:&offset];
+        self.offset = self.lengthPrefixed ? end : offset;
+    }
+    return read;
+}
+
+-(SFByteReader *) readRecord{
+    SFByteReader *reader = nil;
+    if([self hasNext]){
+        size_t offset = (size_t) self.offset;
+        size_t end = [self recordEndWithOffset:&offset];
+        if(!self.lengthPrefixed){
+            end = offset;
+            [SFWKBGeometryReader skipGeometryWithBytes:self.data.bytes andLength:self.data.length andOffset:&end];
+        }
+        NSData *data = self.data;
+        NSData *record = [[NSData alloc] initWithBytesNoCopy:(void *) ((const uint8_t *) data.bytes + offset) length:end - offset deallocator:^(void *bytes, NSUInteger length){
+            // Retain the mapped file data until the record is released
+            (void) data;
+        }];
+        reader = [[SFByteReader alloc] initWithData:record];
+        self.offset = end;
+    }
+    return reader;
+}
+
+-(void) enumerateGeometriesUsingBlock: (void (^)(SFGeometry *geometry, BOOL *stop)) block{
+    BOOL stop = NO;
+    SFGeometry *geometry = nil;
+    while(!stop && (geometry = [self nextObject]) != nil){
+        block(geometry, &stop);
+    }
+}
+
+/**
+ * Get the end byte offset of the record, reading the length prefix when
+ * length prefixed
+ *
+ * @param offset
+ *            record byte offset, set to the geometry byte offset
+ * @return record end byte offset, or data length when not length prefixed
+ */
+-(size_t) recordEndWithOffset: (size_t *) offset{
+    size_t length = self.data.length;
+    size_t end = length;
+    if(self.lengthPrefixed){
+        if(length - *offset < 4){
+            [NSException raise:@"Invalid WKB" format:@"Truncated record length at byte offset: %zu", *offset];
+        }
+        uint32_t recordLength = 0;
+        memcpy(&recordLength, (const uint8_t *) self.data.bytes + *offset, 4);
+        recordLength = self.byteOrder == CFByteOrderBigEndian ? CFSwapInt32BigToHost(recordLength) : CFSwapInt32LittleToHost(recordLength);
+        *offset += 4;
+        if(length - *offset < recordLength){
+            [NSException raise:@"Invalid WKB" format:@"Record length: %u exceeds remaining bytes at byte offset: %zu", recordLength, *offset];
+        }
+        end = *offset + recordLength;
+    }
+    return end;
+}
+
+@end
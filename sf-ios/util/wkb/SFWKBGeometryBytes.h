@@ -0,0 +1,145 @@
+//
+//  SFWKBGeometryBytes.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+#import "SFPoint.h"
+
+/**
+ * Byte range of a WKB geometry, or of a polygon ring coordinate run, within
+ * retained data. Headers, counts, and single coordinates are read on demand,
+ * backing the lazy WKB geometries which decode only when their contents are
+ * accessed.
+ */
+@interface SFWKBGeometryBytes : NSObject
+
+/**
+ * Retained WKB data
+ */
+@property (nonatomic, strong, readonly) NSData *data;
+
+/**
+ * Byte offset of the geometry header, or of the point count for a ring
+ */
+@property (nonatomic, readonly) size_t offset;
+
+/**
+ * Number of bytes of the geometry or ring
+ */
+@property (nonatomic, readonly) size_t length;
+
+/**
+ * Geometry type, line string for a ring
+ */
+@property (nonatomic, readonly) enum SFGeometryType geometryType;
+
+/**
+ * Has z coordinates
+ */
+@property (nonatomic, readonly) BOOL hasZ;
+
+/**
+ * Has m coordinates
+ */
+@property (nonatomic, readonly) BOOL hasM;
+
+/**
+ * True if big endian byte order
+ */
+@property (nonatomic, readonly) BOOL bigEndian;
+
+/**
+ * True if a geometry with a header, false for a ring coordinate run
+ */
+@property (nonatomic, readonly) BOOL hasHeader;
+
+/**
+ * Number of points, rings, or child geometries, 1 for a point
+ */
+@property (nonatomic, readonly) int count;
+
+/**
+ * Initialize over the first geometry of the data
+ *
+ * @param data
+ *            WKB data
+ *
+ * @return new geometry bytes
+ */
+-(instancetype) initWithData: (NSData *) data;
+
+/**
+ * Initialize over the geometry at the byte offset of the data
+ *
+ * @param data
+ *            WKB data
+ * @param offset
+ *            geometry byte offset
+ *
+ * @return new geometry bytes
+ */
+-(instancetype) initWithData: (NSData *) data andOffset: (size_t) offset;
+
+/**
+ * Get a lazy geometry over the bytes. Line strings, polygons, multi line
+ * strings, multi polygons, and geometry collections are returned as lazy
+ * WKB geometries, other types are decoded.
+ *
+ * @return geometry
+ */
+-(SFGeometry *) lazyGeometry;
+
+/**
+ * Decode the geometry
+ *
+ * @return geometry
+ */
+-(SFGeometry *) readGeometry;
+
+/**
+ * Get the envelope directly from the bytes, including the z and m ranges
+ * when present
+ *
+ * @return envelope, nil when empty
+ */
+-(SFGeometryEnvelope *) envelope;
+
+/**
+ * Read a single point of a line string or ring by its byte offset
+ *
+ * @param n
+ *            point index
+ * @return new point
+ */
+-(SFPoint *) pointAtIndex: (int) n;
+
+/**
+ * Read the points of a line string or ring
+ *
+ * @return points
+ */
+-(NSMutableArray<SFPoint *> *) readPoints;
+
+/**
+ * Get the bytes of a polygon ring or child geometry, locating the children
+ * by their headers and counts on first access
+ *
+ * @param n
+ *            ring or child geometry index
+ * @return child geometry bytes
+ */
+-(SFWKBGeometryBytes *) childAtIndex: (int) n;
+
+/**
+ * Get lazy geometries of the polygon rings or child geometries
+ *
+ * @return lazy geometries
+ */
+-(NSMutableArray<SFGeometry *> *) lazyChildren;
+
+@end
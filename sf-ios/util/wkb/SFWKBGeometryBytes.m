@@ -0,0 +1,284 @@
+//
+//  SFWKBGeometryBytes.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFWKBGeometryBytes.h"
+#import "SFWKBGeometryReader.h"
+#import "SFWKBLineString.h"
+#import "SFWKBPolygon.h"
+#import "SFWKBMultiLineString.h"
+#import "SFWKBMultiPolygon.h"
+#import "SFWKBGeometryCollection.h"
+
+@interface SFWKBGeometryBytes()
+
+/**
+ * Retained WKB data
+ */
+@property (nonatomic, strong) NSData *data;
+
+/**
+ * Byte offset of the geometry header, or of the point count for a ring
+ */
+@property (nonatomic) size_t offset;
+
+/**
+ * Number of bytes of the geometry or ring
+ */
+@property (nonatomic) size_t length;
+
+/**
+ * Geometry type, line string for a ring
+ */
+@property (nonatomic) enum SFGeometryType geometryType;
+
+/**
+ * Has z coordinates
+ */
+@property (nonatomic) BOOL hasZ;
+
+/**
+ * Has m coordinates
+ */
+@property (nonatomic) BOOL hasM;
+
+/**
+ * True if big endian byte order
+ */
+@property (nonatomic) BOOL bigEndian;
+
+/**
+ * True if a geometry with a header, false for a ring coordinate run
+ */
+@property (nonatomic) BOOL hasHeader;
+
+/**
+ * Number of points, rings, or child geometries, 1 for a point
+ */
+@property (nonatomic) int count;
+
+/**
+ * Byte offset of the count, or of the coordinate for a point
+ */
+@property (nonatomic) size_t countOffset;
+
+/**
+ * Byte offsets of the rings or child geometries, located on first access
+ */
+@property (nonatomic, strong) NSData *childOffsets;
+
+@end
+
+@implementation SFWKBGeometryBytes
+
+-(instancetype) initWithData: (NSData *) data{
+    return [self initWithData:data andOffset:0];
+}
+
+-(instancetype) initWithData: (NSData *) data andOffset: (size_t) offset{
+    self = [super init];
+    if(self != nil){
+        self.data = data;
+        self.offset = offset;
+        self.hasHeader = YES;
+        enum SFGeometryType geometryType;
+        BOOL hasZ;
+        BOOL hasM;
+        BOOL bigEndian;
+        self.countOffset = [SFWKBGeometryReader readHeaderWithBytes:data.bytes andLength:data.length andOffset:offset andType:&geometryType andHasZ:&hasZ andHasM:&hasM andBigEndian:&bigEndian];
+        self.geometryType = geometryType;
+        self.hasZ = hasZ;
+        self.hasM = hasM;
+        self.bigEndian = bigEndian;
+        self.count = geometryType == SF_POINT ? 1 : [SFWKBGeometryReader readCountWithBytes:data.bytes andLength:data.length andOffset:self.countOffset andBigEndian:bigEndian];
+        size_t end = offset;
+        [SFWKBGeometryReader skipGeometryWithBytes:data.bytes andLength:data.length andOffset:&end];
+        self.length = end - offset;
+    }
+    return self;
+}
+
+/**
+ * Initialize over a polygon ring coordinate run
+ *
+ * @param data
+ *            WKB data
+ * @param offset
+ *            ring point count byte offset
+ * @param hasZ
+ *            has z coordinates
+ * @param hasM
+ *            has m coordinates
+ * @param bigEndian
+ *            big endian byte order
+ *
+ * @return new geometry bytes
+ */
+-(instancetype) initWithData: (NSData *) data andRingOffset: (size_t) offset andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM andBigEndian: (BOOL) bigEndian{
+    self = [super init];
+    if(self != nil){
+        self.data = data;
+        self.offset = offset;
+        self.countOffset = offset;
+        self.hasHeader = NO;
+        self.geometryType = SF_LINESTRING;
+        self.hasZ = hasZ;
+        self.hasM = hasM;
+        self.bigEndian = bigEndian;
+        self.count = [SFWKBGeometryReader readCountWithBytes:data.bytes andLength:data.length andOffset:offset andBigEndian:bigEndian];
+        self.length = 4 + [self coordinateSize] * (size_t) self.count;
+    }
+    return self;
+}
+
+-(SFGeometry *) lazyGeometry{
+    SFGeometry *geometry = nil;
+    switch(self.geometryType){
+        case SF_LINESTRING:
+            geometry = [[SFWKBLineString alloc] initWithWKB:self];
+            break;
+        case SF_POLYGON:
+            geometry = [[SFWKBPolygon alloc] initWithWKB:self];
+            break;
+        case SF_MULTILINESTRING:
+            geometry = [[SFWKBMultiLineString alloc] initWithWKB:self];
+            break;
+        case SF_MULTIPOLYGON:
+            geometry = [[SFWKBMultiPolygon alloc] initWithWKB:self];
+            break;
+        case SF_GEOMETRYCOLLECTION:
+            geometry = [[SFWKBGeometryCollection alloc] initWithWKB:self];
+            break;
+        default:
+            geometry = [self readGeometry];
+            break;
+    }
+    return geometry;
+}
+
+-(SFGeometry *) readGeometry{
+    SFGeometry *geometry = nil;
+    if(self.hasHeader){
+        size_t offset = self.offset;
+        geometry = [SFWKBGeometryReader readGeometryWithBytes:self.data.bytes andLength:self.offset + self.length andOffset:&offset andFilter:nil];
+    }else{
+        geometry = [[SFLineString alloc] initWithPoints:[self readPoints]];
+    }
+    return geometry;
+}
+
+-(SFGeometryEnvelope *) envelope{
+    SFGeometryEnvelope *envelope = nil;
+    if(self.hasHeader){
+        size_t offset = self.offset;
+        envelope = [SFWKBGeometryReader envelopeWithBytes:self.data.bytes andLength:self.offset + self.length andOffset:&offset andZ:self.hasZ andM:self.hasM];
+    }else{
+        envelope = [[self readGeometry] envelope];
+    }
+    return envelope;
+}
+
+-(SFPoint *) pointAtIndex: (int) n{
+    size_t offset = 0;
+    switch(self.geometryType){
+        case SF_POINT:
+            offset = self.countOffset;
+            break;
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+            offset = self.countOffset + 4;
+            break;
+        default:
+            [NSException raise:@"Geometry Not Supported" format:@"Unsupported Geometry Type for point at index: %@", [SFGeometryTypes name:self.geometryType]];
+    }
+    if(n < 0 || n >= self.count){
+        [NSException raise:NSRangeException format:@"Point index: %d beyond bounds of count: %d", n, self.count];
+    }
+    offset += [self coordinateSize] * (size_t) n;
+    return [SFWKBGeometryReader readPointWithBytes:self.data.bytes andLength:self.data.length andOffset:offset andHasZ:self.hasZ andHasM:self.hasM andBigEndian:self.bigEndian];
+}
+
+-(NSMutableArray<SFPoint *> *) readPoints{
+    NSMutableArray<SFPoint *> *points = nil;
+    if(self.geometryType == SF_POINT){
+        points = [NSMutableArray arrayWithObject:[self pointAtIndex:0]];
+    }else{
+        size_t offset = self.countOffset;
+        points = [SFWKBGeometryReader readPointsWithBytes:self.data.bytes andLength:self.data.length andOffset:&offset andHasZ:self.hasZ andHasM:self.hasM andBigEndian:self.bigEndian];
+    }
+    return points;
+}
+
+-(SFWKBGeometryBytes *) childAtIndex: (int) n{
+    if(n < 0 || n >= self.count || self.geometryType == SF_POINT){
+        [NSException raise:NSRangeException format:@"Child index: %d beyond bounds of count: %d", n, self.geometryType == SF_POINT ? 0 : self.count];
+    }
+    size_t offset = ((const size_t *) [self locateChildren].bytes)[n];
+    SFWKBGeometryBytes *child = nil;
+    if([self hasRings]){
+        child = [[SFWKBGeometryBytes alloc] initWithData:self.data andRingOffset:offset andHasZ:self.hasZ andHasM:self.hasM andBigEndian:self.bigEndian];
+    }else{
+        child = [[SFWKBGeometryBytes alloc] initWithData:self.data andOffset:offset];
+    }
+    return child;
+}
+
+-(NSMutableArray<SFGeometry *> *) lazyChildren{
+    NSMutableArray<SFGeometry *> *children = [NSMutableArray arrayWithCapacity:self.count];
+    for(int i = 0; i < self.count; i++){
+        [children addObject:[[self childAtIndex:i] lazyGeometry]];
+    }
+    return children;
+}
+
+/**
+ * Determine if the children are ring coordinate runs
+ *
+ * @return true if polygon or triangle rings
+ */
+-(BOOL) hasRings{
+    return self.geometryType == SF_POLYGON || self.geometryType == SF_TRIANGLE;
+}
+
+/**
+ * Locate the child byte offsets, walking only the ring counts or child
+ * headers and counts
+ *
+ * @return child byte offsets
+ */
+-(NSData *) locateChildren{
+    if(self.childOffsets == nil){
+        NSMutableData *childOffsets = [NSMutableData dataWithLength:sizeof(size_t) * self.count];
+        size_t *offsets = childOffsets.mutableBytes;
+        const void *bytes = self.data.bytes;
+        size_t length = self.offset + self.length;
+        size_t offset = self.countOffset + 4;
+        BOOL rings = [self hasRings];
+        size_t coordinateSize = [self coordinateSize];
+        for(int i = 0; i < self.count; i++){
+            offsets[i] = offset;
+            if(rings){
+                offset += 4 + coordinateSize * [SFWKBGeometryReader readCountWithBytes:bytes andLength:length andOffset:offset andBigEndian:self.bigEndian];
+            }else{
+                [SFWKBGeometryReader skipGeometryWithBytes:bytes andLength:length andOffset:&offset];
+            }
+        }
+        self.childOffsets = childOffsets;
+    }
+    return self.childOffsets;
+}
+
+/**
+ * Get the number of bytes per coordinate
+ *
+ * @return coordinate size
+ */
+-(size_t) coordinateSize{
+    return 8 * (2 + self.hasZ + self.hasM);
+}
+
+@end
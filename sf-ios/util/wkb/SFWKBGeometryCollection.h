@@ -0,0 +1,39 @@
+//
+//  SFWKBGeometryCollection.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFGeometryCollection.h"
+#import "SFWKBGeometryBytes.h"
+
+/**
+ * Geometry collection backed by WKB bytes. The geometry count and envelope are read from the bytes, and the geometries are created as lazy WKB geometries on first access.
+ */
+@interface SFWKBGeometryCollection : SFGeometryCollection
+
+/**
+ * WKB bytes of the geometry collection
+ */
+@property (nonatomic, strong, readonly) SFWKBGeometryBytes *wkb;
+
+/**
+ * Initialize
+ *
+ * @param wkb
+ *            WKB bytes of the geometry collection
+ *
+ * @return new lazy geometry collection
+ */
+-(instancetype) initWithWKB: (SFWKBGeometryBytes *) wkb;
+
+/**
+ * Determine if the geometry collection contents have been decoded
+ *
+ * @return true if decoded
+ */
+-(BOOL) isDecoded;
+
+@end
@@ -0,0 +1,64 @@
+//
+//  SFWKBGeometryCollection.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFWKBGeometryCollection.h"
+
+@interface SFWKBGeometryCollection()
+
+/**
+ * WKB bytes of the geometry
+ */
+@property (nonatomic, strong) SFWKBGeometryBytes *wkb;
+
+/**
+ * True once the contents are decoded or replaced
+ */
+@property (nonatomic) BOOL decoded;
+
+@end
+
+@implementation SFWKBGeometryCollection
+
+-(instancetype) initWithWKB: (SFWKBGeometryBytes *) wkb{
+    self = [super initWithHasZ:wkb.hasZ andHasM:wkb.hasM];
+    if(self != nil){
+        self.wkb = wkb;
+        self.decoded = NO;
+    }
+    return self;
+}
+
+-(BOOL) isDecoded{
+    return self.decoded || self.wkb == nil;
+}
+
+-(NSMutableArray<SFGeometry *> *) geometries{
+    if(![self isDecoded]){
+        [self setGeometries:[self.wkb lazyChildren]];
+    }
+    return [super geometries];
+}
+
+-(void) setGeometries: (NSMutableArray<SFGeometry *> *) geometries{
+    self.decoded = YES;
+    [super setGeometries:geometries];
+}
+
+-(int) numGeometries{
+    return [self isDecoded] ? [super numGeometries] : self.wkb.count;
+}
+
+-(BOOL) isEmpty{
+    return [self numGeometries] == 0;
+}
+
+-(SFGeometryEnvelope *) envelope{
+    return [self isDecoded] ? [super envelope] : [self.wkb envelope];
+}
+
+@end
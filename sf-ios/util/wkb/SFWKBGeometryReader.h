@@ -0,0 +1,265 @@
+//
+//  SFWKBGeometryReader.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "SFGeometry.h"
+#import "SFPoint.h"
+#import "SFByteReader.h"
+#import "SFGeometryFilter.h"
+
+/**
+ * Well-Known Binary geometry reader. Reads big and little endian WKB with
+ * ISO (1000, 2000, 3000) or extended (EWKB) z, m, and SRID type flags
+ * directly from the bytes without copying.
+ */
+@interface SFWKBGeometryReader : NSObject
+
+/**
+ * Read a geometry from the data
+ *
+ * @param data
+ *            WKB data
+ * @return geometry
+ */
++(SFGeometry *) readGeometryWithData: (NSData *) data;
+
+/**
+ * Read a geometry from the data
+ *
+ * @param data
+ *            WKB data
+ * @param filter
+ *            geometry filter, points and geometries failing the filter are
+ *            excluded
+ * @return geometry, nil when filtered
+ */
++(SFGeometry *) readGeometryWithData: (NSData *) data andFilter: (NSObject<SFGeometryFilter> *) filter;
+
+/**
+ * Read a geometry from the byte reader, advancing the next byte past the
+ * geometry. The byte order is read from the WKB.
+ *
+ * @param reader
+ *            byte reader
+ * @return geometry
+ */
++(SFGeometry *) readGeometryWithReader: (SFByteReader *) reader;
+
+/**
+ * Read a geometry from the byte reader, advancing the next byte past the
+ * geometry. The byte order is read from the WKB.
+ *
+ * @param reader
+ *            byte reader
+ * @param filter
+ *            geometry filter, points and geometries failing the filter are
+ *            excluded
+ * @return geometry, nil when filtered
+ */
++(SFGeometry *) readGeometryWithReader: (SFByteReader *) reader andFilter: (NSObject<SFGeometryFilter> *) filter;
+
+/**
+ * Read a geometry from the bytes
+ *
+ * @param bytes
+ *            bytes
+ * @param length
+ *            number of bytes available
+ * @param offset
+ *            geometry byte offset, set to the byte offset after the geometry
+ * @param filter
+ *            geometry filter, points and geometries failing the filter are
+ *            excluded
+ * @return geometry, nil when filtered
+ */
++(SFGeometry *) readGeometryWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t *) offset andFilter: (NSObject<SFGeometryFilter> *) filter;
+
+/**
+ * Get a lazy geometry backed by the data. Line strings, polygons, multi line
+ * strings, multi polygons, and geometry collections are decoded only as
+ * their contents are accessed, other types are decoded.
+ *
+ * @param data
+ *            WKB data, retained by the geometry
+ * @return geometry
+ */
++(SFGeometry *) lazyGeometryWithData: (NSData *) data;
+
+/**
+ * Get a lazy geometry backed by the data at the byte offset
+ *
+ * @param data
+ *            WKB data, retained by the geometry
+ * @param offset
+ *            geometry byte offset
+ * @return geometry
+ */
++(SFGeometry *) lazyGeometryWithData: (NSData *) data andOffset: (size_t) offset;
+
+/**
+ * Read the geometry type from the bytes without reading the geometry
+ *
+ * @param bytes
+ *            bytes
+ * @param length
+ *            number of bytes available
+ * @param offset
+ *            geometry byte offset
+ * @return geometry type
+ */
++(enum SFGeometryType) geometryTypeWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t) offset;
+
+/**
+ * Skip the geometry, walking only the headers and counts and jumping over
+ * the coordinates
+ *
+ * @param bytes
+ *            bytes
+ * @param length
+ *            number of bytes available
+ * @param offset
+ *            geometry byte offset, set to the byte offset after the geometry
+ * @return geometry type
+ */
++(enum SFGeometryType) skipGeometryWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t *) offset;
+
+/**
+ * Get the x and y envelope of the geometry directly from the data without
+ * creating geometries
+ *
+ * @param data
+ *            WKB data
+ * @return envelope, nil when empty
+ */
++(SFGeometryEnvelope *) envelopeWithData: (NSData *) data;
+
+/**
+ * Get the envelope of the geometry directly from the data without creating
+ * geometries
+ *
+ * @param data
+ *            WKB data
+ * @param includeZ
+ *            true to include the z range
+ * @param includeM
+ *            true to include the m range
+ * @return envelope, nil when empty
+ */
++(SFGeometryEnvelope *) envelopeWithData: (NSData *) data andZ: (BOOL) includeZ andM: (BOOL) includeM;
+
+/**
+ * Get the envelope of the geometry directly from the bytes without creating
+ * geometries. Coordinate runs are reduced with vectorized min and max passes
+ * and excluded z and m values are skipped. Circular strings are decoded to
+ * include the extents of their arcs.
+ *
+ * @param bytes
+ *            bytes
+ * @param length
+ *            number of bytes available
+ * @param offset
+ *            geometry byte offset, set to the byte offset after the geometry
+ * @param includeZ
+ *            true to include the z range
+ * @param includeM
+ *            true to include the m range
+ * @return envelope, nil when empty
+ */
++(SFGeometryEnvelope *) envelopeWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t *) offset andZ: (BOOL) includeZ andM: (BOOL) includeM;
+
+/**
+ * Read the x and y bounds of the geometry directly from the bytes without
+ * creating geometries or envelope objects
+ *
+ * @param bounds
+ *            bounds with capacity for min x, min y, max x, and max y
+ * @param bytes
+ *            bytes
+ * @param length
+ *            number of bytes available
+ * @param offset
+ *            geometry byte offset, set to the byte offset after the geometry
+ * @return true if bounds were read, false when empty
+ */
++(BOOL) readBounds: (double *) bounds withBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t *) offset;
+
+/**
+ * Read a geometry header
+ *
+ * @param bytes
+ *            bytes
+ * @param length
+ *            number of bytes available
+ * @param offset
+ *            geometry byte offset
+ * @param geometryType
+ *            geometry type result
+ * @param hasZ
+ *            has z result
+ * @param hasM
+ *            has m result
+ * @param bigEndian
+ *            big endian byte order result
+ * @return byte offset after the header and optional SRID
+ */
++(size_t) readHeaderWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t) offset andType: (enum SFGeometryType *) geometryType andHasZ: (BOOL *) hasZ andHasM: (BOOL *) hasM andBigEndian: (BOOL *) bigEndian;
+
+/**
+ * Read a 4 byte point, ring, or geometry count
+ *
+ * @param bytes
+ *            bytes
+ * @param length
+ *            number of bytes available
+ * @param offset
+ *            count byte offset
+ * @param bigEndian
+ *            big endian byte order
+ * @return count
+ */
++(uint32_t) readCountWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t) offset andBigEndian: (BOOL) bigEndian;
+
+/**
+ * Read a single coordinate as a point
+ *
+ * @param bytes
+ *            bytes
+ * @param length
+ *            number of bytes available
+ * @param offset
+ *            coordinate byte offset
+ * @param hasZ
+ *            coordinate has z
+ * @param hasM
+ *            coordinate has m
+ * @param bigEndian
+ *            big endian byte order
+ * @return point
+ */
++(SFPoint *) readPointWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t) offset andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM andBigEndian: (BOOL) bigEndian;
+
+/**
+ * Read a counted run of coordinates as points
+ *
+ * @param bytes
+ *            bytes
+ * @param length
+ *            number of bytes available
+ * @param offset
+ *            count byte offset, set to the byte offset after the coordinates
+ * @param hasZ
+ *            coordinates have z
+ * @param hasM
+ *            coordinates have m
+ * @param bigEndian
+ *            big endian byte order
+ * @return points
+ */
++(NSMutableArray<SFPoint *> *) readPointsWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t *) offset andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM andBigEndian: (BOOL) bigEndian;
+
+@end
@@ -0,0 +1,914 @@
+//
+//  SFWKBGeometryReader.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Accelerate/Accelerate.h>
+#import "SFWKBGeometryReader.h"
+#import "SFWKBGeometryBytes.h"
+#import "SFPoint.h"
+#import "SFCircularString.h"
+#import "SFCompoundCurve.h"
+#import "SFTriangle.h"
+#import "SFTIN.h"
+#import "SFMultiPoint.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+#import "SFMultiCurve.h"
+#import "SFMultiSurface.h"
+
+/**
+ * Number of coordinate values buffered on the stack before falling back to
+ * the heap
+ */
+#define SF_WKB_BUFFER_SIZE 1024
+
+/**
+ * Big endian (XDR) byte order value
+ */
+#define SF_WKB_BIG_ENDIAN 0
+
+/**
+ * Little endian (NDR) byte order value
+ */
+#define SF_WKB_LITTLE_ENDIAN 1
+
+/**
+ * Extended WKB z flag
+ */
+#define SF_WKB_Z_FLAG 0x80000000
+
+/**
+ * Extended WKB m flag
+ */
+#define SF_WKB_M_FLAG 0x40000000
+
+/**
+ * Extended WKB SRID flag
+ */
+#define SF_WKB_SRID_FLAG 0x20000000
+
+/**
+ * Maximum geometry nesting depth, guarding the recursive readers against
+ * stack exhaustion from malicious or corrupt collections
+ */
+#define SF_WKB_MAX_DEPTH 64
+
+/**
+ * Byte cursor over WKB bytes
+ */
+typedef struct SFWKBCursor{
+    const uint8_t *bytes;
+    size_t length;
+    size_t offset;
+    BOOL bigEndian;
+    BOOL error;
+    int depth;
+} SFWKBCursor;
+
+/**
+ * WKB geometry header
+ */
+typedef struct SFWKBHeader{
+    enum SFGeometryType geometryType;
+    BOOL hasZ;
+    BOOL hasM;
+} SFWKBHeader;
+
+/**
+ * Determine if the number of bytes are available, flagging an error when not
+ *
+ * @param cursor
+ *            cursor
+ * @param count
+ *            number of bytes
+ * @return true if available
+ */
+static BOOL SFWKBAvailable(SFWKBCursor *cursor, size_t count){
+    if(cursor->error || cursor->length - cursor->offset < count){
+        cursor->error = YES;
+        return NO;
+    }
+    return YES;
+}
+
+/**
+ * Enter a nested geometry, flagging an error when the maximum depth is
+ * exceeded
+ *
+ * @param cursor
+ *            cursor
+ * @return true if entered
+ */
+static BOOL SFWKBEnter(SFWKBCursor *cursor){
+    if(cursor->error || cursor->depth >= SF_WKB_MAX_DEPTH){
+        cursor->error = YES;
+        return NO;
+    }
+    cursor->depth++;
+    return YES;
+}
+
+/**
+ * Skip the number of bytes
+ *
+ * @param cursor
+ *            cursor
+ * @param count
+ *            number of bytes
+ */
+static void SFWKBSkip(SFWKBCursor *cursor, size_t count){
+    if(SFWKBAvailable(cursor, count)){
+        cursor->offset += count;
+    }
+}
+
+/**
+ * Read an unsigned 32 bit integer in the cursor byte order
+ *
+ * @param cursor
+ *            cursor
+ * @return value, 0 on error
+ */
+static uint32_t SFWKBReadUInt32(SFWKBCursor *cursor){
+    uint32_t value = 0;
+    if(SFWKBAvailable(cursor, 4)){
+        memcpy(&value, cursor->bytes + cursor->offset, 4);
+        value = cursor->bigEndian ? CFSwapInt32BigToHost(value) : CFSwapInt32LittleToHost(value);
+        cursor->offset += 4;
+    }
+    return value;
+}
+
+/**
+ * Read doubles in the cursor byte order
+ *
+ * @param cursor
+ *            cursor
+ * @param values
+ *            values with capacity for count doubles
+ * @param count
+ *            number of doubles
+ */
+static void SFWKBReadDoubles(SFWKBCursor *cursor, double *values, size_t count){
+    if(SFWKBAvailable(cursor, 8 * count)){
+        memcpy(values, cursor->bytes + cursor->offset, 8 * count);
+        uint64_t *bits = (uint64_t *) values;
+        if(cursor->bigEndian){
+            for(size_t i = 0; i < count; i++){
+                bits[i] = CFSwapInt64BigToHost(bits[i]);
+            }
+        }else{
+            for(size_t i = 0; i < count; i++){
+                bits[i] = CFSwapInt64LittleToHost(bits[i]);
+            }
+        }
+        cursor->offset += 8 * count;
+    }
+}
+
+/**
+ * Read a geometry header, setting the cursor byte order
+ *
+ * @param cursor
+ *            cursor
+ * @param header
+ *            header to populate
+ * @return true if read
+ */
+static BOOL SFWKBReadHeader(SFWKBCursor *cursor, SFWKBHeader *header){
+    
+    if(!SFWKBAvailable(cursor, 1)){
+        return NO;
+    }
+    uint8_t byteOrder = cursor->bytes[cursor->offset++];
+    if(byteOrder != SF_WKB_BIG_ENDIAN && byteOrder != SF_WKB_LITTLE_ENDIAN){
+        cursor->error = YES;
+        return NO;
+    }
+    cursor->bigEndian = byteOrder == SF_WKB_BIG_ENDIAN;
+    
+    uint32_t code = SFWKBReadUInt32(cursor);
+    header->hasZ = (code & SF_WKB_Z_FLAG) != 0;
+    header->hasM = (code & SF_WKB_M_FLAG) != 0;
+    BOOL hasSRID = (code & SF_WKB_SRID_FLAG) != 0;
+    code &= ~(SF_WKB_Z_FLAG | SF_WKB_M_FLAG | SF_WKB_SRID_FLAG);
+    
+    // ISO dimension thousands: 1 z, 2 m, 3 z and m
+    uint32_t dimensions = code / 1000;
+    uint32_t type = code % 1000;
+    header->hasZ = header->hasZ || dimensions == 1 || dimensions == 3;
+    header->hasM = header->hasM || dimensions == 2 || dimensions == 3;
+    if(dimensions > 3 || type < SF_POINT || type > SF_TRIANGLE || type == SF_CURVE || type == SF_SURFACE){
+        cursor->error = YES;
+        return NO;
+    }
+    header->geometryType = type;
+    
+    if(hasSRID){
+        SFWKBSkip(cursor, 4);
+    }
+    
+    return !cursor->error;
+}
+
+/**
+ * Skip a geometry, reading only headers and counts
+ *
+ * @param cursor
+ *            cursor
+ * @param header
+ *            header to populate with the skipped geometry header
+ * @return true if skipped
+ */
+static BOOL SFWKBSkipGeometry(SFWKBCursor *cursor, SFWKBHeader *header){
+    
+    if(!SFWKBReadHeader(cursor, header)){
+        return NO;
+    }
+    
+    size_t coordinateSize = 8 * (2 + header->hasZ + header->hasM);
+    switch(header->geometryType){
+        case SF_POINT:
+            SFWKBSkip(cursor, coordinateSize);
+            break;
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+            SFWKBSkip(cursor, coordinateSize * SFWKBReadUInt32(cursor));
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            {
+                uint32_t rings = SFWKBReadUInt32(cursor);
+                for(uint32_t i = 0; i < rings && !cursor->error; i++){
+                    SFWKBSkip(cursor, coordinateSize * SFWKBReadUInt32(cursor));
+                }
+            }
+            break;
+        default:
+            {
+                uint32_t count = SFWKBReadUInt32(cursor);
+                SFWKBHeader child;
+                if(count > 0 && SFWKBEnter(cursor)){
+                    for(uint32_t i = 0; i < count && !cursor->error; i++){
+                        SFWKBSkipGeometry(cursor, &child);
+                    }
+                    cursor->depth--;
+                }
+            }
+            break;
+    }
+    
+    return !cursor->error;
+}
+
+/**
+ * Determine if the child geometry type is allowed within the parent type
+ *
+ * @param parentType
+ *            parent geometry type
+ * @param childType
+ *            child geometry type
+ * @return true if allowed
+ */
+static BOOL SFWKBChildAllowed(enum SFGeometryType parentType, enum SFGeometryType childType){
+    BOOL allowed = NO;
+    switch(parentType){
+        case SF_MULTIPOINT:
+            allowed = childType == SF_POINT;
+            break;
+        case SF_MULTILINESTRING:
+            allowed = childType == SF_LINESTRING;
+            break;
+        case SF_MULTIPOLYGON:
+            allowed = childType == SF_POLYGON;
+            break;
+        case SF_COMPOUNDCURVE:
+            allowed = childType == SF_LINESTRING || childType == SF_CIRCULARSTRING;
+            break;
+        case SF_CURVEPOLYGON:
+        case SF_MULTICURVE:
+            allowed = childType == SF_LINESTRING || childType == SF_CIRCULARSTRING || childType == SF_COMPOUNDCURVE;
+            break;
+        case SF_MULTISURFACE:
+            allowed = childType == SF_POLYGON || childType == SF_CURVEPOLYGON || childType == SF_TRIANGLE;
+            break;
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            allowed = childType == SF_POLYGON || childType == SF_TRIANGLE;
+            break;
+        case SF_GEOMETRYCOLLECTION:
+            allowed = YES;
+            break;
+        default:
+            break;
+    }
+    return allowed;
+}
+
+/**
+ * Coordinate bounds accumulated from WKB coordinate runs
+ */
+typedef struct SFWKBBounds{
+    double minX;
+    double minY;
+    double minZ;
+    double minM;
+    double maxX;
+    double maxY;
+    double maxZ;
+    double maxM;
+    BOOL includeZ;
+    BOOL includeM;
+    BOOL hasZ;
+    BOOL hasM;
+} SFWKBBounds;
+
+/**
+ * Initialize empty bounds
+ *
+ * @param bounds
+ *            bounds
+ * @param includeZ
+ *            true to accumulate z values
+ * @param includeM
+ *            true to accumulate m values
+ */
+static void SFWKBBoundsInit(SFWKBBounds *bounds, BOOL includeZ, BOOL includeM){
+    bounds->minX = INFINITY;
+    bounds->minY = INFINITY;
+    bounds->minZ = INFINITY;
+    bounds->minM = INFINITY;
+    bounds->maxX = -INFINITY;
+    bounds->maxY = -INFINITY;
+    bounds->maxZ = -INFINITY;
+    bounds->maxM = -INFINITY;
+    bounds->includeZ = includeZ;
+    bounds->includeM = includeM;
+    bounds->hasZ = NO;
+    bounds->hasM = NO;
+}
+
+/**
+ * Expand the range by the min and max of the strided values
+ *
+ * @param values
+ *            first value
+ * @param stride
+ *            value stride
+ * @param count
+ *            number of values
+ * @param min
+ *            range min
+ * @param max
+ *            range max
+ */
+static void SFWKBExpandRange(const double *values, vDSP_Stride stride, size_t count, double *min, double *max){
+    double runMin;
+    double runMax;
+    vDSP_minvD(values, stride, &runMin, count);
+    vDSP_maxvD(values, stride, &runMax, count);
+    *min = MIN(*min, runMin);
+    *max = MAX(*max, runMax);
+}
+
+/**
+ * Expand the bounds by a run of coordinates, reading the coordinates in
+ * aligned stack chunks and reducing each dimension with vectorized min and
+ * max passes
+ *
+ * @param cursor
+ *            cursor at the first coordinate
+ * @param bounds
+ *            bounds
+ * @param count
+ *            number of coordinates
+ * @param hasZ
+ *            coordinates have z
+ * @param hasM
+ *            coordinates have m
+ */
+static void SFWKBExpandBounds(SFWKBCursor *cursor, SFWKBBounds *bounds, size_t count, BOOL hasZ, BOOL hasM){
+    
+    int dimensions = 2 + hasZ + hasM;
+    if(count == 0 || !SFWKBAvailable(cursor, 8 * dimensions * count)){
+        return;
+    }
+    
+    BOOL includeZ = hasZ && bounds->includeZ;
+    BOOL includeM = hasM && bounds->includeM;
+    int mIndex = hasZ ? 3 : 2;
+    bounds->hasZ = bounds->hasZ || includeZ;
+    bounds->hasM = bounds->hasM || includeM;
+    
+    if(count == 1){
+        // Single points without the vector passes, skipping NaN empty points
+        double values[4];
+        SFWKBReadDoubles(cursor, values, dimensions);
+        if(!isnan(values[0]) && !isnan(values[1])){
+            bounds->minX = MIN(bounds->minX, values[0]);
+            bounds->maxX = MAX(bounds->maxX, values[0]);
+            bounds->minY = MIN(bounds->minY, values[1]);
+            bounds->maxY = MAX(bounds->maxY, values[1]);
+            if(includeZ && !isnan(values[2])){
+                bounds->minZ = MIN(bounds->minZ, values[2]);
+                bounds->maxZ = MAX(bounds->maxZ, values[2]);
+            }
+            if(includeM && !isnan(values[mIndex])){
+                bounds->minM = MIN(bounds->minM, values[mIndex]);
+                bounds->maxM = MAX(bounds->maxM, values[mIndex]);
+            }
+        }
+        return;
+    }
+    
+    double values[SF_WKB_BUFFER_SIZE];
+    size_t chunk = SF_WKB_BUFFER_SIZE / dimensions;
+    while(count > 0){
+        size_t points = MIN(count, chunk);
+        SFWKBReadDoubles(cursor, values, dimensions * points);
+        SFWKBExpandRange(values, dimensions, points, &bounds->minX, &bounds->maxX);
+        SFWKBExpandRange(values + 1, dimensions, points, &bounds->minY, &bounds->maxY);
+        if(includeZ){
+            SFWKBExpandRange(values + 2, dimensions, points, &bounds->minZ, &bounds->maxZ);
+        }
+        if(includeM){
+            SFWKBExpandRange(values + mIndex, dimensions, points, &bounds->minM, &bounds->maxM);
+        }
+        count -= points;
+    }
+    
+}
+
+@implementation SFWKBGeometryReader
+
++(SFGeometry *) readGeometryWithData: (NSData *) data{
+    return [self readGeometryWithData:data andFilter:nil];
+}
+
++(SFGeometry *) readGeometryWithData: (NSData *) data andFilter: (NSObject<SFGeometryFilter> *) filter{
+    size_t offset = 0;
+    return [self readGeometryWithBytes:data.bytes andLength:data.length andOffset:&offset andFilter:filter];
+}
+
++(SFGeometry *) readGeometryWithReader: (SFByteReader *) reader{
+    return [self readGeometryWithReader:reader andFilter:nil];
+}
+
++(SFGeometry *) readGeometryWithReader: (SFByteReader *) reader andFilter: (NSObject<SFGeometryFilter> *) filter{
+    size_t offset = reader.nextByte;
+    SFGeometry *geometry = [self readGeometryWithBytes:reader.bytes.bytes andLength:reader.bytes.length andOffset:&offset andFilter:filter];
+    reader.nextByte = (int) offset;
+    return geometry;
+}
+
++(SFGeometry *) readGeometryWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t *) offset andFilter: (NSObject<SFGeometryFilter> *) filter{
+    SFWKBCursor cursor = {bytes, length, MIN(*offset, length), NO, *offset > length};
+    SFGeometry *geometry = [self readGeometryWithCursor:&cursor andFilter:filter inType:SF_NONE];
+    *offset = cursor.offset;
+    return geometry;
+}
+
++(SFGeometry *) lazyGeometryWithData: (NSData *) data{
+    return [self lazyGeometryWithData:data andOffset:0];
+}
+
++(SFGeometry *) lazyGeometryWithData: (NSData *) data andOffset: (size_t) offset{
+    return [[[SFWKBGeometryBytes alloc] initWithData:data andOffset:offset] lazyGeometry];
+}
+
++(enum SFGeometryType) geometryTypeWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t) offset{
+    SFWKBCursor cursor = {bytes, length, MIN(offset, length), NO, offset > length};
+    SFWKBHeader header;
+    if(!SFWKBReadHeader(&cursor, &header)){
+        [self raiseInvalidWithCursor:&cursor];
+    }
+    return header.geometryType;
+}
+
++(enum SFGeometryType) skipGeometryWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t *) offset{
+    SFWKBCursor cursor = {bytes, length, MIN(*offset, length), NO, *offset > length};
+    SFWKBHeader header;
+    if(!SFWKBSkipGeometry(&cursor, &header)){
+        [self raiseInvalidWithCursor:&cursor];
+    }
+    *offset = cursor.offset;
+    return header.geometryType;
+}
+
++(SFGeometryEnvelope *) envelopeWithData: (NSData *) data{
+    return [self envelopeWithData:data andZ:NO andM:NO];
+}
+
++(SFGeometryEnvelope *) envelopeWithData: (NSData *) data andZ: (BOOL) includeZ andM: (BOOL) includeM{
+    size_t offset = 0;
+    return [self envelopeWithBytes:data.bytes andLength:data.length andOffset:&offset andZ:includeZ andM:includeM];
+}
+
++(SFGeometryEnvelope *) envelopeWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t *) offset andZ: (BOOL) includeZ andM: (BOOL) includeM{
+    
+    SFWKBCursor cursor = {bytes, length, MIN(*offset, length), NO, *offset > length};
+    SFWKBBounds bounds;
+    SFWKBBoundsInit(&bounds, includeZ, includeM);
+    [self expandBounds:&bounds withCursor:&cursor];
+    *offset = cursor.offset;
+    
+    SFGeometryEnvelope *envelope = nil;
+    if(bounds.minX <= bounds.maxX && bounds.minY <= bounds.maxY){
+        envelope = [[SFGeometryEnvelope alloc] initWithMinXDouble:bounds.minX andMinYDouble:bounds.minY andMaxXDouble:bounds.maxX andMaxYDouble:bounds.maxY];
+        if(bounds.hasZ){
+            [envelope setHasZ:YES];
+            if(bounds.minZ <= bounds.maxZ){
+                [envelope setMinZ:[[NSDecimalNumber alloc] initWithDouble:bounds.minZ]];
+                [envelope setMaxZ:[[NSDecimalNumber alloc] initWithDouble:bounds.maxZ]];
+            }
+        }
+        if(bounds.hasM){
+            [envelope setHasM:YES];
+            if(bounds.minM <= bounds.maxM){
+                [envelope setMinM:[[NSDecimalNumber alloc] initWithDouble:bounds.minM]];
+                [envelope setMaxM:[[NSDecimalNumber alloc] initWithDouble:bounds.maxM]];
+            }
+        }
+    }
+    
+    return envelope;
+}
+
++(BOOL) readBounds: (double *) bounds withBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t *) offset{
+    
+    SFWKBCursor cursor = {bytes, length, MIN(*offset, length), NO, *offset > length};
+    SFWKBBounds scan;
+    SFWKBBoundsInit(&scan, NO, NO);
+    [self expandBounds:&scan withCursor:&cursor];
+    *offset = cursor.offset;
+    
+    bounds[0] = scan.minX;
+    bounds[1] = scan.minY;
+    bounds[2] = scan.maxX;
+    bounds[3] = scan.maxY;
+    
+    return scan.minX <= scan.maxX && scan.minY <= scan.maxY;
+}
+
++(size_t) readHeaderWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t) offset andType: (enum SFGeometryType *) geometryType andHasZ: (BOOL *) hasZ andHasM: (BOOL *) hasM andBigEndian: (BOOL *) bigEndian{
+    SFWKBCursor cursor = {bytes, length, MIN(offset, length), NO, offset > length};
+    SFWKBHeader header;
+    if(!SFWKBReadHeader(&cursor, &header)){
+        [self raiseInvalidWithCursor:&cursor];
+    }
+    *geometryType = header.geometryType;
+    *hasZ = header.hasZ;
+    *hasM = header.hasM;
+    *bigEndian = cursor.bigEndian;
+    return cursor.offset;
+}
+
++(uint32_t) readCountWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t) offset andBigEndian: (BOOL) bigEndian{
+    SFWKBCursor cursor = {bytes, length, MIN(offset, length), bigEndian, offset > length};
+    uint32_t count = SFWKBReadUInt32(&cursor);
+    if(cursor.error){
+        [self raiseInvalidWithCursor:&cursor];
+    }
+    return count;
+}
+
++(SFPoint *) readPointWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t) offset andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM andBigEndian: (BOOL) bigEndian{
+    SFWKBCursor cursor = {bytes, length, MIN(offset, length), bigEndian, offset > length};
+    double values[4];
+    SFWKBReadDoubles(&cursor, values, 2 + hasZ + hasM);
+    if(cursor.error){
+        [self raiseInvalidWithCursor:&cursor];
+    }
+    return [self pointWithValues:values andHasZ:hasZ andHasM:hasM];
+}
+
++(NSMutableArray<SFPoint *> *) readPointsWithBytes: (const void *) bytes andLength: (size_t) length andOffset: (size_t *) offset andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM andBigEndian: (BOOL) bigEndian{
+    SFWKBCursor cursor = {bytes, length, MIN(*offset, length), bigEndian, *offset > length};
+    SFLineString *lineString = [[SFLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+    [self readPointsOfLineString:lineString withCursor:&cursor andFilter:nil];
+    if(cursor.error){
+        [self raiseInvalidWithCursor:&cursor];
+    }
+    *offset = cursor.offset;
+    return lineString.points;
+}
+
+/**
+ * Read a geometry
+ *
+ * @param cursor
+ *            cursor
+ * @param filter
+ *            geometry filter
+ * @param containingType
+ *            geometry type of the containing geometry, SF_NONE at the top
+ * @return geometry, nil when filtered
+ */
++(SFGeometry *) readGeometryWithCursor: (SFWKBCursor *) cursor andFilter: (NSObject<SFGeometryFilter> *) filter inType: (enum SFGeometryType) containingType{
+    
+    SFWKBHeader header;
+    if(!SFWKBReadHeader(cursor, &header)){
+        [self raiseInvalidWithCursor:cursor];
+    }
+    BOOL hasZ = header.hasZ;
+    BOOL hasM = header.hasM;
+    
+    SFGeometry *geometry = nil;
+    switch(header.geometryType){
+        case SF_POINT:
+            {
+                double values[4];
+                SFWKBReadDoubles(cursor, values, 2 + hasZ + hasM);
+                geometry = [self pointWithValues:values andHasZ:hasZ andHasM:hasM];
+            }
+            break;
+        case SF_LINESTRING:
+            geometry = [[SFLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+            [self readPointsOfLineString:(SFLineString *) geometry withCursor:cursor andFilter:filter];
+            break;
+        case SF_CIRCULARSTRING:
+            geometry = [[SFCircularString alloc] initWithHasZ:hasZ andHasM:hasM];
+            [self readPointsOfLineString:(SFLineString *) geometry withCursor:cursor andFilter:filter];
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            {
+                SFPolygon *polygon = header.geometryType == SF_POLYGON ? [[SFPolygon alloc] initWithHasZ:hasZ andHasM:hasM] : [[SFTriangle alloc] initWithHasZ:hasZ andHasM:hasM];
+                uint32_t rings = SFWKBReadUInt32(cursor);
+                for(uint32_t i = 0; i < rings && !cursor->error; i++){
+                    SFLineString *ring = [[SFLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+                    [self readPointsOfLineString:ring withCursor:cursor andFilter:filter];
+                    if(filter == nil || [filter filterGeometry:ring inType:header.geometryType]){
+                        [polygon addRing:ring];
+                    }
+                }
+                geometry = polygon;
+            }
+            break;
+        case SF_MULTIPOINT:
+            geometry = [[SFMultiPoint alloc] initWithHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_MULTILINESTRING:
+            geometry = [[SFMultiLineString alloc] initWithHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_MULTIPOLYGON:
+            geometry = [[SFMultiPolygon alloc] initWithHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_MULTICURVE:
+            geometry = [[SFMultiCurve alloc] initWithType:SF_MULTICURVE andHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_MULTISURFACE:
+            geometry = [[SFMultiSurface alloc] initWithType:SF_MULTISURFACE andHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_GEOMETRYCOLLECTION:
+            geometry = [[SFGeometryCollection alloc] initWithHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_COMPOUNDCURVE:
+            geometry = [[SFCompoundCurve alloc] initWithHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_CURVEPOLYGON:
+            geometry = [[SFCurvePolygon alloc] initWithHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_POLYHEDRALSURFACE:
+            geometry = [[SFPolyhedralSurface alloc] initWithHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_TIN:
+            geometry = [[SFTIN alloc] initWithHasZ:hasZ andHasM:hasM];
+            break;
+        default:
+            break;
+    }
+    
+    if(cursor->error){
+        [self raiseInvalidWithCursor:cursor];
+    }
+    
+    switch(header.geometryType){
+        case SF_POINT:
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            break;
+        default:
+            [self readChildrenOfGeometry:geometry withCursor:cursor andFilter:filter];
+            break;
+    }
+    
+    if(filter != nil && ![filter filterGeometry:geometry inType:containingType]){
+        geometry = nil;
+    }
+    
+    return geometry;
+}
+
+/**
+ * Expand the bounds by a geometry, walking the headers and reducing the
+ * coordinate runs without creating geometries. Circular strings are decoded
+ * to include the extents of their arcs.
+ *
+ * @param bounds
+ *            bounds
+ * @param cursor
+ *            cursor
+ */
++(void) expandBounds: (SFWKBBounds *) bounds withCursor: (SFWKBCursor *) cursor{
+    
+    size_t geometryOffset = cursor->offset;
+    SFWKBHeader header;
+    if(!SFWKBReadHeader(cursor, &header)){
+        [self raiseInvalidWithCursor:cursor];
+    }
+    BOOL hasZ = header.hasZ;
+    BOOL hasM = header.hasM;
+    
+    switch(header.geometryType){
+        case SF_POINT:
+            SFWKBExpandBounds(cursor, bounds, 1, hasZ, hasM);
+            break;
+        case SF_LINESTRING:
+            SFWKBExpandBounds(cursor, bounds, SFWKBReadUInt32(cursor), hasZ, hasM);
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            {
+                uint32_t rings = SFWKBReadUInt32(cursor);
+                for(uint32_t i = 0; i < rings && !cursor->error; i++){
+                    SFWKBExpandBounds(cursor, bounds, SFWKBReadUInt32(cursor), hasZ, hasM);
+                }
+            }
+            break;
+        case SF_CIRCULARSTRING:
+            {
+                cursor->offset = geometryOffset;
+                SFGeometryEnvelope *envelope = [[self readGeometryWithCursor:cursor andFilter:nil inType:SF_NONE] envelope];
+                if(envelope != nil){
+                    bounds->minX = MIN(bounds->minX, [envelope.minX doubleValue]);
+                    bounds->minY = MIN(bounds->minY, [envelope.minY doubleValue]);
+                    bounds->maxX = MAX(bounds->maxX, [envelope.maxX doubleValue]);
+                    bounds->maxY = MAX(bounds->maxY, [envelope.maxY doubleValue]);
+                    if(bounds->includeZ && envelope.hasZ){
+                        bounds->hasZ = YES;
+                        if(envelope.minZ != nil){
+                            bounds->minZ = MIN(bounds->minZ, [envelope.minZ doubleValue]);
+                            bounds->maxZ = MAX(bounds->maxZ, [envelope.maxZ doubleValue]);
+                        }
+                    }
+                    if(bounds->includeM && envelope.hasM){
+                        bounds->hasM = YES;
+                        if(envelope.minM != nil){
+                            bounds->minM = MIN(bounds->minM, [envelope.minM doubleValue]);
+                            bounds->maxM = MAX(bounds->maxM, [envelope.maxM doubleValue]);
+                        }
+                    }
+                }
+            }
+            break;
+        default:
+            {
+                uint32_t count = SFWKBReadUInt32(cursor);
+                if(count > 0 && SFWKBEnter(cursor)){
+                    for(uint32_t i = 0; i < count && !cursor->error; i++){
+                        [self expandBounds:bounds withCursor:cursor];
+                    }
+                    cursor->depth--;
+                }
+            }
+            break;
+    }
+    
+    if(cursor->error){
+        [self raiseInvalidWithCursor:cursor];
+    }
+    
+}
+
+/**
+ * Read the child geometries of a collection, compound curve, curve polygon,
+ * or surface
+ *
+ * @param geometry
+ *            parent geometry
+ * @param cursor
+ *            cursor
+ * @param filter
+ *            geometry filter
+ */
++(void) readChildrenOfGeometry: (SFGeometry *) geometry withCursor: (SFWKBCursor *) cursor andFilter: (NSObject<SFGeometryFilter> *) filter{
+    
+    enum SFGeometryType geometryType = geometry.geometryType;
+    uint32_t count = SFWKBReadUInt32(cursor);
+    if(count > 0 && !SFWKBEnter(cursor)){
+        [self raiseInvalidWithCursor:cursor];
+    }
+    for(uint32_t i = 0; i < count && !cursor->error; i++){
+        
+        size_t childOffset = cursor->offset;
+        SFGeometry *child = [self readGeometryWithCursor:cursor andFilter:filter inType:geometryType];
+        if(child == nil){
+            continue;
+        }
+        if(!SFWKBChildAllowed(geometryType, child.geometryType)){
+            [NSException raise:@"Invalid WKB" format:@"Unexpected %@ within %@ at byte offset: %zu", [SFGeometryTypes name:child.geometryType], [SFGeometryTypes name:geometryType], childOffset];
+        }
+        
+        switch(geometryType){
+            case SF_COMPOUNDCURVE:
+                [((SFCompoundCurve *) geometry) addLineString:(SFLineString *) child];
+                break;
+            case SF_CURVEPOLYGON:
+                [((SFCurvePolygon *) geometry) addRing:(SFCurve *) child];
+                break;
+            case SF_POLYHEDRALSURFACE:
+            case SF_TIN:
+                [((SFPolyhedralSurface *) geometry) addPolygon:(SFPolygon *) child];
+                break;
+            default:
+                [((SFGeometryCollection *) geometry) addGeometry:child];
+                break;
+        }
+    }
+    if(count > 0){
+        cursor->depth--;
+    }
+    
+}
+
+/**
+ * Read the counted points of a line string or ring
+ *
+ * @param lineString
+ *            line string
+ * @param cursor
+ *            cursor
+ * @param filter
+ *            geometry filter, applied to each point
+ */
++(void) readPointsOfLineString: (SFLineString *) lineString withCursor: (SFWKBCursor *) cursor andFilter: (NSObject<SFGeometryFilter> *) filter{
+    
+    BOOL hasZ = lineString.hasZ;
+    BOOL hasM = lineString.hasM;
+    int dimensions = 2 + hasZ + hasM;
+    size_t count = SFWKBReadUInt32(cursor);
+    if(!SFWKBAvailable(cursor, 8 * dimensions * count) || count == 0){
+        return;
+    }
+    
+    size_t valueCount = dimensions * count;
+    double stackValues[SF_WKB_BUFFER_SIZE];
+    double *values = valueCount <= SF_WKB_BUFFER_SIZE ? stackValues : malloc(sizeof(double) * valueCount);
+    SFWKBReadDoubles(cursor, values, valueCount);
+    
+    enum SFGeometryType geometryType = lineString.geometryType;
+    NSMutableArray<SFPoint *> *points = [NSMutableArray arrayWithCapacity:count];
+    for(size_t i = 0; i < count; i++){
+        SFPoint *point = [self pointWithValues:values + dimensions * i andHasZ:hasZ andHasM:hasM];
+        if(filter == nil || [filter filterGeometry:point inType:geometryType]){
+            [points addObject:point];
+        }
+    }
+    [lineString addPoints:points];
+    
+    if(values != stackValues){
+        free(values);
+    }
+    
+}
+
+/**
+ * Create a point from the coordinate values
+ *
+ * @param values
+ *            x, y, optional z, and optional m values
+ * @param hasZ
+ *            has z
+ * @param hasM
+ *            has m
+ * @return point
+ */
++(SFPoint *) pointWithValues: (const double *) values andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    SFPoint *point = [[SFPoint alloc] initWithHasZ:hasZ andHasM:hasM andXValue:values[0] andYValue:values[1]];
+    if(hasZ){
+        [point setZValue:values[2]];
+    }
+    if(hasM){
+        [point setMValue:values[hasZ ? 3 : 2]];
+    }
+    return point;
+}
+
+/**
+ * Raise an invalid WKB exception
+ *
+ * @param cursor
+ *            cursor
+ */
++(void) raiseInvalidWithCursor: (SFWKBCursor *) cursor{
+    [NSException raise:@"Invalid WKB" format:@"Failed to read WKB geometry at byte offset: %zu of length: %zu", cursor->offset, cursor->length];
+}
+
+@end
@@ -0,0 +1,39 @@
+//
+//  SFWKBLineString.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFLineString.h"
+#import "SFWKBGeometryBytes.h"
+
+/**
+ * Line string backed by WKB bytes. The point count, single points, and envelope are read from the bytes, and the points are decoded on first access to the points array.
+ */
+@interface SFWKBLineString : SFLineString
+
+/**
+ * WKB bytes of the line string
+ */
+@property (nonatomic, strong, readonly) SFWKBGeometryBytes *wkb;
+
+/**
+ * Initialize
+ *
+ * @param wkb
+ *            WKB bytes of the line string
+ *
+ * @return new lazy line string
+ */
+-(instancetype) initWithWKB: (SFWKBGeometryBytes *) wkb;
+
+/**
+ * Determine if the line string contents have been decoded
+ *
+ * @return true if decoded
+ */
+-(BOOL) isDecoded;
+
+@end
@@ -0,0 +1,76 @@
+//
+//  SFWKBLineString.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFWKBLineString.h"
+
+@interface SFWKBLineString()
+
+/**
+ * WKB bytes of the geometry
+ */
+@property (nonatomic, strong) SFWKBGeometryBytes *wkb;
+
+/**
+ * True once the contents are decoded or replaced
+ */
+@property (nonatomic) BOOL decoded;
+
+@end
+
+@implementation SFWKBLineString
+
+-(instancetype) initWithWKB: (SFWKBGeometryBytes *) wkb{
+    self = [super initWithHasZ:wkb.hasZ andHasM:wkb.hasM];
+    if(self != nil){
+        self.wkb = wkb;
+        self.decoded = NO;
+    }
+    return self;
+}
+
+-(BOOL) isDecoded{
+    return self.decoded || self.wkb == nil;
+}
+
+-(NSMutableArray<SFPoint *> *) points{
+    if(![self isDecoded]){
+        [self setPoints:[self.wkb readPoints]];
+    }
+    return [super points];
+}
+
+-(void) setPoints: (NSMutableArray<SFPoint *> *) points{
+    self.decoded = YES;
+    [super setPoints:points];
+}
+
+-(int) numPoints{
+    return [self isDecoded] ? [super numPoints] : self.wkb.count;
+}
+
+-(SFPoint *) pointAtIndex: (int) n{
+    return [self isDecoded] ? [super pointAtIndex:n] : [self.wkb pointAtIndex:n];
+}
+
+-(SFPoint *) startPoint{
+    return [self isEmpty] ? nil : [self pointAtIndex:0];
+}
+
+-(SFPoint *) endPoint{
+    return [self isEmpty] ? nil : [self pointAtIndex:[self numPoints] - 1];
+}
+
+-(BOOL) isEmpty{
+    return [self numPoints] == 0;
+}
+
+-(SFGeometryEnvelope *) envelope{
+    return [self isDecoded] ? [super envelope] : [self.wkb envelope];
+}
+
+@end
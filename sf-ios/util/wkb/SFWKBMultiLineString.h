@@ -0,0 +1,39 @@
+//
+//  SFWKBMultiLineString.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFMultiLineString.h"
+#import "SFWKBGeometryBytes.h"
+
+/**
+ * Multi line string backed by WKB bytes. The line string count and envelope are read from the bytes, and the line strings are created as lazy WKB line strings on first access.
+ */
+@interface SFWKBMultiLineString : SFMultiLineString
+
+/**
+ * WKB bytes of the multi line string
+ */
+@property (nonatomic, strong, readonly) SFWKBGeometryBytes *wkb;
+
+/**
+ * Initialize
+ *
+ * @param wkb
+ *            WKB bytes of the multi line string
+ *
+ * @return new lazy multi line string
+ */
+-(instancetype) initWithWKB: (SFWKBGeometryBytes *) wkb;
+
+/**
+ * Determine if the multi line string contents have been decoded
+ *
+ * @return true if decoded
+ */
+-(BOOL) isDecoded;
+
+@end
@@ -0,0 +1,39 @@
+//
+//  SFWKBMultiPolygon.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFMultiPolygon.h"
+#import "SFWKBGeometryBytes.h"
+
+/**
+ * Multi polygon backed by WKB bytes. The polygon count and envelope are read from the bytes, and the polygons are created as lazy WKB polygons on first access.
+ */
+@interface SFWKBMultiPolygon : SFMultiPolygon
+
+/**
+ * WKB bytes of the multi polygon
+ */
+@property (nonatomic, strong, readonly) SFWKBGeometryBytes *wkb;
+
+/**
+ * Initialize
+ *
+ * @param wkb
+ *            WKB bytes of the multi polygon
+ *
+ * @return new lazy multi polygon
+ */
+-(instancetype) initWithWKB: (SFWKBGeometryBytes *) wkb;
+
+/**
+ * Determine if the multi polygon contents have been decoded
+ *
+ * @return true if decoded
+ */
+-(BOOL) isDecoded;
+
+@end
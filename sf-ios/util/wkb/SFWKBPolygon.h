@@ -0,0 +1,39 @@
+//
+//  SFWKBPolygon.h
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFPolygon.h"
+#import "SFWKBGeometryBytes.h"
+
+/**
+ * Polygon backed by WKB bytes. The ring count and envelope are read from the bytes, and the rings are created as lazy WKB line strings on first access.
+ */
+@interface SFWKBPolygon : SFPolygon
+
+/**
+ * WKB bytes of the polygon
+ */
+@property (nonatomic, strong, readonly) SFWKBGeometryBytes *wkb;
+
+/**
+ * Initialize
+ *
+ * @param wkb
+ *            WKB bytes of the polygon
+ *
+ * @return new lazy polygon
+ */
+-(instancetype) initWithWKB: (SFWKBGeometryBytes *) wkb;
+
+/**
+ * Determine if the polygon contents have been decoded
+ *
+ * @return true if decoded
+ */
+-(BOOL) isDecoded;
+
+@end
@@ -0,0 +1,68 @@
+//
+//  SFWKBPolygon.m
+//  sf-ios
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import "SFWKBPolygon.h"
+
+@interface SFWKBPolygon()
+
+/**
+ * WKB bytes of the geometry
+ */
+@property (nonatomic, strong) SFWKBGeometryBytes *wkb;
+
+/**
+ * True once the contents are decoded or replaced
+ */
+@property (nonatomic) BOOL decoded;
+
+@end
+
+@implementation SFWKBPolygon
+
+-(instancetype) initWithWKB: (SFWKBGeometryBytes *) wkb{
+    self = [super initWithHasZ:wkb.hasZ andHasM:wkb.hasM];
+    if(self != nil){
+        self.wkb = wkb;
+        self.decoded = NO;
+    }
+    return self;
+}
+
+-(BOOL) isDecoded{
+    return self.decoded || self.wkb == nil;
+}
+
+-(NSMutableArray<SFCurve *> *) rings{
+    if(![self isDecoded]){
+        [self setRings:(NSMutableArray<SFLineString *> *) [self.wkb lazyChildren]];
+    }
+    return [super rings];
+}
+
+-(void) setRings: (NSMutableArray<SFLineString *> *) rings{
+    self.decoded = YES;
+    [super setRings:rings];
+}
+
+-(int) numRings{
+    return [self isDecoded] ? [super numRings] : self.wkb.count;
+}
+
+-(int) numInteriorRings{
+    return [self numRings] - 1;
+}
+
+-(BOOL) isEmpty{
+    return [self numRings] == 0;
+}
+
+-(SFGeometryEnvelope *) envelope{
+    return [self isDecoded] ? [super envelope] : [self.wkb envelope];
+}
+
+@end
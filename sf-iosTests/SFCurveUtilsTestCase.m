@@ -0,0 +1,163 @@
+//
+//  SFCurveUtilsTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFCurveUtils.h"
+#import "SFGeometryUtils.h"
+
+@interface SFCurveUtilsTestCase : XCTestCase
+
+@end
+
+@implementation SFCurveUtilsTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test exact envelope, length, centroid, and point on curve of arcs
+ */
+-(void) testArcs {
+    
+    // Three quarter counter clockwise arc around the origin
+    SFCircularString *circularString = [self circularStringWithCoordinates:@[@1, @0, @0, @1, @0, @-1]];
+    
+    SFGeometryEnvelope *envelope = [circularString envelope];
+    [SFTestUtils assertEqualDoubleWithValue:-1.0 andValue2:[envelope.minX doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:-1.0 andValue2:[envelope.minY doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:1.0 andValue2:[envelope.maxX doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:1.0 andValue2:[envelope.maxY doubleValue] andDelta:0.0000001];
+    
+    [SFTestUtils assertEqualDoubleWithValue:1.5 * M_PI andValue2:[SFCurveUtils lengthOfCircularString:circularString] andDelta:0.0000001];
+    
+    [SFTestUtils assertTrue:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:-M_SQRT1_2 andYValue:-M_SQRT1_2] onLine:circularString withEpsilon:0.0000001]];
+    [SFTestUtils assertFalse:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:M_SQRT1_2 andYValue:-M_SQRT1_2] onLine:circularString withEpsilon:0.0000001]];
+    [SFTestUtils assertFalse:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:0.5 andYValue:0.5] onLine:circularString withEpsilon:0.0000001]];
+    
+    // Quarter arc centroid at 2 sqrt(2) / pi along the bisector
+    SFCircularString *quarter = [self circularStringWithCoordinates:@[@1, @0, [NSNumber numberWithDouble:M_SQRT1_2], [NSNumber numberWithDouble:M_SQRT1_2], @0, @1]];
+    SFPoint *centroid = [quarter centroid];
+    double distance = 2.0 * M_SQRT2 / M_PI;
+    [SFTestUtils assertEqualDoubleWithValue:distance * M_SQRT1_2 andValue2:[centroid.x doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:distance * M_SQRT1_2 andValue2:[centroid.y doubleValue] andDelta:0.0000001];
+    
+    // Collinear points are a straight path
+    SFCircularString *straight = [self circularStringWithCoordinates:@[@0, @0, @1, @1, @3, @3]];
+    [SFTestUtils assertEqualDoubleWithValue:3.0 * M_SQRT2 andValue2:[SFCurveUtils lengthOfCircularString:straight] andDelta:0.0000001];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[[straight linearize] numPoints]];
+    
+}
+
+/**
+ * Test linearizing circular strings by segments and tolerance with caching
+ */
+-(void) testLinearize {
+    
+    SFCircularString *circularString = [self circularStringWithCoordinates:@[@10, @0, @0, @10, @0, @-10]];
+    
+    SFLineString *lineString = [SFCurveUtils linearizeCircularString:circularString withSegmentsPerQuadrant:2];
+    [SFTestUtils assertEqualIntWithValue:7 andValue2:[lineString numPoints]];
+    [SFTestUtils assertEqualDoubleWithValue:-10.0 andValue2:[[lineString pointAtIndex:4].x doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[[lineString pointAtIndex:4].y doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:-10.0 andValue2:[[lineString endPoint].y doubleValue]];
+    
+    double tolerance = 0.01;
+    lineString = [circularString linearizeWithTolerance:tolerance];
+    [SFTestUtils assertTrue:lineString == [circularString linearizeWithTolerance:tolerance]];
+    for(int i = 0; i < [lineString numPoints] - 1; i++){
+        SFPoint *point1 = [lineString pointAtIndex:i];
+        SFPoint *point2 = [lineString pointAtIndex:i + 1];
+        double midX = ([point1.x doubleValue] + [point2.x doubleValue]) / 2.0;
+        double midY = ([point1.y doubleValue] + [point2.y doubleValue]) / 2.0;
+        [SFTestUtils assertTrue:10.0 - hypot(midX, midY) <= tolerance];
+    }
+    
+    [circularString addPoint:[[SFPoint alloc] initWithXValue:10 andYValue:-10]];
+    SFLineString *updated = [circularString linearizeWithTolerance:tolerance];
+    [SFTestUtils assertFalse:lineString == updated];
+    [SFTestUtils assertEqualIntWithValue:[lineString numPoints] + 1 andValue2:[updated numPoints]];
+    
+    [circularString addPoints:@[[[SFPoint alloc] initWithXValue:0 andYValue:-20], [[SFPoint alloc] initWithXValue:-10 andYValue:-10]]];
+    updated = [circularString linearizeWithTolerance:tolerance];
+    [SFTestUtils assertEqualDoubleWithValue:-10.0 andValue2:[[updated endPoint].x doubleValue]];
+    
+    // Points modified in place
+    [[circularString endPoint] setXValue:20];
+    [circularString clearLinearization];
+    updated = [circularString linearizeWithTolerance:tolerance];
+    [SFTestUtils assertEqualDoubleWithValue:20.0 andValue2:[[updated endPoint].x doubleValue]];
+    [SFGeometryUtils normalizeGeometry:circularString withMaxX:15];
+    updated = [circularString linearizeWithTolerance:tolerance];
+    [SFTestUtils assertEqualDoubleWithValue:-10.0 andValue2:[[updated endPoint].x doubleValue]];
+    
+    // Z values interpolate along the arc through the middle point
+    SFCircularString *circularStringZ = [[SFCircularString alloc] initWithHasZ:YES andHasM:NO];
+    [circularStringZ addPoint:[[SFPoint alloc] initWithXValue:1 andYValue:0 andZValue:0]];
+    [circularStringZ addPoint:[[SFPoint alloc] initWithXValue:0 andYValue:1 andZValue:10]];
+    [circularStringZ addPoint:[[SFPoint alloc] initWithXValue:-1 andYValue:0 andZValue:20]];
+    SFLineString *lineStringZ = [circularStringZ linearizeWithSegmentsPerQuadrant:4];
+    [SFTestUtils assertEqualIntWithValue:9 andValue2:[lineStringZ numPoints]];
+    [SFTestUtils assertEqualDoubleWithValue:5.0 andValue2:[[lineStringZ pointAtIndex:2].z doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[[lineStringZ pointAtIndex:4].z doubleValue] andDelta:0.0000001];
+    
+}
+
+/**
+ * Test linearizing compound curves and curve polygons
+ */
+-(void) testLinearizeCurvePolygon {
+    
+    // Full circle ring
+    SFCircularString *circle = [self circularStringWithCoordinates:@[@2, @0, @-2, @0, @2, @0]];
+    SFCurvePolygon *curvePolygon = [[SFCurvePolygon alloc] init];
+    [curvePolygon addRing:circle];
+    
+    SFPolygon *polygon = [SFCurveUtils linearizeCurvePolygon:curvePolygon withTolerance:0.0001];
+    [SFTestUtils assertEqualIntWithValue:SF_POLYGON andValue2:polygon.geometryType];
+    [SFTestUtils assertEqualDoubleWithValue:4.0 * M_PI andValue2:[SFGeometryTestUtils areaOfRing:[polygon exteriorRing]] andDelta:0.01];
+    [SFTestUtils assertEqualDoubleWithValue:4.0 * M_PI andValue2:[SFCurveUtils lengthOfCurve:circle] andDelta:0.0000001];
+    
+    // Half circle closed by a line
+    SFCompoundCurve *compoundCurve = [[SFCompoundCurve alloc] init];
+    [compoundCurve addLineString:[self circularStringWithCoordinates:@[@2, @0, @0, @2, @-2, @0]]];
+    SFLineString *line = [[SFLineString alloc] init];
+    [line addPoint:[[SFPoint alloc] initWithXValue:-2 andYValue:0]];
+    [line addPoint:[[SFPoint alloc] initWithXValue:2 andYValue:0]];
+    [compoundCurve addLineString:line];
+    
+    SFLineString *lineString = [SFCurveUtils linearizeCompoundCurve:compoundCurve withSegmentsPerQuadrant:8];
+    [SFTestUtils assertEqualIntWithValue:18 andValue2:[lineString numPoints]];
+    [SFTestUtils assertTrue:[SFGeometryUtils closedPolygonRing:lineString]];
+    [SFTestUtils assertEqualDoubleWithValue:2.0 * M_PI + 4.0 andValue2:[SFCurveUtils lengthOfCurve:compoundCurve] andDelta:0.0000001];
+    
+    SFGeometryEnvelope *envelope = [compoundCurve envelope];
+    [SFTestUtils assertEqualDoubleWithValue:2.0 andValue2:[envelope.maxY doubleValue] andDelta:0.0000001];
+    
+    SFCurvePolygon *halfCircle = [[SFCurvePolygon alloc] initWithRing:compoundCurve];
+    SFGeometry *linear = [SFCurveUtils linearizeGeometry:halfCircle withTolerance:0.0001];
+    [SFTestUtils assertEqualIntWithValue:SF_POLYGON andValue2:linear.geometryType];
+    [SFTestUtils assertEqualDoubleWithValue:2.0 * M_PI andValue2:[SFGeometryTestUtils areaOfRing:[((SFPolygon *) linear) exteriorRing]] andDelta:0.01];
+    
+}
+
+-(SFCircularString *) circularStringWithCoordinates: (NSArray<NSNumber *> *) coordinates{
+    SFCircularString *circularString = [[SFCircularString alloc] init];
+    for(int i = 0; i < coordinates.count; i += 2){
+        [circularString addPoint:[[SFPoint alloc] initWithXValue:[[coordinates objectAtIndex:i] doubleValue] andYValue:[[coordinates objectAtIndex:i + 1] doubleValue]]];
+    }
+    return circularString;
+}
+
+@end
@@ -0,0 +1,82 @@
+//
+//  SFGeometryPredicatesTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryPredicates.h"
+
+@interface SFGeometryPredicatesTestCase : XCTestCase
+
+@end
+
+@implementation SFGeometryPredicatesTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test orientation of nearly collinear points where a floating point cross
+ * product returns inconsistent signs
+ */
+-(void) testOrientation {
+    
+    [SFTestUtils assertTrue:[SFGeometryPredicates orientationWithX1:0 andY1:0 andX2:1 andY2:0 andX3:0 andY3:1] > 0.0];
+    [SFTestUtils assertTrue:[SFGeometryPredicates orientationWithX1:0 andY1:0 andX2:0 andY2:1 andX3:1 andY3:0] < 0.0];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[SFGeometryPredicates orientationWithX1:0.1 andY1:0.1 andX2:0.3 andY2:0.3 andX3:0.7 andY3:0.7]];
+    
+    // Points near (0.5, 0.5) relative to the line through (12, 12) and (24, 24)
+    double x = 0.5;
+    for(int i = 0; i < 32; i++){
+        double y = 0.5;
+        for(int j = 0; j < 32; j++){
+            double orientation = [SFGeometryPredicates orientationWithX1:12 andY1:12 andX2:24 andY2:24 andX3:x andY3:y];
+            if(y > x){
+                [SFTestUtils assertTrue:orientation > 0.0];
+            }else if(y < x){
+                [SFTestUtils assertTrue:orientation < 0.0];
+            }else{
+                [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:orientation];
+            }
+            y = nextafter(y, 1.0);
+        }
+        x = nextafter(x, 1.0);
+    }
+    
+    SFPoint *point1 = [[SFPoint alloc] initWithXValue:1000000 andYValue:1000000];
+    SFPoint *point2 = [[SFPoint alloc] initWithXValue:3000000 andYValue:2000000];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[SFGeometryPredicates orientationWithPoint1:point1 andPoint2:point2 andPoint3:[[SFPoint alloc] initWithXValue:5000000 andYValue:3000000]]];
+    [SFTestUtils assertTrue:[SFGeometryPredicates orientationWithPoint1:point1 andPoint2:point2 andPoint3:[[SFPoint alloc] initWithXValue:5000000 andYValue:3000000.001]] > 0.0];
+    
+}
+
+/**
+ * Test in circle of cocircular and nearly cocircular points
+ */
+-(void) testInCircle {
+    
+    [SFTestUtils assertTrue:[SFGeometryPredicates inCircleWithX1:0 andY1:0 andX2:1 andY2:0 andX3:0 andY3:1 andX4:0.25 andY4:0.25] > 0.0];
+    [SFTestUtils assertTrue:[SFGeometryPredicates inCircleWithX1:0 andY1:0 andX2:1 andY2:0 andX3:0 andY3:1 andX4:2 andY4:2] < 0.0];
+    
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[SFGeometryPredicates inCircleWithX1:0 andY1:0 andX2:1 andY2:0 andX3:1 andY3:1 andX4:0 andY4:1]];
+    [SFTestUtils assertTrue:[SFGeometryPredicates inCircleWithX1:0 andY1:0 andX2:1 andY2:0 andX3:1 andY3:1 andX4:0 andY4:nextafter(1.0, 0.0)] > 0.0];
+    [SFTestUtils assertTrue:[SFGeometryPredicates inCircleWithX1:0 andY1:0 andX2:1 andY2:0 andX3:1 andY3:1 andX4:0 andY4:nextafter(1.0, 2.0)] < 0.0];
+    
+    double offset = 1000000.1;
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[SFGeometryPredicates inCircleWithPoint1:[[SFPoint alloc] initWithXValue:offset andYValue:offset]
+                                                                                           andPoint2:[[SFPoint alloc] initWithXValue:offset + 3 andYValue:offset]
+                                                                                           andPoint3:[[SFPoint alloc] initWithXValue:offset + 3 andYValue:offset + 4]
+                                                                                           andPoint4:[[SFPoint alloc] initWithXValue:offset andYValue:offset + 4]]];
+    
+}
+
+@end
@@ -21,6 +21,7 @@
 #import "SFPolyhedralSurface.h"
 #import "SFTIN.h"
 #import "SFTriangle.h"
+#import "SFByteWriter.h"
 
 
 @interface SFGeometryTestUtils : NSObject
@@ -83,4 +84,28 @@
 
 +(SFCurvePolygon *) createCurvePolygonWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM;
 
++(double) areaOfRing: (SFLineString *) ring;
+
++(double) areaOfMultiPolygon: (SFMultiPolygon *) multiPolygon;
+
++(SFLineString *) lineStringWithCoordinates: (NSArray<NSNumber *> *) coordinates;
+
++(SFLineString *) ringWithCoordinates: (NSArray<NSNumber *> *) coordinates;
+
++(SFLineString *) ringWithCoordinates: (NSArray<NSNumber *> *) coordinates andZValue: (double) z;
+
++(SFPolygon *) polygonWithCoordinates: (NSArray<NSNumber *> *) coordinates;
+
++(SFLineString *) rectangleWithMinX: (double) minX andMinY: (double) minY andMaxX: (double) maxX andMaxY: (double) maxY andClockwise: (BOOL) clockwise;
+
++(SFPolygon *) polygonWithMinX: (double) minX andMinY: (double) minY andMaxX: (double) maxX andMaxY: (double) maxY;
+
++(SFLineString *) squareWithMinX: (double) minX andMinY: (double) minY andSize: (double) size;
+
++(SFLineString *) squareWithMinX: (double) minX andMinY: (double) minY andSize: (double) size andClockwise: (BOOL) clockwise;
+
++(void) writeHeaderWithWriter: (SFByteWriter *) writer andCode: (uint32_t) code;
+
++(void) writeValues: (NSArray<NSNumber *> *) values withWriter: (SFByteWriter *) writer;
+
 @end
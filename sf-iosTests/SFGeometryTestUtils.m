@@ -219,7 +219,7 @@
 +(BOOL) equalDataWithExpected: (NSData *) expected andActual: (NSData *) actual{
     
     return [expected length] == [actual length] && [expected isEqualToData:actual];
-
+    
 }
 
 +(SFPoint *) createPointWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
@@ -392,4 +392,96 @@
     return curvePolygon;
 }
 
++(double) areaOfRing: (SFLineString *) ring{
+    double area = 0.0;
+    NSArray<SFPoint *> *points = ring.points;
+    for(int i = 0; i < (int) points.count - 1; i++){
+        SFPoint *point1 = [points objectAtIndex:i];
+        SFPoint *point2 = [points objectAtIndex:i + 1];
+        area += [point1.x doubleValue] * [point2.y doubleValue] - [point2.x doubleValue] * [point1.y doubleValue];
+    }
+    return area / 2.0;
+}
+
++(double) areaOfMultiPolygon: (SFMultiPolygon *) multiPolygon{
+    double area = 0.0;
+    for(SFPolygon *polygon in [multiPolygon polygons]){
+        NSArray<SFLineString *> *rings = polygon.rings;
+        for(int i = 0; i < rings.count; i++){
+            double ringArea = fabs([self areaOfRing:[rings objectAtIndex:i]]);
+            area += i == 0 ? ringArea : -ringArea;
+        }
+    }
+    return area;
+}
+
++(SFLineString *) lineStringWithCoordinates: (NSArray<NSNumber *> *) coordinates{
+    SFLineString *lineString = [[SFLineString alloc] init];
+    for(int i = 0; i < coordinates.count; i += 2){
+        [lineString addPoint:[[SFPoint alloc] initWithXValue:[[coordinates objectAtIndex:i] doubleValue] andYValue:[[coordinates objectAtIndex:i + 1] doubleValue]]];
+    }
+    return lineString;
+}
+
++(SFLineString *) ringWithCoordinates: (NSArray<NSNumber *> *) coordinates{
+    SFLineString *ring = [[SFLineString alloc] init];
+    for(int i = 0; i <= coordinates.count; i += 2){
+        int index = i % coordinates.count;
+        [ring addPoint:[[SFPoint alloc] initWithXValue:[[coordinates objectAtIndex:index] doubleValue] andYValue:[[coordinates objectAtIndex:index + 1] doubleValue]]];
+    }
+    return ring;
+}
+
++(SFLineString *) ringWithCoordinates: (NSArray<NSNumber *> *) coordinates andZValue: (double) z{
+    SFLineString *ring = [[SFLineString alloc] initWithHasZ:YES andHasM:NO];
+    for(int i = 0; i <= coordinates.count; i += 2){
+        int index = i % coordinates.count;
+        [ring addPoint:[[SFPoint alloc] initWithXValue:[[coordinates objectAtIndex:index] doubleValue] andYValue:[[coordinates objectAtIndex:index + 1] doubleValue] andZValue:z]];
+    }
+    return ring;
+}
+
++(SFPolygon *) polygonWithCoordinates: (NSArray<NSNumber *> *) coordinates{
+    return [[SFPolygon alloc] initWithRing:[self lineStringWithCoordinates:coordinates]];
+}
+
++(SFLineString *) rectangleWithMinX: (double) minX andMinY: (double) minY andMaxX: (double) maxX andMaxY: (double) maxY andClockwise: (BOOL) clockwise{
+    SFLineString *ring = [[SFLineString alloc] init];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:minX andYValue:minY]];
+    if(clockwise){
+        [ring addPoint:[[SFPoint alloc] initWithXValue:minX andYValue:maxY]];
+        [ring addPoint:[[SFPoint alloc] initWithXValue:maxX andYValue:maxY]];
+        [ring addPoint:[[SFPoint alloc] initWithXValue:maxX andYValue:minY]];
+    }else{
+        [ring addPoint:[[SFPoint alloc] initWithXValue:maxX andYValue:minY]];
+        [ring addPoint:[[SFPoint alloc] initWithXValue:maxX andYValue:maxY]];
+        [ring addPoint:[[SFPoint alloc] initWithXValue:minX andYValue:maxY]];
+    }
+    [ring addPoint:[[SFPoint alloc] initWithXValue:minX andYValue:minY]];
+    return ring;
+}
+
++(SFPolygon *) polygonWithMinX: (double) minX andMinY: (double) minY andMaxX: (double) maxX andMaxY: (double) maxY{
+    return [[SFPolygon alloc] initWithRing:[self rectangleWithMinX:minX andMinY:minY andMaxX:maxX andMaxY:maxY andClockwise:NO]];
+}
+
++(SFLineString *) squareWithMinX: (double) minX andMinY: (double) minY andSize: (double) size{
+    return [self squareWithMinX:minX andMinY:minY andSize:size andClockwise:NO];
+}
+
++(SFLineString *) squareWithMinX: (double) minX andMinY: (double) minY andSize: (double) size andClockwise: (BOOL) clockwise{
+    return [self rectangleWithMinX:minX andMinY:minY andMaxX:minX + size andMaxY:minY + size andClockwise:clockwise];
+}
+
++(void) writeHeaderWithWriter: (SFByteWriter *) writer andCode: (uint32_t) code{
+    [writer writeByte:[NSNumber numberWithInt:writer.byteOrder == CFByteOrderBigEndian ? 0 : 1]];
+    [writer writeInt:[NSNumber numberWithUnsignedInt:code]];
+}
+
++(void) writeValues: (NSArray<NSNumber *> *) values withWriter: (SFByteWriter *) writer{
+    for(NSNumber *value in values){
+        [writer writeDouble:[[NSDecimalNumber alloc] initWithDouble:[value doubleValue]]];
+    }
+}
+
 @end
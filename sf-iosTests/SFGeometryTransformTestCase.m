@@ -0,0 +1,165 @@
+//
+//  SFGeometryTransformTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTransform.h"
+#import "SFPolygon.h"
+#import "SFMultiPoint.h"
+#import "SFLinearRing.h"
+
+@interface SFGeometryTransformTestCase : XCTestCase
+
+@end
+
+@implementation SFGeometryTransformTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test WGS84 to Web Mercator and back
+ */
+-(void) testWebMercator {
+    
+    SFLineString *lineString = [[SFLineString alloc] init];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:-180.0 andYValue:SF_WEB_MERCATOR_MAX_LATITUDE]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:0.0 andYValue:0.0]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:-77.0365 andYValue:38.8977]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:180.0 andYValue:-90.0]];
+    
+    [lineString transform:[SFGeometryTransform wgs84ToWebMercator]];
+    
+    [SFTestUtils assertEqualDoubleWithValue:-SF_WEB_MERCATOR_HALF_WORLD_WIDTH andValue2:[[lineString pointAtIndex:0].x doubleValue] andDelta:0.000001];
+    [SFTestUtils assertEqualDoubleWithValue:SF_WEB_MERCATOR_HALF_WORLD_WIDTH andValue2:[[lineString pointAtIndex:0].y doubleValue] andDelta:0.0001];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[[lineString pointAtIndex:1].x doubleValue] andDelta:0.000001];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[[lineString pointAtIndex:1].y doubleValue] andDelta:0.000001];
+    [SFTestUtils assertEqualDoubleWithValue:-8575663.9524960201 andValue2:[[lineString pointAtIndex:2].x doubleValue] andDelta:0.0001];
+    [SFTestUtils assertEqualDoubleWithValue:4707028.5508051412 andValue2:[[lineString pointAtIndex:2].y doubleValue] andDelta:0.0001];
+    // Clamped to the max latitude
+    [SFTestUtils assertEqualDoubleWithValue:-SF_WEB_MERCATOR_HALF_WORLD_WIDTH andValue2:[[lineString pointAtIndex:3].y doubleValue] andDelta:0.0001];
+    
+    [lineString transform:[SFGeometryTransform webMercatorToWGS84]];
+    
+    [SFTestUtils assertEqualDoubleWithValue:-180.0 andValue2:[[lineString pointAtIndex:0].x doubleValue] andDelta:0.000000001];
+    [SFTestUtils assertEqualDoubleWithValue:SF_WEB_MERCATOR_MAX_LATITUDE andValue2:[[lineString pointAtIndex:0].y doubleValue] andDelta:0.000000001];
+    [SFTestUtils assertEqualDoubleWithValue:-77.0365 andValue2:[[lineString pointAtIndex:2].x doubleValue] andDelta:0.000000001];
+    [SFTestUtils assertEqualDoubleWithValue:38.8977 andValue2:[[lineString pointAtIndex:2].y doubleValue] andDelta:0.000000001];
+    [SFTestUtils assertEqualDoubleWithValue:-SF_WEB_MERCATOR_MAX_LATITUDE andValue2:[[lineString pointAtIndex:3].y doubleValue] andDelta:0.000000001];
+    
+}
+
+/**
+ * Test 2D and 3D affine transforms
+ */
+-(void) testAffine {
+    
+    SFLineString *ring = [[SFLineString alloc] init];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:0 andYValue:0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:2 andYValue:0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:2 andYValue:1]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:0 andYValue:0]];
+    SFPolygon *polygon = [[SFPolygon alloc] initWithRing:ring];
+    
+    // Rotate 90 degrees counter clockwise and translate
+    [polygon transform:[SFGeometryTransform affineWithA:0 andB:-1 andC:10 andD:1 andE:0 andF:20]];
+    
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[[ring pointAtIndex:1].x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:22.0 andValue2:[[ring pointAtIndex:1].y doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:9.0 andValue2:[[ring pointAtIndex:2].x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:22.0 andValue2:[[ring pointAtIndex:2].y doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[[ring pointAtIndex:3].x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:20.0 andValue2:[[ring pointAtIndex:3].y doubleValue]];
+    [SFTestUtils assertNil:[ring pointAtIndex:0].z];
+    
+    double matrix[12] = {
+        1, 2, 3, 4,
+        5, 6, 7, 8,
+        9, 10, 11, 12
+    };
+    SFGeometryTransform *transform = [SFGeometryTransform affine3DWithMatrix:matrix];
+    
+    SFMultiPoint *multiPoint = [[SFMultiPoint alloc] initWithHasZ:YES andHasM:YES];
+    [multiPoint addPoint:[[SFPoint alloc] initWithXValue:1 andYValue:2 andZValue:3 andMValue:7]];
+    [multiPoint addPoint:[[SFPoint alloc] initWithXValue:-1 andYValue:0 andZValue:1 andMValue:8]];
+    [multiPoint transform:transform];
+    
+    SFPoint *point = [multiPoint pointAtIndex:0];
+    [SFTestUtils assertEqualDoubleWithValue:18.0 andValue2:[point.x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:46.0 andValue2:[point.y doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:74.0 andValue2:[point.z doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:7.0 andValue2:[point.m doubleValue]];
+    point = [multiPoint pointAtIndex:1];
+    [SFTestUtils assertEqualDoubleWithValue:6.0 andValue2:[point.x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[point.y doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:14.0 andValue2:[point.z doubleValue]];
+    
+    double x[] = {1, -1};
+    double y[] = {2, 0};
+    double z[] = {3, 1};
+    [transform transformX:x andY:y andZ:z withCount:2];
+    [SFTestUtils assertEqualDoubleWithValue:74.0 andValue2:z[0]];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:y[1]];
+    
+}
+
+/**
+ * Test transforming a ring closed by its first point instance
+ */
+-(void) testSharedPoints {
+    
+    SFPoint *start = [[SFPoint alloc] initWithXValue:0 andYValue:0];
+    SFLinearRing *ring = [[SFLinearRing alloc] init];
+    [ring addPoint:start];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:2 andYValue:0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:2 andYValue:1]];
+    [ring addPoint:start];
+    SFPolygon *polygon = [[SFPolygon alloc] initWithRing:ring];
+    
+    [polygon transform:[SFGeometryTransform affineWithA:1 andB:0 andC:5 andD:0 andE:1 andF:-3]];
+    
+    [SFTestUtils assertEqualDoubleWithValue:5.0 andValue2:[[ring startPoint].x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:-3.0 andValue2:[[ring startPoint].y doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:5.0 andValue2:[[ring endPoint].x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:-3.0 andValue2:[[ring endPoint].y doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:7.0 andValue2:[[ring pointAtIndex:1].x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:-2.0 andValue2:[[ring pointAtIndex:2].y doubleValue]];
+    
+}
+
+/**
+ * Test concurrently transforming many geometries
+ */
+-(void) testTransformGeometries {
+    
+    NSMutableArray<SFGeometry *> *geometries = [NSMutableArray array];
+    for(int i = 0; i < 1000; i++){
+        SFLineString *lineString = [[SFLineString alloc] init];
+        [lineString addPoint:[[SFPoint alloc] initWithXValue:i andYValue:-i]];
+        [lineString addPoint:[[SFPoint alloc] initWithXValue:i + 1 andYValue:i]];
+        [geometries addObject:lineString];
+    }
+    
+    [[SFGeometryTransform affineWithA:2 andB:0 andC:1 andD:0 andE:3 andF:-1] transformGeometries:geometries];
+    
+    for(int i = 0; i < 1000; i++){
+        SFLineString *lineString = (SFLineString *) [geometries objectAtIndex:i];
+        [SFTestUtils assertEqualDoubleWithValue:2.0 * i + 1.0 andValue2:[[lineString startPoint].x doubleValue]];
+        [SFTestUtils assertEqualDoubleWithValue:-3.0 * i - 1.0 andValue2:[[lineString startPoint].y doubleValue]];
+        [SFTestUtils assertEqualDoubleWithValue:2.0 * i + 3.0 andValue2:[[lineString endPoint].x doubleValue]];
+        [SFTestUtils assertEqualDoubleWithValue:3.0 * i - 1.0 andValue2:[[lineString endPoint].y doubleValue]];
+    }
+    
+}
+
+@end
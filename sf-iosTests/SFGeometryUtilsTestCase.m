@@ -199,7 +199,7 @@ static NSUInteger GEOMETRIES_PER_TEST = 10;
 }
 
 -(SFGeometryCollection *) createGeometryCollectionWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
-
+    
     SFGeometryCollection * geometryCollection = [[SFGeometryCollection alloc] initWithHasZ:hasZ andHasM:hasM];
     
     int num = 1 + ((int) ([SFTestUtils randomDouble] * 5));
@@ -290,6 +290,106 @@ static NSUInteger GEOMETRIES_PER_TEST = 10;
     
 }
 
+-(void) testMinimizeAndNormalizeGeometries{
+    
+    NSMutableArray<SFGeometry *> *geometries = [[NSMutableArray alloc] init];
+    NSMutableArray<SFGeometry *> *expected = [[NSMutableArray alloc] init];
+    for(int i = 0; i < 200; i++){
+        SFGeometry *geometry = nil;
+        if([SFTestUtils coinFlip]){
+            geometry = [self createPolygon];
+        }else{
+            geometry = [self createMultiPolygon];
+        }
+        [geometries addObject:geometry];
+        [expected addObject:[geometry mutableCopy]];
+    }
+    
+    [SFGeometryUtils minimizeGeometries:geometries withMaxX:180.0];
+    for(SFGeometry *geometry in expected){
+        [SFGeometryUtils minimizeGeometry:geometry withMaxX:180.0];
+    }
+    for(int i = 0; i < geometries.count; i++){
+        [SFGeometryTestUtils compareGeometriesWithExpected:[expected objectAtIndex:i] andActual:[geometries objectAtIndex:i]];
+    }
+    
+    [SFGeometryUtils normalizeGeometries:geometries withMaxX:180.0];
+    for(SFGeometry *geometry in expected){
+        [SFGeometryUtils normalizeGeometry:geometry withMaxX:180.0];
+    }
+    for(int i = 0; i < geometries.count; i++){
+        SFGeometry *geometry = [geometries objectAtIndex:i];
+        [SFGeometryTestUtils compareGeometriesWithExpected:[expected objectAtIndex:i] andActual:geometry];
+        SFGeometryEnvelope *envelope = [geometry envelope];
+        [SFTestUtils assertTrue:[envelope.minX doubleValue] >= -180.0];
+        [SFTestUtils assertTrue:[envelope.maxX doubleValue] <= 180.0];
+    }
+    
+}
+
+-(void) testSplitLineString{
+    
+    SFLineString *lineString = [[SFLineString alloc] init];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:170.0 andYValue:0.0]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:-170.0 andYValue:10.0]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:-160.0 andYValue:10.0]];
+    
+    SFGeometry *split = [SFGeometryUtils splitGeometry:lineString withMaxX:180.0];
+    [SFTestUtils assertEqualIntWithValue:SF_MULTILINESTRING andValue2:split.geometryType];
+    SFMultiLineString *multiLineString = (SFMultiLineString *)split;
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[multiLineString numLineStrings]];
+    
+    SFLineString *west = [multiLineString lineStringAtIndex:0];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[west numPoints]];
+    [SFTestUtils assertEqualDoubleWithValue:180.0 andValue2:[[west pointAtIndex:1].x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:5.0 andValue2:[[west pointAtIndex:1].y doubleValue] andDelta:0.0000001];
+    
+    SFLineString *east = [multiLineString lineStringAtIndex:1];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[east numPoints]];
+    [SFTestUtils assertEqualDoubleWithValue:-180.0 andValue2:[[east pointAtIndex:0].x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:5.0 andValue2:[[east pointAtIndex:0].y doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:-160.0 andValue2:[[east pointAtIndex:2].x doubleValue]];
+    
+    SFGeometryEnvelope *envelope = [split envelope];
+    [SFTestUtils assertEqualDoubleWithValue:-180.0 andValue2:[envelope.minX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:180.0 andValue2:[envelope.maxX doubleValue]];
+    
+    SFLineString *notCrossing = [[SFLineString alloc] init];
+    [notCrossing addPoint:[[SFPoint alloc] initWithXValue:10.0 andYValue:0.0]];
+    [notCrossing addPoint:[[SFPoint alloc] initWithXValue:20.0 andYValue:10.0]];
+    split = [SFGeometryUtils splitGeometry:notCrossing withMaxX:180.0];
+    [SFGeometryTestUtils compareGeometriesWithExpected:notCrossing andActual:split];
+    
+}
+
+-(void) testSplitPolygon{
+    
+    SFLineString *ring = [[SFLineString alloc] init];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:170.0 andYValue:-10.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:-170.0 andYValue:-10.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:-170.0 andYValue:10.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:170.0 andYValue:10.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:170.0 andYValue:-10.0]];
+    SFPolygon *polygon = [[SFPolygon alloc] initWithRing:ring];
+    
+    SFGeometry *split = [SFGeometryUtils splitGeometry:polygon withMaxX:180.0];
+    [SFTestUtils assertEqualIntWithValue:SF_MULTIPOLYGON andValue2:split.geometryType];
+    SFMultiPolygon *multiPolygon = (SFMultiPolygon *)split;
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[multiPolygon numPolygons]];
+    
+    double area = 0.0;
+    for(SFPolygon *part in [multiPolygon polygons]){
+        SFLineString *partRing = [part exteriorRing];
+        [SFTestUtils assertTrue:[SFGeometryUtils closedPolygonRing:partRing]];
+        SFGeometryEnvelope *envelope = [part envelope];
+        [SFTestUtils assertTrue:[envelope.minX doubleValue] >= -180.0];
+        [SFTestUtils assertTrue:[envelope.maxX doubleValue] <= 180.0];
+        area += ([envelope.maxX doubleValue] - [envelope.minX doubleValue]) * ([envelope.maxY doubleValue] - [envelope.minY doubleValue]);
+    }
+    [SFTestUtils assertEqualDoubleWithValue:400.0 andValue2:area andDelta:0.0000001];
+    
+}
+
 -(void) testSimplifyPoints{
     
     double halfWorldWidth = 20037508.342789244;
@@ -452,6 +552,21 @@ static NSUInteger GEOMETRIES_PER_TEST = 10;
     [SFTestUtils assertTrue:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:5 andYValue:5.0000000000000001] onLinePoints:points]];
     [SFTestUtils assertFalse:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:5 andYValue:5.000000000000001] onLinePoints:points]];
     
+    // Exact and distance tolerance checks
+    [SFTestUtils assertTrue:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:2.5 andYValue:0] onLinePoints:points withDistance:0.0]];
+    [SFTestUtils assertTrue:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:5 andYValue:2.5] onLinePoints:points withDistance:0.0]];
+    [SFTestUtils assertFalse:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:2.5 andYValue:0.00000001] onLinePoints:points withDistance:0.0]];
+    [SFTestUtils assertTrue:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:2.5 andYValue:0.00000001] onLinePoints:points withDistance:0.0000001]];
+    [SFTestUtils assertFalse:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:-0.000001 andYValue:0] onLinePoints:points withDistance:0.0000001]];
+    
+    // Distance tolerance is independent of the path length
+    NSMutableArray<SFPoint *> *longPoints = [[NSMutableArray alloc] init];
+    [longPoints addObject:[[SFPoint alloc] initWithXValue:0 andYValue:0]];
+    [longPoints addObject:[[SFPoint alloc] initWithXValue:3000000 andYValue:1000000]];
+    [SFTestUtils assertTrue:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:1500000 andYValue:500000] onLinePoints:longPoints withDistance:0.0]];
+    [SFTestUtils assertTrue:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:1500000 andYValue:500000.000001] onLinePoints:longPoints withDistance:0.00001]];
+    [SFTestUtils assertFalse:[SFGeometryUtils point:[[SFPoint alloc] initWithXValue:1500000 andYValue:500000.0001] onLinePoints:longPoints withDistance:0.00001]];
+    
 }
 
 /**
@@ -501,7 +616,7 @@ static NSUInteger GEOMETRIES_PER_TEST = 10;
  *            child hierarchy
  */
 -(void) testChildHierarchyWithType: (enum SFGeometryType) geometryType andHierarchy: (NSDictionary *) childHierachy{
-
+    
     NSArray<NSNumber *> *childTypes = [SFGeometryUtils childTypesOfType:geometryType];
     if(childTypes.count == 0){
         [SFTestUtils assertTrue:childHierachy.count == 0];
@@ -514,7 +629,7 @@ static NSUInteger GEOMETRIES_PER_TEST = 10;
             
             [SFTestUtils assertEqualIntWithValue:geometryType andValue2:[SFGeometryUtils parentTypeOfType:childType]];
             [SFTestUtils assertEqualIntWithValue:geometryType andValue2:[[[SFGeometryUtils parentHierarchyOfType:childType] objectAtIndex:0] intValue]];
-             
+            
              [self testChildHierarchyWithType:childType andHierarchy:[SFGeometryUtils childHierarchyOfType:childType]];
         }
     }
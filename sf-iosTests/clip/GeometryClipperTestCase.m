@@ -0,0 +1,216 @@
+//
+//  GeometryClipperTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryClipper.h"
+#import "SFLineString.h"
+#import "SFMultiLineString.h"
+#import "SFPolygon.h"
+#import "SFCircularString.h"
+#import "SFCurvePolygon.h"
+#import "SFMultiCurve.h"
+#import "SFMultiSurface.h"
+#import "SFGeometryUtils.h"
+
+@interface GeometryClipperTestCase : XCTestCase
+
+@end
+
+@implementation GeometryClipperTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+-(void) testClipPoint{
+    
+    SFGeometryEnvelope *envelope = [[SFGeometryEnvelope alloc] initWithMinXDouble:0.0 andMinYDouble:0.0 andMaxXDouble:10.0 andMaxYDouble:10.0];
+    
+    SFPoint *inside = [[SFPoint alloc] initWithXValue:10.0 andYValue:5.0];
+    SFGeometry *clipped = [SFGeometryClipper clipGeometry:inside withEnvelope:envelope];
+    [SFTestUtils assertTrue:[inside isEqual:clipped]];
+    
+    SFPoint *outside = [[SFPoint alloc] initWithXValue:11.0 andYValue:5.0];
+    [SFTestUtils assertTrue:[SFGeometryClipper clipGeometry:outside withEnvelope:envelope] == nil];
+    
+    clipped = [SFGeometryClipper clipGeometry:outside withEnvelope:envelope andBuffer:1.0];
+    [SFTestUtils assertTrue:[outside isEqual:clipped]];
+    
+}
+
+-(void) testClipLineString{
+    
+    SFGeometryEnvelope *envelope = [[SFGeometryEnvelope alloc] initWithMinXDouble:0.0 andMinYDouble:0.0 andMaxXDouble:10.0 andMaxYDouble:10.0];
+    
+    SFLineString *lineString = [[SFLineString alloc] initWithHasZ:YES andHasM:NO];
+    [lineString addPoint:[[SFPoint alloc] initWithHasZ:YES andHasM:NO andXValue:-5.0 andYValue:5.0]];
+    [lineString addPoint:[[SFPoint alloc] initWithHasZ:YES andHasM:NO andXValue:5.0 andYValue:5.0]];
+    [lineString addPoint:[[SFPoint alloc] initWithHasZ:YES andHasM:NO andXValue:5.0 andYValue:15.0]];
+    [lineString addPoint:[[SFPoint alloc] initWithHasZ:YES andHasM:NO andXValue:8.0 andYValue:15.0]];
+    [lineString addPoint:[[SFPoint alloc] initWithHasZ:YES andHasM:NO andXValue:8.0 andYValue:5.0]];
+    int z = 0;
+    for(SFPoint *point in lineString.points){
+        [point setZValue:z];
+        z += 10;
+    }
+    
+    SFGeometry *clipped = [SFGeometryClipper clipGeometry:lineString withEnvelope:envelope];
+    [SFTestUtils assertEqualIntWithValue:SF_MULTILINESTRING andValue2:clipped.geometryType];
+    SFMultiLineString *multiLineString = (SFMultiLineString *)clipped;
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[multiLineString numLineStrings]];
+    
+    SFLineString *first = [multiLineString lineStringAtIndex:0];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[first numPoints]];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[[first pointAtIndex:0].x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:5.0 andValue2:[[first pointAtIndex:0].z doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[[first pointAtIndex:2].y doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:15.0 andValue2:[[first pointAtIndex:2].z doubleValue]];
+    
+    SFLineString *second = [multiLineString lineStringAtIndex:1];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[second numPoints]];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[[second pointAtIndex:0].y doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:35.0 andValue2:[[second pointAtIndex:0].z doubleValue]];
+    [SFTestUtils assertTrue:[[lineString pointAtIndex:4] isEqual:[second pointAtIndex:1]]];
+    
+    SFGeometryEnvelope *outside = [[SFGeometryEnvelope alloc] initWithMinXDouble:20.0 andMinYDouble:20.0 andMaxXDouble:30.0 andMaxYDouble:30.0];
+    [SFTestUtils assertTrue:[SFGeometryClipper clipGeometry:lineString withEnvelope:outside] == nil];
+    
+    SFGeometryEnvelope *containing = [[SFGeometryEnvelope alloc] initWithMinXDouble:-10.0 andMinYDouble:0.0 andMaxXDouble:10.0 andMaxYDouble:20.0];
+    [SFTestUtils assertTrue:[lineString isEqual:[SFGeometryClipper clipGeometry:lineString withEnvelope:containing]]];
+    
+}
+
+-(void) testClipPolygon{
+    
+    SFGeometryClipper *clipper = [[SFGeometryClipper alloc] initWithMinX:0.0 andMinY:0.0 andMaxX:10.0 andMaxY:10.0];
+    
+    SFLineString *ring = [[SFLineString alloc] init];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:-5.0 andYValue:-5.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:5.0 andYValue:-5.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:5.0 andYValue:5.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:-5.0 andYValue:5.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:-5.0 andYValue:-5.0]];
+    SFPolygon *polygon = [[SFPolygon alloc] initWithRing:ring];
+    
+    SFGeometry *clipped = [clipper clipGeometry:polygon];
+    [SFTestUtils assertEqualIntWithValue:SF_POLYGON andValue2:clipped.geometryType];
+    SFLineString *clippedRing = [(SFPolygon *)clipped exteriorRing];
+    [SFTestUtils assertEqualIntWithValue:5 andValue2:[clippedRing numPoints]];
+    [SFTestUtils assertTrue:[SFGeometryUtils closedPolygonRing:clippedRing]];
+    SFGeometryEnvelope *envelope = [clipped envelope];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[envelope.minX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[envelope.minY doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:5.0 andValue2:[envelope.maxX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:5.0 andValue2:[envelope.maxY doubleValue]];
+    
+    // Polygon containing the clip envelope with a hole outside of it
+    ring = [[SFLineString alloc] init];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:-20.0 andYValue:-20.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:20.0 andYValue:-20.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:20.0 andYValue:20.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:-20.0 andYValue:20.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:-20.0 andYValue:-20.0]];
+    SFLineString *hole = [[SFLineString alloc] init];
+    [hole addPoint:[[SFPoint alloc] initWithXValue:-15.0 andYValue:-15.0]];
+    [hole addPoint:[[SFPoint alloc] initWithXValue:-15.0 andYValue:-12.0]];
+    [hole addPoint:[[SFPoint alloc] initWithXValue:-12.0 andYValue:-12.0]];
+    [hole addPoint:[[SFPoint alloc] initWithXValue:-15.0 andYValue:-15.0]];
+    polygon = [[SFPolygon alloc] initWithRing:ring];
+    [polygon addRing:hole];
+    
+    clipped = [clipper clipGeometry:polygon];
+    [SFTestUtils assertEqualIntWithValue:SF_POLYGON andValue2:clipped.geometryType];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:[(SFPolygon *)clipped numRings]];
+    envelope = [clipped envelope];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[envelope.minX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[envelope.maxY doubleValue]];
+    
+    [SFTestUtils assertTrue:[[[SFGeometryClipper alloc] initWithMinX:30.0 andMinY:30.0 andMaxX:40.0 andMaxY:40.0] clipGeometry:polygon] == nil];
+    
+}
+
+-(void) testClipCurves{
+    
+    // Arc from (-4, 3) around the bottom of the radius 5 circle to (4, 3),
+    // with control points within the envelope but the arc crossing it
+    SFCircularString *circularString = [[SFCircularString alloc] init];
+    [circularString addPoint:[[SFPoint alloc] initWithXValue:-4.0 andYValue:3.0]];
+    [circularString addPoint:[[SFPoint alloc] initWithXValue:0.0 andYValue:-5.0]];
+    [circularString addPoint:[[SFPoint alloc] initWithXValue:4.0 andYValue:3.0]];
+    
+    SFGeometryClipper *clipper = [[SFGeometryClipper alloc] initWithMinX:-4.5 andMinY:-6.0 andMaxX:4.5 andMaxY:4.0];
+    
+    SFGeometry *clipped = [clipper clipGeometry:circularString];
+    [SFTestUtils assertEqualIntWithValue:SF_MULTILINESTRING andValue2:clipped.geometryType];
+    SFMultiLineString *multiLineString = (SFMultiLineString *)clipped;
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[multiLineString numLineStrings]];
+    for(SFLineString *lineString in [multiLineString lineStrings]){
+        for(SFPoint *point in lineString.points){
+            double x = [point.x doubleValue];
+            double y = [point.y doubleValue];
+            [SFTestUtils assertTrue:x >= -4.5 && x <= 4.5 && y >= -6.0 && y <= 4.0];
+            double radius = sqrt(x * x + y * y);
+            [SFTestUtils assertTrue:radius > 4.99 && radius < 5.0 + 0.0000001];
+        }
+    }
+    
+    SFGeometryClipper *containing = [[SFGeometryClipper alloc] initWithMinX:-5.0 andMinY:-5.0 andMaxX:5.0 andMaxY:3.0];
+    clipped = [containing clipGeometry:circularString];
+    [SFTestUtils assertEqualIntWithValue:SF_CIRCULARSTRING andValue2:clipped.geometryType];
+    [SFTestUtils assertTrue:[circularString isEqual:clipped]];
+    
+    // Multi curves keep their type, with split curves as separate members
+    SFLineString *lineString = [[SFLineString alloc] init];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:0.0 andYValue:0.0]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:1.0 andYValue:1.0]];
+    SFMultiCurve *multiCurve = [[SFMultiCurve alloc] initWithType:SF_MULTICURVE andHasZ:NO andHasM:NO];
+    [multiCurve addCurve:circularString];
+    [multiCurve addCurve:lineString];
+    
+    clipped = [clipper clipGeometry:multiCurve];
+    [SFTestUtils assertEqualIntWithValue:SF_MULTICURVE andValue2:clipped.geometryType];
+    [SFTestUtils assertEqualIntWithValue:4 andValue2:[(SFMultiCurve *)clipped numCurves]];
+    
+    // Multi surfaces keep their type, with curve polygons copied when
+    // within the envelope and clipped to polygons otherwise
+    SFCircularString *circle = [[SFCircularString alloc] init];
+    [circle addPoint:[[SFPoint alloc] initWithXValue:-2.0 andYValue:0.0]];
+    [circle addPoint:[[SFPoint alloc] initWithXValue:2.0 andYValue:0.0]];
+    [circle addPoint:[[SFPoint alloc] initWithXValue:-2.0 andYValue:0.0]];
+    SFCurvePolygon *curvePolygon = [[SFCurvePolygon alloc] initWithRing:circle];
+    SFLineString *ring = [[SFLineString alloc] init];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:-1.0 andYValue:-1.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:1.0 andYValue:-1.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:1.0 andYValue:1.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:-1.0 andYValue:-1.0]];
+    SFMultiSurface *multiSurface = [[SFMultiSurface alloc] initWithType:SF_MULTISURFACE andHasZ:NO andHasM:NO];
+    [multiSurface addSurface:curvePolygon];
+    [multiSurface addSurface:[[SFPolygon alloc] initWithRing:ring]];
+    
+    clipped = [clipper clipGeometry:multiSurface];
+    [SFTestUtils assertEqualIntWithValue:SF_MULTISURFACE andValue2:clipped.geometryType];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[(SFMultiSurface *)clipped numSurfaces]];
+    [SFTestUtils assertEqualIntWithValue:SF_CURVEPOLYGON andValue2:[(SFMultiSurface *)clipped surfaceAtIndex:0].geometryType];
+    
+    clipped = [[[SFGeometryClipper alloc] initWithMinX:0.0 andMinY:-10.0 andMaxX:10.0 andMaxY:10.0] clipGeometry:multiSurface];
+    [SFTestUtils assertEqualIntWithValue:SF_MULTISURFACE andValue2:clipped.geometryType];
+    SFSurface *clippedSurface = [(SFMultiSurface *)clipped surfaceAtIndex:0];
+    [SFTestUtils assertEqualIntWithValue:SF_POLYGON andValue2:clippedSurface.geometryType];
+    SFGeometryEnvelope *envelope = [clippedSurface envelope];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[envelope.minX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:2.0 andValue2:[envelope.maxX doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:-2.0 andValue2:[envelope.minY doubleValue] andDelta:0.0000001];
+    
+}
+
+@end
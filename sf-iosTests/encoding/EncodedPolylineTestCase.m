@@ -0,0 +1,99 @@
+//
+//  EncodedPolylineTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFEncodedPolyline.h"
+
+@interface EncodedPolylineTestCase : XCTestCase
+
+@end
+
+@implementation EncodedPolylineTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test the algorithm documentation example
+ */
+-(void) testExample {
+    
+    SFLineString *lineString = [[SFLineString alloc] init];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:-120.2 andYValue:38.5]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:-120.95 andYValue:40.7]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:-126.453 andYValue:43.252]];
+    
+    NSString *polyline = [SFEncodedPolyline encodeLineString:lineString];
+    [SFTestUtils assertEqualWithValue:@"_p~iF~ps|U_ulLnnqC_mqNvxq`@" andValue2:polyline];
+    
+    SFLineString *decoded = [SFEncodedPolyline decodeLineString:polyline];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[decoded numPoints]];
+    for(int i = 0; i < 3; i++){
+        [SFTestUtils assertEqualDoubleWithValue:[[lineString pointAtIndex:i].x doubleValue] andValue2:[[decoded pointAtIndex:i].x doubleValue] andDelta:1e-9];
+        [SFTestUtils assertEqualDoubleWithValue:[[lineString pointAtIndex:i].y doubleValue] andValue2:[[decoded pointAtIndex:i].y doubleValue] andDelta:1e-9];
+    }
+    
+    const char *bytes = [polyline UTF8String];
+    double coordinates[14];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[SFEncodedPolyline decodeCoordinates:coordinates withBytes:bytes andLength:strlen(bytes) andPrecision:SF_POLYLINE_DEFAULT_PRECISION]];
+    [SFTestUtils assertEqualDoubleWithValue:43.252 andValue2:coordinates[5] andDelta:1e-9];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[[SFEncodedPolyline decodeLineStringWithBytes:bytes andLength:strlen(bytes) andPrecision:SF_POLYLINE_DEFAULT_PRECISION] numPoints]];
+    
+}
+
+/**
+ * Test batch round trips at varying precisions and invalid polylines
+ */
+-(void) testRoundTrip {
+    
+    for(int precision = 0; precision <= 10; precision++){
+        
+        NSMutableArray<SFLineString *> *lineStrings = [NSMutableArray array];
+        for(int i = 0; i < 20; i++){
+            SFLineString *lineString = [[SFLineString alloc] init];
+            for(int j = 0; j < i * 3; j++){
+                [lineString addPoint:[[SFPoint alloc] initWithXValue:((i * 7919 + j * 104729) % 360000) / 1000.0 - 180.0 andYValue:((i * 6007 + j * 7727) % 180000) / 1000.0 - 90.0]];
+            }
+            [lineStrings addObject:lineString];
+        }
+        
+        NSArray<NSString *> *polylines = [SFEncodedPolyline encodeLineStrings:lineStrings withPrecision:precision];
+        NSArray<SFLineString *> *decoded = [SFEncodedPolyline decodeLineStrings:polylines withPrecision:precision];
+        [SFTestUtils assertEqualIntWithValue:(int) lineStrings.count andValue2:(int) decoded.count];
+        
+        double tolerance = 0.5 / pow(10.0, precision) + 1e-12;
+        for(int i = 0; i < lineStrings.count; i++){
+            SFLineString *lineString = [lineStrings objectAtIndex:i];
+            SFLineString *decodedLineString = [decoded objectAtIndex:i];
+            [SFTestUtils assertEqualIntWithValue:[lineString numPoints] andValue2:[decodedLineString numPoints]];
+            for(int j = 0; j < [lineString numPoints]; j++){
+                [SFTestUtils assertEqualDoubleWithValue:[[lineString pointAtIndex:j].x doubleValue] andValue2:[[decodedLineString pointAtIndex:j].x doubleValue] andDelta:tolerance];
+                [SFTestUtils assertEqualDoubleWithValue:[[lineString pointAtIndex:j].y doubleValue] andValue2:[[decodedLineString pointAtIndex:j].y doubleValue] andDelta:tolerance];
+            }
+        }
+    }
+    
+    for(NSString *invalid in @[@"_p~iF~ps|U_", @"_p~iF", @"_p~iF~ps|U_ulLnnqC_mqNvxq`@é", @"\x1f?"]){
+        BOOL raised = NO;
+        @try {
+            [SFEncodedPolyline decodeLineString:invalid];
+        } @catch (NSException *exception) {
+            raised = YES;
+        }
+        [SFTestUtils assertTrue:raised];
+    }
+    
+}
+
+@end
@@ -0,0 +1,91 @@
+//
+//  GeohashTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeohash.h"
+
+@interface GeohashTestCase : XCTestCase
+
+@end
+
+@implementation GeohashTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test encoding and decoding known geohashes
+ */
+-(void) testKnownGeohashes {
+    
+    [SFTestUtils assertEqualWithValue:@"ezs42" andValue2:[SFGeohash encodeLongitude:-5.6 andLatitude:42.6 withLength:5]];
+    [SFTestUtils assertEqualWithValue:@"u4pruydqqvj" andValue2:[SFGeohash encodePoint:[[SFPoint alloc] initWithXValue:10.40744 andYValue:57.64911] withLength:11]];
+    [SFTestUtils assertEqualWithValue:@"zzzzzzzzzzzz" andValue2:[SFGeohash encodeLongitude:180.0 andLatitude:90.0 withLength:12]];
+    [SFTestUtils assertEqualWithValue:@"000000000000" andValue2:[SFGeohash encodeLongitude:-180.0 andLatitude:-90.0 withLength:12]];
+    
+    SFGeometryEnvelope *envelope = [SFGeohash decodeEnvelope:@"ezs42"];
+    [SFTestUtils assertEqualDoubleWithValue:-5.625 andValue2:[envelope.minX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:-5.5810546875 andValue2:[envelope.maxX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:42.5830078125 andValue2:[envelope.minY doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:42.626953125 andValue2:[envelope.maxY doubleValue]];
+    [SFTestUtils assertEqualWithValue:envelope andValue2:[SFGeohash decodeEnvelope:@"EZS42"]];
+    
+    SFPoint *center = [SFGeohash decodePoint:@"ezs42"];
+    [SFTestUtils assertEqualDoubleWithValue:-5.60302734375 andValue2:[center.x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:42.60498046875 andValue2:[center.y doubleValue]];
+    
+    [SFTestUtils assertEqualWithValue:@"ezs42" andValue2:[SFGeohash encodeEnvelope:envelope]];
+    [SFTestUtils assertEqualWithValue:@"" andValue2:[SFGeohash encodeEnvelope:[[SFGeometryEnvelope alloc] initWithMinXDouble:-1.0 andMinYDouble:-1.0 andMaxXDouble:1.0 andMaxYDouble:1.0]]];
+    
+    for(NSString *invalid in @[@"", @"ezs4a", @"ezs42ezs42ezs", @"ézs42"]){
+        BOOL raised = NO;
+        @try {
+            [SFGeohash decodeEnvelope:invalid];
+        } @catch (NSException *exception) {
+            raised = YES;
+        }
+        [SFTestUtils assertTrue:raised];
+    }
+    
+}
+
+/**
+ * Test batch encoding and decoding, with each decoded cell containing its
+ * point and each point encoding to the cell geohash at every length
+ */
+-(void) testBatch {
+    
+    NSMutableArray<SFPoint *> *points = [NSMutableArray array];
+    for(int i = 0; i < 500; i++){
+        [points addObject:[[SFPoint alloc] initWithXValue:((i * 7919) % 360000) / 1000.0 - 180.0 andYValue:((i * 104729) % 180000) / 1000.0 - 90.0]];
+    }
+    
+    for(int length = 1; length <= SF_GEOHASH_MAX_LENGTH; length++){
+        NSArray<NSString *> *geohashes = [SFGeohash encodePoints:points withLength:length];
+        NSArray<SFGeometryEnvelope *> *envelopes = [SFGeohash decodeEnvelopes:geohashes];
+        NSArray<SFPoint *> *centers = [SFGeohash decodePoints:geohashes];
+        for(int i = 0; i < points.count; i++){
+            SFPoint *point = [points objectAtIndex:i];
+            SFGeometryEnvelope *envelope = [envelopes objectAtIndex:i];
+            [SFTestUtils assertEqualIntWithValue:length andValue2:(int) [geohashes objectAtIndex:i].length];
+            [SFTestUtils assertTrue:[envelope.minX doubleValue] <= [point.x doubleValue] && [point.x doubleValue] <= [envelope.maxX doubleValue]];
+            [SFTestUtils assertTrue:[envelope.minY doubleValue] <= [point.y doubleValue] && [point.y doubleValue] <= [envelope.maxY doubleValue]];
+            [SFTestUtils assertEqualWithValue:[geohashes objectAtIndex:i] andValue2:[SFGeohash encodePoint:[centers objectAtIndex:i] withLength:length]];
+            [SFTestUtils assertTrue:[[SFGeohash encodeEnvelope:envelope] hasPrefix:[geohashes objectAtIndex:i]]];
+        }
+    }
+    
+}
+
+@end
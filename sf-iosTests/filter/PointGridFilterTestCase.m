@@ -0,0 +1,101 @@
+//
+//  PointGridFilterTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFPointGridFilter.h"
+#import "SFPolygon.h"
+#import "SFMultiPolygon.h"
+#import "SFMultiLineString.h"
+
+@interface PointGridFilterTestCase : XCTestCase
+
+@end
+
+@implementation PointGridFilterTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test snapping values and points
+ */
+-(void) testSnapPoint {
+    
+    SFPointGridFilter *filter = [[SFPointGridFilter alloc] initWithGridSize:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:38.8977123 andValue2:[filter snapValue:38.897712345678]];
+    [SFTestUtils assertEqualDoubleWithValue:-77.0365556 andValue2:[filter snapValue:-77.03655555]];
+    
+    SFPoint *point = [[SFPoint alloc] initWithXValue:-77.03655555 andYValue:38.897712345678 andZValue:10.123456789 andMValue:1.55555555];
+    [SFTestUtils assertTrue:[filter filterGeometry:point inType:SF_NONE]];
+    [SFTestUtils assertEqualDoubleWithValue:-77.0365556 andValue2:[point.x doubleValue] andDelta:0.0000000001];
+    [SFTestUtils assertEqualDoubleWithValue:38.8977123 andValue2:[point.y doubleValue] andDelta:0.0000000001];
+    [SFTestUtils assertEqualDoubleWithValue:10.123456789 andValue2:[point.z doubleValue] andDelta:0.0000000001];
+    [SFTestUtils assertEqualDoubleWithValue:1.55555555 andValue2:[point.m doubleValue] andDelta:0.0000000001];
+    
+    filter = [[SFPointGridFilter alloc] initWithGridSize:0.5 andZ:YES andM:YES];
+    [point snapToGrid:0.5];
+    [filter snapGeometry:point];
+    [SFTestUtils assertEqualDoubleWithValue:-77.0 andValue2:[point.x doubleValue] andDelta:0.0000000001];
+    [SFTestUtils assertEqualDoubleWithValue:39.0 andValue2:[point.y doubleValue] andDelta:0.0000000001];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[point.z doubleValue] andDelta:0.0000000001];
+    [SFTestUtils assertEqualDoubleWithValue:1.5 andValue2:[point.m doubleValue] andDelta:0.0000000001];
+    
+    // Grid sizes without an integral inverse
+    filter = [[SFPointGridFilter alloc] initWithGridSize:4096];
+    [SFTestUtils assertEqualDoubleWithValue:8192.0 andValue2:[filter snapValue:7000.0]];
+    [SFTestUtils assertEqualDoubleWithValue:-4096.0 andValue2:[filter snapValue:-2049.0]];
+    
+}
+
+/**
+ * Test removing collapsed vertices and degenerate components
+ */
+-(void) testSnapGeometry {
+    
+    SFLineString *lineString = [SFGeometryTestUtils lineStringWithCoordinates:@[@0, @0, @0.2, @0.1, @1.1, @0.9, @0.9, @1.2, @2, @2]];
+    [lineString snapToGrid:1];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[lineString numPoints]];
+    [SFTestUtils assertEqualDoubleWithValue:1.0 andValue2:[[lineString pointAtIndex:1].x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:2.0 andValue2:[[lineString endPoint].y doubleValue]];
+    
+    // Collapsed line strings are emptied
+    SFLineString *collapsed = [SFGeometryTestUtils lineStringWithCoordinates:@[@0.1, @0.1, @0.2, @-0.2]];
+    [collapsed snapToGrid:1];
+    [SFTestUtils assertTrue:[collapsed isEmpty]];
+    
+    // Holes collapsing to lines are removed
+    SFPolygon *polygon = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils lineStringWithCoordinates:@[@0, @0, @10, @0, @10, @10, @0, @10, @0, @0]]];
+    [polygon addRing:[SFGeometryTestUtils lineStringWithCoordinates:@[@2, @2, @2.2, @5, @2.4, @8, @2, @2]]];
+    [polygon addRing:[SFGeometryTestUtils lineStringWithCoordinates:@[@4, @4, @6, @4, @6, @6, @4, @4]]];
+    [polygon snapToGrid:1];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[polygon numRings]];
+    [SFTestUtils assertEqualDoubleWithValue:6.0 andValue2:[[[polygon interiorRingAtIndex:0] pointAtIndex:1].x doubleValue]];
+    
+    // Polygons with a collapsed exterior are removed from collections
+    SFMultiPolygon *multiPolygon = [[SFMultiPolygon alloc] init];
+    [multiPolygon addPolygon:[[SFPolygon alloc] initWithRing:[SFGeometryTestUtils lineStringWithCoordinates:@[@0.1, @0.1, @0.3, @0.1, @0.3, @0.2, @0.1, @0.1]]]];
+    [multiPolygon addPolygon:polygon];
+    [multiPolygon snapToGrid:1];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:[multiPolygon numPolygons]];
+    [SFTestUtils assertEqualWithValue:polygon andValue2:[multiPolygon polygonAtIndex:0]];
+    
+    SFMultiLineString *multiLineString = [[SFMultiLineString alloc] init];
+    [multiLineString addLineString:[SFGeometryTestUtils lineStringWithCoordinates:@[@0.1, @0.1, @0.2, @-0.2]]];
+    [multiLineString snapToGrid:1];
+    [SFTestUtils assertTrue:[multiLineString isEmpty]];
+    
+}
+
+@end
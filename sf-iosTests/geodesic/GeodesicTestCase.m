@@ -0,0 +1,146 @@
+//
+//  GeodesicTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFGeodesic.h"
+#import "SFPolygon.h"
+#import "SFMultiPolygon.h"
+
+@interface GeodesicTestCase : XCTestCase
+
+@end
+
+@implementation GeodesicTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test ellipsoid and sphere distances, azimuths, and destinations
+ */
+-(void) testDistance {
+    
+    SFPoint *jfk = [[SFPoint alloc] initWithXValue:-73.78 andYValue:40.64];
+    SFPoint *lhr = [[SFPoint alloc] initWithXValue:-0.46 andYValue:51.47];
+    
+    [SFTestUtils assertEqualDoubleWithValue:5554747.7396556744 andValue2:[SFGeodesic distanceBetweenPoint1:jfk andPoint2:lhr] andDelta:0.000001];
+    [SFTestUtils assertEqualDoubleWithValue:51.381751569861784 andValue2:[SFGeodesic azimuthFromPoint1:jfk toPoint2:lhr] andDelta:0.000000001];
+    
+    SFPoint *destination = [SFGeodesic destinationFromPoint:jfk withAzimuth:51.381751569861784 andDistance:5554747.7396556744];
+    [SFTestUtils assertEqualDoubleWithValue:-0.46 andValue2:[destination.x doubleValue] andDelta:0.000000001];
+    [SFTestUtils assertEqualDoubleWithValue:51.47 andValue2:[destination.y doubleValue] andDelta:0.000000001];
+    
+    [SFTestUtils assertEqualDoubleWithValue:5539858.8357833987 andValue2:[SFGeodesic distanceBetweenPoint1:jfk andPoint2:lhr withType:SF_GT_SPHERE] andDelta:0.000001];
+    double azimuth = [SFGeodesic azimuthFromPoint1:jfk toPoint2:lhr withType:SF_GT_SPHERE];
+    [SFTestUtils assertEqualDoubleWithValue:51.352617892125799 andValue2:azimuth andDelta:0.000000001];
+    destination = [SFGeodesic destinationFromPoint:jfk withAzimuth:azimuth andDistance:5539858.8357833987 andType:SF_GT_SPHERE];
+    [SFTestUtils assertEqualDoubleWithValue:-0.46 andValue2:[destination.x doubleValue] andDelta:0.000000001];
+    [SFTestUtils assertEqualDoubleWithValue:51.47 andValue2:[destination.y doubleValue] andDelta:0.000000001];
+    
+    // Nearly antipodal points
+    SFPoint *point1 = [[SFPoint alloc] initWithXValue:0.0 andYValue:0.5];
+    SFPoint *point2 = [[SFPoint alloc] initWithXValue:179.7 andYValue:-0.5];
+    [SFTestUtils assertEqualDoubleWithValue:19995624.889961265 andValue2:[SFGeodesic distanceBetweenPoint1:point1 andPoint2:point2] andDelta:0.000001];
+    [SFTestUtils assertEqualDoubleWithValue:29.830010973450658 andValue2:[SFGeodesic azimuthFromPoint1:point1 toPoint2:point2] andDelta:0.000000001];
+    
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[SFGeodesic distanceBetweenPoint1:jfk andPoint2:jfk]];
+    
+}
+
+/**
+ * Test geometry lengths, perimeters, and areas
+ */
+-(void) testGeometryMeasures {
+    
+    // Earth octant
+    SFPolygon *octant = [SFGeometryTestUtils polygonWithCoordinates:@[@0, @0, @90, @0, @0, @90, @0, @0]];
+    [SFTestUtils assertEqualDoubleWithValue:63758202715511.055 andValue2:[SFGeodesic areaOfGeometry:octant] andDelta:1.0];
+    [SFTestUtils assertEqualDoubleWithValue:30022685.630020067 andValue2:[SFGeodesic perimeterOfGeometry:octant] andDelta:0.000001];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[SFGeodesic lengthOfGeometry:octant]];
+    [SFTestUtils assertEqualDoubleWithValue:M_PI * SF_EARTH_MEAN_RADIUS * SF_EARTH_MEAN_RADIUS / 2.0 andValue2:[SFGeodesic areaOfGeometry:octant withType:SF_GT_SPHERE] andDelta:1.0];
+    
+    // Orientation does not change the area
+    SFPolygon *square = [SFGeometryTestUtils polygonWithCoordinates:@[@0, @0, @1, @0, @1, @1, @0, @1, @0, @0]];
+    SFPolygon *clockwise = [SFGeometryTestUtils polygonWithCoordinates:@[@0, @0, @0, @1, @1, @1, @1, @0, @0, @0]];
+    [SFTestUtils assertEqualDoubleWithValue:12308778361.469452 andValue2:[SFGeodesic areaOfGeometry:square] andDelta:0.001];
+    [SFTestUtils assertEqualDoubleWithValue:12308778361.469452 andValue2:[SFGeodesic areaOfGeometry:clockwise] andDelta:0.001];
+    [SFTestUtils assertEqualDoubleWithValue:443770.91724830196 andValue2:[SFGeodesic perimeterOfGeometry:square] andDelta:0.000001];
+    
+    // Hole areas are removed
+    SFPolygon *polygon = [SFGeometryTestUtils polygonWithCoordinates:@[@-1, @-1, @2, @-1, @2, @2, @-1, @2, @-1, @-1]];
+    double outerArea = [SFGeodesic areaOfGeometry:polygon];
+    [polygon addRing:[square exteriorRing]];
+    [SFTestUtils assertEqualDoubleWithValue:outerArea - 12308778361.469452 andValue2:[SFGeodesic areaOfGeometry:polygon] andDelta:0.01];
+    
+    SFMultiPolygon *multiPolygon = [[SFMultiPolygon alloc] init];
+    [multiPolygon addPolygon:polygon];
+    [multiPolygon addPolygon:square];
+    [SFTestUtils assertEqualDoubleWithValue:outerArea andValue2:[SFGeodesic areaOfGeometry:multiPolygon] andDelta:0.01];
+    
+    // Polygon around the north pole crossing the antimeridian
+    SFPolygon *polar = [SFGeometryTestUtils polygonWithCoordinates:@[@-170, @80, @-50, @80, @70, @80, @190, @80]];
+    double polarArea = [SFGeodesic areaOfGeometry:polar];
+    [SFTestUtils assertTrue:polarArea > 0.0 && polarArea < 2.0 * M_PI * SF_EARTH_MEAN_RADIUS * SF_EARTH_MEAN_RADIUS * (1.0 - sin(80.0 * M_PI / 180.0))];
+    
+    SFLineString *lineString = [[SFLineString alloc] init];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:-73.78 andYValue:40.64]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:-0.46 andYValue:51.47]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:-73.78 andYValue:40.64]];
+    [SFTestUtils assertEqualDoubleWithValue:2.0 * 5554747.7396556744 andValue2:[SFGeodesic lengthOfGeometry:lineString] andDelta:0.00001];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[SFGeodesic areaOfGeometry:lineString]];
+    
+}
+
+/**
+ * Test batch distances and lengths of packed coordinates
+ */
+-(void) testBatch {
+    
+    int count = 20000;
+    double *coordinates = malloc(sizeof(double) * 2 * count);
+    double *distances = malloc(sizeof(double) * (count - 1));
+    for(int i = 0; i < count; i++){
+        coordinates[2 * i] = -73.78 + 0.001 * i;
+        coordinates[2 * i + 1] = 40.64 + 0.0005 * sin(i);
+    }
+    
+    for(int type = SF_GT_ELLIPSOID; type <= SF_GT_SPHERE; type++){
+        
+        [SFGeodesic distancesBetweenCoordinates1:coordinates andCoordinates2:coordinates + 2 withCount:count - 1 intoDistances:distances withType:type];
+        
+        double sum = 0.0;
+        for(int i = 0; i < count - 1; i++){
+            if(i % 1000 == 0){
+                SFPoint *point1 = [[SFPoint alloc] initWithXValue:coordinates[2 * i] andYValue:coordinates[2 * i + 1]];
+                SFPoint *point2 = [[SFPoint alloc] initWithXValue:coordinates[2 * i + 2] andYValue:coordinates[2 * i + 3]];
+                [SFTestUtils assertEqualDoubleWithValue:[SFGeodesic distanceBetweenPoint1:point1 andPoint2:point2 withType:type] andValue2:distances[i] andDelta:0.000000001];
+            }
+            sum += distances[i];
+        }
+        
+        [SFTestUtils assertEqualDoubleWithValue:sum andValue2:[SFGeodesic lengthOfCoordinates:coordinates withCount:count andType:type] andDelta:0.0001];
+        [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[SFGeodesic lengthOfCoordinates:coordinates withCount:1 andType:type]];
+    }
+    
+    double ring[] = {0, 0, 1, 0, 1, 1, 0, 1};
+    [SFTestUtils assertEqualDoubleWithValue:12308778361.469452 andValue2:[SFGeodesic areaOfCoordinates:ring withCount:4 andType:SF_GT_ELLIPSOID] andDelta:0.001];
+    double reversed[] = {0, 0, 0, 1, 1, 1, 1, 0};
+    [SFTestUtils assertEqualDoubleWithValue:-12308778361.469452 andValue2:[SFGeodesic areaOfCoordinates:reversed withCount:4 andType:SF_GT_ELLIPSOID] andDelta:0.001];
+    
+    free(coordinates);
+    free(distances);
+}
+
+@end
@@ -0,0 +1,172 @@
+//
+//  GeoJSONTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeoJSONReader.h"
+#import "SFGeoJSONWriter.h"
+#import "SFPoint.h"
+#import "SFPolygon.h"
+#import "SFMultiPoint.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+
+@interface GeoJSONTestCase : XCTestCase
+
+@end
+
+@implementation GeoJSONTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test reading geometries
+ */
+-(void) testReadGeometry {
+    
+    SFPoint *point = (SFPoint *) [SFGeoJSONReader readGeometryWithText:@"{\"type\": \"Point\", \"coordinates\": [-77.0365, 38.8977, 16.5]}"];
+    [SFTestUtils assertEqualIntWithValue:SF_POINT andValue2:point.geometryType];
+    [SFTestUtils assertTrue:point.hasZ];
+    [SFTestUtils assertEqualDoubleWithValue:-77.0365 andValue2:[point.x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:38.8977 andValue2:[point.y doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:16.5 andValue2:[point.z doubleValue]];
+    
+    // Coordinates before the type, with unknown members skipped
+    SFPolygon *polygon = (SFPolygon *) [SFGeoJSONReader readGeometryWithText:@"{\"coordinates\": [[[0, 0], [10, 0], [10, 10], [0, 0]], [[1, 1], [2, 1], [2, 2], [1, 1]]], \"bbox\": [0, 0, 10, 10], \"extra\": {\"a\": [1, \"]}\"]}, \"type\": \"Polygon\"}"];
+    [SFTestUtils assertEqualIntWithValue:SF_POLYGON andValue2:polygon.geometryType];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[polygon numRings]];
+    [SFTestUtils assertEqualIntWithValue:4 andValue2:[[polygon interiorRingAtIndex:0] numPoints]];
+    [SFTestUtils assertFalse:polygon.hasZ];
+    
+    SFMultiPolygon *multiPolygon = (SFMultiPolygon *) [SFGeoJSONReader readGeometryWithText:@"{\"type\": \"MultiPolygon\", \"coordinates\": [[[[0, 0], [1, 0], [1, 1], [0, 0]]], [[[5, 5], [6, 5], [6, 6], [5, 5]], []]]}"];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[multiPolygon numPolygons]];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[[multiPolygon polygonAtIndex:1] numRings]];
+    [SFTestUtils assertEqualDoubleWithValue:6.0 andValue2:[[[multiPolygon polygonAtIndex:1] exteriorRing] pointAtIndex:2].x.doubleValue];
+    
+    SFGeometryCollection *collection = (SFGeometryCollection *) [SFGeoJSONReader readGeometryWithText:@"{\"type\": \"Feature\", \"properties\": {\"name\": \"a \\\"b\\\"\"}, \"geometry\": {\"type\": \"GeometryCollection\", \"geometries\": [{\"type\": \"Point\", \"coordinates\": []}, {\"type\": \"MultiPoint\", \"coordinates\": [[1, 2], [3, 4]]}]}}"];
+    [SFTestUtils assertEqualIntWithValue:SF_GEOMETRYCOLLECTION andValue2:collection.geometryType];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[collection numGeometries]];
+    [SFTestUtils assertTrue:isnan([((SFPoint *) [collection geometryAtIndex:0]).x doubleValue])];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[((SFMultiPoint *) [collection geometryAtIndex:1]) numPoints]];
+    
+    [SFTestUtils assertNil:[SFGeoJSONReader readGeometryWithText:@"{\"type\": \"Feature\", \"geometry\": null, \"properties\": null}"]];
+    
+    // Geometry collections nested beyond the maximum depth
+    NSMutableString *nested = [NSMutableString string];
+    for(int i = 0; i < 10000; i++){
+        [nested appendString:@"{\"type\": \"GeometryCollection\", \"geometries\": ["];
+    }
+    
+    NSArray<NSString *> *invalid = @[
+        @"{\"type\": \"LineString\", \"coordinates\": [[1, 2], [3]]}",
+        @"{\"type\": \"Point\", \"coordinates\": [[1, 2]]}",
+        @"{\"type\": \"LineString\", \"coordinates\": [[1, 2], [3, 4]]",
+        @"{\"type\": \"Polygon\"}",
+        nested
+    ];
+    for(NSString *text in invalid){
+        BOOL raised = NO;
+        @try {
+            [SFGeoJSONReader readGeometryWithText:text];
+        } @catch (NSException *exception) {
+            raised = YES;
+        }
+        [SFTestUtils assertTrue:raised];
+    }
+    
+}
+
+/**
+ * Test writing and reading back geometries
+ */
+-(void) testWriteGeometry {
+    
+    SFPoint *point = [[SFPoint alloc] initWithXValue:1.0 andYValue:2.5];
+    [SFTestUtils assertEqualWithValue:@"{\"type\":\"Point\",\"coordinates\":[1,2.5]}" andValue2:[SFGeoJSONWriter textWithGeometry:point]];
+    
+    SFMultiLineString *multiLineString = [[SFMultiLineString alloc] init];
+    for(int i = 0; i < 3; i++){
+        SFLineString *lineString = [[SFLineString alloc] initWithHasZ:YES andHasM:NO];
+        for(int j = 0; j < 10; j++){
+            [lineString addPoint:[[SFPoint alloc] initWithXValue:i + j * 0.1 andYValue:-j / 3.0 andZValue:j]];
+        }
+        [multiLineString addLineString:lineString];
+    }
+    
+    SFPolygon *polygon = [[SFPolygon alloc] init];
+    SFLineString *ring = [[SFLineString alloc] init];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:0.0 andYValue:0.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:1.0 andYValue:0.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:1.0 andYValue:1.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:0.0 andYValue:0.0]];
+    [polygon addRing:ring];
+    
+    SFGeometryCollection *collection = [[SFGeometryCollection alloc] init];
+    [collection addGeometry:point];
+    [collection addGeometry:[[SFMultiPolygon alloc] initWithPolygon:polygon]];
+    
+    for(SFGeometry *geometry in @[point, multiLineString, polygon, collection]){
+        SFGeometry *read = [SFGeoJSONReader readGeometryWithData:[SFGeoJSONWriter dataWithGeometry:geometry]];
+        [SFTestUtils assertEqualWithValue:geometry andValue2:read];
+    }
+    
+    BOOL raised = NO;
+    @try {
+        [SFGeoJSONWriter textWithGeometry:[[SFPoint alloc] initWithXValue:INFINITY andYValue:0.0]];
+    } @catch (NSException *exception) {
+        raised = YES;
+    }
+    [SFTestUtils assertTrue:raised];
+    
+}
+
+/**
+ * Test streaming a feature collection
+ */
+-(void) testFeatureCollection {
+    
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"features.geojson"];
+    
+    int count = 5000;
+    SFGeoJSONWriter *writer = [[SFGeoJSONWriter alloc] initWithPath:path];
+    [writer beginFeatureCollection];
+    for(int i = 0; i < count; i++){
+        SFLineString *lineString = [[SFLineString alloc] init];
+        [lineString addPoint:[[SFPoint alloc] initWithXValue:i andYValue:i * 0.5]];
+        [lineString addPoint:[[SFPoint alloc] initWithXValue:i + 1 andYValue:i * 0.5]];
+        [writer writeFeatureWithGeometry:lineString];
+        if(i % 1000 == 0){
+            [writer writeFeatureWithGeometry:nil];
+        }
+    }
+    [writer endFeatureCollection];
+    [writer close];
+    
+    SFGeoJSONReader *reader = [[SFGeoJSONReader alloc] initWithPath:path];
+    int read = 0;
+    for(SFGeometry *geometry in reader){
+        SFLineString *lineString = (SFLineString *) geometry;
+        [SFTestUtils assertEqualIntWithValue:SF_LINESTRING andValue2:lineString.geometryType];
+        [SFTestUtils assertEqualDoubleWithValue:read * 0.5 andValue2:[[lineString startPoint].y doubleValue]];
+        read++;
+    }
+    [reader close];
+    [SFTestUtils assertEqualIntWithValue:count andValue2:read];
+    [SFTestUtils assertTrue:reader.offset > 65536];
+    
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+    
+}
+
+@end
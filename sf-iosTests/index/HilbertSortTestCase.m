@@ -0,0 +1,108 @@
+//
+//  HilbertSortTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFHilbertSort.h"
+#import "SFMultiPoint.h"
+#import "SFLineString.h"
+
+@interface HilbertSortTestCase : XCTestCase
+
+@end
+
+@implementation HilbertSortTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test Hilbert indices
+ */
+-(void) testIndex {
+    
+    [SFTestUtils assertEqualIntWithValue:0 andValue2:[SFHilbertSort indexOfX:0 andY:0]];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:[SFHilbertSort indexOfX:1 andY:0]];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[SFHilbertSort indexOfX:1 andY:1]];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[SFHilbertSort indexOfX:0 andY:1]];
+    [SFTestUtils assertTrue:[SFHilbertSort indexOfX:0 andY:65535] == 0x55555555];
+    [SFTestUtils assertTrue:[SFHilbertSort indexOfX:32768 andY:32768] == 0x80000000];
+    [SFTestUtils assertTrue:[SFHilbertSort indexOfX:65535 andY:0] == 0xFFFFFFFF];
+    
+    // Consecutive indices are neighboring cells
+    uint32_t previousX = 0;
+    uint32_t previousY = 0;
+    uint32_t cells[64];
+    for(uint32_t y = 0; y < 8; y++){
+        for(uint32_t x = 0; x < 8; x++){
+            cells[[SFHilbertSort indexOfX:x andY:y]] = (y << 8) | x;
+        }
+    }
+    for(int i = 1; i < 64; i++){
+        uint32_t x = cells[i] & 0xFF;
+        uint32_t y = cells[i] >> 8;
+        [SFTestUtils assertEqualIntWithValue:1 andValue2:abs((int) x - (int) previousX) + abs((int) y - (int) previousY)];
+        previousX = x;
+        previousY = y;
+    }
+    
+}
+
+/**
+ * Test sorting geometries and collections
+ */
+-(void) testSort {
+    
+    // Shuffled 4 x 4 grid of points
+    NSMutableArray<SFGeometry *> *geometries = [NSMutableArray array];
+    for(int i = 0; i < 16; i++){
+        int cell = (i * 7) % 16;
+        [geometries addObject:[[SFPoint alloc] initWithXValue:10.0 + 2.5 * (cell % 4) andYValue:-5.0 + 2.5 * (cell / 4)]];
+    }
+    [geometries insertObject:[[SFLineString alloc] init] atIndex:3];
+    
+    NSArray<SFGeometry *> *sorted = [SFHilbertSort sortGeometries:geometries];
+    [SFTestUtils assertEqualIntWithValue:17 andValue2:(int) sorted.count];
+    [SFTestUtils assertEqualWithValue:[geometries objectAtIndex:3] andValue2:[sorted lastObject]];
+    
+    SFPoint *first = (SFPoint *) [sorted firstObject];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[first.x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:-5.0 andValue2:[first.y doubleValue]];
+    for(int i = 1; i < 16; i++){
+        SFPoint *point1 = (SFPoint *) [sorted objectAtIndex:i - 1];
+        SFPoint *point2 = (SFPoint *) [sorted objectAtIndex:i];
+        double distance = fabs([point1.x doubleValue] - [point2.x doubleValue]) + fabs([point1.y doubleValue] - [point2.y doubleValue]);
+        [SFTestUtils assertEqualDoubleWithValue:2.5 andValue2:distance];
+    }
+    
+    SFMultiPoint *multiPoint = [[SFMultiPoint alloc] init];
+    for(int i = 0; i < 16; i++){
+        [multiPoint addPoint:(SFPoint *) [geometries objectAtIndex:i < 3 ? i : i + 1]];
+    }
+    [SFHilbertSort sortGeometryCollection:multiPoint];
+    for(int i = 0; i < 16; i++){
+        [SFTestUtils assertEqualWithValue:[sorted objectAtIndex:i] andValue2:[multiPoint pointAtIndex:i]];
+    }
+    
+    // Non finite centers are last in their original order
+    double centers[] = {3, 0, NAN, 1, 0, 0, 0, 3, INFINITY, 0, 3, 3, 1, 1};
+    NSData *order = [SFHilbertSort orderOfCenters:centers withCount:7];
+    const int *indices = order.bytes;
+    int expected[] = {2, 6, 3, 5, 0, 1, 4};
+    for(int i = 0; i < 7; i++){
+        [SFTestUtils assertEqualIntWithValue:expected[i] andValue2:indices[i]];
+    }
+    
+}
+
+@end
@@ -0,0 +1,203 @@
+//
+//  PackedGeometryTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFPackedGeometryWriter.h"
+#import "SFPackedGeometryReader.h"
+#import "SFMultiPoint.h"
+#import "SFMultiLineString.h"
+#import "SFMultiPolygon.h"
+#import "SFGeometryCollection.h"
+#import "SFTIN.h"
+#import "SFTriangle.h"
+
+@interface PackedGeometryTestCase : XCTestCase
+
+@end
+
+@implementation PackedGeometryTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test writing and reading back each supported geometry type
+ */
+-(void) testRoundTrip {
+    
+    NSMutableArray<SFGeometry *> *geometries = [NSMutableArray array];
+    
+    [geometries addObject:[[SFPoint alloc] initWithXValue:10.5 andYValue:-20.25]];
+    
+    SFLineString *lineString = [[SFLineString alloc] initWithHasZ:YES andHasM:NO];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:0.0 andYValue:0.0 andZValue:5.0]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:3.0 andYValue:4.0 andZValue:6.0]];
+    [geometries addObject:lineString];
+    
+    SFPolygon *polygon = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils squareWithMinX:50.0 andMinY:50.0 andSize:10.0]];
+    [polygon addRing:[SFGeometryTestUtils squareWithMinX:52.0 andMinY:52.0 andSize:2.0]];
+    [geometries addObject:polygon];
+    
+    SFMultiPoint *multiPoint = [[SFMultiPoint alloc] init];
+    [multiPoint addPoint:[[SFPoint alloc] initWithHasZ:NO andHasM:YES andXValue:-5.0 andYValue:-5.0]];
+    [multiPoint addPoint:[[SFPoint alloc] initWithHasZ:NO andHasM:YES andXValue:-6.0 andYValue:-7.0]];
+    [[multiPoint pointAtIndex:0] setMValue:1.0];
+    [[multiPoint pointAtIndex:1] setMValue:2.0];
+    [geometries addObject:multiPoint];
+    
+    SFMultiLineString *multiLineString = [[SFMultiLineString alloc] init];
+    [multiLineString addLineString:[SFGeometryTestUtils squareWithMinX:20.0 andMinY:30.0 andSize:1.0]];
+    [multiLineString addLineString:[SFGeometryTestUtils squareWithMinX:25.0 andMinY:35.0 andSize:2.0]];
+    [geometries addObject:multiLineString];
+    
+    SFMultiPolygon *multiPolygon = [[SFMultiPolygon alloc] init];
+    [multiPolygon addPolygon:polygon];
+    [multiPolygon addPolygon:[[SFPolygon alloc] initWithRing:[SFGeometryTestUtils squareWithMinX:80.0 andMinY:80.0 andSize:5.0]]];
+    [geometries addObject:multiPolygon];
+    
+    SFTriangle *triangle = [[SFTriangle alloc] init];
+    SFLineString *ring = [[SFLineString alloc] init];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:0.0 andYValue:90.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:1.0 andYValue:90.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:0.0 andYValue:91.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:0.0 andYValue:90.0]];
+    [triangle addRing:ring];
+    [geometries addObject:triangle];
+    SFTIN *tin = [[SFTIN alloc] init];
+    [tin addPolygon:triangle];
+    [geometries addObject:tin];
+    
+    [geometries addObject:[[SFLineString alloc] init]];
+    
+    NSData *data = [SFPackedGeometryWriter dataWithGeometries:geometries];
+    SFPackedGeometryReader *reader = [[SFPackedGeometryReader alloc] initWithData:data];
+    [SFTestUtils assertEqualIntWithValue:(int) geometries.count andValue2:reader.count];
+    [SFTestUtils assertEqualIntWithValue:SF_PACKED_DEFAULT_NODE_SIZE andValue2:reader.nodeSize];
+    [SFTestUtils assertTrue:reader.hasZ];
+    [SFTestUtils assertTrue:reader.hasM];
+    
+    NSMutableArray<SFGeometry *> *remaining = [NSMutableArray arrayWithArray:geometries];
+    for(int i = 0; i < reader.count; i++){
+        SFGeometry *geometry = [reader geometryAtIndex:i];
+        NSUInteger index = [remaining indexOfObject:geometry];
+        [SFTestUtils assertTrue:index != NSNotFound];
+        [SFTestUtils assertEqualIntWithValue:geometry.geometryType andValue2:[remaining objectAtIndex:index].geometryType];
+        [self assertEnvelope:[geometry envelope] withLeafEnvelope:[reader envelopeAtIndex:i]];
+        [remaining removeObjectAtIndex:index];
+    }
+    [SFTestUtils assertEqualIntWithValue:0 andValue2:(int) remaining.count];
+    
+    // Empty line string is ordered last and never queried
+    [SFTestUtils assertNil:[reader envelopeAtIndex:reader.count - 1]];
+    SFGeometryEnvelope *world = [[SFGeometryEnvelope alloc] initWithMinXDouble:-1000.0 andMinYDouble:-1000.0 andMaxXDouble:1000.0 andMaxYDouble:1000.0];
+    [SFTestUtils assertEqualIntWithValue:reader.count - 1 andValue2:(int) [reader geometriesInEnvelope:world].count];
+    [SFTestUtils assertEqualWithValue:[[SFGeometryEnvelope alloc] initWithMinXDouble:-6.0 andMinYDouble:-20.25 andMaxXDouble:85.0 andMaxYDouble:91.0] andValue2:[reader envelope]];
+    
+    BOOL unsupported = NO;
+    @try {
+        [SFPackedGeometryWriter dataWithGeometries:@[[[SFGeometryCollection alloc] init]]];
+    } @catch (NSException *exception) {
+        unsupported = YES;
+    }
+    [SFTestUtils assertTrue:unsupported];
+    
+    BOOL invalid = NO;
+    @try {
+        SFPackedGeometryReader *truncated = [[SFPackedGeometryReader alloc] initWithData:[data subdataWithRange:NSMakeRange(0, data.length - 1)]];
+        [SFTestUtils assertNil:truncated];
+    } @catch (NSException *exception) {
+        invalid = YES;
+    }
+    [SFTestUtils assertTrue:invalid];
+    
+}
+
+/**
+ * Test envelope queries of a memory mapped file against a full scan
+ */
+-(void) testQuery {
+    
+    NSMutableArray<SFGeometry *> *geometries = [NSMutableArray array];
+    for(int i = 0; i < 2000; i++){
+        double x = (i * 7919) % 1000 / 10.0;
+        double y = (i * 104729) % 1000 / 10.0;
+        if(i % 3 == 0){
+            [geometries addObject:[[SFPolygon alloc] initWithRing:[SFGeometryTestUtils squareWithMinX:x andMinY:y andSize:(i % 5) / 2.0]]];
+        }else{
+            [geometries addObject:[[SFPoint alloc] initWithXValue:x andYValue:y]];
+        }
+    }
+    
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSString stringWithFormat:@"%@.sfpk", [[NSUUID UUID] UUIDString]]];
+    SFPackedGeometryWriter *writer = [[SFPackedGeometryWriter alloc] initWithStream:[NSOutputStream outputStreamToFileAtPath:path append:NO] andNodeSize:4];
+    [writer addGeometries:geometries];
+    [writer close];
+    
+    SFPackedGeometryReader *reader = [[SFPackedGeometryReader alloc] initWithPath:path];
+    [SFTestUtils assertEqualIntWithValue:2000 andValue2:reader.count];
+    [SFTestUtils assertEqualIntWithValue:4 andValue2:reader.nodeSize];
+    
+    for(int query = 0; query < 20; query++){
+        double minX = query * 4.5;
+        double minY = 100.0 - query * 5.0;
+        SFGeometryEnvelope *envelope = [[SFGeometryEnvelope alloc] initWithMinXDouble:minX andMinYDouble:minY andMaxXDouble:minX + 12.5 andMaxYDouble:minY + 7.5];
+        
+        int expected = 0;
+        for(SFGeometry *geometry in geometries){
+            if([[geometry envelope] intersectsWithEnvelope:envelope withAllowEmpty:YES]){
+                expected++;
+            }
+        }
+        
+        NSData *indices = [reader indicesInEnvelope:envelope];
+        [SFTestUtils assertEqualIntWithValue:expected andValue2:(int) (indices.length / sizeof(int))];
+        const int *values = indices.bytes;
+        for(int i = 1; i < expected; i++){
+            [SFTestUtils assertTrue:values[i - 1] < values[i]];
+        }
+        
+        __block int count = 0;
+        [reader enumerateGeometriesInEnvelope:envelope usingBlock:^(SFGeometry *geometry, int index, BOOL *stop) {
+            [SFTestUtils assertTrue:[[geometry envelope] intersectsWithEnvelope:envelope withAllowEmpty:YES]];
+            [SFTestUtils assertEqualIntWithValue:values[count] andValue2:index];
+            count++;
+        }];
+        [SFTestUtils assertEqualIntWithValue:expected andValue2:count];
+    }
+    
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+    
+}
+
+/**
+ * Assert the x and y bounds of the geometry envelope match the leaf envelope
+ *
+ * @param envelope
+ *            geometry envelope
+ * @param leafEnvelope
+ *            leaf envelope
+ */
+-(void) assertEnvelope: (SFGeometryEnvelope *) envelope withLeafEnvelope: (SFGeometryEnvelope *) leafEnvelope{
+    if(envelope == nil){
+        [SFTestUtils assertNil:leafEnvelope];
+    }else{
+        [SFTestUtils assertEqualDoubleWithValue:[envelope.minX doubleValue] andValue2:[leafEnvelope.minX doubleValue]];
+        [SFTestUtils assertEqualDoubleWithValue:[envelope.minY doubleValue] andValue2:[leafEnvelope.minY doubleValue]];
+        [SFTestUtils assertEqualDoubleWithValue:[envelope.maxX doubleValue] andValue2:[leafEnvelope.maxX doubleValue]];
+        [SFTestUtils assertEqualDoubleWithValue:[envelope.maxY doubleValue] andValue2:[leafEnvelope.maxY doubleValue]];
+    }
+}
+
+@end
@@ -0,0 +1,185 @@
+//
+//  GeometryRepairTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFGeometryRepair.h"
+#import "SFGeometryValidator.h"
+#import "SFGeometryUtils.h"
+
+@interface GeometryRepairTestCase : XCTestCase
+
+@end
+
+@implementation GeometryRepairTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test repairing self-intersecting polygons
+ */
+-(void) testPolygon {
+    
+    // Bowtie
+    SFPolygon *bowtie = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@0, @0, @2, @2, @2, @0, @0, @2]]];
+    [SFTestUtils assertTrue:![SFGeometryValidator isValidGeometry:bowtie]];
+    SFMultiPolygon *repaired = [SFGeometryRepair makeValidGeometry:bowtie];
+    [SFTestUtils assertTrue:[SFGeometryValidator isValidGeometry:repaired]];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[repaired numPolygons]];
+    [SFTestUtils assertEqualDoubleWithValue:2.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:repaired] andDelta:0.0000001];
+    for(SFPolygon *polygon in [repaired polygons]){
+        [SFTestUtils assertEqualDoubleWithValue:1.0 andValue2:[SFGeometryTestUtils areaOfRing:[polygon exteriorRing]] andDelta:0.0000001];
+    }
+    
+    // Ring looping around itself, the doubly wound center is a hole
+    SFPolygon *loop = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@0, @0, @3, @0, @3, @3, @1, @3, @1, @1, @2, @1, @2, @2, @0, @2]]];
+    repaired = [SFGeometryRepair makeValidGeometry:loop];
+    [SFTestUtils assertTrue:[SFGeometryValidator isValidGeometry:repaired]];
+    [SFTestUtils assertEqualDoubleWithValue:7.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:repaired] andDelta:0.0000001];
+    
+    // Spike and hole crossing the shell
+    SFPolygon *spike = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@0, @0, @4, @0, @4, @4, @6, @6, @4, @4, @0, @4]]];
+    [spike addRing:[SFGeometryTestUtils ringWithCoordinates:@[@3, @1, @5, @1, @5, @3, @3, @3]]];
+    repaired = [SFGeometryRepair makeValidGeometry:spike];
+    [SFTestUtils assertTrue:[SFGeometryValidator validateGeometry:repaired withOrientation:YES] == nil];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[repaired numPolygons]];
+    [SFTestUtils assertEqualDoubleWithValue:16.0 - 2.0 + 2.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:repaired] andDelta:0.0000001];
+    
+    // Valid polygon
+    SFPolygon *square = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@0, @0, @0, @4, @4, @4, @4, @0]]];
+    repaired = [SFGeometryRepair makeValidGeometry:square];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:[repaired numPolygons]];
+    [SFTestUtils assertEqualDoubleWithValue:16.0 andValue2:[SFGeometryTestUtils areaOfRing:[[repaired polygonAtIndex:0] exteriorRing]] andDelta:0.0000001];
+    
+    // Collapsed ring
+    SFPolygon *collapsed = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@0, @0, @2, @2, @1, @1]]];
+    [SFTestUtils assertTrue:[[SFGeometryRepair makeValidGeometry:collapsed] isEmpty]];
+    
+}
+
+/**
+ * Test repairing multi polygons with overlapping and invalid members
+ */
+-(void) testMultiPolygon {
+    
+    SFMultiPolygon *multiPolygon = [[SFMultiPolygon alloc] init];
+    [multiPolygon addPolygon:[[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@0, @0, @2, @0, @2, @2, @0, @2]]]];
+    [multiPolygon addPolygon:[[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@1, @1, @3, @1, @3, @3, @1, @3]]]];
+    [multiPolygon addPolygon:[[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@10, @0, @12, @2, @12, @0, @10, @2]]]];
+    [SFTestUtils assertTrue:![SFGeometryValidator isValidGeometry:multiPolygon]];
+    
+    SFMultiPolygon *repaired = [SFGeometryRepair makeValidGeometry:multiPolygon];
+    [SFTestUtils assertTrue:[SFGeometryValidator isValidGeometry:repaired]];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[repaired numPolygons]];
+    [SFTestUtils assertEqualDoubleWithValue:7.0 + 2.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:repaired] andDelta:0.0000001];
+    
+    NSArray<SFMultiPolygon *> *results = [SFGeometryRepair makeValidGeometries:@[multiPolygon, [multiPolygon polygonAtIndex:2]]];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:(int)results.count];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[[results objectAtIndex:0] numPolygons]];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[[results objectAtIndex:1] numPolygons]];
+    
+}
+
+/**
+ * Test repairing rings with collinear overlapping and degenerate crossings
+ */
+-(void) testDegenerateRing {
+    
+    // Collinear back tracking edges crossed at shared vertices
+    SFPolygon *polygon = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@1, @9, @5, @3, @9, @4, @3, @6, @6, @6, @2, @6, @9, @4]]];
+    SFMultiPolygon *repaired = [SFGeometryRepair makeValidGeometry:polygon];
+    [SFTestUtils assertTrue:![repaired isEmpty]];
+    [SFTestUtils assertEqualDoubleWithValue:[self evenOddAreaOfRing:[polygon exteriorRing]] andValue2:[SFGeometryTestUtils areaOfMultiPolygon:repaired] andDelta:0.0000001];
+    SFPoint *point = [[SFPoint alloc] initWithXValue:5.0 andYValue:4.0];
+    BOOL contains = NO;
+    for(SFPolygon *repairedPolygon in [repaired polygons]){
+        contains = contains || [SFGeometryUtils point:point inPolygon:repairedPolygon];
+    }
+    [SFTestUtils assertTrue:contains];
+    
+    // Random integer rings preserve the even-odd area
+    unsigned int seed = 7;
+    for(int i = 0; i < 500; i++){
+        seed = seed * 1103515245 + 12345;
+        int count = 3 + (seed >> 16) % 8;
+        NSMutableArray<NSNumber *> *coordinates = [[NSMutableArray alloc] init];
+        for(int j = 0; j < count * 2; j++){
+            seed = seed * 1103515245 + 12345;
+            [coordinates addObject:[NSNumber numberWithInt:(seed >> 16) % 10]];
+        }
+        SFLineString *ring = [SFGeometryTestUtils ringWithCoordinates:coordinates];
+        repaired = [SFGeometryRepair makeValidGeometry:[[SFPolygon alloc] initWithRing:ring]];
+        [SFTestUtils assertEqualDoubleWithValue:[self evenOddAreaOfRing:ring] andValue2:[SFGeometryTestUtils areaOfMultiPolygon:repaired] andDelta:0.0000001];
+    }
+    
+}
+
+/**
+ * Brute force even-odd area of a ring, summing the covered lengths at the
+ * center of vertical slabs between all vertices and edge crossings
+ */
+-(double) evenOddAreaOfRing: (SFLineString *) ring{
+    NSArray<SFPoint *> *points = ring.points;
+    int count = (int) points.count - 1;
+    NSMutableArray<NSNumber *> *xs = [[NSMutableArray alloc] init];
+    for(int i = 0; i < count; i++){
+        double ax = [[points objectAtIndex:i].x doubleValue];
+        double ay = [[points objectAtIndex:i].y doubleValue];
+        double bx = [[points objectAtIndex:i + 1].x doubleValue];
+        double by = [[points objectAtIndex:i + 1].y doubleValue];
+        [xs addObject:[NSNumber numberWithDouble:ax]];
+        for(int j = i + 1; j < count; j++){
+            double cx = [[points objectAtIndex:j].x doubleValue];
+            double cy = [[points objectAtIndex:j].y doubleValue];
+            double dx = [[points objectAtIndex:j + 1].x doubleValue];
+            double dy = [[points objectAtIndex:j + 1].y doubleValue];
+            double denominator = (bx - ax) * (dy - cy) - (by - ay) * (dx - cx);
+            if(denominator != 0.0){
+                double s = ((cx - ax) * (dy - cy) - (cy - ay) * (dx - cx)) / denominator;
+                double t = ((cx - ax) * (by - ay) - (cy - ay) * (bx - ax)) / denominator;
+                if(s >= 0.0 && s <= 1.0 && t >= 0.0 && t <= 1.0){
+                    [xs addObject:[NSNumber numberWithDouble:ax + s * (bx - ax)]];
+                }
+            }
+        }
+    }
+    [xs sortUsingSelector:@selector(compare:)];
+    double area = 0.0;
+    for(int k = 0; k < (int) xs.count - 1; k++){
+        double x0 = [[xs objectAtIndex:k] doubleValue];
+        double x1 = [[xs objectAtIndex:k + 1] doubleValue];
+        if(x1 - x0 < 0.000000000001){
+            continue;
+        }
+        double x = (x0 + x1) / 2.0;
+        NSMutableArray<NSNumber *> *ys = [[NSMutableArray alloc] init];
+        for(int i = 0; i < count; i++){
+            double ax = [[points objectAtIndex:i].x doubleValue];
+            double ay = [[points objectAtIndex:i].y doubleValue];
+            double bx = [[points objectAtIndex:i + 1].x doubleValue];
+            double by = [[points objectAtIndex:i + 1].y doubleValue];
+            if((ax < x) != (bx < x)){
+                [ys addObject:[NSNumber numberWithDouble:ay + (x - ax) * (by - ay) / (bx - ax)]];
+            }
+        }
+        [ys sortUsingSelector:@selector(compare:)];
+        for(int i = 0; i < (int) ys.count - 1; i += 2){
+            area += ([[ys objectAtIndex:i + 1] doubleValue] - [[ys objectAtIndex:i] doubleValue]) * (x1 - x0);
+        }
+    }
+    return area;
+}
+
+@end
@@ -0,0 +1,128 @@
+//
+//  GeometryValidatorTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryValidator.h"
+#import "SFMultiPolygon.h"
+
+@interface GeometryValidatorTestCase : XCTestCase
+
+@end
+
+@implementation GeometryValidatorTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test polygon validity errors and locations
+ */
+-(void) testPolygon {
+    
+    SFPolygon *polygon = [self polygonWithRings:@[@[@0, @0, @4, @0, @4, @4, @0, @4], @[@1, @1, @1, @3, @3, @3, @3, @1]]];
+    [SFTestUtils assertTrue:[SFGeometryValidator isValidGeometry:polygon]];
+    [SFTestUtils assertTrue:[SFGeometryValidator validateGeometry:polygon withOrientation:YES] == nil];
+    
+    SFPolygon *reversed = [self polygonWithRings:@[@[@0, @0, @0, @4, @4, @4, @4, @0]]];
+    [SFTestUtils assertTrue:[SFGeometryValidator isValidGeometry:reversed]];
+    [self assertError:[SFGeometryValidator validateGeometry:reversed withOrientation:YES] withType:SF_VET_RING_ORIENTATION andX:0 andY:0];
+    
+    SFPolygon *bowtie = [self polygonWithRings:@[@[@0, @0, @2, @2, @2, @0, @0, @2]]];
+    [self assertError:[SFGeometryValidator validateGeometry:bowtie] withType:SF_VET_SELF_INTERSECTION andX:1 andY:1];
+    
+    SFPolygon *selfTouch = [self polygonWithRings:@[@[@0, @0, @10, @0, @10, @10, @6, @10, @5, @0, @4, @10]]];
+    [self assertError:[SFGeometryValidator validateGeometry:selfTouch] withType:SF_VET_RING_SELF_INTERSECTION andX:5 andY:0];
+    
+    SFPolygon *holeOutside = [self polygonWithRings:@[@[@0, @0, @4, @0, @4, @4, @0, @4], @[@5, @1, @5, @3, @7, @3, @7, @1]]];
+    [self assertError:[SFGeometryValidator validateGeometry:holeOutside] withType:SF_VET_HOLE_OUTSIDE_SHELL andX:5 andY:1];
+    
+    SFPolygon *nestedHoles = [self polygonWithRings:@[@[@0, @0, @10, @0, @10, @10, @0, @10], @[@1, @1, @1, @9, @9, @9, @9, @1], @[@3, @3, @3, @6, @6, @6, @6, @3]]];
+    [self assertError:[SFGeometryValidator validateGeometry:nestedHoles] withType:SF_VET_NESTED_HOLES andX:3 andY:3];
+    
+    SFPolygon *holeTouch = [self polygonWithRings:@[@[@0, @0, @4, @0, @4, @4, @0, @4], @[@0, @2, @2, @3, @2, @1]]];
+    [SFTestUtils assertTrue:[SFGeometryValidator isValidGeometry:holeTouch]];
+    
+    SFPolygon *disconnected = [self polygonWithRings:@[@[@0, @0, @4, @0, @4, @4, @0, @4], @[@0, @2, @2, @3, @4, @2, @2, @1]]];
+    [self assertError:[SFGeometryValidator validateGeometry:disconnected] withType:SF_VET_DISCONNECTED_INTERIOR andX:4 andY:2];
+    
+    SFPolygon *holesCycle = [self polygonWithRings:@[@[@0, @0, @10, @0, @10, @10, @0, @10], @[@0, @5, @3, @7, @5, @5, @3, @3], @[@5, @5, @7, @7, @10, @5, @7, @3]]];
+    [self assertError:[SFGeometryValidator validateGeometry:holesCycle] withType:SF_VET_DISCONNECTED_INTERIOR andX:10 andY:5];
+    
+    SFLineString *open = [[SFLineString alloc] init];
+    [open addPoint:[[SFPoint alloc] initWithXValue:0 andYValue:0]];
+    [open addPoint:[[SFPoint alloc] initWithXValue:1 andYValue:0]];
+    [open addPoint:[[SFPoint alloc] initWithXValue:1 andYValue:1]];
+    [self assertError:[SFGeometryValidator validateGeometry:[[SFPolygon alloc] initWithRing:open]] withType:SF_VET_RING_NOT_CLOSED andX:0 andY:0];
+    
+    SFPolygon *collapsed = [self polygonWithRings:@[@[@0, @0, @1, @1, @1, @1]]];
+    [self assertError:[SFGeometryValidator validateGeometry:collapsed] withType:SF_VET_TOO_FEW_POINTS andX:0 andY:0];
+    
+    SFPolygon *infinite = [self polygonWithRings:@[@[@0, @0, @1, @0, [NSNumber numberWithDouble:INFINITY], @1]]];
+    [SFTestUtils assertEqualIntWithValue:SF_VET_INVALID_COORDINATE andValue2:[SFGeometryValidator validateGeometry:infinite].type];
+    
+}
+
+/**
+ * Test multi polygon member overlap and nesting
+ */
+-(void) testMultiPolygon {
+    
+    SFMultiPolygon *touching = [[SFMultiPolygon alloc] init];
+    [touching addPolygon:[self polygonWithRings:@[@[@0, @0, @2, @0, @2, @2, @0, @2]]]];
+    [touching addPolygon:[self polygonWithRings:@[@[@2, @0, @4, @0, @4, @2, @2, @2, @3, @1]]]];
+    [SFTestUtils assertTrue:[SFGeometryValidator isValidGeometry:touching]];
+    
+    SFMultiPolygon *sharedEdge = [[SFMultiPolygon alloc] init];
+    [sharedEdge addPolygon:[self polygonWithRings:@[@[@0, @0, @1, @0, @1, @1, @0, @1]]]];
+    [sharedEdge addPolygon:[self polygonWithRings:@[@[@1, @0, @2, @0, @2, @1, @1, @1]]]];
+    [self assertError:[SFGeometryValidator validateGeometry:sharedEdge] withType:SF_VET_SELF_INTERSECTION andX:1 andY:0];
+    
+    SFMultiPolygon *nested = [[SFMultiPolygon alloc] init];
+    [nested addPolygon:[self polygonWithRings:@[@[@0, @0, @4, @0, @4, @4, @0, @4]]]];
+    [nested addPolygon:[self polygonWithRings:@[@[@1, @1, @2, @1, @2, @2, @1, @2]]]];
+    [self assertError:[SFGeometryValidator validateGeometry:nested] withType:SF_VET_NESTED_SHELLS andX:1 andY:1];
+    
+    SFMultiPolygon *inHole = [[SFMultiPolygon alloc] init];
+    [inHole addPolygon:[self polygonWithRings:@[@[@0, @0, @10, @0, @10, @10, @0, @10], @[@1, @1, @1, @9, @9, @9, @9, @1]]]];
+    [inHole addPolygon:[self polygonWithRings:@[@[@3, @3, @6, @3, @6, @6, @3, @6]]]];
+    [SFTestUtils assertTrue:[SFGeometryValidator isValidGeometry:inHole]];
+    
+    NSDictionary<NSNumber *, SFValidityError *> *errors = [SFGeometryValidator validateGeometries:@[touching, sharedEdge, nested, inHole]];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:(int)errors.count];
+    [SFTestUtils assertEqualIntWithValue:SF_VET_SELF_INTERSECTION andValue2:[errors objectForKey:[NSNumber numberWithInt:1]].type];
+    [SFTestUtils assertEqualIntWithValue:SF_VET_NESTED_SHELLS andValue2:[errors objectForKey:[NSNumber numberWithInt:2]].type];
+    
+}
+
+-(void) assertError: (SFValidityError *) error withType: (enum SFValidityErrorType) type andX: (double) x andY: (double) y{
+    [SFTestUtils assertTrue:error != nil];
+    [SFTestUtils assertEqualIntWithValue:type andValue2:error.type];
+    [SFTestUtils assertEqualDoubleWithValue:x andValue2:[error.location.x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:y andValue2:[error.location.y doubleValue]];
+}
+
+-(SFPolygon *) polygonWithRings: (NSArray<NSArray<NSNumber *> *> *) rings{
+    SFPolygon *polygon = [[SFPolygon alloc] init];
+    for(NSArray<NSNumber *> *coordinates in rings){
+        SFLineString *ring = [[SFLineString alloc] init];
+        for(int i = 0; i <= coordinates.count; i += 2){
+            int index = i % coordinates.count;
+            [ring addPoint:[[SFPoint alloc] initWithXValue:[[coordinates objectAtIndex:index] doubleValue] andYValue:[[coordinates objectAtIndex:index + 1] doubleValue]]];
+        }
+        [polygon addRing:ring];
+    }
+    return polygon;
+}
+
+@end
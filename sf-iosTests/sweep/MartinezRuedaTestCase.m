@@ -0,0 +1,162 @@
+//
+//  MartinezRuedaTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFMartinezRueda.h"
+
+@interface MartinezRuedaTestCase : XCTestCase
+
+@end
+
+@implementation MartinezRuedaTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test overlay of overlapping squares
+ */
+-(void) testOverlappingSquares {
+    
+    SFPolygon *subject = [SFGeometryTestUtils polygonWithMinX:0 andMinY:0 andMaxX:2 andMaxY:2];
+    SFPolygon *clipping = [SFGeometryTestUtils polygonWithMinX:1 andMinY:1 andMaxX:3 andMaxY:3];
+    
+    SFMultiPolygon *intersection = [SFMartinezRueda intersectionWithGeometry:subject andGeometry:clipping];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:[intersection numPolygons]];
+    [SFTestUtils assertEqualDoubleWithValue:1.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:intersection] andDelta:0.0000001];
+    SFGeometryEnvelope *envelope = [intersection envelope];
+    [SFTestUtils assertEqualDoubleWithValue:1.0 andValue2:[envelope.minX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:1.0 andValue2:[envelope.minY doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:2.0 andValue2:[envelope.maxX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:2.0 andValue2:[envelope.maxY doubleValue]];
+    
+    SFMultiPolygon *unionPolygon = [SFMartinezRueda unionWithGeometry:subject andGeometry:clipping];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:[unionPolygon numPolygons]];
+    [SFTestUtils assertEqualDoubleWithValue:7.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:unionPolygon] andDelta:0.0000001];
+    
+    SFMultiPolygon *difference = [SFMartinezRueda differenceWithGeometry:subject andGeometry:clipping];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:[difference numPolygons]];
+    [SFTestUtils assertEqualDoubleWithValue:3.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:difference] andDelta:0.0000001];
+    
+    SFMultiPolygon *xorPolygon = [SFMartinezRueda xorWithGeometry:subject andGeometry:clipping];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[xorPolygon numPolygons]];
+    [SFTestUtils assertEqualDoubleWithValue:6.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:xorPolygon] andDelta:0.0000001];
+    
+    for(SFPolygon *polygon in [unionPolygon polygons]){
+        [SFTestUtils assertTrue:[SFGeometryTestUtils areaOfRing:[polygon exteriorRing]] > 0.0];
+    }
+    
+}
+
+/**
+ * Test overlay results with holes and disjoint inputs
+ */
+-(void) testHolesAndDisjoint {
+    
+    SFPolygon *subject = [SFGeometryTestUtils polygonWithMinX:0 andMinY:0 andMaxX:4 andMaxY:4];
+    SFPolygon *clipping = [SFGeometryTestUtils polygonWithMinX:1 andMinY:1 andMaxX:3 andMaxY:3];
+    
+    SFMultiPolygon *difference = [SFMartinezRueda differenceWithGeometry:subject andGeometry:clipping];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:[difference numPolygons]];
+    SFPolygon *polygon = [difference polygonAtIndex:0];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[polygon numRings]];
+    [SFTestUtils assertTrue:[SFGeometryTestUtils areaOfRing:[polygon exteriorRing]] > 0.0];
+    [SFTestUtils assertTrue:[SFGeometryTestUtils areaOfRing:[polygon ringAtIndex:1]] < 0.0];
+    [SFTestUtils assertEqualDoubleWithValue:12.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:difference] andDelta:0.0000001];
+    
+    SFMultiPolygon *identical = [SFMartinezRueda intersectionWithGeometry:subject andGeometry:subject];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:[identical numPolygons]];
+    [SFTestUtils assertEqualDoubleWithValue:16.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:identical] andDelta:0.0000001];
+    
+    SFPolygon *disjoint = [SFGeometryTestUtils polygonWithMinX:10 andMinY:10 andMaxX:11 andMaxY:11];
+    [SFTestUtils assertTrue:[[SFMartinezRueda intersectionWithGeometry:subject andGeometry:disjoint] isEmpty]];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[[SFMartinezRueda unionWithGeometry:subject andGeometry:disjoint] numPolygons]];
+    
+    // Clipping multi polygon forming a frame around a hole
+    SFMultiPolygon *frame = [[SFMultiPolygon alloc] init];
+    [frame addPolygon:[SFGeometryTestUtils polygonWithMinX:0 andMinY:0 andMaxX:1 andMaxY:4]];
+    [frame addPolygon:[SFGeometryTestUtils polygonWithMinX:3 andMinY:0 andMaxX:4 andMaxY:4]];
+    SFPolygon *bar = [SFGeometryTestUtils polygonWithMinX:0.5 andMinY:0 andMaxX:3.5 andMaxY:1];
+    SFMultiPolygon *unionPolygon = [SFMartinezRueda unionWithGeometry:bar andGeometry:frame];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:[unionPolygon numPolygons]];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:unionPolygon] andDelta:0.0000001];
+    
+}
+
+/**
+ * Test cascaded union of overlapping and disjoint geometries
+ */
+-(void) testCascadedUnion {
+    
+    NSMutableArray<SFGeometry *> *geometries = [[NSMutableArray alloc] init];
+    for(int x = 0; x < 10; x++){
+        for(int y = 0; y < 10; y++){
+            [geometries addObject:[SFGeometryTestUtils polygonWithMinX:x andMinY:y andMaxX:x + 1.5 andMaxY:y + 1.5]];
+        }
+    }
+    SFMultiPolygon *disjoint = [[SFMultiPolygon alloc] init];
+    [disjoint addPolygon:[SFGeometryTestUtils polygonWithMinX:20 andMinY:20 andMaxX:21 andMaxY:21]];
+    [disjoint addPolygon:[SFGeometryTestUtils polygonWithMinX:30 andMinY:20 andMaxX:32 andMaxY:21]];
+    [geometries addObject:disjoint];
+    
+    SFMultiPolygon *unionPolygon = [SFMartinezRueda unionWithGeometries:geometries];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[unionPolygon numPolygons]];
+    [SFTestUtils assertEqualDoubleWithValue:10.5 * 10.5 + 3.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:unionPolygon] andDelta:0.0000001];
+    
+    [SFTestUtils assertTrue:[[SFMartinezRueda unionWithGeometries:[[NSArray alloc] init]] isEmpty]];
+    
+}
+
+/**
+ * Test result ring orientation of disjoint and degenerate inputs
+ */
+-(void) testOrientation {
+    
+    // Clockwise exterior and counter clockwise hole with disjoint bounds
+    SFPolygon *subject = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@0, @0, @0, @4, @4, @4, @4, @0]]];
+    [subject addRing:[SFGeometryTestUtils ringWithCoordinates:@[@1, @1, @3, @1, @3, @3, @1, @3]]];
+    SFPolygon *clipping = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@10, @10, @10, @11, @11, @11, @11, @10]]];
+    
+    SFMultiPolygon *unionPolygon = [SFMartinezRueda unionWithGeometry:subject andGeometry:clipping];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[unionPolygon numPolygons]];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[[unionPolygon polygonAtIndex:0] numRings]];
+    [SFTestUtils assertEqualDoubleWithValue:12.0 + 1.0 andValue2:[SFGeometryTestUtils areaOfMultiPolygon:unionPolygon] andDelta:0.0000001];
+    [self assertOrientation:unionPolygon];
+    
+    SFMultiPolygon *difference = [SFMartinezRueda differenceWithGeometry:subject andGeometry:clipping];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:[difference numPolygons]];
+    [self assertOrientation:difference];
+    
+    // Touching triangle and quadrilateral leaving a hole without an exterior ring
+    SFPolygon *triangle = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@4.5, @5.5, @4.75, @5.25, @7, @9]]];
+    SFPolygon *quadrilateral = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@3.5555555555555558, @6.4444444444444446, @4.5, @5.5000000000000009, @4.5882352941176467, @5.549019607843138, @3.8857142857142857, @6.4857142857142858]]];
+    [self assertOrientation:[SFMartinezRueda intersectionWithGeometry:triangle andGeometry:quadrilateral]];
+    [self assertOrientation:[SFMartinezRueda unionWithGeometry:triangle andGeometry:quadrilateral]];
+    [self assertOrientation:[SFMartinezRueda differenceWithGeometry:triangle andGeometry:quadrilateral]];
+    [self assertOrientation:[SFMartinezRueda xorWithGeometry:triangle andGeometry:quadrilateral]];
+    
+}
+
+-(void) assertOrientation: (SFMultiPolygon *) multiPolygon{
+    for(SFPolygon *polygon in [multiPolygon polygons]){
+        NSArray<SFLineString *> *rings = polygon.rings;
+        for(int i = 0; i < rings.count; i++){
+            double area = [SFGeometryTestUtils areaOfRing:[rings objectAtIndex:i]];
+            [SFTestUtils assertTrue:i == 0 ? area > 0.0 : area < 0.0];
+        }
+    }
+}
+
+@end
@@ -0,0 +1,136 @@
+//
+//  MVTGeometryTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFMVTGeometryEncoder.h"
+#import "SFMVTGeometryDecoder.h"
+#import "SFPolygon.h"
+#import "SFMultiPoint.h"
+#import "SFMultiPolygon.h"
+
+@interface MVTGeometryTestCase : XCTestCase
+
+@end
+
+@implementation MVTGeometryTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test the specification example geometries, with a tile envelope matching
+ * the tile coordinates flipped in y
+ */
+-(void) testSpecificationExamples {
+    
+    SFGeometryEnvelope *envelope = [[SFGeometryEnvelope alloc] initWithMinXDouble:0.0 andMinYDouble:-4096.0 andMaxXDouble:4096.0 andMaxYDouble:0.0];
+    SFMVTGeometryEncoder *encoder = [[SFMVTGeometryEncoder alloc] initWithEnvelope:envelope];
+    SFMVTGeometryDecoder *decoder = [[SFMVTGeometryDecoder alloc] initWithEnvelope:envelope];
+    
+    SFMultiPoint *multiPoint = [[SFMultiPoint alloc] init];
+    [multiPoint addPoint:[[SFPoint alloc] initWithXValue:5.0 andYValue:-7.0]];
+    [multiPoint addPoint:[[SFPoint alloc] initWithXValue:3.0 andYValue:-2.0]];
+    [SFTestUtils assertEqualIntWithValue:SF_MVT_POINT andValue2:[encoder encodeGeometry:multiPoint]];
+    [self assertCommands:@[@17, @10, @14, @3, @9] withEncoder:encoder];
+    [SFTestUtils assertEqualWithValue:multiPoint andValue2:[decoder decodeData:[encoder commandData] withType:SF_MVT_POINT]];
+    
+    SFLineString *lineString = [[SFLineString alloc] init];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:2.0 andYValue:-2.0]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:2.0 andYValue:-2.2]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:2.0 andYValue:-10.0]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:10.0 andYValue:-10.0]];
+    [SFTestUtils assertEqualIntWithValue:SF_MVT_LINESTRING andValue2:[encoder encodeGeometry:lineString]];
+    [self assertCommands:@[@9, @4, @4, @18, @0, @16, @16, @0] withEncoder:encoder];
+    
+    // Counter clockwise exterior ring in tile coordinates is reversed
+    SFLineString *ring = [[SFLineString alloc] init];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:3.0 andYValue:-6.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:20.0 andYValue:-34.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:8.0 andYValue:-12.0]];
+    [ring addPoint:[[SFPoint alloc] initWithXValue:3.0 andYValue:-6.0]];
+    SFPolygon *polygon = [[SFPolygon alloc] initWithRing:ring];
+    [SFTestUtils assertEqualIntWithValue:SF_MVT_POLYGON andValue2:[encoder encodeGeometry:polygon]];
+    SFPolygon *decoded = (SFPolygon *) [decoder decodeCommands:[encoder commands] withCount:[encoder commandCount] andType:SF_MVT_POLYGON];
+    [SFTestUtils assertEqualIntWithValue:SF_POLYGON andValue2:decoded.geometryType];
+    [SFTestUtils assertEqualIntWithValue:4 andValue2:[[decoded exteriorRing] numPoints]];
+    [SFTestUtils assertEqualDoubleWithValue:8.0 andValue2:[[[decoded exteriorRing] pointAtIndex:0].x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:20.0 andValue2:[[[decoded exteriorRing] pointAtIndex:1].x doubleValue]];
+    
+}
+
+/**
+ * Test quantization to a tile envelope, degenerate removal, and multi
+ * polygon round trips
+ */
+-(void) testQuantization {
+    
+    SFGeometryEnvelope *envelope = [[SFGeometryEnvelope alloc] initWithMinXDouble:1000.0 andMinYDouble:2000.0 andMaxXDouble:1256.0 andMaxYDouble:2256.0];
+    SFMVTGeometryEncoder *encoder = [[SFMVTGeometryEncoder alloc] initWithEnvelope:envelope andExtent:256];
+    SFMVTGeometryDecoder *decoder = [[SFMVTGeometryDecoder alloc] initWithEnvelope:envelope andExtent:256];
+    
+    // Ring collapsing to under 3 distinct tile coordinates
+    SFLineString *sliver = [[SFLineString alloc] init];
+    [sliver addPoint:[[SFPoint alloc] initWithXValue:1010.0 andYValue:2010.0]];
+    [sliver addPoint:[[SFPoint alloc] initWithXValue:1010.2 andYValue:2010.1]];
+    [sliver addPoint:[[SFPoint alloc] initWithXValue:1010.1 andYValue:2010.3]];
+    [sliver addPoint:[[SFPoint alloc] initWithXValue:1010.0 andYValue:2010.0]];
+    [SFTestUtils assertEqualIntWithValue:SF_MVT_UNKNOWN andValue2:[encoder encodeGeometry:[[SFPolygon alloc] initWithRing:sliver]]];
+    [SFTestUtils assertEqualIntWithValue:0 andValue2:[encoder commandCount]];
+    
+    // Square with a clockwise hole, and a second polygon
+    SFMultiPolygon *multiPolygon = [[SFMultiPolygon alloc] init];
+    SFPolygon *polygon = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils squareWithMinX:1010.0 andMinY:2010.0 andSize:100.0 andClockwise:NO]];
+    [polygon addRing:[SFGeometryTestUtils squareWithMinX:1020.0 andMinY:2020.0 andSize:10.0 andClockwise:YES]];
+    [polygon addRing:sliver];
+    [multiPolygon addPolygon:polygon];
+    [multiPolygon addPolygon:[[SFPolygon alloc] initWithRing:[SFGeometryTestUtils squareWithMinX:1200.0 andMinY:2200.0 andSize:20.0 andClockwise:NO]]];
+    [SFTestUtils assertEqualIntWithValue:SF_MVT_POLYGON andValue2:[encoder encodeGeometry:multiPolygon]];
+    
+    SFMultiPolygon *decoded = (SFMultiPolygon *) [decoder decodeData:[encoder commandData] withType:SF_MVT_POLYGON];
+    [SFTestUtils assertEqualIntWithValue:SF_MULTIPOLYGON andValue2:decoded.geometryType];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[decoded numPolygons]];
+    SFPolygon *first = [decoded polygonAtIndex:0];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[first numRings]];
+    [SFTestUtils assertEqualWithValue:[multiPolygon envelope] andValue2:[decoded envelope]];
+    [SFTestUtils assertEqualWithValue:[[polygon interiorRingAtIndex:0] envelope] andValue2:[[first interiorRingAtIndex:0] envelope]];
+    
+    BOOL invalid = NO;
+    @try {
+        uint32_t commands[] = {9, 4, 4, 18, 0};
+        [decoder decodeCommands:commands withCount:5 andType:SF_MVT_LINESTRING];
+    } @catch (NSException *exception) {
+        invalid = YES;
+    }
+    [SFTestUtils assertTrue:invalid];
+    
+}
+
+/**
+ * Assert the encoded commands
+ *
+ * @param expected
+ *            expected commands
+ * @param encoder
+ *            encoder
+ */
+-(void) assertCommands: (NSArray<NSNumber *> *) expected withEncoder: (SFMVTGeometryEncoder *) encoder{
+    [SFTestUtils assertEqualIntWithValue:(int) expected.count andValue2:[encoder commandCount]];
+    const uint32_t *commands = [encoder commands];
+    for(int i = 0; i < expected.count; i++){
+        [SFTestUtils assertEqualIntWithValue:[[expected objectAtIndex:i] intValue] andValue2:commands[i]];
+    }
+}
+
+@end
@@ -0,0 +1,104 @@
+//
+//  TileCoverTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFTileCover.h"
+#import "SFGeometryTransform.h"
+#import "SFPolygon.h"
+#import "SFMultiPoint.h"
+
+@interface TileCoverTestCase : XCTestCase
+
+@end
+
+@implementation TileCoverTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test point and line tile covers
+ */
+-(void) testPointsAndLines {
+    
+    SFPoint *point = [[SFPoint alloc] initWithXValue:-77.0365 andYValue:38.8977];
+    NSData *tiles = [SFTileCover tilesOfGeometry:point atZoom:10];
+    [SFTestUtils assertEqualIntWithValue:2 * sizeof(int) andValue2:(int) tiles.length];
+    const int *values = tiles.bytes;
+    [SFTestUtils assertEqualIntWithValue:292 andValue2:values[0]];
+    [SFTestUtils assertEqualIntWithValue:391 andValue2:values[1]];
+    
+    // Duplicate points share a tile
+    SFMultiPoint *multiPoint = [[SFMultiPoint alloc] init];
+    [multiPoint addPoint:point];
+    [multiPoint addPoint:[[SFPoint alloc] initWithXValue:-77.0366 andYValue:38.8978]];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:(int) [SFTileCover tileCountOfGeometry:multiPoint atZoom:10]];
+    
+    // A world diagonal touches two tiles per row instead of the whole envelope
+    SFLineString *lineString = [[SFLineString alloc] init];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:-180.0 andYValue:SF_WEB_MERCATOR_MAX_LATITUDE]];
+    [lineString addPoint:[[SFPoint alloc] initWithXValue:180.0 andYValue:-SF_WEB_MERCATOR_MAX_LATITUDE]];
+    [SFTestUtils assertEqualIntWithValue:31 andValue2:(int) [SFTileCover tileCountOfGeometry:lineString atZoom:4]];
+    
+    NSData *runs = [SFTileCover tileRunsOfGeometry:lineString atZoom:4];
+    [SFTestUtils assertEqualIntWithValue:16 * 3 * sizeof(int) andValue2:(int) runs.length];
+    values = runs.bytes;
+    for(int i = 0; i < 16; i++){
+        [SFTestUtils assertEqualIntWithValue:i andValue2:values[3 * i]];
+        [SFTestUtils assertEqualIntWithValue:i == 0 ? 0 : i - 1 andValue2:values[3 * i + 1]];
+        [SFTestUtils assertEqualIntWithValue:i andValue2:values[3 * i + 2]];
+    }
+    
+}
+
+/**
+ * Test polygon tile covers with holes
+ */
+-(void) testPolygons {
+    
+    SFPolygon *world = [SFGeometryTestUtils polygonWithCoordinates:@[@-180, @-90, @180, @-90, @180, @90, @-180, @90, @-180, @-90]];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:(int) [SFTileCover tileCountOfGeometry:world atZoom:0]];
+    [SFTestUtils assertEqualIntWithValue:64 andValue2:(int) [SFTileCover tileCountOfGeometry:world atZoom:3]];
+    
+    SFPolygon *polygon = [SFGeometryTestUtils polygonWithCoordinates:@[@-80, @-60, @80, @-60, @80, @60, @-80, @60, @-80, @-60]];
+    [SFTestUtils assertEqualIntWithValue:224 andValue2:(int) [SFTileCover tileCountOfGeometry:polygon atZoom:5]];
+    
+    // Tiles within the hole are not touched
+    [polygon addRing:[[SFGeometryTestUtils polygonWithCoordinates:@[@-40, @-30, @-40, @30, @40, @30, @40, @-30, @-40, @-30]] exteriorRing]];
+    [SFTestUtils assertEqualIntWithValue:200 andValue2:(int) [SFTileCover tileCountOfGeometry:polygon atZoom:5]];
+    
+    NSData *runs = [SFTileCover tileRunsOfGeometry:polygon atZoom:5];
+    [SFTestUtils assertEqualIntWithValue:18 * 3 * sizeof(int) andValue2:(int) runs.length];
+    const int *values = runs.bytes;
+    [SFTestUtils assertEqualIntWithValue:9 andValue2:values[0]];
+    [SFTestUtils assertEqualIntWithValue:8 andValue2:values[1]];
+    [SFTestUtils assertEqualIntWithValue:23 andValue2:values[2]];
+    [SFTestUtils assertEqualIntWithValue:14 andValue2:values[15]];
+    [SFTestUtils assertEqualIntWithValue:8 andValue2:values[16]];
+    [SFTestUtils assertEqualIntWithValue:12 andValue2:values[17]];
+    [SFTestUtils assertEqualIntWithValue:14 andValue2:values[18]];
+    [SFTestUtils assertEqualIntWithValue:19 andValue2:values[19]];
+    [SFTestUtils assertEqualIntWithValue:23 andValue2:values[20]];
+    
+    NSData *tiles = [SFTileCover tilesOfGeometry:polygon atZoom:5];
+    [SFTestUtils assertEqualIntWithValue:200 * 2 * sizeof(int) andValue2:(int) tiles.length];
+    values = tiles.bytes;
+    for(int i = 1; i < 200; i++){
+        [SFTestUtils assertTrue:values[2 * i + 1] > values[2 * i - 1] || (values[2 * i + 1] == values[2 * i - 1] && values[2 * i] > values[2 * i - 2])];
+    }
+    
+}
+
+@end
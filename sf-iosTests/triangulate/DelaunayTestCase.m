@@ -0,0 +1,150 @@
+//
+//  DelaunayTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFDelaunay.h"
+
+@interface DelaunayTestCase : XCTestCase
+
+@end
+
+@implementation DelaunayTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test triangulating a multi point grid with z values
+ */
+-(void) testMultiPoint {
+    
+    SFMultiPoint *multiPoint = [self gridWithSize:10];
+    
+    SFTIN *tin = [SFDelaunay triangulateMultiPoint:multiPoint];
+    [SFTestUtils assertEqualIntWithValue:SF_TIN andValue2:tin.geometryType];
+    [SFTestUtils assertTrue:tin.hasZ];
+    
+    // 2n - h - 2 triangles for n points with h on the convex hull
+    [SFTestUtils assertEqualIntWithValue:2 * 100 - 36 - 2 andValue2:[tin numPolygons]];
+    
+    double area = 0.0;
+    for(SFPolygon *triangle in tin.polygons){
+        [SFTestUtils assertEqualIntWithValue:SF_TRIANGLE andValue2:triangle.geometryType];
+        SFLineString *ring = [triangle exteriorRing];
+        [SFTestUtils assertEqualIntWithValue:4 andValue2:[ring numPoints]];
+        SFPoint *point = [ring pointAtIndex:0];
+        [SFTestUtils assertEqualDoubleWithValue:[point.x doubleValue] + [point.y doubleValue] andValue2:[point.z doubleValue]];
+        double triangleArea = [SFGeometryTestUtils areaOfRing:ring];
+        [SFTestUtils assertTrue:triangleArea > 0.0];
+        area += triangleArea;
+    }
+    [SFTestUtils assertEqualDoubleWithValue:81.0 andValue2:area andDelta:0.0000001];
+    
+    NSData *vertices = [self verticesOfMultiPoint:multiPoint];
+    NSData *indices = [SFDelaunay triangleIndicesOfVertices:vertices.bytes withCount:[multiPoint numPoints]];
+    [SFTestUtils assertEqualIntWithValue:3 * [tin numPolygons] andValue2:(int)(indices.length / sizeof(int))];
+    
+    [SFTestUtils assertEqualIntWithValue:0 andValue2:[[SFDelaunay triangulateMultiPoint:[[SFMultiPoint alloc] init]] numPolygons]];
+    
+}
+
+/**
+ * Test triangulating a multi point grid with a breakline
+ */
+-(void) testBreakline {
+    
+    SFMultiPoint *multiPoint = [self gridWithSize:5];
+    
+    SFLineString *breakline = [[SFLineString alloc] initWithHasZ:YES andHasM:NO];
+    [breakline addPoint:[[SFPoint alloc] initWithXValue:0.0 andYValue:2.0 andZValue:2.0]];
+    [breakline addPoint:[[SFPoint alloc] initWithXValue:4.0 andYValue:3.0 andZValue:7.0]];
+    
+    [SFTestUtils assertTrue:![self tin:[SFDelaunay triangulateMultiPoint:multiPoint] hasEdgeFromPoint:[breakline startPoint] toPoint:[breakline endPoint]]];
+    
+    int failedEdges = -1;
+    SFTIN *tin = [SFDelaunay triangulateMultiPoint:multiPoint withBreaklines:@[breakline] andFailedEdges:&failedEdges];
+    [SFTestUtils assertEqualIntWithValue:0 andValue2:failedEdges];
+    [SFTestUtils assertTrue:[self tin:tin hasEdgeFromPoint:[breakline startPoint] toPoint:[breakline endPoint]]];
+    [SFTestUtils assertEqualIntWithValue:2 * 25 - 16 - 2 andValue2:[tin numPolygons]];
+    
+    double area = 0.0;
+    for(SFPolygon *triangle in tin.polygons){
+        double triangleArea = [SFGeometryTestUtils areaOfRing:[triangle exteriorRing]];
+        [SFTestUtils assertTrue:triangleArea > 0.0];
+        area += triangleArea;
+    }
+    [SFTestUtils assertEqualDoubleWithValue:16.0 andValue2:area andDelta:0.0000001];
+    
+    // Crossing breaklines without a shared vertex, the first is honored
+    SFLineString *crossing = [[SFLineString alloc] initWithHasZ:YES andHasM:NO];
+    [crossing addPoint:[[SFPoint alloc] initWithXValue:1.0 andYValue:0.0 andZValue:1.0]];
+    [crossing addPoint:[[SFPoint alloc] initWithXValue:2.0 andYValue:4.0 andZValue:6.0]];
+    SFLineString *crossed = [[SFLineString alloc] initWithHasZ:YES andHasM:NO];
+    [crossed addPoint:[[SFPoint alloc] initWithXValue:0.0 andYValue:1.0 andZValue:1.0]];
+    [crossed addPoint:[[SFPoint alloc] initWithXValue:4.0 andYValue:2.0 andZValue:6.0]];
+    tin = [SFDelaunay triangulateMultiPoint:multiPoint withBreaklines:@[crossing, crossed] andFailedEdges:&failedEdges];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:failedEdges];
+    [SFTestUtils assertTrue:[self tin:tin hasEdgeFromPoint:[crossing startPoint] toPoint:[crossing endPoint]]];
+    [SFTestUtils assertTrue:![self tin:tin hasEdgeFromPoint:[crossed startPoint] toPoint:[crossed endPoint]]];
+    
+    NSData *vertices = [self verticesOfMultiPoint:multiPoint];
+    int edges[4] = {5, 14, 1, 22};
+    failedEdges = -1;
+    [SFDelaunay triangleIndicesOfVertices:vertices.bytes withCount:[multiPoint numPoints] andEdges:edges andEdgeCount:2 andFailedEdges:&failedEdges];
+    [SFTestUtils assertEqualIntWithValue:1 andValue2:failedEdges];
+    
+}
+
+-(SFMultiPoint *) gridWithSize: (int) size{
+    SFMultiPoint *multiPoint = [[SFMultiPoint alloc] initWithHasZ:YES andHasM:NO];
+    for(int x = 0; x < size; x++){
+        for(int y = 0; y < size; y++){
+            [multiPoint addPoint:[[SFPoint alloc] initWithXValue:x andYValue:y andZValue:x + y]];
+        }
+    }
+    return multiPoint;
+}
+
+-(NSData *) verticesOfMultiPoint: (SFMultiPoint *) multiPoint{
+    NSMutableData *vertices = [[NSMutableData alloc] init];
+    for(SFPoint *point in [multiPoint points]){
+        double coordinates[2] = {[point.x doubleValue], [point.y doubleValue]};
+        [vertices appendBytes:coordinates length:sizeof(coordinates)];
+    }
+    return vertices;
+}
+
+-(BOOL) tin: (SFTIN *) tin hasEdgeFromPoint: (SFPoint *) point1 toPoint: (SFPoint *) point2{
+    for(SFPolygon *triangle in tin.polygons){
+        NSArray<SFPoint *> *points = [triangle exteriorRing].points;
+        for(int i = 0; i < 3; i++){
+            SFPoint *start = [points objectAtIndex:i];
+            SFPoint *end = [points objectAtIndex:i + 1];
+            if([self point:start equalsPoint:point1] && [self point:end equalsPoint:point2]){
+                return YES;
+            }
+            if([self point:start equalsPoint:point2] && [self point:end equalsPoint:point1]){
+                return YES;
+            }
+        }
+    }
+    return NO;
+}
+
+-(BOOL) point: (SFPoint *) point1 equalsPoint: (SFPoint *) point2{
+    return [point1.x doubleValue] == [point2.x doubleValue] && [point1.y doubleValue] == [point2.y doubleValue];
+}
+
+@end
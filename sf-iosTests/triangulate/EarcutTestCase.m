@@ -0,0 +1,94 @@
+//
+//  EarcutTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFEarcut.h"
+#import "SFMultiPolygon.h"
+
+@interface EarcutTestCase : XCTestCase
+
+@end
+
+@implementation EarcutTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test triangulating a polygon with a hole
+ */
+-(void) testPolygonWithHole {
+    
+    SFPolygon *polygon = [[SFPolygon alloc] initWithHasZ:YES andHasM:NO];
+    [polygon addRing:[SFGeometryTestUtils ringWithCoordinates:@[@0, @0, @10, @0, @10, @10, @0, @10] andZValue:7.0]];
+    [polygon addRing:[SFGeometryTestUtils ringWithCoordinates:@[@2, @2, @2, @8, @8, @8, @8, @2] andZValue:7.0]];
+    
+    SFTIN *tin = [SFEarcut triangulatePolygon:polygon];
+    [SFTestUtils assertEqualIntWithValue:SF_TIN andValue2:tin.geometryType];
+    [SFTestUtils assertTrue:tin.hasZ];
+    [SFTestUtils assertEqualIntWithValue:8 andValue2:[tin numPolygons]];
+    
+    double area = 0.0;
+    for(SFPolygon *triangle in tin.polygons){
+        [SFTestUtils assertEqualIntWithValue:SF_TRIANGLE andValue2:triangle.geometryType];
+        SFLineString *ring = [triangle exteriorRing];
+        [SFTestUtils assertEqualIntWithValue:4 andValue2:[ring numPoints]];
+        [SFTestUtils assertEqualDoubleWithValue:7.0 andValue2:[[ring pointAtIndex:0].z doubleValue]];
+        double triangleArea = [SFGeometryTestUtils areaOfRing:ring];
+        [SFTestUtils assertTrue:triangleArea > 0.0];
+        area += triangleArea;
+    }
+    [SFTestUtils assertEqualDoubleWithValue:64.0 andValue2:area andDelta:0.0000001];
+    
+    NSData *indices = [SFEarcut triangleIndicesOfPolygon:polygon];
+    [SFTestUtils assertEqualIntWithValue:24 andValue2:(int)(indices.length / sizeof(int))];
+    NSData *vertices = [SFEarcut verticesOfPolygon:polygon];
+    [SFTestUtils assertEqualIntWithValue:16 andValue2:(int)(vertices.length / sizeof(double))];
+    
+}
+
+/**
+ * Test triangulating a large polygon and a multi polygon
+ */
+-(void) testLargePolygon {
+    
+    NSMutableArray<NSNumber *> *coordinates = [[NSMutableArray alloc] init];
+    int count = 1000;
+    for(int i = 0; i < count; i++){
+        double angle = 2.0 * M_PI * i / count;
+        double radius = 100.0 + 10.0 * sin(angle * 12.0);
+        [coordinates addObject:[NSNumber numberWithDouble:radius * cos(angle)]];
+        [coordinates addObject:[NSNumber numberWithDouble:radius * sin(angle)]];
+    }
+    SFPolygon *polygon = [[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:coordinates andZValue:7.0]];
+    
+    SFTIN *tin = [SFEarcut triangulatePolygon:polygon];
+    [SFTestUtils assertEqualIntWithValue:count - 2 andValue2:[tin numPolygons]];
+    
+    double area = 0.0;
+    for(SFPolygon *triangle in tin.polygons){
+        area += [SFGeometryTestUtils areaOfRing:[triangle exteriorRing]];
+    }
+    [SFTestUtils assertEqualDoubleWithValue:[SFGeometryTestUtils areaOfRing:[polygon exteriorRing]] andValue2:area andDelta:0.000001];
+    
+    SFMultiPolygon *multiPolygon = [[SFMultiPolygon alloc] init];
+    [multiPolygon addPolygon:polygon];
+    [multiPolygon addPolygon:[[SFPolygon alloc] initWithRing:[SFGeometryTestUtils ringWithCoordinates:@[@200, @0, @210, @0, @210, @10, @200, @10] andZValue:7.0]]];
+    SFTIN *multiTin = [SFEarcut triangulateGeometry:multiPolygon];
+    [SFTestUtils assertEqualIntWithValue:count - 2 + 2 andValue2:[multiTin numPolygons]];
+    
+}
+
+@end
@@ -0,0 +1,122 @@
+//
+//  PreparedTINTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFPreparedTIN.h"
+#import "SFDelaunay.h"
+
+@interface PreparedTINTestCase : XCTestCase
+
+@end
+
+@implementation PreparedTINTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test locating triangles and interpolating z and m values
+ */
+-(void) testInterpolate {
+    
+    SFMultiPoint *multiPoint = [[SFMultiPoint alloc] initWithHasZ:YES andHasM:YES];
+    for(int x = 0; x <= 10; x++){
+        for(int y = 0; y <= 10; y++){
+            [multiPoint addPoint:[[SFPoint alloc] initWithXValue:x andYValue:y andZValue:[self zAtX:x andY:y] andMValue:x]];
+        }
+    }
+    SFTIN *tin = [SFDelaunay triangulateMultiPoint:multiPoint];
+    SFPreparedTIN *preparedTin = [[SFPreparedTIN alloc] initWithTIN:tin];
+    [SFTestUtils assertEqualIntWithValue:[tin numPolygons] andValue2:[preparedTin numTriangles]];
+    
+    double z = 0.0;
+    double m = 0.0;
+    [SFTestUtils assertTrue:[preparedTin interpolateAtX:2.5 andY:3.25 withZ:&z andM:&m]];
+    [SFTestUtils assertEqualDoubleWithValue:[self zAtX:2.5 andY:3.25] andValue2:z andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:2.5 andValue2:m andDelta:0.0000001];
+    
+    [SFTestUtils assertEqualDoubleWithValue:[self zAtX:10.0 andY:0.0] andValue2:[[preparedTin zAtX:10.0 andY:0.0] doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:7.75 andValue2:[[preparedTin mAtX:7.75 andY:9.5] doubleValue] andDelta:0.0000001];
+    
+    [SFTestUtils assertTrue:[preparedTin zAtX:10.5 andY:5.0] == nil];
+    [SFTestUtils assertTrue:[preparedTin triangleAtX:-0.1 andY:5.0] == nil];
+    [SFTestUtils assertEqualIntWithValue:-1 andValue2:[preparedTin indexOfTriangleAtX:5.0 andY:11.0]];
+    
+    SFPoint *point = [preparedTin interpolatePoint:[[SFPoint alloc] initWithXValue:4.2 andYValue:6.9]];
+    [SFTestUtils assertTrue:point.hasZ];
+    [SFTestUtils assertTrue:point.hasM];
+    [SFTestUtils assertEqualDoubleWithValue:[self zAtX:4.2 andY:6.9] andValue2:[point.z doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:4.2 andValue2:[point.m doubleValue] andDelta:0.0000001];
+    
+    SFTriangle *triangle = [preparedTin triangleAtPoint:point];
+    [SFTestUtils assertTrue:triangle != nil];
+    SFGeometryEnvelope *envelope = [triangle envelope];
+    [SFTestUtils assertTrue:[envelope.minX doubleValue] <= 4.2 && [envelope.maxX doubleValue] >= 4.2];
+    [SFTestUtils assertTrue:[envelope.minY doubleValue] <= 6.9 && [envelope.maxY doubleValue] >= 6.9];
+    
+    // Interior triangles are adjacent to three triangles sharing their edges
+    int triangleIndex = [preparedTin indexOfTriangleAtX:5.3 andY:5.6];
+    for(int edge = 0; edge < 3; edge++){
+        int adjacent = [preparedTin indexOfTriangleAdjacentToIndex:triangleIndex atEdge:edge];
+        [SFTestUtils assertTrue:adjacent != -1 && adjacent != triangleIndex];
+        BOOL shared = NO;
+        for(int adjacentEdge = 0; adjacentEdge < 3; adjacentEdge++){
+            shared = shared || [preparedTin indexOfTriangleAdjacentToIndex:adjacent atEdge:adjacentEdge] == triangleIndex;
+        }
+        [SFTestUtils assertTrue:shared];
+    }
+    
+}
+
+/**
+ * Test interpolating z values of many locations
+ */
+-(void) testInterpolateBatch {
+    
+    SFMultiPoint *multiPoint = [[SFMultiPoint alloc] initWithHasZ:YES andHasM:NO];
+    for(int i = 0; i < 2000; i++){
+        double x = fmod(i * 0.6180339887, 1.0) * 100.0;
+        double y = fmod(i * 0.7548776662, 1.0) * 100.0;
+        [multiPoint addPoint:[[SFPoint alloc] initWithXValue:x andYValue:y andZValue:[self zAtX:x andY:y]]];
+    }
+    SFPreparedTIN *preparedTin = [[SFPreparedTIN alloc] initWithTIN:[SFDelaunay triangulateMultiPoint:multiPoint]];
+    
+    int count = 10000;
+    double *x = malloc(sizeof(double) * count);
+    double *y = malloc(sizeof(double) * count);
+    double *z = malloc(sizeof(double) * count);
+    for(int i = 0; i < count; i++){
+        x[i] = 50.0 + 40.0 * cos(i * 0.001);
+        y[i] = 50.0 + 40.0 * sin(i * 0.001);
+    }
+    x[0] = -1.0;
+    
+    [preparedTin interpolateZAtX:x andY:y withCount:count intoZ:z];
+    
+    [SFTestUtils assertTrue:isnan(z[0])];
+    for(int i = 1; i < count; i++){
+        [SFTestUtils assertEqualDoubleWithValue:[self zAtX:x[i] andY:y[i]] andValue2:z[i] andDelta:0.0000001];
+    }
+    
+    free(x);
+    free(y);
+    free(z);
+    
+}
+
+-(double) zAtX: (double) x andY: (double) y{
+    return 2.0 * x + 3.0 * y + 1.0;
+}
+
+@end
@@ -0,0 +1,173 @@
+//
+//  TWKBGeometryTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFTWKBGeometryReader.h"
+#import "SFTWKBGeometryWriter.h"
+#import "SFPoint.h"
+#import "SFPolygon.h"
+#import "SFMultiPolygon.h"
+#import "SFGeometryCollection.h"
+
+@interface TWKBGeometryTestCase : XCTestCase
+
+@end
+
+@implementation TWKBGeometryTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test the specification point example
+ */
+-(void) testPoint {
+    
+    SFPoint *point = [[SFPoint alloc] initWithXValue:1.0 andYValue:2.0];
+    NSData *data = [SFTWKBGeometryWriter bytesWithGeometry:point andPrecision:0];
+    const uint8_t expected[] = {0x01, 0x00, 0x02, 0x04};
+    [SFTestUtils assertEqualWithValue:[NSData dataWithBytes:expected length:sizeof(expected)] andValue2:data];
+    [SFTestUtils assertEqualWithValue:point andValue2:[SFTWKBGeometryReader readGeometryWithData:data]];
+    
+    // Precision rounding
+    SFPoint *precise = [[SFPoint alloc] initWithXValue:-77.123456 andYValue:38.98765];
+    SFPoint *rounded = (SFPoint *) [SFTWKBGeometryReader readGeometryWithData:[SFTWKBGeometryWriter bytesWithGeometry:precise andPrecision:3]];
+    [SFTestUtils assertEqualDoubleWithValue:-77.123 andValue2:[rounded.x doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:38.988 andValue2:[rounded.y doubleValue] andDelta:0.0000001];
+    
+    // Empty point
+    SFPoint *empty = [[SFPoint alloc] initWithXValue:NAN andYValue:NAN];
+    SFPoint *readEmpty = (SFPoint *) [SFTWKBGeometryReader readGeometryWithData:[SFTWKBGeometryWriter bytesWithGeometry:empty andPrecision:0]];
+    [SFTestUtils assertTrue:isnan([readEmpty.x doubleValue])];
+    
+    BOOL invalid = NO;
+    @try {
+        [[SFTWKBGeometryWriter alloc] initWithPrecision:8];
+    } @catch (NSException *exception) {
+        invalid = YES;
+    }
+    [SFTestUtils assertTrue:invalid];
+    
+}
+
+/**
+ * Test line strings and polygons with z values, bounding boxes, and sizes
+ */
+-(void) testPolygon {
+    
+    SFLineString *lineString = [[SFLineString alloc] initWithHasZ:YES andHasM:NO];
+    for(int i = 0; i < 300; i++){
+        SFPoint *point = [[SFPoint alloc] initWithHasZ:YES andHasM:NO andXValue:i * 1.5 andYValue:-i * 0.25];
+        [point setZValue:i % 11];
+        [lineString addPoint:point];
+    }
+    SFTWKBGeometryWriter *writer = [[SFTWKBGeometryWriter alloc] initWithPrecision:2];
+    [writer setIncludeBoundingBox:YES];
+    [writer setIncludeSize:YES];
+    NSData *data = [writer writeGeometry:lineString];
+    [SFTestUtils assertEqualWithValue:lineString andValue2:[SFTWKBGeometryReader readGeometryWithData:data]];
+    
+    SFGeometryEnvelope *envelope = [SFTWKBGeometryReader boundingBoxWithData:data];
+    [SFTestUtils assertTrue:envelope.hasZ];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[envelope.minX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:448.5 andValue2:[envelope.maxX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:-74.75 andValue2:[envelope.minY doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[envelope.maxZ doubleValue]];
+    
+    SFPolygon *polygon = [[SFPolygon alloc] init];
+    [polygon addRing:[SFGeometryTestUtils squareWithMinX:0.0 andMinY:0.0 andSize:10.0]];
+    [polygon addRing:[SFGeometryTestUtils squareWithMinX:2.0 andMinY:2.0 andSize:3.0]];
+    data = [SFTWKBGeometryWriter bytesWithGeometry:polygon andPrecision:0];
+    [SFTestUtils assertEqualWithValue:polygon andValue2:[SFTWKBGeometryReader readGeometryWithData:data]];
+    [SFTestUtils assertNil:[SFTWKBGeometryReader boundingBoxWithData:data]];
+    
+    // Sized geometries read back to back from a byte reader
+    SFByteWriter *byteWriter = [[SFByteWriter alloc] init];
+    [writer writeGeometry:polygon toWriter:byteWriter];
+    [writer writeGeometry:lineString toWriter:byteWriter];
+    SFByteReader *byteReader = [[SFByteReader alloc] initWithData:[byteWriter data]];
+    [byteWriter close];
+    [SFTestUtils assertEqualWithValue:polygon andValue2:[SFTWKBGeometryReader readGeometryWithReader:byteReader]];
+    [SFTestUtils assertEqualWithValue:lineString andValue2:[SFTWKBGeometryReader readGeometryWithReader:byteReader]];
+    [SFTestUtils assertEqualIntWithValue:(int) byteReader.bytes.length andValue2:byteReader.nextByte];
+    
+    BOOL invalid = NO;
+    @try {
+        [SFTWKBGeometryReader readGeometryWithData:[data subdataWithRange:NSMakeRange(0, data.length - 1)]];
+    } @catch (NSException *exception) {
+        invalid = YES;
+    }
+    [SFTestUtils assertTrue:invalid];
+    
+}
+
+/**
+ * Test multi polygons with ID lists and geometry collections
+ */
+-(void) testCollection {
+    
+    SFMultiPolygon *multiPolygon = [[SFMultiPolygon alloc] init];
+    for(int i = 0; i < 3; i++){
+        SFPolygon *polygon = [[SFPolygon alloc] init];
+        [polygon addRing:[SFGeometryTestUtils squareWithMinX:20.0 * i andMinY:-5.0 andSize:5.0 + i]];
+        [multiPolygon addPolygon:polygon];
+    }
+    SFTWKBGeometryWriter *writer = [[SFTWKBGeometryWriter alloc] init];
+    NSData *data = [writer writeGeometry:multiPolygon withIds:@[@7, @-3, @1000000]];
+    NSMutableArray<NSNumber *> *ids = [NSMutableArray array];
+    [SFTestUtils assertEqualWithValue:multiPolygon andValue2:[SFTWKBGeometryReader readGeometryWithData:data andIds:ids]];
+    [SFTestUtils assertEqualWithValue:(@[@7, @-3, @1000000]) andValue2:ids];
+    
+    BOOL invalid = NO;
+    @try {
+        [writer writeGeometry:multiPolygon withIds:@[@1]];
+    } @catch (NSException *exception) {
+        invalid = YES;
+    }
+    [SFTestUtils assertTrue:invalid];
+    
+    SFGeometryCollection *collection = [[SFGeometryCollection alloc] init];
+    [collection addGeometry:[[SFPoint alloc] initWithXValue:-1.0 andYValue:1.0]];
+    [collection addGeometry:multiPolygon];
+    [collection addGeometry:[[SFLineString alloc] init]];
+    [writer setIncludeBoundingBox:YES];
+    [writer setIncludeSize:YES];
+    data = [writer writeGeometry:collection];
+    [SFTestUtils assertEqualWithValue:collection andValue2:[SFTWKBGeometryReader readGeometryWithData:data]];
+    SFGeometryEnvelope *envelope = [SFTWKBGeometryReader boundingBoxWithData:data];
+    [SFTestUtils assertEqualDoubleWithValue:-1.0 andValue2:[envelope.minX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:47.0 andValue2:[envelope.maxX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:-5.0 andValue2:[envelope.minY doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:2.0 andValue2:[envelope.maxY doubleValue]];
+    
+    // Collections nested beyond the maximum depth
+    NSMutableData *nested = [NSMutableData data];
+    const uint8_t collectionBytes[] = {0x07, 0x00, 0x01};
+    for(int i = 0; i < 100000; i++){
+        [nested appendBytes:collectionBytes length:sizeof(collectionBytes)];
+    }
+    const uint8_t pointBytes[] = {0x01, 0x00, 0x02, 0x04};
+    [nested appendBytes:pointBytes length:sizeof(pointBytes)];
+    invalid = NO;
+    @try {
+        [SFTWKBGeometryReader readGeometryWithData:nested];
+    } @catch (NSException *exception) {
+        invalid = YES;
+    }
+    [SFTestUtils assertTrue:invalid];
+    
+}
+
+@end
@@ -0,0 +1,294 @@
+//
+//  WKBGeometryReaderTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFWKBGeometryReader.h"
+#import "SFWKBFileReader.h"
+#import "SFByteWriter.h"
+#import "SFPointFiniteFilter.h"
+#import "SFPolygon.h"
+#import "SFGeometryCollection.h"
+
+@interface WKBGeometryReaderTestCase : XCTestCase
+
+@end
+
+@implementation WKBGeometryReaderTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test reading big endian, little endian, ISO, and extended WKB geometries
+ */
+-(void) testReadGeometry {
+    
+    SFByteWriter *writer = [[SFByteWriter alloc] initWithByteOrder:CFByteOrderBigEndian];
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:1001];
+    [SFGeometryTestUtils writeValues:@[@1.5, @-2.5, @10.0] withWriter:writer];
+    SFPoint *point = (SFPoint *) [SFWKBGeometryReader readGeometryWithData:[writer data]];
+    [writer close];
+    [SFTestUtils assertEqualIntWithValue:SF_POINT andValue2:point.geometryType];
+    [SFTestUtils assertTrue:point.hasZ];
+    [SFTestUtils assertTrue:!point.hasM];
+    [SFTestUtils assertEqualDoubleWithValue:1.5 andValue2:[point.x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:-2.5 andValue2:[point.y doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[point.z doubleValue]];
+    
+    // Extended WKB z, m, and SRID flags
+    writer = [[SFByteWriter alloc] initWithByteOrder:CFByteOrderLittleEndian];
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:0xE0000001];
+    [writer writeInt:[NSNumber numberWithInt:4326]];
+    [SFGeometryTestUtils writeValues:@[@1.0, @2.0, @3.0, @4.0] withWriter:writer];
+    point = (SFPoint *) [SFWKBGeometryReader readGeometryWithData:[writer data]];
+    [writer close];
+    [SFTestUtils assertTrue:point.hasZ];
+    [SFTestUtils assertTrue:point.hasM];
+    [SFTestUtils assertEqualDoubleWithValue:3.0 andValue2:[point.z doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:4.0 andValue2:[point.m doubleValue]];
+    
+    // Little endian polygon with a hole
+    writer = [[SFByteWriter alloc] initWithByteOrder:CFByteOrderLittleEndian];
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:SF_POLYGON];
+    [writer writeInt:[NSNumber numberWithInt:2]];
+    [writer writeInt:[NSNumber numberWithInt:4]];
+    [SFGeometryTestUtils writeValues:@[@0.0, @0.0, @4.0, @0.0, @4.0, @4.0, @0.0, @0.0] withWriter:writer];
+    [writer writeInt:[NSNumber numberWithInt:4]];
+    [SFGeometryTestUtils writeValues:@[@1.0, @1.0, @2.0, @1.0, @2.0, @2.0, @1.0, @1.0] withWriter:writer];
+    SFPolygon *polygon = (SFPolygon *) [SFWKBGeometryReader readGeometryWithData:[writer data]];
+    [writer close];
+    [SFTestUtils assertEqualIntWithValue:SF_POLYGON andValue2:polygon.geometryType];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[polygon numRings]];
+    [SFTestUtils assertEqualIntWithValue:4 andValue2:[[polygon interiorRingAtIndex:0] numPoints]];
+    [SFTestUtils assertEqualDoubleWithValue:2.0 andValue2:[[[polygon interiorRingAtIndex:0] pointAtIndex:2].y doubleValue]];
+    
+    // Big endian collection of a little endian point and a big endian line
+    writer = [[SFByteWriter alloc] initWithByteOrder:CFByteOrderBigEndian];
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:SF_GEOMETRYCOLLECTION];
+    [writer writeInt:[NSNumber numberWithInt:2]];
+    [writer setByteOrder:CFByteOrderLittleEndian];
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:SF_POINT];
+    [SFGeometryTestUtils writeValues:@[@5.0, @6.0] withWriter:writer];
+    [writer setByteOrder:CFByteOrderBigEndian];
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:SF_LINESTRING];
+    [writer writeInt:[NSNumber numberWithInt:3]];
+    [SFGeometryTestUtils writeValues:@[@0.0, @0.0, @NAN, @1.0, @2.0, @2.0] withWriter:writer];
+    NSData *data = [writer data];
+    [writer close];
+    
+    SFGeometryCollection *collection = (SFGeometryCollection *) [SFWKBGeometryReader readGeometryWithData:data];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[collection numGeometries]];
+    SFPoint *member = (SFPoint *) [collection geometryAtIndex:0];
+    [SFTestUtils assertEqualDoubleWithValue:6.0 andValue2:[member.y doubleValue]];
+    SFLineString *lineString = (SFLineString *) [collection geometryAtIndex:1];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[lineString numPoints]];
+    
+    // Filtered non finite points
+    collection = (SFGeometryCollection *) [SFWKBGeometryReader readGeometryWithData:data andFilter:[[SFPointFiniteFilter alloc] init]];
+    lineString = (SFLineString *) [collection geometryAtIndex:1];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[lineString numPoints]];
+    
+    // Byte reader advanced past the geometry
+    NSMutableData *padded = [NSMutableData dataWithData:data];
+    [padded appendData:data];
+    SFByteReader *reader = [[SFByteReader alloc] initWithData:padded];
+    [SFWKBGeometryReader readGeometryWithReader:reader];
+    [SFTestUtils assertEqualIntWithValue:(int) data.length andValue2:reader.nextByte];
+    [SFWKBGeometryReader readGeometryWithReader:reader];
+    [SFTestUtils assertEqualIntWithValue:(int) padded.length andValue2:reader.nextByte];
+    
+    // Truncated
+    BOOL invalid = NO;
+    @try {
+        [SFWKBGeometryReader readGeometryWithData:[data subdataWithRange:NSMakeRange(0, data.length - 1)]];
+    } @catch (NSException *exception) {
+        invalid = YES;
+    }
+    [SFTestUtils assertTrue:invalid];
+    
+    // Nested beyond the maximum depth
+    writer = [[SFByteWriter alloc] init];
+    for(int i = 0; i < 100000; i++){
+        [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:SF_GEOMETRYCOLLECTION];
+        [writer writeInt:@1];
+    }
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:SF_POINT];
+    [SFGeometryTestUtils writeValues:@[@1.0, @2.0] withWriter:writer];
+    data = [writer data];
+    [writer close];
+    invalid = NO;
+    @try {
+        [SFWKBGeometryReader readGeometryWithData:data];
+    } @catch (NSException *exception) {
+        invalid = YES;
+    }
+    [SFTestUtils assertTrue:invalid];
+    invalid = NO;
+    @try {
+        [SFWKBGeometryReader envelopeWithData:data];
+    } @catch (NSException *exception) {
+        invalid = YES;
+    }
+    [SFTestUtils assertTrue:invalid];
+    invalid = NO;
+    @try {
+        size_t offset = 0;
+        [SFWKBGeometryReader skipGeometryWithBytes:data.bytes andLength:data.length andOffset:&offset];
+    } @catch (NSException *exception) {
+        invalid = YES;
+    }
+    [SFTestUtils assertTrue:invalid];
+    
+}
+
+/**
+ * Test streaming records from a mapped file
+ */
+-(void) testFileReader {
+    
+    SFByteWriter *writer = [[SFByteWriter alloc] init];
+    for(int i = 0; i < 10; i++){
+        [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:SF_LINESTRING];
+        [writer writeInt:[NSNumber numberWithInt:i + 1]];
+        for(int j = 0; j <= i; j++){
+            [SFGeometryTestUtils writeValues:@[[NSNumber numberWithInt:i], [NSNumber numberWithInt:j]] withWriter:writer];
+        }
+        [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:SF_POINT];
+        [SFGeometryTestUtils writeValues:@[[NSNumber numberWithInt:i], @0.0] withWriter:writer];
+    }
+    NSData *data = [writer data];
+    [writer close];
+    
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSString stringWithFormat:@"%@.wkb", [[NSUUID UUID] UUIDString]]];
+    [data writeToFile:path atomically:YES];
+    
+    SFWKBFileReader *fileReader = [[SFWKBFileReader alloc] initWithPath:path];
+    int count = 0;
+    for(SFGeometry *geometry in fileReader){
+        if(count % 2 == 0){
+            [SFTestUtils assertEqualIntWithValue:SF_LINESTRING andValue2:geometry.geometryType];
+            [SFTestUtils assertEqualIntWithValue:count / 2 + 1 andValue2:[((SFLineString *) geometry) numPoints]];
+        }else{
+            [SFTestUtils assertEqualIntWithValue:SF_POINT andValue2:geometry.geometryType];
+        }
+        count++;
+    }
+    [SFTestUtils assertEqualIntWithValue:20 andValue2:count];
+    [SFTestUtils assertTrue:![fileReader hasNext]];
+    
+    // Skip the line strings
+    fileReader.offset = 0;
+    count = 0;
+    while([fileReader hasNext]){
+        if([fileReader peekGeometryType] == SF_LINESTRING){
+            [SFTestUtils assertEqualIntWithValue:SF_LINESTRING andValue2:[fileReader skip]];
+        }else{
+            SFPoint *point = (SFPoint *) [fileReader nextObject];
+            [SFTestUtils assertEqualDoubleWithValue:count++ andValue2:[point.x doubleValue]];
+        }
+    }
+    [SFTestUtils assertEqualIntWithValue:10 andValue2:count];
+    
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+    
+    // Length prefixed records
+    NSMutableData *prefixed = [NSMutableData data];
+    size_t offset = 0;
+    while(offset < data.length){
+        size_t start = offset;
+        [SFWKBGeometryReader skipGeometryWithBytes:data.bytes andLength:data.length andOffset:&offset];
+        uint32_t length = CFSwapInt32HostToBig((uint32_t) (offset - start));
+        [prefixed appendBytes:&length length:4];
+        [prefixed appendBytes:(const uint8_t *) data.bytes + start length:offset - start];
+    }
+    
+    fileReader = [[SFWKBFileReader alloc] initWithData:prefixed andLengthPrefixed:YES];
+    SFByteReader *record = [fileReader readRecord];
+    [SFTestUtils assertEqualIntWithValue:5 + 4 + 16 andValue2:(int) record.bytes.length];
+    [SFTestUtils assertEqualIntWithValue:SF_POINT andValue2:[fileReader skip]];
+    
+    __block int lineStrings = 0;
+    [fileReader enumerateGeometriesUsingBlock:^(SFGeometry *geometry, BOOL *stop) {
+        if(geometry.geometryType == SF_LINESTRING){
+            lineStrings++;
+        }
+        *stop = lineStrings == 5;
+    }];
+    [SFTestUtils assertEqualIntWithValue:5 andValue2:lineStrings];
+    [SFTestUtils assertEqualIntWithValue:SF_POINT andValue2:[fileReader peekGeometryType]];
+    
+}
+
+/**
+ * Test envelopes read directly from the bytes
+ */
+-(void) testEnvelope {
+    
+    // Little endian multi line string with z and m of a long and a short line
+    SFByteWriter *writer = [[SFByteWriter alloc] initWithByteOrder:CFByteOrderLittleEndian];
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:3005];
+    [writer writeInt:[NSNumber numberWithInt:2]];
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:3002];
+    [writer writeInt:[NSNumber numberWithInt:1000]];
+    for(int i = 0; i < 1000; i++){
+        [SFGeometryTestUtils writeValues:@[[NSNumber numberWithDouble:cos(i * 0.01) * 10.0], [NSNumber numberWithDouble:sin(i * 0.01) * 5.0], [NSNumber numberWithInt:i], [NSNumber numberWithInt:-i]] withWriter:writer];
+    }
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:3002];
+    [writer writeInt:[NSNumber numberWithInt:2]];
+    [SFGeometryTestUtils writeValues:@[@-20.0, @1.0, @2.0, @3.0, @-19.0, @1.0, @2.0, @3.0] withWriter:writer];
+    NSData *data = [writer data];
+    [writer close];
+    
+    SFGeometryEnvelope *expected = [[SFWKBGeometryReader readGeometryWithData:data] envelope];
+    SFGeometryEnvelope *envelope = [SFWKBGeometryReader envelopeWithData:data andZ:YES andM:YES];
+    [SFTestUtils assertEqualDoubleWithValue:-20.0 andValue2:[envelope.minX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:[expected.maxX doubleValue] andValue2:[envelope.maxX doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:[expected.minY doubleValue] andValue2:[envelope.minY doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertEqualDoubleWithValue:[expected.maxY doubleValue] andValue2:[envelope.maxY doubleValue] andDelta:0.0000001];
+    [SFTestUtils assertTrue:envelope.hasZ];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[envelope.minZ doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:999.0 andValue2:[envelope.maxZ doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:-999.0 andValue2:[envelope.minM doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:3.0 andValue2:[envelope.maxM doubleValue]];
+    
+    envelope = [SFWKBGeometryReader envelopeWithData:data];
+    [SFTestUtils assertTrue:!envelope.hasZ];
+    [SFTestUtils assertNil:envelope.minZ];
+    [SFTestUtils assertTrue:!envelope.hasM];
+    
+    // Empty point
+    writer = [[SFByteWriter alloc] init];
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:SF_POINT];
+    [SFGeometryTestUtils writeValues:@[@NAN, @NAN] withWriter:writer];
+    [SFTestUtils assertNil:[SFWKBGeometryReader envelopeWithData:[writer data]]];
+    [writer close];
+    
+    // Bounds of file records
+    NSMutableData *records = [NSMutableData dataWithData:data];
+    [records appendData:data];
+    SFWKBFileReader *fileReader = [[SFWKBFileReader alloc] initWithData:records andLengthPrefixed:NO];
+    double bounds[4];
+    int count = 0;
+    while([fileReader hasNext]){
+        [SFTestUtils assertTrue:[fileReader nextBounds:bounds]];
+        [SFTestUtils assertEqualDoubleWithValue:-20.0 andValue2:bounds[0]];
+        [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:bounds[2]];
+        count++;
+    }
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:count];
+    
+}
+
+@end
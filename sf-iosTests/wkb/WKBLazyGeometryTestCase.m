@@ -0,0 +1,142 @@
+//
+//  WKBLazyGeometryTestCase.m
+//  sf-iosTests
+//
+//  Created by NGA on 10/18/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "SFTestUtils.h"
+#import "SFGeometryTestUtils.h"
+#import "SFWKBGeometryReader.h"
+#import "SFWKBFileReader.h"
+#import "SFWKBLineString.h"
+#import "SFWKBPolygon.h"
+#import "SFWKBMultiPolygon.h"
+#import "SFByteWriter.h"
+
+@interface WKBLazyGeometryTestCase : XCTestCase
+
+@end
+
+@implementation WKBLazyGeometryTestCase
+
+-(void) setUp {
+    [super setUp];
+}
+
+-(void) tearDown {
+    [super tearDown];
+}
+
+/**
+ * Test lazy line strings
+ */
+-(void) testLineString {
+    
+    SFByteWriter *writer = [[SFByteWriter alloc] initWithByteOrder:CFByteOrderLittleEndian];
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:1002];
+    [writer writeInt:[NSNumber numberWithInt:100]];
+    for(int i = 0; i < 100; i++){
+        [SFGeometryTestUtils writeValues:@[[NSNumber numberWithInt:i], [NSNumber numberWithInt:i % 7], [NSNumber numberWithInt:-i]] withWriter:writer];
+    }
+    NSData *data = [writer data];
+    [writer close];
+    
+    SFWKBLineString *lineString = (SFWKBLineString *) [SFWKBGeometryReader lazyGeometryWithData:data];
+    [SFTestUtils assertTrue:[lineString isKindOfClass:[SFWKBLineString class]]];
+    [SFTestUtils assertTrue:lineString.hasZ];
+    [SFTestUtils assertEqualIntWithValue:100 andValue2:[lineString numPoints]];
+    SFPoint *point = [lineString pointAtIndex:42];
+    [SFTestUtils assertEqualDoubleWithValue:42.0 andValue2:[point.x doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[point.y doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:-42.0 andValue2:[point.z doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:99.0 andValue2:[[lineString endPoint].x doubleValue]];
+    SFGeometryEnvelope *envelope = [lineString envelope];
+    [SFTestUtils assertEqualDoubleWithValue:6.0 andValue2:[envelope.maxY doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:-99.0 andValue2:[envelope.minZ doubleValue]];
+    [SFTestUtils assertTrue:![lineString isDecoded]];
+    
+    // Decoded on mutation and equal to the fully read geometry
+    [SFTestUtils assertEqualWithValue:[SFWKBGeometryReader readGeometryWithData:data] andValue2:lineString];
+    [SFTestUtils assertTrue:[lineString isDecoded]];
+    [lineString addPoint:[[SFPoint alloc] initWithHasZ:YES andHasM:NO andXValue:100.0 andYValue:0.0]];
+    [SFTestUtils assertEqualIntWithValue:101 andValue2:[lineString numPoints]];
+    
+    lineString = (SFWKBLineString *) [SFWKBGeometryReader lazyGeometryWithData:data];
+    BOOL outOfRange = NO;
+    @try {
+        [lineString pointAtIndex:100];
+    } @catch (NSException *exception) {
+        outOfRange = YES;
+    }
+    [SFTestUtils assertTrue:outOfRange];
+    
+}
+
+/**
+ * Test lazy multi polygons and polygons
+ */
+-(void) testMultiPolygon {
+    
+    SFByteWriter *writer = [[SFByteWriter alloc] initWithByteOrder:CFByteOrderBigEndian];
+    [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:SF_MULTIPOLYGON];
+    [writer writeInt:[NSNumber numberWithInt:3]];
+    for(int i = 0; i < 3; i++){
+        double x = 10.0 * i;
+        [SFGeometryTestUtils writeHeaderWithWriter:writer andCode:SF_POLYGON];
+        [writer writeInt:[NSNumber numberWithInt:i == 1 ? 2 : 1]];
+        [writer writeInt:[NSNumber numberWithInt:5]];
+        [SFGeometryTestUtils writeValues:@[@(x), @0.0, @(x + 5.0), @0.0, @(x + 5.0), @5.0, @(x), @5.0, @(x), @0.0] withWriter:writer];
+        if(i == 1){
+            [writer writeInt:[NSNumber numberWithInt:4]];
+            [SFGeometryTestUtils writeValues:@[@(x + 1.0), @1.0, @(x + 2.0), @1.0, @(x + 2.0), @2.0, @(x + 1.0), @1.0] withWriter:writer];
+        }
+    }
+    NSData *data = [writer data];
+    [writer close];
+    
+    SFWKBMultiPolygon *multiPolygon = (SFWKBMultiPolygon *) [SFWKBGeometryReader lazyGeometryWithData:data];
+    [SFTestUtils assertTrue:[multiPolygon isKindOfClass:[SFWKBMultiPolygon class]]];
+    [SFTestUtils assertEqualIntWithValue:3 andValue2:[multiPolygon numPolygons]];
+    SFGeometryEnvelope *envelope = [multiPolygon envelope];
+    [SFTestUtils assertEqualDoubleWithValue:0.0 andValue2:[envelope.minX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:25.0 andValue2:[envelope.maxX doubleValue]];
+    [SFTestUtils assertEqualDoubleWithValue:5.0 andValue2:[envelope.maxY doubleValue]];
+    [SFTestUtils assertTrue:![multiPolygon isDecoded]];
+    
+    SFWKBPolygon *polygon = (SFWKBPolygon *) [multiPolygon polygonAtIndex:1];
+    [SFTestUtils assertTrue:[multiPolygon isDecoded]];
+    [SFTestUtils assertTrue:[polygon isKindOfClass:[SFWKBPolygon class]]];
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:[polygon numRings]];
+    [SFTestUtils assertEqualDoubleWithValue:10.0 andValue2:[[polygon envelope].minX doubleValue]];
+    [SFTestUtils assertTrue:![polygon isDecoded]];
+    
+    SFWKBLineString *hole = (SFWKBLineString *) [polygon interiorRingAtIndex:0];
+    [SFTestUtils assertTrue:[hole isKindOfClass:[SFWKBLineString class]]];
+    [SFTestUtils assertEqualIntWithValue:4 andValue2:[hole numPoints]];
+    [SFTestUtils assertEqualDoubleWithValue:12.0 andValue2:[[hole pointAtIndex:1].x doubleValue]];
+    [SFTestUtils assertTrue:![hole isDecoded]];
+    
+    [SFTestUtils assertEqualWithValue:[SFWKBGeometryReader readGeometryWithData:data] andValue2:multiPolygon];
+    
+    // Lazy geometries from length prefixed records
+    NSMutableData *records = [NSMutableData data];
+    for(int i = 0; i < 2; i++){
+        uint32_t length = CFSwapInt32HostToBig((uint32_t) data.length);
+        [records appendBytes:&length length:4];
+        [records appendData:data];
+    }
+    SFWKBFileReader *fileReader = [[SFWKBFileReader alloc] initWithData:records andLengthPrefixed:YES];
+    int count = 0;
+    while([fileReader hasNext]){
+        SFGeometry *geometry = [fileReader nextLazyGeometry];
+        [SFTestUtils assertTrue:[geometry isKindOfClass:[SFWKBMultiPolygon class]]];
+        count++;
+    }
+    [SFTestUtils assertEqualIntWithValue:2 andValue2:count];
+    
+}
+
+@end